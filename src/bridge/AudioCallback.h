@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Bridge
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+ /**
+  * @file AudioCallback.h
+  * @ingroup bridge
+  */
+#if !defined(__AUDIO_CALLBACK_H__)
+#define __AUDIO_CALLBACK_H__
+
+#include "Defines.h"
+#include "common/SPSCRingBuffer.h"
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to exchange audio between the audio device and the bridge audio buffers.
+ *
+ *  This runs on the real-time audio thread; the audio buffers are wait-free, so nothing here may lock,
+ *  allocate or log (overruns and underruns are counted by the buffers).
+ * @param input Buffer captured audio is added to.
+ * @param output Buffer playback audio is taken from.
+ * @param out Audio device playback samples.
+ * @param in Audio device capture samples.
+ * @param frameCount Number of frames (samples) to capture and playback.
+ */
+inline void audioCallback(SPSCRingBuffer<short>& input, SPSCRingBuffer<short>& output, void* out, const void* in, uint32_t frameCount)
+{
+    // capture input audio
+    if (frameCount > 0U) {
+        input.addData((const short*)in, frameCount);
+    }
+
+    // playback output audio (the output buffer is silenced by miniaudio if there isn't enough audio)
+    output.get((short*)out, frameCount);
+}
+
+#endif // __AUDIO_CALLBACK_H__
@@ -20,11 +20,14 @@
 #include "common/p25/lc/LC.h"
 #include "common/p25/P25Utils.h"
 #include "common/network/udp/Socket.h"
+#include "common/network/RTPHeader.h"
+#include "common/network/RTPExtensionHeader.h"
 #include "common/Log.h"
 #include "common/StopWatch.h"
 #include "common/Thread.h"
 #include "common/Utils.h"
 #include "bridge/ActivityLog.h"
+#include "AudioCallback.h"
 #include "HostBridge.h"
 #include "BridgeMain.h"
 #include "SampleTimeConversion.h"
@@ -74,35 +77,8 @@ void audioCallback(ma_device* device, void* output, const void* input, ma_uint32
     if (!bridge->m_running)
         return;
 
-    ma_uint32 pcmBytes = frameCount * ma_get_bytes_per_frame(device->capture.format, device->capture.channels);
-
-    // capture input audio
-    if (frameCount > 0U) {
-        std::lock_guard<std::mutex> lock(HostBridge::m_audioMutex);
-
-        int smpIdx = 0;
-        short samples[MBE_SAMPLES_LENGTH];
-        const uint8_t* pcm = (const uint8_t*)input;
-        for (uint32_t pcmIdx = 0; pcmIdx < pcmBytes; pcmIdx += 2) {
-            samples[smpIdx] = (short)((pcm[pcmIdx + 1] << 8) + pcm[pcmIdx + 0]);
-            smpIdx++;
-        }
-
-        bridge->m_inputAudio.addData(samples, MBE_SAMPLES_LENGTH);
-    }
-
-    // playback output audio
-    if (bridge->m_outputAudio.dataSize() >= MBE_SAMPLES_LENGTH) {
-        short samples[MBE_SAMPLES_LENGTH];
-        bridge->m_outputAudio.get(samples, MBE_SAMPLES_LENGTH);
-        uint8_t* pcm = (uint8_t*)output;
-        int pcmIdx = 0;
-        for (uint32_t smpIdx = 0; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
-            pcm[pcmIdx + 0] = (uint8_t)(samples[smpIdx] & 0xFF);
-            pcm[pcmIdx + 1] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
-            pcmIdx += 2;
-        }
-    }
+    // overruns and underruns are counted by the buffers and reported by the main loop
+    ::audioCallback(bridge->m_inputAudio, bridge->m_outputAudio, output, input, frameCount);
 }
 
 /* Helper callback, called when MDC packets are detected. */
@@ -152,6 +128,20 @@ HostBridge::HostBridge(const std::string& confFile) :
     m_udpSendAddress("127.0.0.1"),
     m_udpReceivePort(32001),
     m_udpReceiveAddress("127.0.0.1"),
+    m_udpSendAddr(),
+    m_udpSendAddrLen(0U),
+    m_udpRTPFrames(false),
+    m_udpAudioCodec(RTPAudioCodecType::PCM16),
+    m_udpFramesPerPacket(1U),
+    m_udpJitterBuffer(nullptr),
+    m_udpTxSamples(nullptr),
+    m_udpTxFrames(0U),
+    m_udpTxSrcId(0U),
+    m_udpTxDstId(0U),
+    m_udpTxSeq(0U),
+    m_udpTxTimestamp(0U),
+    m_udpTxSSRC(0U),
+    m_udpTxMarker(true),
     m_srcId(p25::defines::WUID_FNE),
     m_srcIdOverride(0U),
     m_overrideSrcIdFromMDC(false),
@@ -165,6 +155,8 @@ HostBridge::HostBridge(const std::string& confFile) :
     m_txAudioGain(1.0f),
     m_vocoderEncoderAudioGain(3.0),
     m_txMode(1U),
+    m_crossMode(false),
+    m_rxMode(1U),
     m_voxSampleLevel(30.0f),
     m_dropTimeMS(180U),
     m_dropTime(1000U, 0U, 180U),
@@ -181,8 +173,12 @@ HostBridge::HostBridge(const std::string& confFile) :
     m_maDevice(),
     m_inputAudio(MBE_SAMPLES_LENGTH * NUMBER_OF_BUFFERS, "Input Audio Buffer"),
     m_outputAudio(MBE_SAMPLES_LENGTH * NUMBER_OF_BUFFERS, "Output Audio Buffer"),
+    m_inputOverruns(0U),
+    m_outputOverruns(0U),
+    m_outputUnderruns(0U),
     m_decoder(nullptr),
     m_encoder(nullptr),
+    m_transcoder(nullptr),
     m_mdcDecoder(nullptr),
     m_dmrEmbeddedData(),
     m_rxDMRLC(),
@@ -196,6 +192,7 @@ HostBridge::HostBridge(const std::string& confFile) :
     m_netLDU2(nullptr),
     m_p25SeqNo(0U),
     m_p25N(0U),
+    m_txSamples(nullptr),
     m_audioDetect(false),
     m_trafficFromUDP(false),
     m_udpSrcId(0U),
@@ -239,6 +236,13 @@ HostBridge::HostBridge(const std::string& confFile) :
 
     ::memset(m_netLDU1, 0x00U, 9U * 25U);
     ::memset(m_netLDU2, 0x00U, 9U * 25U);
+
+    // PCM samples are buffered until a whole LDU or DMR voice burst can be encoded at once
+    m_txSamples = new short[MBE_SAMPLES_LENGTH * vocoder::IMBE_CODEWORDS_PER_LDU];
+    ::memset(m_txSamples, 0x00U, MBE_SAMPLES_LENGTH * vocoder::IMBE_CODEWORDS_PER_LDU * sizeof(short));
+
+    m_udpTxSamples = new short[MBE_SAMPLES_LENGTH * UDP_AUDIO_MAX_FRAMES_PER_PACKET];
+    ::memset(m_udpTxSamples, 0x00U, MBE_SAMPLES_LENGTH * UDP_AUDIO_MAX_FRAMES_PER_PACKET * sizeof(short));
 }
 
 /* Finalizes a instance of the HostBridge class. */
@@ -248,6 +252,8 @@ HostBridge::~HostBridge()
     delete[] m_ambeBuffer;
     delete[] m_netLDU1;
     delete[] m_netLDU2;
+    delete[] m_txSamples;
+    delete[] m_udpTxSamples;
 }
 
 /* Executes the main FNE processing loop. */
@@ -317,6 +323,9 @@ int HostBridge::run()
     }
 #endif // !defined(_WIN32)
 
+    // start the asynchronous log writer (this must happen after any forking)
+    ::LogStartAsyncWriter();
+
     ::LogInfo(__BANNER__ "\r\n" __PROG_NAME__ " " __VER__ " (built " __BUILD__ ")\r\n" \
         "Copyright (c) 2017-2024 Bryan Biedenkapp, N2PLL and DVMProject (https://github.com/dvmproject) Authors.\r\n" \
         "Portions Copyright (c) 2015-2021 by Jonathan Naylor, G4KLX and others\r\n" \
@@ -327,7 +336,7 @@ int HostBridge::run()
     if (!ret)
         return EXIT_FAILURE;
 
-    if (!m_localAudio && !m_udpAudio) {
+    if (!m_localAudio && !m_udpAudio && !m_crossMode) {
         ::LogError(LOG_HOST, "Must at least local audio or UDP audio!");
         return EXIT_FAILURE;
     }
@@ -423,6 +432,14 @@ int HostBridge::run()
     m_decoder->setAutoGain(m_vocoderDecoderAutoGain);
     m_encoder->setGainAdjust(m_vocoderEncoderAudioGain);
 
+    // initialize cross-mode transcoder
+    if (m_crossMode) {
+        if (m_txMode == TX_MODE_DMR)
+            m_transcoder = new vocoder::MBETranscoder(vocoder::TRANSCODE_IMBE_TO_DMR_AMBE);
+        else
+            m_transcoder = new vocoder::MBETranscoder(vocoder::TRANSCODE_DMR_AMBE_TO_IMBE);
+    }
+
 #if defined(_WIN32)
     initializeAMBEDLL();
     if (m_useExternalVocoder) {
@@ -504,6 +521,8 @@ int HostBridge::run()
                     ::fatal("failed to reinitialize audio device! panic.");
                 }
             }
+
+            checkAudioBuffers();
         }
 
         // ------------------------------------------------------
@@ -517,7 +536,7 @@ int HostBridge::run()
         }
 
         if (m_udpAudio && m_udpAudioSocket != nullptr)
-            processUDPAudio();
+            processUDPAudio(ms);
 
         if (ms < 2U)
             Thread::sleep(1U);
@@ -535,10 +554,15 @@ int HostBridge::run()
         delete m_udpAudioSocket;
     }
 
+    if (m_udpJitterBuffer != nullptr)
+        delete m_udpJitterBuffer;
+
     if (m_decoder != nullptr)
         delete m_decoder;
     if (m_encoder != nullptr)
         delete m_encoder;
+    if (m_transcoder != nullptr)
+        delete m_transcoder;
 
     delete m_mdcDecoder;
 
@@ -807,6 +831,12 @@ bool HostBridge::readParams()
     if (m_txMode > TX_MODE_P25)
         m_txMode = TX_MODE_P25;
 
+    // cross-mode bridges traffic received in the other digital mode into the transmit mode
+    m_crossMode = systemConf["crossMode"].as<bool>(false);
+    m_rxMode = m_txMode;
+    if (m_crossMode)
+        m_rxMode = (m_txMode == TX_MODE_DMR) ? TX_MODE_P25 : TX_MODE_DMR;
+
     m_voxSampleLevel = systemConf["voxSampleLevel"].as<float>(30.0f);
     m_dropTimeMS = (uint16_t)systemConf["dropTimeMs"].as<uint32_t>(180);
     m_dropTime = Timer(1000U, 0U, m_dropTimeMS);
@@ -826,6 +856,12 @@ bool HostBridge::readParams()
     yaml::Node networkConf = m_conf["network"];
     m_udpAudio = networkConf["udpAudio"].as<bool>(false);
 
+    if (m_crossMode && (m_localAudio || m_udpAudio)) {
+        LogWarning(LOG_HOST, "Cross-mode does not carry audio, disabling local and UDP audio.");
+        m_localAudio = false;
+        m_udpAudio = false;
+    }
+
     LogInfo("General Parameters");
     LogInfo("    Rx Audio Gain: %.1f", m_rxAudioGain);
     LogInfo("    Vocoder Decoder Audio Gain: %.1f", m_vocoderDecoderAudioGain);
@@ -833,6 +869,7 @@ bool HostBridge::readParams()
     LogInfo("    Tx Audio Gain: %.1f", m_txAudioGain);
     LogInfo("    Vocoder Encoder Audio Gain: %.1f", m_vocoderEncoderAudioGain);
     LogInfo("    Transmit Mode: %s", m_txMode == TX_MODE_DMR ? "DMR" : "P25");
+    LogInfo("    Cross-Mode: %s", m_crossMode ? "yes" : "no");
     LogInfo("    VOX Sample Level: %.1f", m_voxSampleLevel);
     LogInfo("    Drop Time: %ums", m_dropTimeMS);
     LogInfo("    Detect Analog MDC1200: %s", m_detectAnalogMDC1200 ? "yes" : "no");
@@ -861,12 +898,27 @@ bool HostBridge::createNetwork()
     bool allowDiagnosticTransfer = networkConf["allowDiagnosticTransfer"].as<bool>(false);
     bool debug = networkConf["debug"].as<bool>(false);
 
-    m_udpAudio = networkConf["udpAudio"].as<bool>(false);
+    m_udpAudio = networkConf["udpAudio"].as<bool>(false) && !m_crossMode;
     m_udpMetadata = networkConf["udpMetadata"].as<bool>(false);
     m_udpSendPort = (uint16_t)networkConf["udpSendPort"].as<uint32_t>(34001);
     m_udpSendAddress = networkConf["udpSendAddress"].as<std::string>();
     m_udpReceivePort = (uint16_t)networkConf["udpReceivePort"].as<uint32_t>(34001);
     m_udpReceiveAddress = networkConf["udpReceiveAddress"].as<std::string>();
+    m_udpRTPFrames = networkConf["udpRTPFrames"].as<bool>(false);
+    std::string udpAudioCodec = networkConf["udpAudioCodec"].as<std::string>("pcm16");
+    if (!RTPAudioCodec::fromName(udpAudioCodec, m_udpAudioCodec)) {
+        LogWarning(LOG_HOST, "Invalid UDP audio codec, %s, using pcm16.", udpAudioCodec.c_str());
+        m_udpAudioCodec = RTPAudioCodecType::PCM16;
+    }
+    m_udpFramesPerPacket = networkConf["udpFramesPerPacket"].as<uint32_t>(1U);
+    if (m_udpFramesPerPacket < 1U)
+        m_udpFramesPerPacket = 1U;
+    if (m_udpFramesPerPacket > UDP_AUDIO_MAX_FRAMES_PER_PACKET)
+        m_udpFramesPerPacket = UDP_AUDIO_MAX_FRAMES_PER_PACKET;
+    uint32_t udpJitterMinDelay = networkConf["udpJitterMinDelay"].as<uint32_t>(RTP_JITTER_DEFAULT_MIN_DELAY);
+    uint32_t udpJitterMaxDelay = networkConf["udpJitterMaxDelay"].as<uint32_t>(RTP_JITTER_DEFAULT_MAX_DELAY);
+    if (udpJitterMaxDelay < udpJitterMinDelay)
+        udpJitterMaxDelay = udpJitterMinDelay;
 
     m_srcId = (uint32_t)networkConf["sourceId"].as<uint32_t>(p25::defines::WUID_FNE);
     m_overrideSrcIdFromMDC = networkConf["overrideSourceIdFromMDC"].as<bool>(false);
@@ -929,6 +981,12 @@ bool HostBridge::createNetwork()
         LogInfo("    UDP Audio Send Port: %u", m_udpSendPort);
         LogInfo("    UDP Audio Receive Address: %s", m_udpReceiveAddress.c_str());
         LogInfo("    UDP Audio Receive Port: %u", m_udpReceivePort);
+        LogInfo("    UDP Audio RTP Frames: %s", m_udpRTPFrames ? "yes" : "no");
+        if (m_udpRTPFrames) {
+            LogInfo("    UDP Audio Codec: %s", RTPAudioCodec::toName(m_udpAudioCodec).c_str());
+            LogInfo("    UDP Audio Frames Per Packet: %u (%ums)", m_udpFramesPerPacket, m_udpFramesPerPacket * 20U);
+            LogInfo("    UDP Audio Jitter Buffer Delay: %ums - %ums", udpJitterMinDelay * 20U, udpJitterMaxDelay * 20U);
+        }
     }
 
     LogInfo("    Source ID: %u", m_srcId);
@@ -951,6 +1009,11 @@ bool HostBridge::createNetwork()
         break;
     }
 
+    if (m_crossMode) {
+        dmr = true;
+        p25 = true;
+    }
+
     // initialize networking
     m_network = new PeerNetwork(address, port, local, id, password, true, debug, dmr, p25, false, true, true, true, allowDiagnosticTransfer, true, false);
 
@@ -975,6 +1038,22 @@ bool HostBridge::createNetwork()
     if (m_udpAudio) {
         m_udpAudioSocket = new Socket(m_udpReceiveAddress, m_udpReceivePort);
         m_udpAudioSocket->open();
+
+        // resolve the send address once, rather than for every packet
+        if (udp::Socket::lookup(m_udpSendAddress, m_udpSendPort, m_udpSendAddr, m_udpSendAddrLen) != 0) {
+            LogWarning(LOG_HOST, "failed to resolve UDP audio send address, %s", m_udpSendAddress.c_str());
+            m_udpSendAddrLen = 0U;
+        }
+
+        if (m_udpRTPFrames) {
+            m_udpJitterBuffer = new RTPJitterBuffer(MBE_SAMPLES_LENGTH, udpJitterMinDelay, udpJitterMaxDelay);
+
+            std::random_device rd;
+            std::mt19937 mt(rd());
+            m_udpTxSSRC = mt();
+            m_udpTxSeq = (uint16_t)(mt() & 0xFFFFU);
+            m_udpTxTimestamp = mt();
+        }
     }
 
     return true;
@@ -982,103 +1061,285 @@ bool HostBridge::createNetwork()
 
 /* Helper to process UDP audio. */
 
-void HostBridge::processUDPAudio()
+void HostBridge::processUDPAudio(uint32_t ms)
 {
     if (!m_udpAudio)
         return;
     if (m_udpAudioSocket == nullptr)
         return;
 
+    if (m_udpJitterBuffer != nullptr)
+        m_udpJitterBuffer->clock(ms);
+
     sockaddr_storage addr;
     uint32_t addrLen;
 
-    // read message from socket
+    // read all pending messages from socket
     uint8_t buffer[DATA_PACKET_LENGTH];
-    ::memset(buffer, 0x00U, DATA_PACKET_LENGTH);
-    int length = m_udpAudioSocket->read(buffer, DATA_PACKET_LENGTH, addr, addrLen);
-    if (length < 0) {
-        return;
-    }
+    while (true) {
+        int length = m_udpAudioSocket->read(buffer, DATA_PACKET_LENGTH, addr, addrLen);
+        if (length <= 0) {
+            break;
+        }
 
-    if (length > 0) {
         if (m_debug)
             Utils::dump(1U, "UDP Audio Network Packet", buffer, length);
 
-        uint32_t pcmLength = __GET_UINT32(buffer, 0U);
-
-        UInt8Array __pcm = std::make_unique<uint8_t[]>(pcmLength);
-        uint8_t* pcm = __pcm.get();
-
-        ::memcpy(pcm, buffer + 4U, pcmLength);
+        if (m_udpRTPFrames) {
+            decodeRTPAudio(buffer, (uint32_t)length);
+            continue;
+        }
 
-        // Utils::dump(1U, "PCM RECV BYTE BUFFER", pcm, pcmLength);
+        uint32_t pcmLength = __GET_UINT32(buffer, 0U);
+        if (pcmLength != (MBE_SAMPLES_LENGTH * 2U) || (uint32_t)length < pcmLength + 4U) {
+            LogWarning(LOG_HOST, "%s, invalid PCM audio packet, pcmLength = %u, length = %d", UDP_CALL, pcmLength, length);
+            continue;
+        }
 
         m_udpSrcId = m_srcId;
         if (m_udpMetadata) {
-            if (m_overrideSrcIdFromUDP)
+            if (m_overrideSrcIdFromUDP && (uint32_t)length >= pcmLength + 12U)
                 m_udpSrcId = __GET_UINT32(buffer, pcmLength + 8U);
         }
 
         m_udpDstId = m_dstId;
 
-        std::lock_guard<std::mutex> lock(m_audioMutex);
+        short samples[MBE_SAMPLES_LENGTH];
+        for (uint32_t smpIdx = 0; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
+            samples[smpIdx] = (short)((buffer[4U + (smpIdx * 2U) + 1U] << 8) + buffer[4U + (smpIdx * 2U)]);
+        }
 
-        int smpIdx = 0;
+        processUDPAudioFrame(samples);
+    }
+
+    // play out RTP framed audio at the frame rate, regardless of how it arrived
+    if (m_udpJitterBuffer != nullptr) {
         short samples[MBE_SAMPLES_LENGTH];
-        for (uint32_t pcmIdx = 0; pcmIdx < pcmLength; pcmIdx += 2) {
-            samples[smpIdx] = (short)((pcm[pcmIdx + 1] << 8) + pcm[pcmIdx + 0]);
-            smpIdx++;
-        }
-
-        m_inputAudio.addData(samples, MBE_SAMPLES_LENGTH);
-
-        m_trafficFromUDP = true;
-
-        // force start a call if one isn't already in progress
-        if (!m_audioDetect && !m_callInProgress) {
-            m_audioDetect = true;
-            if (m_txStreamId == 0U) {
-                m_txStreamId = 1U; // prevent further false starts -- this isn't the right way to handle this...
-                LogMessage(LOG_HOST, "%s, call start, srcId = %u, dstId = %u", UDP_CALL, m_udpSrcId, m_udpDstId);
-                if (m_grantDemand) {
-                    switch (m_txMode) {
-                    case TX_MODE_P25:
-                    {
-                        p25::lc::LC lc = p25::lc::LC();
-                        lc.setLCO(p25::defines::LCO::GROUP);
-                        lc.setDstId(m_udpDstId);
-                        lc.setSrcId(m_udpSrcId);
-
-                        p25::data::LowSpeedData lsd = p25::data::LowSpeedData();
-
-                        uint8_t controlByte = 0x80U;
-                        m_network->writeP25TDU(lc, lsd, controlByte);
-                    }
-                    break;
-                    }
+        while (m_udpJitterBuffer->read(samples))
+            processUDPAudioFrame(samples);
+    }
+}
+
+/* Helper to process a frame of received UDP audio. */
+
+void HostBridge::processUDPAudioFrame(const short* samples)
+{
+    assert(samples != nullptr);
+
+    // the encoders take little-endian PCM bytes
+    uint8_t pcm[MBE_SAMPLES_LENGTH * 2U];
+    for (uint32_t smpIdx = 0; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
+        pcm[(smpIdx * 2U) + 0U] = (uint8_t)(samples[smpIdx] & 0xFF);
+        pcm[(smpIdx * 2U) + 1U] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
+    }
+
+    std::lock_guard<std::mutex> lock(m_audioMutex);
+
+    m_trafficFromUDP = true;
+
+    // force start a call if one isn't already in progress
+    if (!m_audioDetect && !m_callInProgress) {
+        m_audioDetect = true;
+        if (m_txStreamId == 0U) {
+            m_txStreamId = 1U; // prevent further false starts -- this isn't the right way to handle this...
+            LogMessage(LOG_HOST, "%s, call start, srcId = %u, dstId = %u", UDP_CALL, m_udpSrcId, m_udpDstId);
+            if (m_grantDemand) {
+                switch (m_txMode) {
+                case TX_MODE_P25:
+                {
+                    p25::lc::LC lc = p25::lc::LC();
+                    lc.setLCO(p25::defines::LCO::GROUP);
+                    lc.setDstId(m_udpDstId);
+                    lc.setSrcId(m_udpSrcId);
+
+                    p25::data::LowSpeedData lsd = p25::data::LowSpeedData();
+
+                    uint8_t controlByte = 0x80U;
+                    m_network->writeP25TDU(lc, lsd, controlByte);
+                }
+                break;
                 }
             }
+        }
+
+        m_dropTime.stop();
 
-            m_dropTime.stop();
+        if (!m_dropTime.isRunning())
+            m_dropTime.start();
+    }
 
-            if (!m_dropTime.isRunning())
-                m_dropTime.start();
+    // If audio detection is active and no call is in progress, encode and transmit the audio
+    if (m_audioDetect && !m_callInProgress) {
+        m_dropTime.start();
+
+        switch (m_txMode) {
+        case TX_MODE_DMR:
+            encodeDMRAudioFrame(pcm, m_udpSrcId);
+            break;
+        case TX_MODE_P25:
+            encodeP25AudioFrame(pcm, m_udpSrcId);
+            break;
         }
+    }
+}
 
-        // If audio detection is active and no call is in progress, encode and transmit the audio
-        if (m_audioDetect && !m_callInProgress) {
-            m_dropTime.start();
+/* Helper to decode a RTP framed UDP audio packet into the jitter buffer. */
 
-            switch (m_txMode) {
-            case TX_MODE_DMR:
-                encodeDMRAudioFrame(pcm, m_udpSrcId);
-                break;
-            case TX_MODE_P25:
-                encodeP25AudioFrame(pcm, m_udpSrcId);
-                break;
-            }
+void HostBridge::decodeRTPAudio(const uint8_t* buffer, uint32_t length)
+{
+    assert(buffer != nullptr);
+
+    if (length < RTP_HEADER_LENGTH_BYTES)
+        return;
+
+    frame::RTPHeader header = frame::RTPHeader();
+    if (!header.decode(buffer)) {
+        LogWarning(LOG_HOST, "%s, invalid RTP audio packet, length = %u", UDP_CALL, length);
+        return;
+    }
+
+    RTPAudioCodecType::E codec;
+    if (!RTPAudioCodec::fromPayloadType(header.getPayloadType(), codec)) {
+        LogWarning(LOG_HOST, "%s, unsupported RTP audio payload type, payloadType = $%02X", UDP_CALL, header.getPayloadType());
+        return;
+    }
+
+    uint32_t offset = RTP_HEADER_LENGTH_BYTES + (header.getCSRCCount() * 4U);
+
+    m_udpSrcId = m_srcId;
+    m_udpDstId = m_dstId;
+    if (header.getExtension()) {
+        if (length < offset + RTP_EXTENSION_HEADER_LENGTH_BYTES)
+            return;
+
+        frame::RTPExtensionHeader extHeader = frame::RTPExtensionHeader();
+        extHeader.decode(buffer + offset);
+        offset += RTP_EXTENSION_HEADER_LENGTH_BYTES;
+
+        uint32_t extLength = extHeader.getPayloadLength() * 4U;
+        if (length < offset + extLength)
+            return;
+
+        // metadata carries the destination and source IDs
+        if (extHeader.getPayloadType() == UDP_AUDIO_RTP_METADATA_PROFILE && extLength >= 8U) {
+            if (m_udpMetadata && m_overrideSrcIdFromUDP)
+                m_udpSrcId = __GET_UINT32(buffer, offset + 4U);
         }
+
+        offset += extLength;
     }
+
+    if (length <= offset)
+        return;
+
+    uint32_t payloadLength = length - offset;
+    if (header.getPadding()) {
+        uint8_t padding = buffer[length - 1U];
+        if (padding >= payloadLength)
+            return;
+        payloadLength -= padding;
+    }
+
+    short samples[MBE_SAMPLES_LENGTH * UDP_AUDIO_MAX_FRAMES_PER_PACKET];
+    uint32_t maxLength = MBE_SAMPLES_LENGTH * UDP_AUDIO_MAX_FRAMES_PER_PACKET * RTPAudioCodec::bytesPerSample(codec);
+    if (payloadLength > maxLength)
+        payloadLength = maxLength;
+
+    uint32_t count = RTPAudioCodec::decode(codec, buffer + offset, payloadLength, samples);
+    m_udpJitterBuffer->write(header.getSSRC(), header.getTimestamp(), samples, count);
+}
+
+/* Helper to write a frame of decoded audio to the UDP audio destination. */
+
+void HostBridge::writeUDPAudio(const short* samples, uint32_t srcId, uint32_t dstId)
+{
+    assert(samples != nullptr);
+
+    if (m_udpAudioSocket == nullptr)
+        return;
+
+    if (m_udpSendAddrLen == 0U) {
+        if (udp::Socket::lookup(m_udpSendAddress, m_udpSendPort, m_udpSendAddr, m_udpSendAddrLen) != 0) {
+            m_udpSendAddrLen = 0U;
+            return;
+        }
+    }
+
+    if (!m_udpRTPFrames) {
+        uint8_t audioData[(MBE_SAMPLES_LENGTH * 2U) + 12U]; // PCM + (4 bytes (PCM length) + 4 bytes (srcId) + 4 bytes (dstId))
+        __SET_UINT32((MBE_SAMPLES_LENGTH * 2U), audioData, 0U);
+        for (uint32_t smpIdx = 0; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
+            audioData[4U + (smpIdx * 2U) + 0U] = (uint8_t)(samples[smpIdx] & 0xFF);
+            audioData[4U + (smpIdx * 2U) + 1U] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
+        }
+
+        uint32_t length = (MBE_SAMPLES_LENGTH * 2U) + 4U;
+        if (m_udpMetadata) {
+            // embed destination and source IDs
+            __SET_UINT32(dstId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 4U));
+            __SET_UINT32(srcId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 8U));
+            length += 8U;
+        }
+
+        m_udpAudioSocket->write(audioData, length, m_udpSendAddr, m_udpSendAddrLen);
+        return;
+    }
+
+    // a change of source or destination starts a new talkspurt
+    if (m_udpTxFrames > 0U && (srcId != m_udpTxSrcId || dstId != m_udpTxDstId))
+        flushUDPAudio(true);
+
+    ::memcpy(m_udpTxSamples + (m_udpTxFrames * MBE_SAMPLES_LENGTH), samples, MBE_SAMPLES_LENGTH * sizeof(short));
+    m_udpTxSrcId = srcId;
+    m_udpTxDstId = dstId;
+    m_udpTxFrames++;
+
+    if (m_udpTxFrames >= m_udpFramesPerPacket)
+        flushUDPAudio();
+}
+
+/* Helper to send the pending RTP framed UDP audio frames. */
+
+void HostBridge::flushUDPAudio(bool callEnd)
+{
+    if (m_udpTxFrames > 0U && m_udpAudioSocket != nullptr && m_udpSendAddrLen > 0U) {
+        uint8_t buffer[RTP_HEADER_LENGTH_BYTES + RTP_EXTENSION_HEADER_LENGTH_BYTES + 8U + (MBE_SAMPLES_LENGTH * 2U * UDP_AUDIO_MAX_FRAMES_PER_PACKET)];
+
+        frame::RTPHeader header = frame::RTPHeader();
+        header.setExtension(m_udpMetadata);
+        header.setMarker(m_udpTxMarker);
+        header.setPayloadType(RTPAudioCodec::toPayloadType(m_udpAudioCodec));
+        header.setSequence(m_udpTxSeq++);
+        header.setTimestamp(m_udpTxTimestamp);
+        header.setSSRC(m_udpTxSSRC);
+        header.encode(buffer);
+
+        uint32_t length = RTP_HEADER_LENGTH_BYTES;
+        if (m_udpMetadata) {
+            // embed destination and source IDs
+            frame::RTPExtensionHeader extHeader = frame::RTPExtensionHeader();
+            extHeader.setPayloadType(UDP_AUDIO_RTP_METADATA_PROFILE);
+            extHeader.setPayloadLength(2U);
+            extHeader.encode(buffer + length);
+            length += RTP_EXTENSION_HEADER_LENGTH_BYTES;
+
+            __SET_UINT32(m_udpTxDstId, buffer, length);
+            __SET_UINT32(m_udpTxSrcId, buffer, length + 4U);
+            length += 8U;
+        }
+
+        uint32_t sampleCount = m_udpTxFrames * MBE_SAMPLES_LENGTH;
+        length += RTPAudioCodec::encode(m_udpAudioCodec, m_udpTxSamples, sampleCount, buffer + length);
+
+        m_udpAudioSocket->write(buffer, length, m_udpSendAddr, m_udpSendAddrLen);
+
+        m_udpTxTimestamp += sampleCount;
+        m_udpTxMarker = false;
+    }
+
+    m_udpTxFrames = 0U;
+    if (callEnd)
+        m_udpTxMarker = true;
 }
 
 /* Helper to process DMR network traffic. */
@@ -1089,7 +1350,7 @@ void HostBridge::processDMRNetwork(uint8_t* buffer, uint32_t length)
     using namespace dmr;
     using namespace dmr::defines;
 
-    if (m_txMode != TX_MODE_DMR)
+    if (m_rxMode != TX_MODE_DMR)
         return;
 
     // process network message header
@@ -1167,7 +1428,9 @@ void HostBridge::processDMRNetwork(uint8_t* buffer, uint32_t length)
             m_rxStartTime = now;
 
             LogMessage(LOG_HOST, "DMR, call start, srcId = %u, dstId = %u, slot = %u", srcId, dstId, slotNo);
-            if (m_preambleLeaderTone)
+            if (m_crossMode)
+                crossModeCallStart();
+            else if (m_preambleLeaderTone)
                 generatePreambleTone();
 
             // if we can, use the LC from the voice header as to keep all options intact
@@ -1209,6 +1472,11 @@ void HostBridge::processDMRNetwork(uint8_t* buffer, uint32_t length)
 
                 LogMessage(LOG_HOST, "DMR, call end, srcId = %u, dstId = %u, dur = %us", srcId, dstId, diff / 1000U);
             }
+
+            if (m_udpAudio && m_udpRTPFrames)
+                flushUDPAudio(true);
+            if (m_crossMode)
+                crossModeCallEnd(srcId, dstId);
             
             m_rxDMRLC = lc::LC();
             m_rxDMRPILC = lc::PrivacyLC();
@@ -1260,86 +1528,65 @@ void HostBridge::decodeDMRAudioFrame(uint8_t* ambe, uint32_t srcId, uint32_t dst
     using namespace dmr;
     using namespace dmr::defines;
 
-    for (uint32_t n = 0; n < AMBE_PER_SLOT; n++) {
-        uint8_t ambePartial[RAW_AMBE_LENGTH_BYTES];
-        for (uint32_t i = 0; i < RAW_AMBE_LENGTH_BYTES; i++)
-            ambePartial[i] = ambe[i + (n * 9)];
+    if (m_crossMode) {
+        // transcode straight to IMBE, rather than decoding to PCM and encoding again
+        for (uint32_t n = 0; n < AMBE_PER_SLOT; n++) {
+            uint8_t imbe[p25::defines::RAW_IMBE_LENGTH_BYTES];
+            int errs = m_transcoder->transcode(ambe + (n * RAW_AMBE_LENGTH_BYTES), imbe);
+            if (m_debug)
+                LogMessage(LOG_HOST, DMR_DT_VOICE ", Frame, VC%u.%u, srcId = %u, dstId = %u, errs = %u (transcoded)", dmrN, n, srcId, dstId, errs);
 
-        short samples[MBE_SAMPLES_LENGTH];
-        int errs = 0;
-#if defined(_WIN32)
-        if (m_useExternalVocoder) {
-            ambeDecode(ambePartial, RAW_AMBE_LENGTH_BYTES, samples);
+            writeP25IMBE(imbe, srcId, dstId);
         }
-        else {
+
+        return;
+    }
+
+    // decode the burst's AMBE codewords into contiguous PCM samples
+    const uint32_t sampleCnt = MBE_SAMPLES_LENGTH * AMBE_PER_SLOT;
+    short samples[sampleCnt];
+    int errs = 0;
+#if defined(_WIN32)
+    if (m_useExternalVocoder) {
+        for (uint32_t n = 0; n < AMBE_PER_SLOT; n++)
+            ambeDecode(ambe + (n * RAW_AMBE_LENGTH_BYTES), RAW_AMBE_LENGTH_BYTES, samples + (n * MBE_SAMPLES_LENGTH));
+    }
+    else {
 #endif // defined(_WIN32)
-            m_decoder->decode(ambePartial, samples);
+        errs = m_decoder->decodeBurst(ambe, samples);
 #if defined(_WIN32)
-        }
+    }
 #endif // defined(_WIN32)
 
-        if (m_debug)
-            LogMessage(LOG_HOST, DMR_DT_VOICE ", Frame, VC%u.%u, srcId = %u, dstId = %u, errs = %u", dmrN, n, srcId, dstId, errs);
-
-        // post-process: apply gain to decoded audio frames
-        if (m_rxAudioGain != 1.0f) {
-            for (int n = 0; n < MBE_SAMPLES_LENGTH; n++) {
-                short sample = samples[n];
-                float newSample = sample * m_rxAudioGain;
-                sample = (short)newSample;
-
-                // clip if necessary
-                if (m_rxAudioGain > 1.0f) {
-                    if (newSample > 32767)
-                        sample = 32767;
-                    else if (newSample < -32767)
-                        sample = -32767;
-                }
-
-                samples[n] = sample;
-            }
-        }
+    if (m_debug)
+        LogMessage(LOG_HOST, DMR_DT_VOICE ", Frame, VC%u, srcId = %u, dstId = %u, errs = %u", dmrN, srcId, dstId, errs);
 
-        if (m_localAudio) {
-            m_outputAudio.addData(samples, MBE_SAMPLES_LENGTH);
-        }
-
-        if (m_udpAudio) {
-            int pcmIdx = 0;
-            uint8_t pcm[MBE_SAMPLES_LENGTH * 2U];
-            for (uint32_t smpIdx = 0; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
-                pcm[pcmIdx + 0] = (uint8_t)(samples[smpIdx] & 0xFF);
-                pcm[pcmIdx + 1] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
-                pcmIdx += 2;
-            }
+    // post-process: apply gain to decoded audio frames
+    if (m_rxAudioGain != 1.0f) {
+        for (uint32_t n = 0; n < sampleCnt; n++) {
+            short sample = samples[n];
+            float newSample = sample * m_rxAudioGain;
+            sample = (short)newSample;
 
-            uint32_t length = (MBE_SAMPLES_LENGTH * 2U) + 4U;
-            uint8_t* audioData = nullptr;
-            if (!m_udpMetadata) {
-                audioData = new uint8_t[(MBE_SAMPLES_LENGTH * 2U) + 4U]; // PCM + 4 bytes (PCM length)
-                __SET_UINT32((MBE_SAMPLES_LENGTH * 2U), audioData, 0U);
-                ::memcpy(audioData + 4U, pcm, MBE_SAMPLES_LENGTH * 2U);
-            }
-            else {
-                length = (MBE_SAMPLES_LENGTH * 2U) + 12U;
-                audioData = new uint8_t[(MBE_SAMPLES_LENGTH * 2U) + 12U]; // PCM + (4 bytes (PCM length) + 4 bytes (srcId) + 4 bytes (dstId))
-                __SET_UINT32((MBE_SAMPLES_LENGTH * 2U), audioData, 0U);
-                ::memcpy(audioData + 4U, pcm, MBE_SAMPLES_LENGTH * 2U);
-
-                // embed destination and source IDs
-                __SET_UINT32(dstId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 4U));
-                __SET_UINT32(srcId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 8U));
+            // clip if necessary
+            if (m_rxAudioGain > 1.0f) {
+                if (newSample > 32767)
+                    sample = 32767;
+                else if (newSample < -32767)
+                    sample = -32767;
             }
 
-            sockaddr_storage addr;
-            uint32_t addrLen;
+            samples[n] = sample;
+        }
+    }
 
-            if (udp::Socket::lookup(m_udpSendAddress, m_udpSendPort, addr, addrLen) == 0) {
-                m_udpAudioSocket->write(audioData, length, addr, addrLen);
-            }
+    if (m_localAudio) {
+        m_outputAudio.addData(samples, sampleCnt);
+    }
 
-            delete[] audioData;
-        }
+    if (m_udpAudio) {
+        for (uint32_t n = 0; n < AMBE_PER_SLOT; n++)
+            writeUDPAudio(samples + (n * MBE_SAMPLES_LENGTH), srcId, dstId);
     }
 }
 
@@ -1362,79 +1609,91 @@ void HostBridge::encodeDMRAudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
     if (forcedDstId > 0 && forcedDstId != m_dstId)
         dstId = forcedDstId;
 
-    uint8_t* data = nullptr;
-    m_dmrN = (uint8_t)(m_dmrSeqNo % 6);
-    if (m_ambeCount == AMBE_PER_SLOT) {
-        // is this the intitial sequence?
-        if (m_dmrSeqNo == 0) {
-            // send DMR voice header
-            data = new uint8_t[DMR_FRAME_LENGTH_BYTES];
-
-            // generate DMR LC
-            lc::LC dmrLC = lc::LC();
-            dmrLC.setFLCO(FLCO::GROUP);
-            dmrLC.setSrcId(srcId);
-            dmrLC.setDstId(dstId);
-            m_dmrEmbeddedData.setLC(dmrLC);
-
-            // generate the Slot TYpe
-            SlotType slotType = SlotType();
-            slotType.setDataType(DataType::VOICE_LC_HEADER);
-            slotType.encode(data);
+    if (m_ambeCount == AMBE_PER_SLOT)
+        writeDMRVoiceBurst(srcId, dstId);
 
-            lc::FullLC fullLC = lc::FullLC();
-            fullLC.encode(dmrLC, data, DataType::VOICE_LC_HEADER);
-
-            // generate DMR network frame
-            data::NetData dmrData;
-            dmrData.setSlotNo(m_slot);
-            dmrData.setDataType(DataType::VOICE_LC_HEADER);
-            dmrData.setSrcId(srcId);
-            dmrData.setDstId(dstId);
-            dmrData.setFLCO(FLCO::GROUP);
-            dmrData.setN(m_dmrN);
-            dmrData.setSeqNo(m_dmrSeqNo);
-            dmrData.setBER(0U);
-            dmrData.setRSSI(0U);
+    int smpIdx = 0;
+    short samples[MBE_SAMPLES_LENGTH];
+    for (uint32_t pcmIdx = 0; pcmIdx < (MBE_SAMPLES_LENGTH * 2U); pcmIdx += 2) {
+        samples[smpIdx] = (short)((pcm[pcmIdx + 1] << 8) + pcm[pcmIdx + 0]);
+        smpIdx++;
+    }
 
-            dmrData.setData(data);
+    // pre-process: apply gain to PCM audio frames
+    if (m_txAudioGain != 1.0f) {
+        for (int n = 0; n < MBE_SAMPLES_LENGTH; n++) {
+            short sample = samples[n];
+            float newSample = sample * m_txAudioGain;
+            sample = (short)newSample;
 
-            m_network->writeDMR(dmrData, false);
-            m_txStreamId = m_network->getDMRStreamId(m_slot);
+            // clip if necessary
+            if (m_txAudioGain > 1.0f) {
+                if (newSample > 32767)
+                    sample = 32767;
+                else if (newSample < -32767)
+                    sample = -32767;
+            }
 
-            m_dmrSeqNo++;
-            delete[] data;
+            samples[n] = sample;
         }
+    }
 
-        // send DMR voice
-        data = new uint8_t[DMR_FRAME_LENGTH_BYTES];
+    ::memcpy(m_txSamples + (m_ambeCount * MBE_SAMPLES_LENGTH), samples, MBE_SAMPLES_LENGTH * sizeof(short));
+    m_ambeCount++;
+    if (m_ambeCount < AMBE_PER_SLOT)
+        return;
 
-        ::memcpy(data, m_ambeBuffer, 13U);
-        data[13U] = (uint8_t)(m_ambeBuffer[13U] & 0xF0);
-        data[19U] = (uint8_t)(m_ambeBuffer[13U] & 0x0F);
-        ::memcpy(data + 20U, m_ambeBuffer + 14U, 13U);
+    // encode the buffered PCM samples into the burst's AMBE codewords
+    ::memset(m_ambeBuffer, 0x00U, 27U);
+#if defined(_WIN32)
+    if (m_useExternalVocoder) {
+        for (uint32_t n = 0; n < AMBE_PER_SLOT; n++)
+            ambeEncode(m_txSamples + (n * MBE_SAMPLES_LENGTH), MBE_SAMPLES_LENGTH, m_ambeBuffer + (n * RAW_AMBE_LENGTH_BYTES));
+    }
+    else {
+#endif // defined(_WIN32)
+        m_encoder->encodeBurst(m_txSamples, m_ambeBuffer);
+#if defined(_WIN32)
+    }
+#endif // defined(_WIN32)
 
-        DataType::E dataType = DataType::VOICE_SYNC;
-        if (m_dmrN == 0)
-            dataType = DataType::VOICE_SYNC;
-        else {
-            dataType = DataType::VOICE;
+    // Utils::dump(1U, "Encoded AMBE", m_ambeBuffer, 27U);
+}
 
-            uint8_t lcss = m_dmrEmbeddedData.getData(data, m_dmrN);
+/* Helper to write the buffered AMBE codewords as a DMR voice burst. */
 
-            // generated embedded signalling
-            data::EMB emb = data::EMB();
-            emb.setColorCode(0U);
-            emb.setLCSS(lcss);
-            emb.encode(data);
-        }
+void HostBridge::writeDMRVoiceBurst(uint32_t srcId, uint32_t dstId)
+{
+    using namespace dmr;
+    using namespace dmr::defines;
+
+    uint8_t* data = nullptr;
+    m_dmrN = (uint8_t)(m_dmrSeqNo % 6);
+
+    // is this the intitial sequence?
+    if (m_dmrSeqNo == 0) {
+        // send DMR voice header
+        data = new uint8_t[DMR_FRAME_LENGTH_BYTES];
+
+        // generate DMR LC
+        lc::LC dmrLC = lc::LC();
+        dmrLC.setFLCO(FLCO::GROUP);
+        dmrLC.setSrcId(srcId);
+        dmrLC.setDstId(dstId);
+        m_dmrEmbeddedData.setLC(dmrLC);
 
-        LogMessage(LOG_HOST, DMR_DT_VOICE ", srcId = %u, dstId = %u, slot = %u, seqNo = %u", srcId, dstId, m_slot, m_dmrN);
+        // generate the Slot TYpe
+        SlotType slotType = SlotType();
+        slotType.setDataType(DataType::VOICE_LC_HEADER);
+        slotType.encode(data);
+
+        lc::FullLC fullLC = lc::FullLC();
+        fullLC.encode(dmrLC, data, DataType::VOICE_LC_HEADER);
 
         // generate DMR network frame
         data::NetData dmrData;
         dmrData.setSlotNo(m_slot);
-        dmrData.setDataType(dataType);
+        dmrData.setDataType(DataType::VOICE_LC_HEADER);
         dmrData.setSrcId(srcId);
         dmrData.setDstId(dstId);
         dmrData.setFLCO(FLCO::GROUP);
@@ -1449,54 +1708,56 @@ void HostBridge::encodeDMRAudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
         m_txStreamId = m_network->getDMRStreamId(m_slot);
 
         m_dmrSeqNo++;
-        ::memset(m_ambeBuffer, 0x00U, 27U);
-        m_ambeCount = 0U;
+        delete[] data;
     }
 
-    int smpIdx = 0;
-    short samples[MBE_SAMPLES_LENGTH];
-    for (uint32_t pcmIdx = 0; pcmIdx < (MBE_SAMPLES_LENGTH * 2U); pcmIdx += 2) {
-        samples[smpIdx] = (short)((pcm[pcmIdx + 1] << 8) + pcm[pcmIdx + 0]);
-        smpIdx++;
-    }
+    // send DMR voice
+    data = new uint8_t[DMR_FRAME_LENGTH_BYTES];
 
-    // pre-process: apply gain to PCM audio frames
-    if (m_txAudioGain != 1.0f) {
-        for (int n = 0; n < MBE_SAMPLES_LENGTH; n++) {
-            short sample = samples[n];
-            float newSample = sample * m_txAudioGain;
-            sample = (short)newSample;
+    ::memcpy(data, m_ambeBuffer, 13U);
+    data[13U] = (uint8_t)(m_ambeBuffer[13U] & 0xF0);
+    data[19U] = (uint8_t)(m_ambeBuffer[13U] & 0x0F);
+    ::memcpy(data + 20U, m_ambeBuffer + 14U, 13U);
 
-            // clip if necessary
-            if (m_txAudioGain > 1.0f) {
-                if (newSample > 32767)
-                    sample = 32767;
-                else if (newSample < -32767)
-                    sample = -32767;
-            }
+    DataType::E dataType = DataType::VOICE_SYNC;
+    if (m_dmrN == 0)
+        dataType = DataType::VOICE_SYNC;
+    else {
+        dataType = DataType::VOICE;
 
-            samples[n] = sample;
-        }
-    }
+        uint8_t lcss = m_dmrEmbeddedData.getData(data, m_dmrN);
 
-    // encode PCM samples into AMBE codewords
-    uint8_t ambe[RAW_AMBE_LENGTH_BYTES];
-    ::memset(ambe, 0x00U, RAW_AMBE_LENGTH_BYTES);
-#if defined(_WIN32)
-    if (m_useExternalVocoder) {
-        ambeEncode(samples, MBE_SAMPLES_LENGTH, ambe);
+        // generated embedded signalling
+        data::EMB emb = data::EMB();
+        emb.setColorCode(0U);
+        emb.setLCSS(lcss);
+        emb.encode(data);
     }
-    else {
-#endif // defined(_WIN32)
-        m_encoder->encode(samples, ambe);
-#if defined(_WIN32)
-    }
-#endif // defined(_WIN32)
 
-    // Utils::dump(1U, "Encoded AMBE", ambe, RAW_AMBE_LENGTH_BYTES);
+    LogMessage(LOG_HOST, DMR_DT_VOICE ", srcId = %u, dstId = %u, slot = %u, seqNo = %u", srcId, dstId, m_slot, m_dmrN);
 
-    ::memcpy(m_ambeBuffer + (m_ambeCount * 9U), ambe, RAW_AMBE_LENGTH_BYTES);
-    m_ambeCount++;
+    // generate DMR network frame
+    data::NetData dmrData;
+    dmrData.setSlotNo(m_slot);
+    dmrData.setDataType(dataType);
+    dmrData.setSrcId(srcId);
+    dmrData.setDstId(dstId);
+    dmrData.setFLCO(FLCO::GROUP);
+    dmrData.setN(m_dmrN);
+    dmrData.setSeqNo(m_dmrSeqNo);
+    dmrData.setBER(0U);
+    dmrData.setRSSI(0U);
+
+    dmrData.setData(data);
+
+    m_network->writeDMR(dmrData, false);
+    m_txStreamId = m_network->getDMRStreamId(m_slot);
+
+    m_dmrSeqNo++;
+    delete[] data;
+
+    ::memset(m_ambeBuffer, 0x00U, 27U);
+    m_ambeCount = 0U;
 }
 
 /* Helper to process P25 network traffic. */
@@ -1508,7 +1769,7 @@ void HostBridge::processP25Network(uint8_t* buffer, uint32_t length)
     using namespace p25::defines;
     using namespace p25::dfsi::defines;
 
-    if (m_txMode != TX_MODE_P25)
+    if (m_rxMode != TX_MODE_P25)
         return;
 
     bool grantDemand = (buffer[14U] & 0x80U) == 0x80U;
@@ -1595,7 +1856,9 @@ void HostBridge::processP25Network(uint8_t* buffer, uint32_t length)
             m_rxStartTime = now;
 
             LogMessage(LOG_HOST, "P25, call start, srcId = %u, dstId = %u", srcId, dstId);
-            if (m_preambleLeaderTone)
+            if (m_crossMode)
+                crossModeCallStart();
+            else if (m_preambleLeaderTone)
                 generatePreambleTone();
         }
 
@@ -1611,6 +1874,11 @@ void HostBridge::processP25Network(uint8_t* buffer, uint32_t length)
                 LogMessage(LOG_HOST, "P25, call end, srcId = %u, dstId = %u, dur = %us", srcId, dstId, diff / 1000U);
             }
 
+            if (m_udpAudio && m_udpRTPFrames)
+                flushUDPAudio(true);
+            if (m_crossMode)
+                crossModeCallEnd(srcId, dstId);
+
             m_rxP25LC = lc::LC();
             m_rxStartTime = 0U;
             m_rxStreamId = 0U;
@@ -1777,116 +2045,66 @@ void HostBridge::decodeP25AudioFrame(uint8_t* ldu, uint32_t srcId, uint32_t dstI
     using namespace p25;
     using namespace p25::defines;
 
-    // decode 9 IMBE codewords into PCM samples
-    for (int n = 0; n < 9; n++) {
-        uint8_t imbe[RAW_IMBE_LENGTH_BYTES];
-        switch (n) {
-        case 0:
-            ::memcpy(imbe, ldu + 10U, RAW_IMBE_LENGTH_BYTES);
-            break;
-        case 1:
-            ::memcpy(imbe, ldu + 26U, RAW_IMBE_LENGTH_BYTES);
-            break;
-        case 2:
-            ::memcpy(imbe, ldu + 55U, RAW_IMBE_LENGTH_BYTES);
-            break;
-        case 3:
-            ::memcpy(imbe, ldu + 80U, RAW_IMBE_LENGTH_BYTES);
-            break;
-        case 4:
-            ::memcpy(imbe, ldu + 105U, RAW_IMBE_LENGTH_BYTES);
-            break;
-        case 5:
-            ::memcpy(imbe, ldu + 130U, RAW_IMBE_LENGTH_BYTES);
-            break;
-        case 6:
-            ::memcpy(imbe, ldu + 155U, RAW_IMBE_LENGTH_BYTES);
-            break;
-        case 7:
-            ::memcpy(imbe, ldu + 180U, RAW_IMBE_LENGTH_BYTES);
-            break;
-        case 8:
-            ::memcpy(imbe, ldu + 204U, RAW_IMBE_LENGTH_BYTES);
-            break;
+    if (m_crossMode) {
+        // transcode straight to AMBE, rather than decoding to PCM and encoding again
+        for (uint32_t n = 0; n < vocoder::IMBE_CODEWORDS_PER_LDU; n++) {
+            int errs = m_transcoder->transcode(ldu + vocoder::IMBE_LDU_OFFSETS[n], m_ambeBuffer + (m_ambeCount * 9U));
+            if (m_debug)
+                LogDebug(LOG_HOST, "P25, LDU (Logical Link Data Unit), Frame, VC%u.%u, srcId = %u, dstId = %u, errs = %u (transcoded)", p25N, n, srcId, dstId, errs);
+
+            m_ambeCount++;
+            if (m_ambeCount == dmr::defines::AMBE_PER_SLOT)
+                writeDMRVoiceBurst(srcId, dstId);
         }
 
-        // Utils::dump(1U, "IMBE", imbe, RAW_IMBE_LENGTH_BYTES);
+        return;
+    }
 
-        short samples[MBE_SAMPLES_LENGTH];
-        int errs = 0;
+    // decode 9 IMBE codewords into contiguous PCM samples
+    const uint32_t sampleCnt = MBE_SAMPLES_LENGTH * vocoder::IMBE_CODEWORDS_PER_LDU;
+    short samples[sampleCnt];
+    int errs = 0;
 #if defined(_WIN32)
-        if (m_useExternalVocoder) {
-            ambeDecode(imbe, RAW_IMBE_LENGTH_BYTES, samples);
-        }
-        else {
+    if (m_useExternalVocoder) {
+        for (uint32_t n = 0; n < vocoder::IMBE_CODEWORDS_PER_LDU; n++)
+            ambeDecode(ldu + vocoder::IMBE_LDU_OFFSETS[n], RAW_IMBE_LENGTH_BYTES, samples + (n * MBE_SAMPLES_LENGTH));
+    }
+    else {
 #endif // defined(_WIN32)
-            m_decoder->decode(imbe, samples);
+        errs = m_decoder->decodeLDU(ldu, samples);
 #if defined(_WIN32)
-        }
+    }
 #endif // defined(_WIN32)
 
-        if (m_debug)
-            LogDebug(LOG_HOST, "P25, LDU (Logical Link Data Unit), Frame, VC%u.%u, srcId = %u, dstId = %u, errs = %u", p25N, n, srcId, dstId, errs);
-
-        // post-process: apply gain to decoded audio frames
-        if (m_rxAudioGain != 1.0f) {
-            for (int n = 0; n < MBE_SAMPLES_LENGTH; n++) {
-                short sample = samples[n];
-                float newSample = sample * m_rxAudioGain;
-                sample = (short)newSample;
-
-                // clip if necessary
-                if (m_rxAudioGain > 1.0f) {
-                    if (newSample > 32767)
-                        sample = 32767;
-                    else if (newSample < -32767)
-                        sample = -32767;
-                }
-
-                samples[n] = sample;
-            }
-        }
-
-        if (m_localAudio) {
-            m_outputAudio.addData(samples, MBE_SAMPLES_LENGTH);
-        }
+    if (m_debug)
+        LogDebug(LOG_HOST, "P25, LDU (Logical Link Data Unit), Frame, VC%u, srcId = %u, dstId = %u, errs = %u", p25N, srcId, dstId, errs);
 
-        if (m_udpAudio) {
-            int pcmIdx = 0;
-            uint8_t pcm[MBE_SAMPLES_LENGTH * 2U];
-            for (uint32_t smpIdx = 0; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
-                pcm[pcmIdx + 0] = (uint8_t)(samples[smpIdx] & 0xFF);
-                pcm[pcmIdx + 1] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
-                pcmIdx += 2;
-            }
+    // post-process: apply gain to decoded audio frames
+    if (m_rxAudioGain != 1.0f) {
+        for (uint32_t n = 0; n < sampleCnt; n++) {
+            short sample = samples[n];
+            float newSample = sample * m_rxAudioGain;
+            sample = (short)newSample;
 
-            uint32_t length = (MBE_SAMPLES_LENGTH * 2U) + 4U;
-            uint8_t* audioData = nullptr;
-            if (!m_udpMetadata) {
-                audioData = new uint8_t[(MBE_SAMPLES_LENGTH * 2U) + 4U]; // PCM + 4 bytes (PCM length)
-                __SET_UINT32((MBE_SAMPLES_LENGTH * 2U), audioData, 0U);
-                ::memcpy(audioData + 4U, pcm, MBE_SAMPLES_LENGTH * 2U);
-            }
-            else {
-                length = (MBE_SAMPLES_LENGTH * 2U) + 12U;
-                audioData = new uint8_t[(MBE_SAMPLES_LENGTH * 2U) + 12U]; // PCM + (4 bytes (PCM length) + 4 bytes (srcId) + 4 bytes (dstId))
-                __SET_UINT32((MBE_SAMPLES_LENGTH * 2U), audioData, 0U);
-                ::memcpy(audioData + 4U, pcm, MBE_SAMPLES_LENGTH * 2U);
-
-                // embed destination and source IDs
-                __SET_UINT32(dstId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 4U));
-                __SET_UINT32(srcId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 8U));
+            // clip if necessary
+            if (m_rxAudioGain > 1.0f) {
+                if (newSample > 32767)
+                    sample = 32767;
+                else if (newSample < -32767)
+                    sample = -32767;
             }
 
-            sockaddr_storage addr;
-            uint32_t addrLen;
+            samples[n] = sample;
+        }
+    }
 
-            if (udp::Socket::lookup(m_udpSendAddress, m_udpSendPort, addr, addrLen) == 0) {
-                m_udpAudioSocket->write(audioData, length, addr, addrLen);
-            }
+    if (m_localAudio) {
+        m_outputAudio.addData(samples, sampleCnt);
+    }
 
-            delete[] audioData;
-        }
+    if (m_udpAudio) {
+        for (uint32_t n = 0; n < vocoder::IMBE_CODEWORDS_PER_LDU; n++)
+            writeUDPAudio(samples + (n * MBE_SAMPLES_LENGTH), srcId, dstId);
     }
 }
 
@@ -1898,13 +2116,6 @@ void HostBridge::encodeP25AudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
     using namespace p25;
     using namespace p25::defines;
 
-    if (m_p25N > 17)
-        m_p25N = 0;
-    if (m_p25N == 0)
-        ::memset(m_netLDU1, 0x00U, 9U * 25U);
-    if (m_p25N == 9)
-        ::memset(m_netLDU2, 0x00U, 9U * 25U);
-
     int smpIdx = 0;
     short samples[MBE_SAMPLES_LENGTH];
     for (uint32_t pcmIdx = 0; pcmIdx < (MBE_SAMPLES_LENGTH * 2U); pcmIdx += 2) {
@@ -1931,81 +2142,27 @@ void HostBridge::encodeP25AudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
         }
     }
 
-    // encode PCM samples into IMBE codewords
-    uint8_t imbe[RAW_IMBE_LENGTH_BYTES];
-    ::memset(imbe, 0x00U, RAW_IMBE_LENGTH_BYTES);
+    if (m_p25N > 17)
+        m_p25N = 0;
+
+    uint32_t frame = m_p25N % vocoder::IMBE_CODEWORDS_PER_LDU;
+    ::memcpy(m_txSamples + (frame * MBE_SAMPLES_LENGTH), samples, MBE_SAMPLES_LENGTH * sizeof(short));
+
+    // encode the buffered PCM samples into the LDU's IMBE codewords
+    if (frame == vocoder::IMBE_CODEWORDS_PER_LDU - 1U) {
+        uint8_t* ldu = (m_p25N < 9U) ? m_netLDU1 : m_netLDU2;
+        ::memset(ldu, 0x00U, 9U * 25U);
 #if defined(_WIN32)
-    if (m_useExternalVocoder) {
-        ambeEncode(samples, MBE_SAMPLES_LENGTH, imbe);
-    }
-    else {
+        if (m_useExternalVocoder) {
+            for (uint32_t n = 0; n < vocoder::IMBE_CODEWORDS_PER_LDU; n++)
+                ambeEncode(m_txSamples + (n * MBE_SAMPLES_LENGTH), MBE_SAMPLES_LENGTH, ldu + vocoder::IMBE_LDU_OFFSETS[n]);
+        }
+        else {
 #endif // defined(_WIN32)
-        m_encoder->encode(samples, imbe);
+            m_encoder->encodeLDU(m_txSamples, ldu);
 #if defined(_WIN32)
-    }
+        }
 #endif // defined(_WIN32)
-
-    // Utils::dump(1U, "Encoded IMBE", imbe, RAW_IMBE_LENGTH_BYTES);
-
-    // fill the LDU buffers appropriately
-    switch (m_p25N) {
-    // LDU1
-    case 0:
-        ::memcpy(m_netLDU1 + 10U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 1:
-        ::memcpy(m_netLDU1 + 26U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 2:
-        ::memcpy(m_netLDU1 + 55U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 3:
-        ::memcpy(m_netLDU1 + 80U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 4:
-        ::memcpy(m_netLDU1 + 105U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 5:
-        ::memcpy(m_netLDU1 + 130U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 6:
-        ::memcpy(m_netLDU1 + 155U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 7:
-        ::memcpy(m_netLDU1 + 180U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 8:
-        ::memcpy(m_netLDU1 + 204U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-
-    // LDU2
-    case 9:
-        ::memcpy(m_netLDU2 + 10U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 10:
-        ::memcpy(m_netLDU2 + 26U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 11:
-        ::memcpy(m_netLDU2 + 55U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 12:
-        ::memcpy(m_netLDU2 + 80U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 13:
-        ::memcpy(m_netLDU2 + 105U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 14:
-        ::memcpy(m_netLDU2 + 130U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 15:
-        ::memcpy(m_netLDU2 + 155U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 16:
-        ::memcpy(m_netLDU2 + 180U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
-    case 17:
-        ::memcpy(m_netLDU2 + 204U, imbe, RAW_IMBE_LENGTH_BYTES);
-        break;
     }
 
     uint32_t srcId = m_srcId;
@@ -2019,6 +2176,40 @@ void HostBridge::encodeP25AudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
     if (forcedDstId > 0 && forcedDstId != m_dstId)
         dstId = forcedDstId;
 
+    writeP25LDU(srcId, dstId);
+}
+
+/* Helper to write an IMBE codeword into the LDU buffers, sending each LDU once it is full. */
+
+void HostBridge::writeP25IMBE(const uint8_t* imbe, uint32_t srcId, uint32_t dstId)
+{
+    assert(imbe != nullptr);
+    using namespace p25;
+    using namespace p25::defines;
+
+    if (m_p25N > 17)
+        m_p25N = 0;
+    if (m_p25N == 0)
+        ::memset(m_netLDU1, 0x00U, 9U * 25U);
+    if (m_p25N == 9)
+        ::memset(m_netLDU2, 0x00U, 9U * 25U);
+
+    // fill the LDU buffers appropriately
+    if (m_p25N < 9U)
+        ::memcpy(m_netLDU1 + vocoder::IMBE_LDU_OFFSETS[m_p25N], imbe, RAW_IMBE_LENGTH_BYTES);
+    else
+        ::memcpy(m_netLDU2 + vocoder::IMBE_LDU_OFFSETS[m_p25N - 9U], imbe, RAW_IMBE_LENGTH_BYTES);
+
+    writeP25LDU(srcId, dstId);
+}
+
+/* Helper to send the LDU buffers once they are full, advancing the voice frame counter. */
+
+void HostBridge::writeP25LDU(uint32_t srcId, uint32_t dstId)
+{
+    using namespace p25;
+    using namespace p25::defines;
+
     lc::LC lc = lc::LC();
     lc.setLCO(LCO::GROUP);
     lc.setGroup(true);
@@ -2049,8 +2240,6 @@ void HostBridge::encodeP25AudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
 
 void HostBridge::generatePreambleTone()
 {
-    std::lock_guard<std::mutex> lock(m_audioMutex);
-
     uint64_t frameCount = SampleTimeConvert::ToSamples(SAMPLE_RATE, 1, m_preambleLength);
     if (frameCount > m_outputAudio.freeSpace()) {
         ::LogError(LOG_HOST, "failed to generate preamble tone");
@@ -2075,6 +2264,31 @@ void HostBridge::generatePreambleTone()
     m_outputAudio.addData(sineSamples, frameCount);
 }
 
+/* Helper to report audio dropped or run dry between the audio device and the bridge. */
+
+void HostBridge::checkAudioBuffers()
+{
+    uint32_t overruns = m_inputAudio.overruns();
+    if (overruns != m_inputOverruns) {
+        LogWarning(LOG_HOST, "%s overrun, captured audio dropped %u times", m_inputAudio.name(), overruns - m_inputOverruns);
+        m_inputOverruns = overruns;
+    }
+
+    overruns = m_outputAudio.overruns();
+    if (overruns != m_outputOverruns) {
+        LogWarning(LOG_HOST, "%s overrun, received audio dropped %u times", m_outputAudio.name(), overruns - m_outputOverruns);
+        m_outputOverruns = overruns;
+    }
+
+    // the output buffer always runs dry at the end of a call, only gaps during a call are audible
+    uint32_t underruns = m_outputAudio.underruns();
+    if (underruns != m_outputUnderruns) {
+        if (m_callInProgress)
+            LogWarning(LOG_HOST, "%s underrun, received audio ran dry during call", m_outputAudio.name());
+        m_outputUnderruns = underruns;
+    }
+}
+
 /* Helper to end a local or UDP call. */
 
 void HostBridge::callEnd(uint32_t srcId, uint32_t dstId)
@@ -2090,35 +2304,8 @@ void HostBridge::callEnd(uint32_t srcId, uint32_t dstId)
     m_audioDetect = false;
     m_dropTime.stop();
 
-    if (!m_callInProgress) {
-        switch (m_txMode) {
-        case TX_MODE_DMR:
-        {
-            dmr::data::NetData data = dmr::data::NetData();
-            data.setDataType(dmr::defines::DataType::TERMINATOR_WITH_LC);
-            data.setDstId(dstId);
-            data.setSrcId(srcId);
-
-            m_network->writeDMRTerminator(data, &m_dmrSeqNo, &m_dmrN, m_dmrEmbeddedData);
-            m_network->resetDMR(data.getSlotNo());
-        }
-        break;
-        case TX_MODE_P25:
-        {
-            p25::lc::LC lc = p25::lc::LC();
-            lc.setLCO(p25::defines::LCO::GROUP);
-            lc.setDstId(dstId);
-            lc.setSrcId(srcId);
-
-            p25::data::LowSpeedData lsd = p25::data::LowSpeedData();
-
-            uint8_t controlByte = 0x00U;
-            m_network->writeP25TDU(lc, lsd, controlByte);
-            m_network->resetP25();
-        }
-        break;
-        }
-    }
+    if (!m_callInProgress)
+        writeCallTerminator(srcId, dstId);
 
     m_srcIdOverride = 0;
     m_txStreamId = 0;
@@ -2133,6 +2320,66 @@ void HostBridge::callEnd(uint32_t srcId, uint32_t dstId)
     m_p25N = 0U;
 }
 
+/* Helper to write the call terminator for the transmit mode. */
+
+void HostBridge::writeCallTerminator(uint32_t srcId, uint32_t dstId)
+{
+    switch (m_txMode) {
+    case TX_MODE_DMR:
+    {
+        dmr::data::NetData data = dmr::data::NetData();
+        data.setDataType(dmr::defines::DataType::TERMINATOR_WITH_LC);
+        data.setDstId(dstId);
+        data.setSrcId(srcId);
+
+        m_network->writeDMRTerminator(data, &m_dmrSeqNo, &m_dmrN, m_dmrEmbeddedData);
+        m_network->resetDMR(data.getSlotNo());
+    }
+    break;
+    case TX_MODE_P25:
+    {
+        p25::lc::LC lc = p25::lc::LC();
+        lc.setLCO(p25::defines::LCO::GROUP);
+        lc.setDstId(dstId);
+        lc.setSrcId(srcId);
+
+        p25::data::LowSpeedData lsd = p25::data::LowSpeedData();
+
+        uint8_t controlByte = 0x00U;
+        m_network->writeP25TDU(lc, lsd, controlByte);
+        m_network->resetP25();
+    }
+    break;
+    }
+}
+
+/* Helper to start a cross-mode call (transcoding network traffic into the transmit mode). */
+
+void HostBridge::crossModeCallStart()
+{
+    m_transcoder->reset();
+
+    m_txStreamId = 0;
+
+    ::memset(m_ambeBuffer, 0x00U, 27U);
+    m_ambeCount = 0U;
+    m_dmrSeqNo = 0U;
+    m_dmrN = 0U;
+    m_p25SeqNo = 0U;
+    m_p25N = 0U;
+}
+
+/* Helper to end a cross-mode call. */
+
+void HostBridge::crossModeCallEnd(uint32_t srcId, uint32_t dstId)
+{
+    // only terminate if any of the call was transmitted
+    if ((m_txMode == TX_MODE_DMR && m_dmrSeqNo > 0U) || (m_txMode == TX_MODE_P25 && m_p25SeqNo > 0U))
+        writeCallTerminator(srcId, dstId);
+
+    crossModeCallStart();
+}
+
 /* Entry point to audio processing thread. */
 
 void* HostBridge::threadAudioProcess(void* arg)
@@ -2176,12 +2423,14 @@ void* HostBridge::threadAudioProcess(void* arg)
 
             // scope is intentional
             {
-                std::lock_guard<std::mutex> lock(m_audioMutex);
-
                 if (bridge->m_inputAudio.dataSize() >= MBE_SAMPLES_LENGTH) {
                     short samples[MBE_SAMPLES_LENGTH];
                     bridge->m_inputAudio.get(samples, MBE_SAMPLES_LENGTH);
 
+                    // the input buffer is wait-free; the lock only guards the encoder and call state shared
+                    // with UDP audio
+                    std::lock_guard<std::mutex> lock(m_audioMutex);
+
                     // process MDC, if necessary
                     if (bridge->m_overrideSrcIdFromMDC)
                         mdc_decoder_process_samples(bridge->m_mdcDecoder, samples, MBE_SAMPLES_LENGTH);
@@ -2334,7 +2583,7 @@ void* HostBridge::threadNetworkProcess(void* arg)
 
             uint32_t length = 0U;
             bool netReadRet = false;
-            if (bridge->m_txMode == TX_MODE_DMR) {
+            if (bridge->m_rxMode == TX_MODE_DMR) {
                 std::lock_guard<std::mutex> lock(HostBridge::m_networkMutex);
                 UInt8Array dmrBuffer = bridge->m_network->readDMR(netReadRet, length);
                 if (netReadRet) {
@@ -2342,7 +2591,7 @@ void* HostBridge::threadNetworkProcess(void* arg)
                 }
             }
 
-            if (bridge->m_txMode == TX_MODE_P25) {
+            if (bridge->m_rxMode == TX_MODE_P25) {
                 std::lock_guard<std::mutex> lock(HostBridge::m_networkMutex);
                 UInt8Array p25Buffer = bridge->m_network->readP25(netReadRet, length);
                 if (netReadRet) {
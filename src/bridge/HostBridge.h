@@ -21,11 +21,14 @@
 #include "common/dmr/lc/LC.h"
 #include "common/dmr/lc/PrivacyLC.h"
 #include "common/network/udp/Socket.h"
+#include "common/network/RTPAudioCodec.h"
+#include "common/network/RTPJitterBuffer.h"
 #include "common/yaml/Yaml.h"
-#include "common/RingBuffer.h"
+#include "common/SPSCRingBuffer.h"
 #include "common/Timer.h"
 #include "vocoder/MBEDecoder.h"
 #include "vocoder/MBEEncoder.h"
+#include "vocoder/MBETranscoder.h"
 #define MINIAUDIO_IMPLEMENTATION
 #include "audio/miniaudio.h"
 #include "mdc/mdc_decode.h"
@@ -62,6 +65,9 @@ const uint8_t HALF_RATE_MODE = 0x01U;
 const uint8_t TX_MODE_DMR = 1U;
 const uint8_t TX_MODE_P25 = 2U;
 
+const uint32_t UDP_AUDIO_MAX_FRAMES_PER_PACKET = 6U;
+const uint16_t UDP_AUDIO_RTP_METADATA_PROFILE = 0x4456U;  // "DV"
+
 
 // ---------------------------------------------------------------------------
 //  Global Functions
@@ -134,6 +140,21 @@ private:
     std::string m_udpSendAddress;
     uint16_t m_udpReceivePort;
     std::string m_udpReceiveAddress;
+    sockaddr_storage m_udpSendAddr;
+    uint32_t m_udpSendAddrLen;
+
+    bool m_udpRTPFrames;
+    network::RTPAudioCodecType::E m_udpAudioCodec;
+    uint32_t m_udpFramesPerPacket;
+    network::RTPJitterBuffer* m_udpJitterBuffer;
+    short* m_udpTxSamples;
+    uint32_t m_udpTxFrames;
+    uint32_t m_udpTxSrcId;
+    uint32_t m_udpTxDstId;
+    uint16_t m_udpTxSeq;
+    uint32_t m_udpTxTimestamp;
+    uint32_t m_udpTxSSRC;
+    bool m_udpTxMarker;
 
     uint32_t m_srcId;
     uint32_t m_srcIdOverride;
@@ -150,6 +171,8 @@ private:
     float m_vocoderEncoderAudioGain;
 
     uint8_t m_txMode;
+    bool m_crossMode;
+    uint8_t m_rxMode;
 
     float m_voxSampleLevel;
     uint16_t m_dropTimeMS;
@@ -174,11 +197,15 @@ private:
     ma_waveform m_maSineWaveform;
     ma_waveform_config m_maSineWaveConfig;
 
-    RingBuffer<short> m_inputAudio;
-    RingBuffer<short> m_outputAudio;
+    SPSCRingBuffer<short> m_inputAudio;
+    SPSCRingBuffer<short> m_outputAudio;
+    uint32_t m_inputOverruns;
+    uint32_t m_outputOverruns;
+    uint32_t m_outputUnderruns;
 
     vocoder::MBEDecoder* m_decoder;
     vocoder::MBEEncoder* m_encoder;
+    vocoder::MBETranscoder* m_transcoder;
 
     mdc_decoder_t* m_mdcDecoder;
 
@@ -195,6 +222,7 @@ private:
     uint8_t* m_netLDU2;
     uint32_t m_p25SeqNo;
     uint8_t m_p25N;
+    short* m_txSamples;
 
     bool m_audioDetect;
     bool m_trafficFromUDP;
@@ -359,8 +387,32 @@ private:
 
     /**
      * @brief Helper to process UDP audio.
+     * @param ms Number of milliseconds elapsed since the last call.
+     */
+    void processUDPAudio(uint32_t ms);
+    /**
+     * @brief Helper to process a frame of received UDP audio.
+     * @param samples Frame of PCM samples (MBE_SAMPLES_LENGTH samples).
+     */
+    void processUDPAudioFrame(const short* samples);
+    /**
+     * @brief Helper to decode a RTP framed UDP audio packet into the jitter buffer.
+     * @param buffer Buffer containing the RTP packet.
+     * @param length Length of the RTP packet.
+     */
+    void decodeRTPAudio(const uint8_t* buffer, uint32_t length);
+    /**
+     * @brief Helper to write a frame of decoded audio to the UDP audio destination.
+     * @param samples Frame of PCM samples (MBE_SAMPLES_LENGTH samples).
+     * @param srcId Source ID.
+     * @param dstId Destination ID.
+     */
+    void writeUDPAudio(const short* samples, uint32_t srcId, uint32_t dstId);
+    /**
+     * @brief Helper to send the pending RTP framed UDP audio frames.
+     * @param callEnd Flag indicating the call has ended, and the next packet starts a new talkspurt.
      */
-    void processUDPAudio();
+    void flushUDPAudio(bool callEnd = false);
 
     /**
      * @brief Helper to process DMR network traffic.
@@ -383,6 +435,12 @@ private:
      * @param forcedDstId 
      */
     void encodeDMRAudioFrame(uint8_t* pcm, uint32_t forcedSrcId = 0U, uint32_t forcedDstId = 0U);
+    /**
+     * @brief Helper to write the buffered AMBE codewords as a DMR voice burst.
+     * @param srcId Source Radio ID.
+     * @param dstId Destination ID.
+     */
+    void writeDMRVoiceBurst(uint32_t srcId, uint32_t dstId);
 
     /**
      * @brief Helper to process P25 network traffic.
@@ -405,11 +463,39 @@ private:
      * @param forcedDstId 
      */
     void encodeP25AudioFrame(uint8_t* pcm, uint32_t forcedSrcId = 0U, uint32_t forcedDstId = 0U);
+    /**
+     * @brief Helper to write an IMBE codeword into the LDU buffers, sending each LDU once it is full.
+     * @param imbe IMBE codeword.
+     * @param srcId Source Radio ID.
+     * @param dstId Destination ID.
+     */
+    void writeP25IMBE(const uint8_t* imbe, uint32_t srcId, uint32_t dstId);
+    /**
+     * @brief Helper to send the LDU buffers once they are full, advancing the voice frame counter.
+     * @param srcId Source Radio ID.
+     * @param dstId Destination ID.
+     */
+    void writeP25LDU(uint32_t srcId, uint32_t dstId);
+
+    /**
+     * @brief Helper to start a cross-mode call (transcoding network traffic into the transmit mode).
+     */
+    void crossModeCallStart();
+    /**
+     * @brief Helper to end a cross-mode call.
+     * @param srcId Source Radio ID.
+     * @param dstId Destination ID.
+     */
+    void crossModeCallEnd(uint32_t srcId, uint32_t dstId);
 
     /**
      * @brief Helper to generate the preamble tone.
      */
     void generatePreambleTone();
+    /**
+     * @brief Helper to report audio dropped or run dry between the audio device and the bridge.
+     */
+    void checkAudioBuffers();
 
     /**
      * @brief Helper to end a local or UDP call.
@@ -417,6 +503,12 @@ private:
      * @param dstId 
      */
     void callEnd(uint32_t srcId, uint32_t dstId);
+    /**
+     * @brief Helper to write the call terminator for the transmit mode.
+     * @param srcId Source Radio ID.
+     * @param dstId Destination ID.
+     */
+    void writeCallTerminator(uint32_t srcId, uint32_t dstId);
 
     /**
      * @brief Entry point to audio processing thread.
@@ -13,7 +13,11 @@
 
 using namespace system_clock;
 
+#include <cerrno>
 #include <stdio.h>
+#if !defined(_WIN32)
+#include <time.h>
+#endif // !defined(_WIN32)
 
 // ---------------------------------------------------------------------------
 //  Constants
@@ -139,6 +143,51 @@ uint64_t hrc::diffNowUS(hrc::hrc_t& then)
     return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - then).count();
 }
 
+/* Get current monotonic time in microseconds. */
+
+uint64_t mono::nowUS()
+{
+#if defined(_WIN32)
+    static LARGE_INTEGER frequency = { };
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+
+    LARGE_INTEGER now;
+    ::QueryPerformanceCounter(&now);
+
+    return (uint64_t)((now.QuadPart / frequency.QuadPart) * 1000000ULL +
+        ((now.QuadPart % frequency.QuadPart) * 1000000ULL) / frequency.QuadPart);
+#else
+    struct timespec now;
+    ::clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000ULL + (uint64_t)now.tv_nsec / 1000ULL;
+#endif // defined(_WIN32)
+}
+
+/* 
+ * Suspends the current thread until the given monotonic time is reached. 
+ * This uses an absolute deadline so that the time spent processing before the call does not accumulate as drift.
+ */
+
+void mono::sleepUntilUS(uint64_t deadlineUS)
+{
+#if defined(_WIN32)
+    uint64_t now = mono::nowUS();
+    if (deadlineUS > now) {
+        ::Sleep((DWORD)((deadlineUS - now + 999ULL) / 1000ULL));
+    }
+#else
+    struct timespec deadline;
+    deadline.tv_sec = (time_t)(deadlineUS / 1000000ULL);
+    deadline.tv_nsec = (long)((deadlineUS % 1000000ULL) * 1000ULL);
+
+    // clock_nanosleep returns the error directly (and does not set errno), restart if interrupted
+    while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+        ;
+#endif // defined(_WIN32)
+}
+
 /* Convert milliseconds to jiffies. */
 
 uint64_t system_clock::msToJiffies(uint64_t ms)
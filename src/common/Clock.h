@@ -113,6 +113,26 @@ namespace system_clock
         uint64_t diffNowUS(hrc_t& then);
     } // namespace hrc
 
+    /*
+    ** Monotonic Clock
+    */
+
+    namespace mono
+    {
+        /**
+         * @brief Get current monotonic time in microseconds.
+         * @ingroup system_clock
+         * @returns uint64_t Current monotonic time in microseconds.
+         */
+        uint64_t nowUS();
+        /**
+         * @brief Suspends the current thread until the given monotonic time is reached.
+         * @ingroup system_clock
+         * @param deadlineUS Monotonic time in microseconds to sleep until.
+         */
+        void sleepUntilUS(uint64_t deadlineUS);
+    } // namespace mono
+
     /**
      * @brief Convert milliseconds to jiffies.
      * @ingroup system_clock
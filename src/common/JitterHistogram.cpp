@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "JitterHistogram.h"
+
+#include <cstdio>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+/* upper bounds (exclusive) for each bucket in microseconds; the last bucket catches everything else */
+static const uint32_t BUCKET_LIMITS_US[JITTER_HISTOGRAM_BUCKETS] = { 50U, 100U, 250U, 500U, 1000U, 2000U, 5000U, 10000U, 0U };
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the JitterHistogram class. */
+
+JitterHistogram::JitterHistogram() :
+    m_buckets(),
+    m_count(0ULL),
+    m_total(0ULL),
+    m_min(UINT64_MAX),
+    m_max(0ULL)
+{
+    reset();
+}
+
+/* Records a timing error sample. */
+
+void JitterHistogram::record(uint64_t us)
+{
+    uint8_t bucket = JITTER_HISTOGRAM_BUCKETS - 1U;
+    for (uint8_t i = 0U; i < JITTER_HISTOGRAM_BUCKETS - 1U; i++) {
+        if (us < BUCKET_LIMITS_US[i]) {
+            bucket = i;
+            break;
+        }
+    }
+
+    m_buckets[bucket]++;
+    m_count++;
+    m_total += us;
+
+    // samples are recorded from a single thread, so a simple load/store is sufficient here
+    if (us < m_min.load())
+        m_min.store(us);
+    if (us > m_max.load())
+        m_max.store(us);
+}
+
+/* Resets all recorded samples. */
+
+void JitterHistogram::reset()
+{
+    for (uint8_t i = 0U; i < JITTER_HISTOGRAM_BUCKETS; i++)
+        m_buckets[i].store(0ULL);
+
+    m_count.store(0ULL);
+    m_total.store(0ULL);
+    m_min.store(UINT64_MAX);
+    m_max.store(0ULL);
+}
+
+/* Gets the number of samples recorded in the given bucket. */
+
+uint64_t JitterHistogram::bucket(uint8_t bucket) const
+{
+    if (bucket >= JITTER_HISTOGRAM_BUCKETS)
+        return 0ULL;
+
+    return m_buckets[bucket].load();
+}
+
+/* Gets the upper bound (exclusive) of the given bucket in microseconds. */
+
+uint32_t JitterHistogram::bucketLimit(uint8_t bucket)
+{
+    if (bucket >= JITTER_HISTOGRAM_BUCKETS)
+        return 0U;
+
+    return BUCKET_LIMITS_US[bucket];
+}
+
+/* Gets the smallest recorded sample in microseconds. */
+
+uint64_t JitterHistogram::min() const
+{
+    uint64_t min = m_min.load();
+    if (min == UINT64_MAX)
+        return 0ULL;
+
+    return min;
+}
+
+/* Gets the mean of the recorded samples in microseconds. */
+
+uint64_t JitterHistogram::mean() const
+{
+    uint64_t count = m_count.load();
+    if (count == 0ULL)
+        return 0ULL;
+
+    return m_total.load() / count;
+}
+
+/* Helper to generate a textual summary of the histogram. */
+
+std::string JitterHistogram::toString() const
+{
+    char buffer[512U];
+    int len = ::snprintf(buffer, sizeof(buffer), "samples = %llu, min = %lluus, mean = %lluus, max = %lluus,",
+        (unsigned long long)count(), (unsigned long long)min(), (unsigned long long)mean(), (unsigned long long)max());
+
+    for (uint8_t i = 0U; i < JITTER_HISTOGRAM_BUCKETS && len > 0 && (size_t)len < sizeof(buffer); i++) {
+        if (BUCKET_LIMITS_US[i] == 0U)
+            len += ::snprintf(buffer + len, sizeof(buffer) - len, " >=%uus: %llu", BUCKET_LIMITS_US[i - 1U], (unsigned long long)bucket(i));
+        else
+            len += ::snprintf(buffer + len, sizeof(buffer) - len, " <%uus: %llu", BUCKET_LIMITS_US[i], (unsigned long long)bucket(i));
+    }
+
+    return std::string(buffer);
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file JitterHistogram.h
+ * @ingroup timers
+ * @file JitterHistogram.cpp
+ * @ingroup timers
+ */
+#if !defined(__JITTER_HISTOGRAM_H__)
+#define __JITTER_HISTOGRAM_H__
+
+#include "common/Defines.h"
+
+#include <atomic>
+#include <string>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+/**
+ * @addtogroup timers
+ * @{
+ */
+
+const uint8_t   JITTER_HISTOGRAM_BUCKETS = 9U;
+
+/** @} */
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Records timing error samples (in microseconds) into a fixed set of histogram buckets.
+ * @ingroup timers
+ *
+ * Samples are expected to be recorded from a single thread; the statistics may be read from any thread.
+ */
+class HOST_SW_API JitterHistogram {
+public:
+    /**
+     * @brief Initializes a new instance of the JitterHistogram class.
+     */
+    JitterHistogram();
+
+    /**
+     * @brief Records a timing error sample.
+     * @param us Timing error in microseconds.
+     */
+    void record(uint64_t us);
+    /**
+     * @brief Resets all recorded samples.
+     */
+    void reset();
+
+    /**
+     * @brief Gets the number of samples recorded.
+     * @returns uint64_t Number of samples recorded.
+     */
+    uint64_t count() const { return m_count.load(); }
+    /**
+     * @brief Gets the number of samples recorded in the given bucket.
+     * @param bucket Bucket index.
+     * @returns uint64_t Number of samples recorded in the bucket.
+     */
+    uint64_t bucket(uint8_t bucket) const;
+    /**
+     * @brief Gets the upper bound (exclusive) of the given bucket in microseconds.
+     * @param bucket Bucket index.
+     * @returns uint32_t Upper bound of the bucket in microseconds (0 for the overflow bucket).
+     */
+    static uint32_t bucketLimit(uint8_t bucket);
+
+    /**
+     * @brief Gets the smallest recorded sample in microseconds.
+     * @returns uint64_t Smallest recorded sample.
+     */
+    uint64_t min() const;
+    /**
+     * @brief Gets the largest recorded sample in microseconds.
+     * @returns uint64_t Largest recorded sample.
+     */
+    uint64_t max() const { return m_max.load(); }
+    /**
+     * @brief Gets the mean of the recorded samples in microseconds.
+     * @returns uint64_t Mean of the recorded samples.
+     */
+    uint64_t mean() const;
+
+    /**
+     * @brief Helper to generate a textual summary of the histogram.
+     * @returns std::string Textual summary of the histogram.
+     */
+    std::string toString() const;
+
+private:
+    std::atomic<uint64_t> m_buckets[JITTER_HISTOGRAM_BUCKETS];
+    std::atomic<uint64_t> m_count;
+    std::atomic<uint64_t> m_total;
+    std::atomic<uint64_t> m_min;
+    std::atomic<uint64_t> m_max;
+};
+
+#endif // __JITTER_HISTOGRAM_H__
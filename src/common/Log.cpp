@@ -9,6 +9,7 @@
  *
  */
 #include "Log.h"
+#include "Thread.h"
 #include "network/BaseNetwork.h"
 
 #if defined(_WIN32)
@@ -28,7 +29,11 @@
 #include <ctime>
 #include <cassert>
 #include <cstring>
+#include <atomic>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 // ---------------------------------------------------------------------------
 //  Constants
@@ -38,6 +43,22 @@
 
 const uint32_t LOG_BUFFER_LEN = 4096U;
 
+const uint32_t LOG_QUEUE_LEN = 1024U; // must be a power of 2
+
+// ---------------------------------------------------------------------------
+//  Structure Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Represents a preformatted log entry queued for the log writer.
+ */
+struct LogRecord {
+    std::atomic<size_t> sequence;       //! Queue Sequence
+    uint32_t level;                     //! Log Level
+    bool activity;                      //! Flag indicating this is an activity log entry
+    char buffer[LOG_BUFFER_LEN];        //! Formatted Log Entry
+};
+
 // ---------------------------------------------------------------------------
 //  Global Variables
 // ---------------------------------------------------------------------------
@@ -61,6 +82,22 @@ static std::ostream m_outStream { std::cerr.rdbuf() };
 
 static char LEVELS[] = " DMIWEF";
 
+static LogRecord* m_logQueue = nullptr;
+static std::atomic<size_t> m_logEnqueuePos(0U);
+static size_t m_logDequeuePos = 0U;
+static std::atomic<uint64_t> m_logDropped(0U);
+
+static thread_t* m_logWriter = nullptr;
+static std::thread::id m_logWriterId;
+static std::atomic<bool> m_logWriterRunning(false);
+
+static std::mutex m_logSignalLock;
+static std::condition_variable m_logSignal;
+static std::atomic<bool> m_logPending(false);
+
+static void (*m_activityWrite)(const char*) = nullptr;
+static void (*m_activityFlush)() = nullptr;
+
 // ---------------------------------------------------------------------------
 //  Global Functions
 // ---------------------------------------------------------------------------
@@ -83,7 +120,7 @@ static bool LogOpen()
 {
 #if defined(CATCH2_TEST_COMPILATION)
     return true;
-#endif
+#else
     if (m_fileLevel == 0U)
         return true;
 
@@ -137,6 +174,223 @@ static bool LogOpen()
         return false;
 #endif // !defined(_WIN32)
     }
+#endif // defined(CATCH2_TEST_COMPILATION)
+}
+
+/* Helper to write a formatted log entry to the log outputs (network, file, syslog and stdout). */
+
+static void LogWriteRecord(uint32_t level, bool activity, const char* buffer)
+{
+    if (activity) {
+        if (m_activityWrite != nullptr)
+            m_activityWrite(buffer);
+        return;
+    }
+
+    if (m_network != nullptr) {
+        // don't transfer debug data...
+        if (level > 1U) {
+            m_network->writeDiagLog(buffer);
+        }
+    }
+
+    if (level >= m_fileLevel && m_fileLevel != 0U) {
+        if (!g_useSyslog) {
+            if (m_fpLog != nullptr)
+                ::fprintf(m_fpLog, "%s\n", buffer);
+        } else {
+#if !defined(_WIN32)
+            // convert our log level into syslog level
+            int syslogLevel = LOG_INFO;
+            switch (level) {
+            case 1U:
+                syslogLevel = LOG_DEBUG;
+                break;
+            case 2U:
+                syslogLevel = LOG_NOTICE;
+                break;
+            case 3U:
+            case 9999U: // in-band U: messages should also be info level
+                syslogLevel = LOG_INFO;
+                break;
+            case 4U:
+                syslogLevel = LOG_WARNING;
+                break;
+            case 5U:
+                syslogLevel = LOG_ERR;
+                break;
+            default:
+                syslogLevel = LOG_EMERG;
+                break;
+            }
+
+            syslog(syslogLevel, "%s", buffer);
+#endif // !defined(_WIN32)
+        }
+    }
+
+    if (!g_useSyslog && level >= g_logDisplayLevel && g_logDisplayLevel != 0U) {
+        ::fprintf(stdout, "%s" EOL, buffer);
+    }
+}
+
+/* Helper to flush the log outputs. */
+
+static void LogFlush()
+{
+    if (m_fpLog != nullptr)
+        ::fflush(m_fpLog);
+    ::fflush(stdout);
+
+    if (m_activityFlush != nullptr)
+        m_activityFlush();
+}
+
+/* Helper to queue a formatted log entry for the log writer. */
+
+static bool LogEnqueue(uint32_t level, bool activity, const char* buffer)
+{
+    size_t pos = m_logEnqueuePos.load(std::memory_order_relaxed);
+    LogRecord* record = nullptr;
+    while (true) {
+        record = &m_logQueue[pos & (LOG_QUEUE_LEN - 1U)];
+        size_t seq = record->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (m_logEnqueuePos.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0) {
+            // the queue is full -- drop the entry rather than stall the caller
+            m_logDropped++;
+            return false;
+        }
+        else {
+            pos = m_logEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    // only copy the entry itself (not the whole record buffer)
+    size_t len = ::strnlen(buffer, LOG_BUFFER_LEN - 1U);
+    record->level = level;
+    record->activity = activity;
+    ::memcpy(record->buffer, buffer, len);
+    record->buffer[len] = '\0';
+
+    record->sequence.store(pos + 1U, std::memory_order_release);
+
+    // wake the writer if it is idle (the lock is only taken on the idle to pending transition)
+    if (!m_logPending.exchange(true)) {
+        std::lock_guard<std::mutex> lock(m_logSignalLock);
+        m_logSignal.notify_one();
+    }
+
+    return true;
+}
+
+/* Helper to write all queued log entries to the log outputs. */
+
+static uint32_t LogDrainQueue()
+{
+    uint32_t count = 0U;
+    while (count < LOG_QUEUE_LEN) {
+        LogRecord* record = &m_logQueue[m_logDequeuePos & (LOG_QUEUE_LEN - 1U)];
+        size_t seq = record->sequence.load(std::memory_order_acquire);
+        if ((intptr_t)seq - (intptr_t)(m_logDequeuePos + 1U) < 0)
+            break;
+
+        // check the log file (and roll it over if the day changed) once per batch
+        if (count == 0U && m_fileLevel != 0U)
+            ::LogOpen();
+
+        LogWriteRecord(record->level, record->activity, record->buffer);
+
+        record->sequence.store(m_logDequeuePos + LOG_QUEUE_LEN, std::memory_order_release);
+        m_logDequeuePos++;
+        count++;
+    }
+
+    uint64_t dropped = m_logDropped.exchange(0U);
+    if (dropped > 0U) {
+        char timestamp[24U];
+        ::LogFormatTimestamp(timestamp);
+
+        char buffer[128U];
+        ::snprintf(buffer, sizeof(buffer), "W: %s (LOG) %llu log entries dropped, log queue full", timestamp, (unsigned long long)dropped);
+        LogWriteRecord(4U, false, buffer);
+        count++;
+    }
+
+    if (count > 0U)
+        LogFlush();
+
+    return count;
+}
+
+/* Entry point to the log writer thread. */
+
+static void* LogWriterThread(void* arg)
+{
+    thread_t* th = (thread_t*)arg;
+    if (th != nullptr) {
+#ifdef _GNU_SOURCE
+        ::pthread_setname_np(th->thread, "log:writer");
+#endif // _GNU_SOURCE
+
+        // scope is intentional
+        {
+            std::lock_guard<std::mutex> lock(m_logSignalLock);
+            m_logWriterId = std::this_thread::get_id();
+        }
+
+        while (true) {
+            // scope is intentional
+            {
+                std::unique_lock<std::mutex> lock(m_logSignalLock);
+                m_logSignal.wait(lock, [] { return m_logPending.load() || !m_logWriterRunning.load(); });
+                m_logPending = false;
+            }
+
+            bool running = m_logWriterRunning.load();
+            while (LogDrainQueue() > 0U)
+                ;
+
+            if (!running)
+                break;
+        }
+    }
+
+    return nullptr;
+}
+
+/* Stops the asynchronous log writer, writing any queued log entries. */
+
+void LogStopAsyncWriter()
+{
+    if (!m_logWriterRunning)
+        return;
+
+    bool self = false;
+    {
+        std::lock_guard<std::mutex> lock(m_logSignalLock);
+        m_logWriterRunning = false;
+        self = (std::this_thread::get_id() == m_logWriterId);
+        m_logSignal.notify_one();
+    }
+
+    // the writer cannot wait for itself to stop (i.e. it logged a fatal error); it stops when it returns
+    // to its loop
+    if (self)
+        return;
+#if defined(_WIN32)
+    ::WaitForSingleObject(m_logWriter->thread, INFINITE);
+    ::CloseHandle(m_logWriter->thread);
+#else
+    ::pthread_join(m_logWriter->thread, NULL);
+#endif // defined(_WIN32)
+
+    delete m_logWriter;
+    m_logWriter = nullptr;
 }
 
 /* Internal helper to set an output stream to direct logging to. */
@@ -158,12 +412,53 @@ void* LogGetNetwork()
 
 void LogSetNetwork(void* network)
 {
-#if defined(CATCH2_TEST_COMPILATION)
-    return;
-#endif
+#if !defined(CATCH2_TEST_COMPILATION)
     // note: The Network class is passed here as a void so we can avoid including the Network.h
     // header in Log.h. This is dirty and probably terrible...
     m_network = (network::BaseNetwork*)network;
+#endif // !defined(CATCH2_TEST_COMPILATION)
+}
+
+/* Sets the handlers the log writer uses to write and flush activity log entries. */
+
+void LogSetActivitySink(void (*write)(const char*), void (*flush)())
+{
+    m_activityWrite = write;
+    m_activityFlush = flush;
+}
+
+/* Helper to format the current date and time for a log entry. */
+
+uint32_t LogFormatTimestamp(char* buffer)
+{
+    // the date and time is only reformatted when the second changes
+    static thread_local time_t cachedSec = 0;
+    static thread_local char cached[20U];
+
+    struct timeval now;
+    ::gettimeofday(&now, NULL);
+
+    time_t sec = (time_t)now.tv_sec;
+    if (sec != cachedSec) {
+        struct tm tm;
+#if defined(_WIN32)
+        ::localtime_s(&tm, &sec);
+#else
+        ::localtime_r(&sec, &tm);
+#endif // defined(_WIN32)
+        ::strftime(cached, sizeof(cached), "%Y-%m-%d %H:%M:%S", &tm);
+        cachedSec = sec;
+    }
+
+    uint32_t ms = (uint32_t)(now.tv_usec / 1000U);
+    ::memcpy(buffer, cached, 19U);
+    buffer[19U] = '.';
+    buffer[20U] = (char)('0' + (ms / 100U) % 10U);
+    buffer[21U] = (char)('0' + (ms / 10U) % 10U);
+    buffer[22U] = (char)('0' + ms % 10U);
+    buffer[23U] = '\0';
+
+    return 23U;
 }
 
 /* Initializes the diagnostics log. */
@@ -184,19 +479,78 @@ bool LogInitialise(const std::string& filePath, const std::string& fileRoot, uin
     return ::LogOpen();
 }
 
+/* Starts the asynchronous log writer. */
+
+bool LogStartAsyncWriter()
+{
+#if defined(CATCH2_TEST_COMPILATION)
+    return true;
+#else
+    if (m_logWriterRunning)
+        return true;
+
+    // the queue is never released; a caller may still be queuing an entry when the writer is stopped
+    if (m_logQueue == nullptr) {
+        m_logQueue = new LogRecord[LOG_QUEUE_LEN];
+        for (uint32_t i = 0U; i < LOG_QUEUE_LEN; i++)
+            m_logQueue[i].sequence.store(i);
+        m_logEnqueuePos = 0U;
+        m_logDequeuePos = 0U;
+    }
+
+    // make sure queued log entries are written if the process exits without finalizing the log
+    static bool atExit = false;
+    if (!atExit) {
+        ::atexit(LogStopAsyncWriter);
+        atExit = true;
+    }
+
+    m_logWriterRunning = true;
+    m_logWriter = new thread_t();
+    if (!Thread::runAsThread(nullptr, LogWriterThread, m_logWriter)) {
+        m_logWriter = nullptr;
+        m_logWriterRunning = false;
+
+        LogDrainQueue();
+        return false;
+    }
+
+    return true;
+#endif // defined(CATCH2_TEST_COMPILATION)
+}
+
 /* Finalizes the diagnostics log. */
 
 void LogFinalise()
 {
-#if defined(CATCH2_TEST_COMPILATION)
-    return;
-#endif
-    if (m_fpLog != nullptr)
+#if !defined(CATCH2_TEST_COMPILATION)
+    LogStopAsyncWriter();
+
+    if (m_fpLog != nullptr) {
         ::fclose(m_fpLog);
+        m_fpLog = nullptr;
+    }
 #if !defined(_WIN32)
     if (g_useSyslog)
         closelog();
 #endif // !defined(_WIN32)
+#endif // !defined(CATCH2_TEST_COMPILATION)
+}
+
+/* Writes a activity log entry to the log outputs. */
+
+void LogQueueActivity(const char* buffer)
+{
+    assert(buffer != nullptr);
+
+    if (m_logWriterRunning) {
+        LogEnqueue(2U, true, buffer);
+        return;
+    }
+
+    LogWriteRecord(2U, true, buffer);
+    if (m_activityFlush != nullptr)
+        m_activityFlush();
 }
 
 /* Writes a new entry to the diagnostics log. */
@@ -206,109 +560,63 @@ void Log(uint32_t level, const char *module, const char* fmt, ...)
     assert(fmt != nullptr);
 #if defined(CATCH2_TEST_COMPILATION)
     g_disableTimeDisplay = true;
+#else
+    bool fatal = level >= 6U && level < 9999U;
+
+    // is there anywhere for this entry to go?
+    if (!fatal && !(m_outStream && g_logDisplayLevel == 0U) && !(m_network != nullptr && level > 1U) &&
+        !(level >= m_fileLevel && m_fileLevel != 0U) && !(!g_useSyslog && level >= g_logDisplayLevel && g_logDisplayLevel != 0U))
+        return;
 #endif
     char buffer[LOG_BUFFER_LEN];
+    uint32_t len = 0U;
     if (!g_disableTimeDisplay && !g_useSyslog) {
-        time_t now;
-        ::time(&now);
-        struct tm* tm = ::localtime(&now);
-
-        struct timeval nowMillis;
-        ::gettimeofday(&nowMillis, NULL);
+        char timestamp[24U];
+        ::LogFormatTimestamp(timestamp);
 
         if (module != nullptr) {
-            ::sprintf(buffer, "%c: %04d-%02d-%02d %02d:%02d:%02d.%03lu (%s) ", LEVELS[level], tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday, tm->tm_hour, tm->tm_min, tm->tm_sec, nowMillis.tv_usec / 1000U, module);
+            len = ::snprintf(buffer, LOG_BUFFER_LEN, "%c: %s (%s) ", LEVELS[level], timestamp, module);
         }
         else {
-            ::sprintf(buffer, "%c: %04d-%02d-%02d %02d:%02d:%02d.%03lu ", LEVELS[level], tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday, tm->tm_hour, tm->tm_min, tm->tm_sec, nowMillis.tv_usec / 1000U);
+            len = ::snprintf(buffer, LOG_BUFFER_LEN, "%c: %s ", LEVELS[level], timestamp);
         }
     }
     else {
         if (module != nullptr) {
-            ::sprintf(buffer, "%c: (%s) ", LEVELS[level], module);
+            len = ::snprintf(buffer, LOG_BUFFER_LEN, "%c: (%s) ", LEVELS[level], module);
         }
         else {
             if (level >= 9999U) {
-                ::sprintf(buffer, "U: ");
+                len = ::snprintf(buffer, LOG_BUFFER_LEN, "U: ");
             }
             else {
-                ::sprintf(buffer, "%c: ", LEVELS[level]);
+                len = ::snprintf(buffer, LOG_BUFFER_LEN, "%c: ", LEVELS[level]);
             }
         }
     }
 
-    va_list vl, vl_len;
+    va_list vl;
     va_start(vl, fmt);
-    va_copy(vl_len, vl);
-
-    size_t len = ::vsnprintf(nullptr, 0U, fmt, vl_len);
-    ::vsnprintf(buffer + ::strlen(buffer), len + 1U, fmt, vl);
-
-    va_end(vl_len);
+    ::vsnprintf(buffer + len, LOG_BUFFER_LEN - len, fmt, vl);
     va_end(vl);
 
     if (m_outStream && g_logDisplayLevel == 0U) {
         m_outStream << buffer << std::endl;
     }
 
-    if (m_network != nullptr) {
-        // don't transfer debug data...
-        if (level > 1U) {
-            m_network->writeDiagLog(buffer);
-        }
-    }
-
 #if defined(CATCH2_TEST_COMPILATION)
     UNSCOPED_INFO(buffer);
     return;
-#endif
-
-    if (level >= m_fileLevel && m_fileLevel != 0U) {
-        if (!g_useSyslog) {
-            bool ret = ::LogOpen();
-            if (!ret)
-                return;
-
-            ::fprintf(m_fpLog, "%s\n", buffer);
-            ::fflush(m_fpLog);
-        } else {
-#if !defined(_WIN32)
-            // convert our log level into syslog level
-            int syslogLevel = LOG_INFO;
-            switch (level) {
-            case 1U:
-                syslogLevel = LOG_DEBUG;
-                break;
-            case 2U:
-                syslogLevel = LOG_NOTICE;
-                break;
-            case 3U:
-            case 9999U: // in-band U: messages should also be info level
-                syslogLevel = LOG_INFO;
-                break;
-            case 4U:
-                syslogLevel = LOG_WARNING;
-                break;
-            case 5U:
-                syslogLevel = LOG_ERR;
-                break;
-            default:
-                syslogLevel = LOG_EMERG;
-                break;
-            }
-
-            syslog(syslogLevel, "%s", buffer);
-#endif // !defined(_WIN32)
-        }
-    }
+#else
+    // fatal error (specially allow any log levels above 9999)
+    if (fatal) {
+        LogStopAsyncWriter();
 
-    if (!g_useSyslog && level >= g_logDisplayLevel && g_logDisplayLevel != 0U) {
-        ::fprintf(stdout, "%s" EOL, buffer);
-        ::fflush(stdout);
-    }
+        if (level >= m_fileLevel && m_fileLevel != 0U)
+            ::LogOpen();
+        LogWriteRecord(level, false, buffer);
+        LogFlush();
 
-    // fatal error (specially allow any log levels above 9999)
-    if (level >= 6U && level < 9999U) {
         if (m_fpLog != nullptr)
             ::fclose(m_fpLog);
 #if !defined(_WIN32)
@@ -317,4 +625,18 @@ void Log(uint32_t level, const char *module, const char* fmt, ...)
 #endif // !defined(_WIN32)
         exit(1);
     }
+
+    if (m_logWriterRunning) {
+        LogEnqueue(level, false, buffer);
+        return;
+    }
+
+    if (level >= m_fileLevel && m_fileLevel != 0U) {
+        if (!::LogOpen())
+            return;
+    }
+
+    LogWriteRecord(level, false, buffer);
+    LogFlush();
+#endif
 }
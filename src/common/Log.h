@@ -167,6 +167,19 @@ extern HOST_SW_API void* LogGetNetwork();
  */
 extern HOST_SW_API void LogSetNetwork(void* network);
 
+/**
+ * @brief Sets the handlers the log writer uses to write and flush activity log entries.
+ * @param write Function to write a formatted activity log entry.
+ * @param flush Function to flush the activity log.
+ */
+extern HOST_SW_API void LogSetActivitySink(void (*write)(const char*), void (*flush)());
+/**
+ * @brief Helper to format the current date and time for a log entry.
+ * @param[out] buffer Buffer to format the date and time into (at least 24 bytes).
+ * @returns uint32_t Length of the formatted date and time.
+ */
+extern HOST_SW_API uint32_t LogFormatTimestamp(char* buffer);
+
 /**
  * @brief Initializes the diagnostics log.
  * @param filePath File path for the log file.
@@ -178,10 +191,30 @@ extern HOST_SW_API void LogSetNetwork(void* network);
  * @returns 
  */
 extern HOST_SW_API bool LogInitialise(const std::string& filePath, const std::string& fileRoot, uint32_t fileLevel, uint32_t displayLevel, bool disableTimeDisplay = false, bool useSyslog = false);
+/**
+ * @brief Starts the asynchronous log writer.
+ * 
+ * Once started, log entries are formatted on the calling thread and queued to a bounded lock-free
+ * queue; a background writer thread batches the file, syslog, stdout and network diagnostics output.
+ * If the queue is full the entry is dropped (and the number of dropped entries is logged) rather than
+ * stalling the caller. This must be called after any process forking.
+ * @returns bool True, if the log writer was started, otherwise false.
+ */
+extern HOST_SW_API bool LogStartAsyncWriter();
+/**
+ * @brief Stops the asynchronous log writer, writing any queued log entries. Log entries are written
+ *  on the calling thread afterwards.
+ */
+extern HOST_SW_API void LogStopAsyncWriter();
 /**
  * @brief Finalizes the diagnostics log.
  */
 extern HOST_SW_API void LogFinalise();
+/**
+ * @brief Writes a formatted entry to the activity log.
+ * @param buffer Formatted activity log entry.
+ */
+extern HOST_SW_API void LogQueueActivity(const char* buffer);
 /**
  * @brief Writes a new entry to the diagnostics log.
  * @param level Log level for entry.
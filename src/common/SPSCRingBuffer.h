@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file SPSCRingBuffer.h
+ * @ingroup common
+ */
+#if !defined(__SPSC_RING_BUFFER_H__)
+#define __SPSC_RING_BUFFER_H__
+
+#include "common/Defines.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Wait-free single producer, single consumer circular buffer.
+ *
+ * Exactly one thread may add data and exactly one (other) thread may get data; neither side
+ * ever blocks, locks or allocates, which makes it suitable for passing audio to and from a
+ * real-time audio callback. Data that does not fit is dropped (and counted as an overrun) rather
+ * than clearing the buffer, as the producer cannot safely move the consumer position.
+ * @ingroup common
+ * @tparam T Type of data to store in SPSCRingBuffer.
+ */
+template<class T>
+class HOST_SW_API SPSCRingBuffer {
+public:
+    /**
+     * @brief Initializes a new instance of the SPSCRingBuffer class.
+     * @param length Length of ring buffer.
+     * @param name Name of buffer.
+     */
+    SPSCRingBuffer(uint32_t length, const char* name) :
+        m_length(length + 1U),
+        m_name(name),
+        m_buffer(nullptr),
+        m_iPtr(0U),
+        m_overruns(0U),
+        m_oPtr(0U),
+        m_underruns(0U),
+        m_streaming(false)
+    {
+        assert(length > 0U);
+
+        m_buffer = new T[m_length];
+        ::memset(m_buffer, 0x00, m_length * sizeof(T));
+    }
+
+    /**
+     * @brief Finalizes a instance of the SPSCRingBuffer class.
+     */
+    ~SPSCRingBuffer()
+    {
+        delete[] m_buffer;
+    }
+
+    /**
+     * @brief Adds data to the end of the ring buffer. (Producer only.)
+     * @param buffer Data buffer.
+     * @param length Length of data in buffer.
+     * @return bool True, if data is added to ring buffer, otherwise false.
+     */
+    bool addData(const T* buffer, uint32_t length)
+    {
+        uint32_t iPtr = m_iPtr.load(std::memory_order_relaxed);
+        uint32_t oPtr = m_oPtr.load(std::memory_order_acquire);
+        if (length > freeSpace(iPtr, oPtr)) {
+            m_overruns.fetch_add(1U, std::memory_order_relaxed);
+            return false;
+        }
+
+        uint32_t first = m_length - iPtr;
+        if (first > length)
+            first = length;
+
+        ::memcpy(m_buffer + iPtr, buffer, first * sizeof(T));
+        ::memcpy(m_buffer, buffer + first, (length - first) * sizeof(T));
+
+        iPtr += length;
+        if (iPtr >= m_length)
+            iPtr -= m_length;
+
+        m_iPtr.store(iPtr, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Gets data from the ring buffer. (Consumer only.)
+     *
+     *  A get that cannot be satisfied after a previous one was, counts as an underrun; gets made
+     *  while the buffer has been idle do not.
+     * @param buffer Buffer to write data to be retrieved.
+     * @param length Length of data to retrieve.
+     * @return bool True, if data is read from ring buffer, otherwise false.
+     */
+    bool get(T* buffer, uint32_t length)
+    {
+        uint32_t oPtr = m_oPtr.load(std::memory_order_relaxed);
+        uint32_t iPtr = m_iPtr.load(std::memory_order_acquire);
+        if (length > dataSize(iPtr, oPtr)) {
+            if (m_streaming) {
+                m_underruns.fetch_add(1U, std::memory_order_relaxed);
+                m_streaming = false;
+            }
+
+            return false;
+        }
+
+        uint32_t first = m_length - oPtr;
+        if (first > length)
+            first = length;
+
+        ::memcpy(buffer, m_buffer + oPtr, first * sizeof(T));
+        ::memcpy(buffer + first, m_buffer, (length - first) * sizeof(T));
+
+        oPtr += length;
+        if (oPtr >= m_length)
+            oPtr -= m_length;
+
+        m_oPtr.store(oPtr, std::memory_order_release);
+        m_streaming = true;
+        return true;
+    }
+
+    /**
+     * @brief Discards all data currently stored in the ring buffer. (Consumer only.)
+     */
+    void clear()
+    {
+        m_oPtr.store(m_iPtr.load(std::memory_order_acquire), std::memory_order_release);
+        m_streaming = false;
+    }
+
+    /**
+     * @brief Returns the currently available space in the ring buffer.
+     * @return uint32_t Space free in the ring buffer.
+     */
+    uint32_t freeSpace() const
+    {
+        return freeSpace(m_iPtr.load(std::memory_order_acquire), m_oPtr.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Returns the size of the data currently stored in the ring buffer.
+     * @return uint32_t Size of data stored in the ring buffer.
+     */
+    uint32_t dataSize() const
+    {
+        return dataSize(m_iPtr.load(std::memory_order_acquire), m_oPtr.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Gets the length of the ring buffer.
+     * @return uint32_t Length of ring buffer.
+     */
+    uint32_t length() const
+    {
+        return m_length - 1U;
+    }
+
+    /**
+     * @brief Gets the number of times data was dropped because the ring buffer was full.
+     * @return uint32_t Number of overruns.
+     */
+    uint32_t overruns() const
+    {
+        return m_overruns.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the number of times the ring buffer ran dry while data was being retrieved.
+     * @return uint32_t Number of underruns.
+     */
+    uint32_t underruns() const
+    {
+        return m_underruns.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the name of the ring buffer.
+     * @return const char* Name of ring buffer.
+     */
+    const char* name() const
+    {
+        return m_name;
+    }
+
+private:
+    uint32_t m_length;
+
+    const char* m_name;
+
+    T* m_buffer;
+
+    // producer side (the consumer side is padded onto its own cache line)
+    std::atomic<uint32_t> m_iPtr;
+    std::atomic<uint32_t> m_overruns;
+    uint8_t m_pad[64U - (2U * sizeof(std::atomic<uint32_t>))];
+
+    // consumer side
+    std::atomic<uint32_t> m_oPtr;
+    std::atomic<uint32_t> m_underruns;
+    bool m_streaming;
+
+    /**
+     * @brief Helper to calculate the space free between the given data pointers.
+     * @param iPtr Input (write) pointer.
+     * @param oPtr Output (read) pointer.
+     * @return uint32_t Space free in the ring buffer.
+     */
+    uint32_t freeSpace(uint32_t iPtr, uint32_t oPtr) const
+    {
+        return (m_length - 1U) - dataSize(iPtr, oPtr);
+    }
+
+    /**
+     * @brief Helper to calculate the size of the data between the given data pointers.
+     * @param iPtr Input (write) pointer.
+     * @param oPtr Output (read) pointer.
+     * @return uint32_t Size of data stored in the ring buffer.
+     */
+    uint32_t dataSize(uint32_t iPtr, uint32_t oPtr) const
+    {
+        return (iPtr >= oPtr) ? (iPtr - oPtr) : (m_length - (oPtr - iPtr));
+    }
+};
+
+#endif // __SPSC_RING_BUFFER_H__
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "TickScheduler.h"
+#include "Clock.h"
+
+using namespace system_clock;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the TickScheduler class. */
+
+TickScheduler::TickScheduler(JitterHistogram* jitter) :
+    m_jitter(jitter),
+    m_lastTickUS(0ULL),
+    m_deadlineUS(0ULL),
+    m_overruns(0ULL)
+{
+    start();
+}
+
+/* Starts (or restarts) the scheduler from the current time. */
+
+void TickScheduler::start()
+{
+    m_lastTickUS = mono::nowUS();
+    m_deadlineUS = m_lastTickUS;
+}
+
+/* Suspends the calling thread until the next tick is due. */
+
+uint32_t TickScheduler::wait(uint32_t periodMs)
+{
+    return (uint32_t)(waitUS(periodMs * 1000ULL) / 1000ULL);
+}
+
+/* Suspends the calling thread until the next tick is due. */
+
+uint64_t TickScheduler::waitUS(uint64_t periodUS)
+{
+    if (periodUS == 0ULL)
+        periodUS = 1000ULL;
+
+    m_deadlineUS += periodUS;
+
+    uint64_t now = mono::nowUS();
+    if (now >= m_deadlineUS + periodUS) {
+        // the loop overran by at least a whole period; rather than bursting to catch
+        // up on the missed ticks, resynchronize the schedule to the current time
+        m_overruns += (now - m_deadlineUS) / periodUS;
+        m_deadlineUS = now;
+    }
+    else {
+        mono::sleepUntilUS(m_deadlineUS);
+        now = mono::nowUS();
+    }
+
+    if (m_jitter != nullptr) {
+        m_jitter->record((now > m_deadlineUS) ? now - m_deadlineUS : 0ULL);
+    }
+
+    uint64_t elapsed = now - m_lastTickUS;
+    m_lastTickUS = now;
+    return elapsed;
+}
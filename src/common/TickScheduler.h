@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file TickScheduler.h
+ * @ingroup timers
+ * @file TickScheduler.cpp
+ * @ingroup timers
+ */
+#if !defined(__TICK_SCHEDULER_H__)
+#define __TICK_SCHEDULER_H__
+
+#include "common/Defines.h"
+#include "common/JitterHistogram.h"
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Paces a periodic thread loop against absolute monotonic clock deadlines.
+ * @ingroup timers
+ *
+ * Unlike sleeping a fixed amount of time after each pass of a loop, the deadline for the next tick is
+ * advanced by exactly one period from the previous deadline; the time spent processing inside the loop
+ * does not accumulate into the tick period, and wall clock adjustments have no effect.
+ */
+class HOST_SW_API TickScheduler {
+public:
+    /**
+     * @brief Initializes a new instance of the TickScheduler class.
+     * @param jitter Histogram to record wakeup lateness into (optional).
+     */
+    TickScheduler(JitterHistogram* jitter = nullptr);
+
+    /**
+     * @brief Starts (or restarts) the scheduler from the current time.
+     */
+    void start();
+
+    /**
+     * @brief Suspends the calling thread until the next tick is due.
+     * @param periodMs Tick period in milliseconds.
+     * @returns uint32_t Time in milliseconds since the previous tick.
+     */
+    uint32_t wait(uint32_t periodMs);
+    /**
+     * @brief Suspends the calling thread until the next tick is due.
+     * @param periodUS Tick period in microseconds.
+     * @returns uint64_t Time in microseconds since the previous tick.
+     */
+    uint64_t waitUS(uint64_t periodUS);
+
+    /**
+     * @brief Gets the number of ticks that were skipped because the loop overran its deadline.
+     * @returns uint64_t Number of skipped ticks.
+     */
+    uint64_t overruns() const { return m_overruns; }
+
+private:
+    JitterHistogram* m_jitter;
+
+    uint64_t m_lastTickUS;
+    uint64_t m_deadlineUS;
+    uint64_t m_overruns;
+};
+
+#endif // __TICK_SCHEDULER_H__
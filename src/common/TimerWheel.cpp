@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "TimerWheel.h"
+
+#include <cassert>
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the TimerWheel class. */
+
+TimerWheel::TimerWheel(uint32_t resolution, uint32_t slots) :
+    m_resolution(resolution),
+    m_slots(slots),
+    m_timers(),
+    m_now(0ULL),
+    m_tick(0ULL),
+    m_seq(0U)
+{
+    assert(resolution > 0U);
+    assert(slots > 0U);
+}
+
+/* Starts (or restarts) the timer for the given ID. */
+
+void TimerWheel::start(uint32_t id, uint32_t secs, uint32_t msecs)
+{
+    uint64_t timeout = (secs * 1000ULL) + msecs;
+    if (timeout == 0ULL || timeout > 0xFFFFFFFFULL) {
+        // like a Timer, a timer without a timeout never runs
+        stop(id);
+        return;
+    }
+
+    TimerEntry& entry = m_timers[id];
+    entry.timeout = (uint32_t)timeout;
+    schedule(id, entry);
+}
+
+/* Restarts the timer for the given ID with its current timeout. */
+
+bool TimerWheel::restart(uint32_t id)
+{
+    auto it = m_timers.find(id);
+    if (it == m_timers.end())
+        return false;
+
+    schedule(id, it->second);
+    return true;
+}
+
+/* Stops the timer for the given ID. */
+
+bool TimerWheel::stop(uint32_t id)
+{
+    // any wheel slot entry left for the timer is discarded when its slot is next visited
+    return m_timers.erase(id) > 0U;
+}
+
+/* Stops all timers. */
+
+void TimerWheel::clear()
+{
+    m_timers.clear();
+    for (auto& slot : m_slots)
+        slot.clear();
+}
+
+/* Gets the timeout for the timer for the given ID. */
+
+uint32_t TimerWheel::getTimeout(uint32_t id) const
+{
+    auto it = m_timers.find(id);
+    if (it == m_timers.end())
+        return 0U;
+
+    return it->second.timeout / 1000U;
+}
+
+/* Gets the current time for the timer for the given ID. */
+
+uint32_t TimerWheel::getTimer(uint32_t id) const
+{
+    auto it = m_timers.find(id);
+    if (it == m_timers.end())
+        return 0U;
+
+    return (uint32_t)((m_now - it->second.start) / 1000ULL);
+}
+
+/* Updates the wheel by the passed number of milliseconds. */
+
+void TimerWheel::clock(uint32_t ms, std::vector<uint32_t>& expired)
+{
+    m_now += ms;
+
+    uint64_t target = m_now / m_resolution;
+    while (m_tick < target) {
+        m_tick++;
+
+        std::vector<std::pair<uint32_t, uint32_t>>& slot = m_slots[m_tick % m_slots.size()];
+        size_t kept = 0U;
+        for (size_t i = 0U; i < slot.size(); i++) {
+            auto it = m_timers.find(slot[i].first);
+            if (it == m_timers.end() || it->second.seq != slot[i].second)
+                continue; // stopped or restarted timer
+
+            if (it->second.tick <= m_tick) {
+                expired.push_back(slot[i].first);
+                m_timers.erase(it);
+                continue;
+            }
+
+            // timer is due on a later turn of the wheel
+            slot[kept++] = slot[i];
+        }
+
+        slot.resize(kept);
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to place the timer in the wheel slot for its deadline. */
+
+void TimerWheel::schedule(uint32_t id, TimerEntry& entry)
+{
+    entry.start = m_now;
+    entry.tick = (m_now + entry.timeout + m_resolution - 1U) / m_resolution;
+    entry.seq = ++m_seq;
+
+    m_slots[entry.tick % m_slots.size()].push_back(std::make_pair(id, entry.seq));
+}
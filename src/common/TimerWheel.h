@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file TimerWheel.h
+ * @ingroup timers
+ * @file TimerWheel.cpp
+ * @ingroup timers
+ */
+#if !defined(__TIMER_WHEEL_H__)
+#define __TIMER_WHEEL_H__
+
+#include "common/Defines.h"
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements a hashed timer wheel that tracks a large number of timeouts keyed by a unique ID.
+ * @ingroup timers
+ *
+ * Unlike a collection of Timer instances, clocking the wheel does not touch every running timer; only
+ * the wheel slots whose tick has elapsed are visited. Restarting a timer does not search the wheel,
+ * the old wheel entry is left in place and discarded when its slot is next visited. A timer expires at
+ * the first wheel tick on or after its deadline, so expiry may be reported up to one tick late.
+ *
+ * This class is not thread-safe; thread safety must be implemented by the owner.
+ */
+class HOST_SW_API TimerWheel {
+public:
+    /**
+     * @brief Initializes a new instance of the TimerWheel class.
+     * @param resolution Duration of a single wheel tick in milliseconds.
+     * @param slots Number of slots in the wheel.
+     */
+    TimerWheel(uint32_t resolution = 1000U, uint32_t slots = 512U);
+
+    /**
+     * @brief Gets the number of running timers.
+     * @returns size_t Number of running timers.
+     */
+    size_t size() const { return m_timers.size(); }
+
+    /**
+     * @brief Starts (or restarts) the timer for the given ID.
+     * @param id Unique ID.
+     * @param secs Timeout in seconds.
+     * @param msecs Timeout in milliseconds.
+     */
+    void start(uint32_t id, uint32_t secs, uint32_t msecs = 0U);
+    /**
+     * @brief Restarts the timer for the given ID with its current timeout.
+     * @param id Unique ID.
+     * @returns bool True, if the timer was restarted, otherwise false.
+     */
+    bool restart(uint32_t id);
+    /**
+     * @brief Stops the timer for the given ID.
+     * @param id Unique ID.
+     * @returns bool True, if the timer was stopped, otherwise false.
+     */
+    bool stop(uint32_t id);
+    /**
+     * @brief Stops all timers.
+     */
+    void clear();
+
+    /**
+     * @brief Helper to determine if the timer for the given ID is running.
+     * @param id Unique ID.
+     * @returns bool True, if the timer is running, otherwise false.
+     */
+    bool isRunning(uint32_t id) const { return m_timers.find(id) != m_timers.end(); }
+    /**
+     * @brief Gets the timeout for the timer for the given ID.
+     * @param id Unique ID.
+     * @returns uint32_t Timeout in seconds.
+     */
+    uint32_t getTimeout(uint32_t id) const;
+    /**
+     * @brief Gets the current time for the timer for the given ID.
+     * @param id Unique ID.
+     * @returns uint32_t Time elapsed since the timer was started in seconds.
+     */
+    uint32_t getTimer(uint32_t id) const;
+
+    /**
+     * @brief Updates the wheel by the passed number of milliseconds.
+     * @param ms Number of milliseconds.
+     * @param[out] expired IDs of the timers that have expired; expired timers are stopped.
+     */
+    void clock(uint32_t ms, std::vector<uint32_t>& expired);
+
+private:
+    /**
+     * @brief Represents a running timer.
+     */
+    struct TimerEntry {
+        uint64_t start;
+        uint64_t tick;
+        uint32_t timeout;
+        uint32_t seq;
+    };
+
+    uint32_t m_resolution;
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> m_slots;
+
+    std::unordered_map<uint32_t, TimerEntry> m_timers;
+
+    uint64_t m_now;
+    uint64_t m_tick;
+    uint32_t m_seq;
+
+    /**
+     * @brief Helper to place the timer in the wheel slot for its deadline.
+     * @param id Unique ID.
+     * @param entry Timer.
+     */
+    void schedule(uint32_t id, TimerEntry& entry);
+};
+
+#endif // __TIMER_WHEEL_H__
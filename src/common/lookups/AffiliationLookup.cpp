@@ -20,11 +20,17 @@ using namespace lookups;
 
 const uint32_t UNIT_REG_TIMEOUT = 43200U; // 12 hours
 
+const uint32_t UNIT_REG_WHEEL_RESOLUTION = 1000U;
+const uint32_t UNIT_REG_WHEEL_SLOTS = 4096U;
+const uint32_t GRANT_WHEEL_RESOLUTION = 100U;
+const uint32_t GRANT_WHEEL_SLOTS = 512U;
+
 // ---------------------------------------------------------------------------
 //  Static Class Members
 // ---------------------------------------------------------------------------
 
 std::mutex AffiliationLookup::m_mutex;
+std::atomic<uint32_t> AffiliationLookup::m_grpAffVersion(0U);
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -35,14 +41,17 @@ std::mutex AffiliationLookup::m_mutex;
 AffiliationLookup::AffiliationLookup(const std::string name, ChannelLookup* channelLookup, bool verbose) :
     m_rfGrantChCnt(0U),
     m_unitRegTable(),
-    m_unitRegTimers(),
+    m_unitRegTimers(UNIT_REG_WHEEL_RESOLUTION, UNIT_REG_WHEEL_SLOTS),
     m_grpAffTable(),
+    m_grpAffMembers(),
     m_grantChTable(),
     m_grantSrcIdTable(),
     m_uuGrantedTable(),
     m_netGrantedTable(),
-    m_grantTimers(),
+    m_grantTimers(GRANT_WHEEL_RESOLUTION, GRANT_WHEEL_SLOTS),
     m_releaseGrant(nullptr),
+    m_unitDereg(nullptr),
+    m_groupAffChange(nullptr),
     m_name(),
     m_chLookup(channelLookup),
     m_disableUnitRegTimeout(false),
@@ -51,14 +60,6 @@ AffiliationLookup::AffiliationLookup(const std::string name, ChannelLookup* chan
     assert(channelLookup != nullptr);
 
     m_name = name;
-
-    m_unitRegTable.clear();
-    m_unitRegTimers.clear();
-    m_grpAffTable.clear();
-
-    m_grantChTable.clear();
-    m_grantSrcIdTable.clear();
-    m_grantTimers.clear();
 }
 
 /* Finalizes a instance of the AffiliationLookup class. */
@@ -73,10 +74,8 @@ void AffiliationLookup::unitReg(uint32_t srcId)
         return;
     }
 
-    m_unitRegTable.push_back(srcId);
-
-    m_unitRegTimers[srcId] = Timer(1000U, UNIT_REG_TIMEOUT);
-    m_unitRegTimers[srcId].start();
+    m_unitRegTable.insert(srcId);
+    m_unitRegTimers.start(srcId, UNIT_REG_TIMEOUT);
 
     if (m_verbose) {
         LogMessage(LOG_HOST, "%s, unit registration, srcId = %u",
@@ -88,8 +87,6 @@ void AffiliationLookup::unitReg(uint32_t srcId)
 
 bool AffiliationLookup::unitDereg(uint32_t srcId, bool automatic)
 {
-    bool ret = false;
-
     if (!isUnitReg(srcId)) {
         return false;
     }
@@ -101,22 +98,16 @@ bool AffiliationLookup::unitDereg(uint32_t srcId, bool automatic)
 
     groupUnaff(srcId);
 
-    m_unitRegTimers[srcId].stop();
+    m_unitRegTimers.stop(srcId);
 
     // remove dynamic unit registration table entry
-    if (std::find(m_unitRegTable.begin(), m_unitRegTable.end(), srcId) != m_unitRegTable.end()) {
-        auto it = std::find(m_unitRegTable.begin(), m_unitRegTable.end(), srcId);
-        m_unitRegTable.erase(it);
-        ret = true;
-    }
+    m_unitRegTable.erase(srcId);
 
-    if (ret) {
-        if (m_unitDereg != nullptr) {
-            m_unitDereg(srcId, automatic);
-        }
+    if (m_unitDereg != nullptr) {
+        m_unitDereg(srcId, automatic);
     }
 
-    return ret;
+    return true;
 }
 
 /* Helper to start the source ID registration timer. */
@@ -128,7 +119,7 @@ void AffiliationLookup::touchUnitReg(uint32_t srcId)
     }
 
     if (isUnitReg(srcId)) {
-        m_unitRegTimers[srcId].start();
+        m_unitRegTimers.start(srcId, UNIT_REG_TIMEOUT);
     }
 }
 
@@ -141,7 +132,7 @@ uint32_t AffiliationLookup::unitRegTimeout(uint32_t srcId)
     }
 
     if (isUnitReg(srcId)) {
-        return m_unitRegTimers[srcId].getTimeout();
+        return m_unitRegTimers.getTimeout(srcId);
     }
 
     return 0U;
@@ -156,7 +147,7 @@ uint32_t AffiliationLookup::unitRegTimer(uint32_t srcId)
     }
 
     if (isUnitReg(srcId)) {
-        return m_unitRegTimers[srcId].getTimer();
+        return m_unitRegTimers.getTimer(srcId);
     }
 
     return 0U;
@@ -167,21 +158,16 @@ uint32_t AffiliationLookup::unitRegTimer(uint32_t srcId)
 bool AffiliationLookup::isUnitReg(uint32_t srcId) const
 {
     // lookup dynamic unit registration table entry
-    if (std::find(m_unitRegTable.begin(), m_unitRegTable.end(), srcId) != m_unitRegTable.end()) {
-        return true;
-    }
-    else {
-        return false;
-    }
+    return m_unitRegTable.find(srcId) != m_unitRegTable.end();
 }
 
 /* Helper to release unit registrations. */
 
 void AffiliationLookup::clearUnitReg()
 {
-    std::vector<uint32_t> srcToRel = std::vector<uint32_t>();
     LogWarning(LOG_HOST, "%s, releasing all unit registrations", m_name.c_str());
     m_unitRegTable.clear();
+    m_unitRegTimers.clear();
 }
 
 /* Helper to group affiliate a source ID. */
@@ -189,8 +175,21 @@ void AffiliationLookup::clearUnitReg()
 void AffiliationLookup::groupAff(uint32_t srcId, uint32_t dstId)
 {
     if (!isGroupAff(srcId, dstId)) {
+        // remove the source ID from any talkgroup it was previously affiliated to
+        auto it = m_grpAffTable.find(srcId);
+        if (it != m_grpAffTable.end()) {
+            removeGrpAffMember(it->second, srcId);
+        }
+
         // update dynamic affiliation table
         m_grpAffTable[srcId] = dstId;
+        std::unordered_set<uint32_t>& members = m_grpAffMembers[dstId];
+        members.insert(srcId);
+        m_grpAffVersion++;
+
+        if (members.size() == 1U && m_groupAffChange != nullptr) {
+            m_groupAffChange(dstId, true);
+        }
 
         if (m_verbose) {
             LogMessage(LOG_HOST, "%s, group affiliation, srcId = %u, dstId = %u",
@@ -204,39 +203,41 @@ void AffiliationLookup::groupAff(uint32_t srcId, uint32_t dstId)
 bool AffiliationLookup::groupUnaff(uint32_t srcId)
 {
     // lookup dynamic affiliation table entry
-    if (m_grpAffTable.find(srcId) != m_grpAffTable.end()) {
-        uint32_t tblDstId = m_grpAffTable.at(srcId);
-        if (m_verbose) {
-            LogMessage(LOG_HOST, "%s, group unaffiliation, srcId = %u, dstId = %u",
-                m_name.c_str(), srcId, tblDstId);
-        }
-    } else {
+    auto it = m_grpAffTable.find(srcId);
+    if (it == m_grpAffTable.end()) {
         return false;
     }
 
-    // remove dynamic affiliation table entry
-    try {
-        uint32_t entry = m_grpAffTable.at(srcId); // this value will get discarded
-        (void)entry;                              // but some variants of C++ mark the unordered_map<>::at as nodiscard
-        m_grpAffTable.erase(srcId);
-        return true;
-    }
-    catch (...) {
-        return false;
+    uint32_t tblDstId = it->second;
+    if (m_verbose) {
+        LogMessage(LOG_HOST, "%s, group unaffiliation, srcId = %u, dstId = %u",
+            m_name.c_str(), srcId, tblDstId);
     }
+
+    // remove dynamic affiliation table entry
+    m_grpAffTable.erase(it);
+    removeGrpAffMember(tblDstId, srcId);
+    m_grpAffVersion++;
+    return true;
 }
 
 /* Helper to determine if the group destination ID has any affiations. */
 
 bool AffiliationLookup::hasGroupAff(uint32_t dstId) const
 {
-    for (auto entry : m_grpAffTable) {
-        if (entry.second == dstId) {
-            return true;
-        }
+    return m_grpAffMembers.find(dstId) != m_grpAffMembers.end();
+}
+
+/* Gets the count of source IDs affiliated to the group destination ID. */
+
+uint32_t AffiliationLookup::grpAffCount(uint32_t dstId) const
+{
+    auto it = m_grpAffMembers.find(dstId);
+    if (it == m_grpAffMembers.end()) {
+        return 0U;
     }
 
-    return false;
+    return (uint32_t)it->second.size();
 }
 
 /* Helper to determine if the source ID has affiliated to the group destination ID. */
@@ -244,14 +245,9 @@ bool AffiliationLookup::hasGroupAff(uint32_t dstId) const
 bool AffiliationLookup::isGroupAff(uint32_t srcId, uint32_t dstId) const
 {
     // lookup dynamic affiliation table entry
-    if (m_grpAffTable.find(srcId) != m_grpAffTable.end()) {
-        uint32_t tblDstId = m_grpAffTable.at(srcId);
-        if (tblDstId == dstId) {
-            return true;
-        }
-        else {
-            return false;
-        }
+    auto it = m_grpAffTable.find(srcId);
+    if (it != m_grpAffTable.end()) {
+        return it->second == dstId;
     }
 
     return false;
@@ -268,26 +264,40 @@ std::vector<uint32_t> AffiliationLookup::clearGroupAff(uint32_t dstId, bool rele
 
     if (dstId == 0U && releaseAll) {
         LogWarning(LOG_HOST, "%s, releasing all group affiliations", m_name.c_str());
+        srcToRel.reserve(m_grpAffTable.size());
         for (auto entry : m_grpAffTable) {
             uint32_t srcId = entry.first;
             srcToRel.push_back(srcId);
         }
+
+        m_grpAffTable.clear();
+        if (m_groupAffChange != nullptr) {
+            for (auto entry : m_grpAffMembers) {
+                m_groupAffChange(entry.first, false);
+            }
+        }
+        m_grpAffMembers.clear();
     }
     else {
         LogWarning(LOG_HOST, "%s, releasing group affiliations, dstId = %u", m_name.c_str(), dstId);
-        for (auto entry : m_grpAffTable) {
-            uint32_t srcId = entry.first;
-            uint32_t grpId = entry.second;
-            if (grpId == dstId) {
-                srcToRel.push_back(srcId);
+        auto it = m_grpAffMembers.find(dstId);
+        if (it != m_grpAffMembers.end()) {
+            srcToRel.assign(it->second.begin(), it->second.end());
+            m_grpAffMembers.erase(it);
+
+            if (m_groupAffChange != nullptr) {
+                m_groupAffChange(dstId, false);
             }
         }
-    }
 
-    for (auto srcId : srcToRel) {
-        m_grpAffTable.erase(srcId);
+        for (auto srcId : srcToRel) {
+            m_grpAffTable.erase(srcId);
+        }
     }
 
+    if (srcToRel.size() > 0U)
+        m_grpAffVersion++;
+
     return srcToRel;
 }
 
@@ -314,8 +324,7 @@ bool AffiliationLookup::grantCh(uint32_t dstId, uint32_t srcId, uint32_t grantTi
     m_uuGrantedTable[dstId] = !grp;
     m_netGrantedTable[dstId] = netGranted;
 
-    m_grantTimers[dstId] = Timer(1000U, grantTimeout);
-    m_grantTimers[dstId].start();
+    m_grantTimers.start(dstId, grantTimeout);
 
     if (m_verbose) {
         LogMessage(LOG_HOST, "%s, granting channel, chNo = %u, dstId = %u, srcId = %u, group = %u",
@@ -335,7 +344,7 @@ void AffiliationLookup::touchGrant(uint32_t dstId)
 
     std::lock_guard<std::mutex> lock(m_mutex);
     if (isGranted(dstId)) {
-        m_grantTimers[dstId].start();
+        m_grantTimers.restart(dstId);
     }
 }
 
@@ -395,7 +404,7 @@ bool AffiliationLookup::releaseGrant(uint32_t dstId, bool releaseAll, bool noLoc
             m_rfGrantChCnt = 0U;
         }
 
-        m_grantTimers[dstId].stop();
+        m_grantTimers.stop(dstId);
 
         if (!noLock)
             m_mutex.unlock();
@@ -547,16 +556,9 @@ void AffiliationLookup::clock(uint32_t ms)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    // clock all the grant timers
+    // clock the grant timers
     std::vector<uint32_t> gntsToRel = std::vector<uint32_t>();
-    for (auto entry : m_grantChTable) {
-        uint32_t dstId = entry.first;
-
-        m_grantTimers[dstId].clock(ms);
-        if (m_grantTimers[dstId].isRunning() && m_grantTimers[dstId].hasExpired()) {
-            gntsToRel.push_back(dstId);
-        }
-    }
+    m_grantTimers.clock(ms, gntsToRel);
 
     // release grants that have timed out
     for (uint32_t dstId : gntsToRel) {
@@ -564,14 +566,9 @@ void AffiliationLookup::clock(uint32_t ms)
     }
 
     if (!m_disableUnitRegTimeout) {
-        // clock all the unit registration timers
+        // clock the unit registration timers
         std::vector<uint32_t> unitsToDereg = std::vector<uint32_t>();
-        for (uint32_t srcId : m_unitRegTable) {
-            m_unitRegTimers[srcId].clock(ms);
-            if (m_unitRegTimers[srcId].isRunning() && m_unitRegTimers[srcId].hasExpired()) {
-                unitsToDereg.push_back(srcId);
-            }
-        }
+        m_unitRegTimers.clock(ms, unitsToDereg);
 
         // release units registrations that have timed out
         for (uint32_t srcId : unitsToDereg) {
@@ -579,3 +576,26 @@ void AffiliationLookup::clock(uint32_t ms)
         }
     }
 }
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to remove a source ID from the affiliated members of a group destination ID. */
+
+void AffiliationLookup::removeGrpAffMember(uint32_t dstId, uint32_t srcId)
+{
+    auto it = m_grpAffMembers.find(dstId);
+    if (it == m_grpAffMembers.end()) {
+        return;
+    }
+
+    it->second.erase(srcId);
+    if (it->second.empty()) {
+        m_grpAffMembers.erase(it);
+
+        if (m_groupAffChange != nullptr) {
+            m_groupAffChange(dstId, false);
+        }
+    }
+}
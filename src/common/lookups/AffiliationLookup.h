@@ -23,10 +23,13 @@
 #include "common/Defines.h"
 #include "common/lookups/ChannelLookup.h"
 #include "common/Timer.h"
+#include "common/TimerWheel.h"
 
 #include <cstdio>
 #include <unordered_map>
+#include <unordered_set>
 #include <algorithm>
+#include <atomic>
 #include <vector>
 #include <functional>
 #include <mutex>
@@ -66,7 +69,7 @@ namespace lookups
          * @brief Gets the unit registration table.
          * @returns std::vector<uint32> Unit Registration Table.
          */
-        std::vector<uint32_t> unitRegTable() const { return m_unitRegTable; }
+        std::vector<uint32_t> unitRegTable() const { return std::vector<uint32_t>(m_unitRegTable.begin(), m_unitRegTable.end()); }
         /**
          * @brief Helper to register a source ID.
          * @param srcId Source Radio ID.
@@ -119,6 +122,11 @@ namespace lookups
          * @returns std::unordered_map<uint32_t, uint32_t> Group Affiliation Table.
          */
         std::unordered_map<uint32_t, uint32_t> grpAffTable() const { return m_grpAffTable; }
+        /**
+         * @brief Gets a counter that is incremented every time any group affiliation table changes.
+         * @returns uint32_t Group affiliation version.
+         */
+        static uint32_t grpAffVersion() { return m_grpAffVersion; }
         /**
          * @brief Helper to group affiliate a source ID.
          * @param srcId Source Radio ID.
@@ -137,6 +145,12 @@ namespace lookups
          * @returns bool True, if talkgroup ID has affiliations, otherwise false.
          */
         virtual bool hasGroupAff(uint32_t dstId) const;
+        /**
+         * @brief Gets the count of source IDs affiliated to the group destination ID.
+         * @param dstId Talkgroup ID.
+         * @returns uint32_t Total count of source IDs affiliated to the talkgroup ID.
+         */
+        uint32_t grpAffCount(uint32_t dstId) const;
         /**
          * @brief Helper to determine if the source ID has affiliated to the group destination ID.
          * @param srcId Source Radio ID.
@@ -275,24 +289,34 @@ namespace lookups
          * @param callback Unit deregistration function callback.
          */
         void setUnitDeregCallback(std::function<void(uint32_t, bool)>&& callback) { m_unitDereg = callback; }
+        /**
+         * @brief Helper to set the group affiliation callback; the callback is called when a talkgroup gains
+         *  its first affiliation or loses its last affiliation.
+         * @param callback Group affiliation function callback.
+         */
+        void setGroupAffCallback(std::function<void(uint32_t, bool)>&& callback) { m_groupAffChange = callback; }
 
     protected:
         uint8_t m_rfGrantChCnt;
 
-        std::vector<uint32_t> m_unitRegTable;
-        std::unordered_map<uint32_t, Timer> m_unitRegTimers;
+        std::unordered_set<uint32_t> m_unitRegTable;
+        TimerWheel m_unitRegTimers;
         std::unordered_map<uint32_t, uint32_t> m_grpAffTable;
+        //                 dstId     srcIds
+        std::unordered_map<uint32_t, std::unordered_set<uint32_t>> m_grpAffMembers;
 
         std::unordered_map<uint32_t, uint32_t> m_grantChTable;
         std::unordered_map<uint32_t, uint32_t> m_grantSrcIdTable;
         std::unordered_map<uint32_t, bool> m_uuGrantedTable;
         std::unordered_map<uint32_t, bool> m_netGrantedTable;
-        std::unordered_map<uint32_t, Timer> m_grantTimers;
+        TimerWheel m_grantTimers;
 
         //                 chNo      dstId     slot
         std::function<void(uint32_t, uint32_t, uint8_t)> m_releaseGrant;
         //                 srcId     auto
         std::function<void(uint32_t, bool)> m_unitDereg;
+        //                 dstId     affiliated
+        std::function<void(uint32_t, bool)> m_groupAffChange;
 
         std::string m_name;
         ChannelLookup* m_chLookup;
@@ -302,6 +326,15 @@ namespace lookups
         bool m_verbose;
 
         static std::mutex m_mutex;
+        static std::atomic<uint32_t> m_grpAffVersion;
+
+    private:
+        /**
+         * @brief Helper to remove a source ID from the affiliated members of a group destination ID.
+         * @param dstId Talkgroup ID.
+         * @param srcId Source Radio ID.
+         */
+        void removeGrpAffMember(uint32_t dstId, uint32_t srcId);
     };
 } // namespace lookups
 
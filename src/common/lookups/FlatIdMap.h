@@ -0,0 +1,309 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file FlatIdMap.h
+ * @ingroup lookups
+ */
+#if !defined(__FLAT_ID_MAP_H__)
+#define __FLAT_ID_MAP_H__
+
+#include "common/Defines.h"
+
+#include <utility>
+#include <vector>
+
+namespace lookups
+{
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a open-addressing hash map keyed by a 32-bit unique ID.
+     *
+     * Entries are stored densely (in insertion order, until an entry is erased) in a single
+     * vector; a separate linear probed index of (ID, entry position) pairs is used to find an
+     * entry. Lookups never throw and never allocate, and iterating the map walks the dense entry
+     * vector. Erasing an entry moves the last entry into its place and uses backward shift
+     * deletion on the index, so the index never accumulates tombstones.
+     *
+     * This class is not thread-safe; thread safety must be implemented by the owner.
+     * @tparam T Type of the entries stored in the map.
+     * @ingroup lookups
+     */
+    template <class T>
+    class FlatIdMap {
+    public:
+        typedef std::pair<uint32_t, T> value_type;
+        typedef typename std::vector<value_type>::iterator iterator;
+        typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+        /**
+         * @brief Initializes a new instance of the FlatIdMap class.
+         */
+        FlatIdMap() :
+            m_entries(),
+            m_keys(),
+            m_index(),
+            m_mask(0U),
+            m_shift(64U)
+        {
+            /* stub */
+        }
+
+        /**
+         * @brief Gets the number of entries in the map.
+         * @returns size_t Number of entries.
+         */
+        size_t size() const { return m_entries.size(); }
+        /**
+         * @brief Helper to determine if the map is empty.
+         * @returns bool True, if the map contains no entries, otherwise false.
+         */
+        bool empty() const { return m_entries.empty(); }
+
+        /**
+         * @brief Removes all entries from the map.
+         */
+        void clear()
+        {
+            m_entries.clear();
+            m_keys.clear();
+            m_index.clear();
+            m_mask = 0U;
+            m_shift = 64U;
+        }
+
+        /**
+         * @brief Reserves space for the given number of entries.
+         * @param count Number of entries.
+         */
+        void reserve(size_t count)
+        {
+            m_entries.reserve(count);
+
+            size_t capacity = 16U;
+            while (capacity * 3U < count * 4U)
+                capacity <<= 1U;
+            if (capacity > m_index.size())
+                rehash(capacity);
+        }
+
+        /**
+         * @brief Exchanges the contents of this map with the given map.
+         * @param other Map to exchange contents with.
+         */
+        void swap(FlatIdMap& other)
+        {
+            m_entries.swap(other.m_entries);
+            m_keys.swap(other.m_keys);
+            m_index.swap(other.m_index);
+            std::swap(m_mask, other.m_mask);
+            std::swap(m_shift, other.m_shift);
+        }
+
+        /** @name Iterators */
+        iterator begin() { return m_entries.begin(); }
+        iterator end() { return m_entries.end(); }
+        const_iterator begin() const { return m_entries.begin(); }
+        const_iterator end() const { return m_entries.end(); }
+        /** @} */
+
+        /**
+         * @brief Finds the entry for the given unique ID.
+         * @param id Unique ID.
+         * @returns T* Entry, or nullptr if the map has no entry for the unique ID.
+         */
+        T* get(uint32_t id)
+        {
+            size_t pos = position(id);
+            return (pos != NO_ENTRY) ? &m_entries[pos].second : nullptr;
+        }
+        /**
+         * @brief Finds the entry for the given unique ID.
+         * @param id Unique ID.
+         * @returns const T* Entry, or nullptr if the map has no entry for the unique ID.
+         */
+        const T* get(uint32_t id) const
+        {
+            size_t pos = position(id);
+            return (pos != NO_ENTRY) ? &m_entries[pos].second : nullptr;
+        }
+
+        /**
+         * @brief Finds the entry for the given unique ID.
+         * @param id Unique ID.
+         * @returns iterator Iterator to the entry, or end() if the map has no entry for the unique ID.
+         */
+        iterator find(uint32_t id)
+        {
+            size_t pos = position(id);
+            return (pos != NO_ENTRY) ? m_entries.begin() + pos : m_entries.end();
+        }
+        /**
+         * @brief Finds the entry for the given unique ID.
+         * @param id Unique ID.
+         * @returns const_iterator Iterator to the entry, or end() if the map has no entry for the unique ID.
+         */
+        const_iterator find(uint32_t id) const
+        {
+            size_t pos = position(id);
+            return (pos != NO_ENTRY) ? m_entries.begin() + pos : m_entries.end();
+        }
+
+        /**
+         * @brief Helper to determine if the map has an entry for the given unique ID.
+         * @param id Unique ID.
+         * @returns bool True, if the map has an entry for the unique ID, otherwise false.
+         */
+        bool contains(uint32_t id) const { return position(id) != NO_ENTRY; }
+
+        /**
+         * @brief Gets the entry for the given unique ID, adding a default entry if the map has no
+         *  entry for the unique ID.
+         * @param id Unique ID.
+         * @returns T& Entry.
+         */
+        T& operator[](uint32_t id)
+        {
+            if ((m_entries.size() + 1U) * 4U > m_index.size() * 3U)
+                rehash((m_index.size() == 0U) ? 16U : m_index.size() << 1U);
+
+            size_t slot = home(id);
+            while (m_index[slot] != 0U) {
+                if (m_keys[slot] == id)
+                    return m_entries[m_index[slot] - 1U].second;
+                slot = (slot + 1U) & m_mask;
+            }
+
+            m_entries.push_back(value_type(id, T()));
+            m_keys[slot] = id;
+            m_index[slot] = (uint32_t)m_entries.size();
+            return m_entries.back().second;
+        }
+
+        /**
+         * @brief Erases the entry for the given unique ID.
+         * @param id Unique ID.
+         * @returns size_t Number of entries erased.
+         */
+        size_t erase(uint32_t id)
+        {
+            size_t slot = this->slot(id);
+            if (slot == NO_ENTRY)
+                return 0U;
+
+            // move the last entry into the place of the erased entry
+            size_t pos = m_index[slot] - 1U;
+            size_t last = m_entries.size() - 1U;
+            if (pos != last) {
+                m_entries[pos] = m_entries[last];
+                m_index[this->slot(m_entries[pos].first)] = (uint32_t)(pos + 1U);
+            }
+            m_entries.pop_back();
+
+            // backward shift the following index slots that probed past the erased slot
+            size_t next = slot;
+            while (true) {
+                next = (next + 1U) & m_mask;
+                if (m_index[next] == 0U)
+                    break;
+
+                size_t ideal = home(m_keys[next]);
+                bool between = (slot <= next) ? (slot < ideal && ideal <= next) : (slot < ideal || ideal <= next);
+                if (between)
+                    continue;
+
+                m_keys[slot] = m_keys[next];
+                m_index[slot] = m_index[next];
+                slot = next;
+            }
+
+            m_index[slot] = 0U;
+            return 1U;
+        }
+
+    private:
+        static const size_t NO_ENTRY = (size_t)-1;
+
+        std::vector<value_type> m_entries;
+        std::vector<uint32_t> m_keys;
+        std::vector<uint32_t> m_index;      // entry position + 1; 0 is a empty slot
+        size_t m_mask;
+        uint32_t m_shift;
+
+        /**
+         * @brief Helper to get the home index slot of a unique ID (fibonacci hashing).
+         * @param id Unique ID.
+         * @returns size_t Index slot.
+         */
+        size_t home(uint32_t id) const { return (size_t)(((uint64_t)id * 0x9E3779B97F4A7C15ULL) >> m_shift); }
+
+        /**
+         * @brief Helper to find the index slot for the given unique ID.
+         * @param id Unique ID.
+         * @returns size_t Index slot, or NO_ENTRY if the map has no entry for the unique ID.
+         */
+        size_t slot(uint32_t id) const
+        {
+            if (m_index.size() == 0U)
+                return NO_ENTRY;
+
+            size_t slot = home(id);
+            while (m_index[slot] != 0U) {
+                if (m_keys[slot] == id)
+                    return slot;
+                slot = (slot + 1U) & m_mask;
+            }
+
+            return NO_ENTRY;
+        }
+
+        /**
+         * @brief Helper to find the entry position for the given unique ID.
+         * @param id Unique ID.
+         * @returns size_t Entry position, or NO_ENTRY if the map has no entry for the unique ID.
+         */
+        size_t position(uint32_t id) const
+        {
+            size_t slot = this->slot(id);
+            return (slot != NO_ENTRY) ? m_index[slot] - 1U : NO_ENTRY;
+        }
+
+        /**
+         * @brief Helper to rebuild the index with the given capacity.
+         * @param capacity Number of index slots (must be a power of 2).
+         */
+        void rehash(size_t capacity)
+        {
+            m_keys.assign(capacity, 0U);
+            m_index.assign(capacity, 0U);
+            m_mask = capacity - 1U;
+
+            m_shift = 64U;
+            for (size_t i = capacity; i > 1U; i >>= 1U)
+                m_shift--;
+
+            for (size_t i = 0U; i < m_entries.size(); i++) {
+                size_t slot = home(m_entries[i].first);
+                while (m_index[slot] != 0U)
+                    slot = (slot + 1U) & m_mask;
+
+                m_keys[slot] = m_entries[i].first;
+                m_index[slot] = (uint32_t)(i + 1U);
+            }
+        }
+    };
+
+    template <class T>
+    const size_t FlatIdMap<T>::NO_ENTRY;
+} // namespace lookups
+
+#endif // __FLAT_ID_MAP_H__
@@ -50,10 +50,9 @@ IdenTable IdenTableLookup::find(uint32_t id)
     IdenTable entry;
 
     std::lock_guard<std::mutex> lock(m_mutex);
-    try {
-        entry = m_table.at(id);
-    } catch (...) {
-        /* stub */
+    const IdenTable* _entry = m_table.get(id);
+    if (_entry != nullptr) {
+        entry = *_entry;
     }
 
     float chBandwidthKhz = entry.chBandwidthKhz();
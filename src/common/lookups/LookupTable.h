@@ -22,11 +22,13 @@
 #include "common/Defines.h"
 #include "common/Thread.h"
 #include "common/Timer.h"
+#include "common/lookups/FlatIdMap.h"
 
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <cctype>
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 
@@ -55,7 +57,8 @@ namespace lookups
             m_filename(filename),
             m_reloadTime(reloadTime),
             m_table(),
-            m_stop(false)
+            m_stop(false),
+            m_version(0U)
         {
             /* stub */
         }
@@ -96,6 +99,10 @@ namespace lookups
                 return;
             }
 
+            // the reload thread has already been stopped
+            if (m_stop)
+                return;
+
             m_stop = true;
 
             wait();
@@ -142,16 +149,7 @@ namespace lookups
          */
         virtual bool hasEntry(uint32_t id)
         {
-            try {
-                T entry = m_table.at(id); // this value will get discarded
-                (void)entry;              // but some variants of C++ mark the unordered_map<>::at as nodiscard
-                return true;
-            }
-            catch (...) {
-                return false;
-            }
-
-            return false;
+            return m_table.contains(id);
         }
 
         /**
@@ -163,9 +161,15 @@ namespace lookups
 
         /**
          * @brief Helper to return the lookup table.
-         * @returns std::unordered_map<uint32_t, T> Table.
+         * @returns FlatIdMap<T> Table.
+         */
+        virtual FlatIdMap<T> table() { return m_table; }
+
+        /**
+         * @brief Returns a counter that is incremented every time the lookup table changes.
+         * @return uint32_t Lookup table version.
          */
-        virtual std::unordered_map<uint32_t, T> table() { return m_table; }
+        uint32_t version() const { return m_version; }
 
         /**
          * @brief Returns the filename used to load this lookup table.
@@ -181,8 +185,9 @@ namespace lookups
     protected:
         std::string m_filename;
         uint32_t m_reloadTime;
-        std::unordered_map<uint32_t, T> m_table;
+        FlatIdMap<T> m_table;
         bool m_stop;
+        std::atomic<uint32_t> m_version;
 
         /**
          * @brief Loads the table from the passed lookup table file.
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "lookups/MappedCSVFile.h"
+
+using namespace lookups;
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // !defined(_WIN32)
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint32_t MappedCSVFile::MAX_FIELDS;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to convert the field to a integer (with the same semantics as ::atoi()). */
+
+int CSVField::toInt() const
+{
+    size_t i = 0U;
+    while (i < length && (data[i] == ' ' || data[i] == '\t'))
+        i++;
+
+    bool negative = false;
+    if (i < length && (data[i] == '-' || data[i] == '+')) {
+        negative = data[i] == '-';
+        i++;
+    }
+
+    int value = 0;
+    while (i < length && data[i] >= '0' && data[i] <= '9') {
+        value = (value * 10) + (data[i] - '0');
+        i++;
+    }
+
+    return negative ? -value : value;
+}
+
+/* Initializes a new instance of the MappedCSVFile class. */
+
+MappedCSVFile::MappedCSVFile() :
+    m_data(nullptr),
+    m_size(0U),
+    m_modified(0U),
+    m_mapped(false)
+{
+    /* stub */
+}
+
+/* Finalizes a instance of the MappedCSVFile class. */
+
+MappedCSVFile::~MappedCSVFile()
+{
+    close();
+}
+
+/* Opens and maps the given file. */
+
+bool MappedCSVFile::open(const std::string& filename)
+{
+    close();
+
+    struct stat st;
+    if (::stat(filename.c_str(), &st) != 0)
+        return false;
+
+    m_size = (size_t)st.st_size;
+#if defined(_WIN32)
+    m_modified = (uint64_t)st.st_mtime * 1000000000ULL;
+#elif defined(__APPLE__)
+    m_modified = ((uint64_t)st.st_mtimespec.tv_sec * 1000000000ULL) + (uint64_t)st.st_mtimespec.tv_nsec;
+#else
+    m_modified = ((uint64_t)st.st_mtim.tv_sec * 1000000000ULL) + (uint64_t)st.st_mtim.tv_nsec;
+#endif // defined(_WIN32)
+
+    // empty files cannot be mapped
+    if (m_size == 0U)
+        return true;
+
+#if !defined(_WIN32)
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data != MAP_FAILED) {
+        ::madvise(data, m_size, MADV_SEQUENTIAL);
+
+        m_data = (const char*)data;
+        m_mapped = true;
+        return true;
+    }
+#endif // !defined(_WIN32)
+
+    // fallback to reading the entire file into memory
+    FILE* fp = ::fopen(filename.c_str(), "rb");
+    if (fp == nullptr)
+        return false;
+
+    char* buffer = (char*)::malloc(m_size);
+    if (buffer == nullptr) {
+        ::fclose(fp);
+        return false;
+    }
+
+    m_size = ::fread(buffer, 1U, m_size, fp);
+    ::fclose(fp);
+
+    m_data = buffer;
+    m_mapped = false;
+    return true;
+}
+
+/* Closes and unmaps the file. */
+
+void MappedCSVFile::close()
+{
+    if (m_data != nullptr) {
+#if !defined(_WIN32)
+        if (m_mapped)
+            ::munmap((void*)m_data, m_size);
+        else
+#endif // !defined(_WIN32)
+            ::free((void*)m_data);
+    }
+
+    m_data = nullptr;
+    m_size = 0U;
+    m_mapped = false;
+}
+
+/* Helper to count the number of lines in the file. */
+
+size_t MappedCSVFile::lineCount() const
+{
+    if (m_data == nullptr)
+        return 0U;
+
+    size_t count = 0U;
+    const char* pos = m_data;
+    const char* end = m_data + m_size;
+    while (pos < end) {
+        const char* eol = (const char*)::memchr(pos, '\n', end - pos);
+        count++;
+        if (eol == nullptr)
+            break;
+        pos = eol + 1;
+    }
+
+    return count;
+}
+
+/* Helper to split the file into chunks of whole lines. */
+
+std::vector<CSVChunk> MappedCSVFile::chunks(uint32_t count) const
+{
+    std::vector<CSVChunk> chunks;
+    if (m_data == nullptr || count == 0U)
+        return chunks;
+
+    const char* pos = m_data;
+    const char* end = m_data + m_size;
+    size_t chunkSize = (m_size / count) + 1U;
+    while (pos < end) {
+        const char* chunkEnd = pos + chunkSize;
+        if (chunkEnd >= end) {
+            chunkEnd = end;
+        }
+        else {
+            // extend the chunk to the end of the line
+            const char* eol = (const char*)::memchr(chunkEnd, '\n', end - chunkEnd);
+            chunkEnd = (eol != nullptr) ? eol + 1 : end;
+        }
+
+        chunks.push_back(CSVChunk { pos, chunkEnd });
+        pos = chunkEnd;
+    }
+
+    return chunks;
+}
+
+/* Helper to get the next line from the given position. */
+
+bool MappedCSVFile::nextLine(const char*& pos, const char* end, const char*& line, size_t& length)
+{
+    if (pos >= end)
+        return false;
+
+    line = pos;
+    const char* eol = (const char*)::memchr(pos, '\n', end - pos);
+    if (eol == nullptr) {
+        length = end - pos;
+        pos = end;
+    }
+    else {
+        length = eol - pos;
+        pos = eol + 1;
+    }
+
+    // strip the carriage return of CRLF line endings
+    if (length > 0U && line[length - 1U] == '\r')
+        length--;
+
+    return true;
+}
+
+/* Helper to split a line into fields. */
+
+uint32_t MappedCSVFile::split(const char* line, size_t length, CSVField* fields, bool skipEmpty, char delim)
+{
+    uint32_t count = 0U;
+    const char* start = line;
+    const char* end = line + length;
+    for (const char* pos = line; pos < end && count < MAX_FIELDS; pos++) {
+        if (*pos == delim) {
+            if (!skipEmpty || pos != start) {
+                fields[count++] = CSVField { start, (size_t)(pos - start) };
+            }
+            start = pos + 1;
+        }
+    }
+
+    if (start < end && count < MAX_FIELDS) {
+        fields[count++] = CSVField { start, (size_t)(end - start) };
+    }
+
+    return count;
+}
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file MappedCSVFile.h
+ * @ingroup lookups
+ * @file MappedCSVFile.cpp
+ * @ingroup lookups
+ */
+#if !defined(__MAPPED_CSV_FILE_H__)
+#define __MAPPED_CSV_FILE_H__
+
+#include "common/Defines.h"
+
+#include <string>
+#include <vector>
+
+namespace lookups
+{
+    // ---------------------------------------------------------------------------
+    //  Structure Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Represents a single field of a line in a CSV file; the field points directly
+     *  into the file contents and is not NUL terminated.
+     * @ingroup lookups
+     */
+    struct CSVField {
+        const char* data;                   //! Field Data
+        size_t length;                      //! Field Length
+
+        /**
+         * @brief Helper to determine if the field is empty.
+         * @returns bool True, if the field is empty, otherwise false.
+         */
+        bool empty() const { return length == 0U; }
+        /**
+         * @brief Helper to convert the field to a string.
+         * @returns std::string Field as a string.
+         */
+        std::string str() const { return std::string(data, length); }
+        /**
+         * @brief Helper to convert the field to a integer (with the same semantics as ::atoi()).
+         * @returns int Field as a integer.
+         */
+        int toInt() const;
+    };
+
+    /**
+     * @brief Represents a range of whole lines in a CSV file.
+     * @ingroup lookups
+     */
+    struct CSVChunk {
+        const char* begin;                  //! First Byte of the Chunk
+        const char* end;                    //! Byte after the last Byte of the Chunk
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a read-only, memory mapped, CSV file reader.
+     *
+     * The file is mapped into memory (or read into memory with a single read on platforms without
+     * mmap()) and lines and fields are returned as pointers into the file contents, avoiding any copies
+     * or temporary strings while parsing.
+     * @ingroup lookups
+     */
+    class HOST_SW_API MappedCSVFile {
+    public:
+        static const uint32_t MAX_FIELDS = 16U;
+
+        /**
+         * @brief Initializes a new instance of the MappedCSVFile class.
+         */
+        MappedCSVFile();
+        /**
+         * @brief Finalizes a instance of the MappedCSVFile class.
+         */
+        ~MappedCSVFile();
+
+        /**
+         * @brief Opens and maps the given file.
+         * @param filename Full-path to the file.
+         * @returns bool True, if the file was opened, otherwise false.
+         */
+        bool open(const std::string& filename);
+        /**
+         * @brief Closes and unmaps the file.
+         */
+        void close();
+
+        /**
+         * @brief Gets the contents of the file.
+         * @returns const char* File contents.
+         */
+        const char* data() const { return m_data; }
+        /**
+         * @brief Gets the size of the file.
+         * @returns size_t Size of the file.
+         */
+        size_t size() const { return m_size; }
+        /**
+         * @brief Gets the last modified time of the file (in nanoseconds since the epoch).
+         * @returns uint64_t Last modified time.
+         */
+        uint64_t modified() const { return m_modified; }
+
+        /**
+         * @brief Helper to count the number of lines in the file.
+         * @returns size_t Number of lines.
+         */
+        size_t lineCount() const;
+
+        /**
+         * @brief Helper to split the file into chunks of whole lines.
+         * @param count Number of chunks.
+         * @returns std::vector<CSVChunk> Chunks (may be less then the requested number of chunks for small files).
+         */
+        std::vector<CSVChunk> chunks(uint32_t count) const;
+
+        /**
+         * @brief Helper to get the next line from the given position.
+         * @param[in,out] pos Current position; updated to the start of the following line.
+         * @param end End of the range being read.
+         * @param[out] line Start of the line.
+         * @param[out] length Length of the line (excluding any line terminator).
+         * @returns bool True, if a line was read, otherwise false.
+         */
+        static bool nextLine(const char*& pos, const char* end, const char*& line, size_t& length);
+        /**
+         * @brief Helper to split a line into fields.
+         * @param line Start of the line.
+         * @param length Length of the line.
+         * @param[out] fields Fields (at most MAX_FIELDS).
+         * @param skipEmpty Flag indicating empty fields should be skipped (and not returned).
+         * @param delim Field delimiter.
+         * @returns uint32_t Number of fields.
+         */
+        static uint32_t split(const char* line, size_t length, CSVField* fields, bool skipEmpty, char delim = ',');
+
+    private:
+        const char* m_data;
+        size_t m_size;
+        uint64_t m_modified;
+        bool m_mapped;
+    };
+} // namespace lookups
+
+#endif // __MAPPED_CSV_FILE_H__
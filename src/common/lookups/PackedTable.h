@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file PackedTable.h
+ * @ingroup lookups
+ */
+#if !defined(__PACKED_TABLE_H__)
+#define __PACKED_TABLE_H__
+
+#include "common/Defines.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace lookups
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @addtogroup lookups
+     * @{
+     */
+
+    const uint32_t PACKED_TABLE_MAGIC_LEN = 4U;
+    const uint8_t PACKED_TABLE_VERSION = 0x01U;     //! Format version; carried as the last byte of the table magic.
+
+    const uint8_t PACKED_TABLE_RID_MAGIC[PACKED_TABLE_MAGIC_LEN] = { 'R', 'I', 'D', PACKED_TABLE_VERSION };
+    const uint8_t PACKED_TABLE_PID_MAGIC[PACKED_TABLE_MAGIC_LEN] = { 'P', 'I', 'D', PACKED_TABLE_VERSION };
+    const uint8_t PACKED_TABLE_TGR_MAGIC[PACKED_TABLE_MAGIC_LEN] = { 'T', 'G', 'R', PACKED_TABLE_VERSION };
+    /** @} */
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a writer for the compact binary representation of a lookup table, used to
+     *  transfer lookup tables between FNEs without an intermediate text file.
+     *
+     * All values are written in network byte order; strings are written as a 16-bit length followed
+     * by the string bytes. Peers that cannot decode this form (they advertise support with the "packedTables"
+     * flag in their configuration) are sent the contents of the lookup table file instead.
+     * @ingroup lookups
+     */
+    class HOST_SW_API PackedTableWriter {
+    public:
+        /**
+         * @brief Initializes a new instance of the PackedTableWriter class.
+         * @param buffer Buffer to write to.
+         */
+        PackedTableWriter(std::vector<uint8_t>& buffer) :
+            m_buffer(buffer)
+        {
+            /* stub */
+        }
+
+        /**
+         * @brief Writes the table magic.
+         * @param magic Table magic.
+         */
+        void writeMagic(const uint8_t* magic) { m_buffer.insert(m_buffer.end(), magic, magic + PACKED_TABLE_MAGIC_LEN); }
+        /**
+         * @brief Writes a 8-bit value.
+         * @param value Value.
+         */
+        void writeUInt8(uint8_t value) { m_buffer.push_back(value); }
+        /**
+         * @brief Writes a 16-bit value.
+         * @param value Value.
+         */
+        void writeUInt16(uint16_t value)
+        {
+            m_buffer.push_back((uint8_t)(value >> 8));
+            m_buffer.push_back((uint8_t)(value >> 0));
+        }
+        /**
+         * @brief Writes a 32-bit value.
+         * @param value Value.
+         */
+        void writeUInt32(uint32_t value)
+        {
+            m_buffer.push_back((uint8_t)(value >> 24));
+            m_buffer.push_back((uint8_t)(value >> 16));
+            m_buffer.push_back((uint8_t)(value >> 8));
+            m_buffer.push_back((uint8_t)(value >> 0));
+        }
+        /**
+         * @brief Writes a string (truncated to 65535 bytes).
+         * @param value Value.
+         */
+        void writeString(const std::string& value)
+        {
+            uint16_t len = (value.length() > 0xFFFFU) ? 0xFFFFU : (uint16_t)value.length();
+            writeUInt16(len);
+            m_buffer.insert(m_buffer.end(), value.begin(), value.begin() + len);
+        }
+        /**
+         * @brief Writes a list of 32-bit values.
+         * @param values Values.
+         */
+        void writeList(const std::vector<uint32_t>& values)
+        {
+            writeUInt32((uint32_t)values.size());
+            for (uint32_t value : values)
+                writeUInt32(value);
+        }
+
+    private:
+        std::vector<uint8_t>& m_buffer;
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements a reader for the compact binary representation of a lookup table.
+     *
+     * Every read is bounds checked; once a read runs past the end of the buffer the reader is
+     * flagged as failed and all following reads return zero values.
+     * @ingroup lookups
+     */
+    class HOST_SW_API PackedTableReader {
+    public:
+        /**
+         * @brief Initializes a new instance of the PackedTableReader class.
+         * @param data Buffer to read from.
+         * @param length Length of the buffer.
+         */
+        PackedTableReader(const uint8_t* data, uint32_t length) :
+            m_data(data),
+            m_length(length),
+            m_offset(0U),
+            m_failed(false)
+        {
+            /* stub */
+        }
+
+        /**
+         * @brief Helper to determine if the buffer starts with the given table magic.
+         * @param data Buffer.
+         * @param length Length of the buffer.
+         * @param magic Table magic.
+         * @returns bool True, if the buffer starts with the table magic, otherwise false.
+         */
+        static bool hasMagic(const uint8_t* data, uint32_t length, const uint8_t* magic)
+        {
+            return data != nullptr && length >= PACKED_TABLE_MAGIC_LEN && ::memcmp(data, magic, PACKED_TABLE_MAGIC_LEN) == 0;
+        }
+
+        /**
+         * @brief Reads and checks the table magic.
+         * @param magic Table magic.
+         * @returns bool True, if the table magic matched, otherwise false.
+         */
+        bool readMagic(const uint8_t* magic)
+        {
+            if (!check(PACKED_TABLE_MAGIC_LEN))
+                return false;
+
+            bool ret = ::memcmp(m_data + m_offset, magic, PACKED_TABLE_MAGIC_LEN) == 0;
+            m_offset += PACKED_TABLE_MAGIC_LEN;
+            return ret;
+        }
+        /**
+         * @brief Reads a 8-bit value.
+         * @returns uint8_t Value.
+         */
+        uint8_t readUInt8()
+        {
+            if (!check(1U))
+                return 0U;
+            return m_data[m_offset++];
+        }
+        /**
+         * @brief Reads a 16-bit value.
+         * @returns uint16_t Value.
+         */
+        uint16_t readUInt16()
+        {
+            if (!check(2U))
+                return 0U;
+
+            uint16_t value = (uint16_t)((m_data[m_offset] << 8) | m_data[m_offset + 1U]);
+            m_offset += 2U;
+            return value;
+        }
+        /**
+         * @brief Reads a 32-bit value.
+         * @returns uint32_t Value.
+         */
+        uint32_t readUInt32()
+        {
+            if (!check(4U))
+                return 0U;
+
+            uint32_t value = ((uint32_t)m_data[m_offset] << 24) | ((uint32_t)m_data[m_offset + 1U] << 16) |
+                ((uint32_t)m_data[m_offset + 2U] << 8) | (uint32_t)m_data[m_offset + 3U];
+            m_offset += 4U;
+            return value;
+        }
+        /**
+         * @brief Reads a string.
+         * @returns std::string Value.
+         */
+        std::string readString()
+        {
+            uint16_t len = readUInt16();
+            if (!check(len))
+                return std::string();
+
+            std::string value((const char*)m_data + m_offset, len);
+            m_offset += len;
+            return value;
+        }
+        /**
+         * @brief Reads an entry count, and checks the remaining buffer can hold that many entries.
+         * @param entryLen Minimum length of an entry.
+         * @returns uint32_t Number of entries, or zero if the count cannot be valid (the reader is flagged as failed).
+         */
+        uint32_t readCount(size_t entryLen)
+        {
+            uint32_t count = readUInt32();
+            if (!check((size_t)count * entryLen))
+                return 0U;
+            return count;
+        }
+        /**
+         * @brief Reads a list of 32-bit values.
+         * @returns std::vector<uint32_t> Values.
+         */
+        std::vector<uint32_t> readList()
+        {
+            std::vector<uint32_t> values;
+
+            uint32_t count = readCount(4U);
+            if (m_failed)
+                return values;
+
+            values.reserve(count);
+            for (uint32_t i = 0U; i < count; i++)
+                values.push_back(readUInt32());
+            return values;
+        }
+
+        /**
+         * @brief Helper to determine if a read ran past the end of the buffer.
+         * @returns bool True, if a read failed, otherwise false.
+         */
+        bool failed() const { return m_failed; }
+        /**
+         * @brief Gets the number of bytes remaining in the buffer.
+         * @returns size_t Number of bytes remaining.
+         */
+        size_t remaining() const { return m_length - m_offset; }
+
+    private:
+        const uint8_t* m_data;
+        size_t m_length;
+        size_t m_offset;
+        bool m_failed;
+
+        /**
+         * @brief Helper to check the given number of bytes can be read.
+         * @param len Number of bytes.
+         * @returns bool True, if the bytes can be read, otherwise false.
+         */
+        bool check(size_t len)
+        {
+            if (m_failed || len > m_length - m_offset) {
+                m_failed = true;
+                return false;
+            }
+
+            return true;
+        }
+    };
+} // namespace lookups
+
+#endif // __PACKED_TABLE_H__
@@ -11,18 +11,69 @@
  *
  */
 #include "PeerListLookup.h"
+#include "MappedCSVFile.h"
+#include "PackedTable.h"
 #include "Log.h"
 
 using namespace lookups;
 
+#include <cstdio>
 #include <fstream>
 #include <algorithm>
 
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to parse the contents of a peer ID lookup file. */
+
+static void parseBuffer(const char* data, size_t size, FlatIdMap<PeerId>& table)
+{
+    const char* pos = data;
+    const char* end = data + size;
+    const char* line = nullptr;
+    size_t length = 0U;
+
+    CSVField fields[MappedCSVFile::MAX_FIELDS];
+    while (MappedCSVFile::nextLine(pos, end, line, length)) {
+        if (length > 0U) {
+            // Skip comments with #
+            if (line[0U] == '#')
+                continue;
+
+            // tokenize line
+            uint32_t count = MappedCSVFile::split(line, length, fields, false);
+            if (count == 0U)
+                continue;
+
+            // parse tokenized line
+            uint32_t id = (uint32_t)fields[0U].toInt();
+            bool peerLink = false;
+            if (count >= 3U)
+                peerLink = fields[2U].toInt() == 1;
+
+            // Check for an optional alias field
+            if (count >= 2U) {
+                if (!fields[1U].empty()) {
+                    table[id] = PeerId(id, fields[1U].str(), peerLink, false);
+                    LogDebug(LOG_HOST, "Loaded peer ID %u into peer ID lookup table, using unique peer password%s", id,
+                        (peerLink) ? ", Peer-Link Enabled" : "");
+                    continue;
+                }
+            }
+
+            table[id] = PeerId(id, "", peerLink, false);
+            LogDebug(LOG_HOST, "Loaded peer ID %u into peer ID lookup table, using master password%s", id,
+                (peerLink) ? ", Peer-Link Enabled" : "");
+        }
+    }
+}
+
 // ---------------------------------------------------------------------------
 //  Static Class Members
 // ---------------------------------------------------------------------------
 
-std::mutex PeerListLookup::m_mutex;
+std::shared_timed_mutex PeerListLookup::m_mutex;
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -40,8 +91,9 @@ PeerListLookup::PeerListLookup(const std::string& filename, Mode mode, uint32_t
 
 void PeerListLookup::clear()
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
     m_table.clear();
+    m_version++;
 }
 
 /* Adds a new entry to the list. */
@@ -50,47 +102,31 @@ void PeerListLookup::addEntry(uint32_t id, const std::string& password, bool pee
 {
     PeerId entry = PeerId(id, password, peerLink, false);
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-    try {
-        PeerId _entry = m_table.at(id);
-        // if either the alias or the enabled flag doesn't match, update the entry
-        if (_entry.peerId() == id) {
-            _entry = PeerId(id, password, peerLink, false);
-            m_table[id] = _entry;
-        }
-    } catch (...) {
-        m_table[id] = entry;
-    }
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+    m_table[id] = entry;
+    m_version++;
 }
 
 /* Removes an existing entry from the list. */
 
 void PeerListLookup::eraseEntry(uint32_t id)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    try {
-        PeerId entry = m_table.at(id);  // this value will get discarded
-        (void)entry;                    // but some variants of C++ mark the unordered_map<>::at as nodiscard
-        m_table.erase(id);
-    } catch (...) {
-        /* stub */
-    }
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+    m_table.erase(id);
+    m_version++;
 }
 
 /* Finds a table entry in this lookup table. */
 
 PeerId PeerListLookup::find(uint32_t id)
 {
-    PeerId entry;
-
-    std::lock_guard<std::mutex> lock(m_mutex);
-    try {
-        entry = m_table.at(id);
-    } catch (...) {
-        entry = PeerId(0U, "", false, true);
+    std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+    const PeerId* entry = m_table.get(id);
+    if (entry != nullptr) {
+        return *entry;
     }
 
-    return entry;
+    return PeerId(0U, "", false, true);
 }
 
 /* Commit the table. */
@@ -111,12 +147,8 @@ bool PeerListLookup::getACL() const
 
 bool PeerListLookup::isPeerInList(uint32_t id) const
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (m_table.find(id) != m_table.end()) {
-        return true;
-    }
-
-    return false;
+    std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+    return m_table.contains(id);
 }
 
 /* Checks if a peer ID is allowed based on the mode and enabled flag. */
@@ -141,7 +173,7 @@ bool PeerListLookup::isPeerAllowed(uint32_t id) const
 
 void PeerListLookup::setMode(Mode mode)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
     m_mode = mode;
 }
 
@@ -152,6 +184,73 @@ PeerListLookup::Mode PeerListLookup::getMode() const
     return m_mode;
 }
 
+/* Serializes the lookup table into its compact binary representation. */
+
+void PeerListLookup::serialize(std::vector<uint8_t>& data)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+
+    data.clear();
+    data.reserve(8U + (m_table.size() * 16U));
+
+    PackedTableWriter writer(data);
+    writer.writeMagic(PACKED_TABLE_PID_MAGIC);
+    writer.writeUInt32((uint32_t)m_table.size());
+    for (auto& entry : m_table) {
+        writer.writeUInt32(entry.first);
+        writer.writeUInt8(entry.second.peerLink() ? 1U : 0U);
+        writer.writeString(entry.second.peerPassword());
+    }
+}
+
+/* Replaces the lookup table with the given serialized table. */
+
+bool PeerListLookup::deserialize(const uint8_t* data, uint32_t length)
+{
+    if (data == nullptr || length == 0U)
+        return false;
+
+    FlatIdMap<PeerId> table;
+    if (PackedTableReader::hasMagic(data, length, PACKED_TABLE_PID_MAGIC)) {
+        PackedTableReader reader(data, length);
+        reader.readMagic(PACKED_TABLE_PID_MAGIC);
+
+        // an entry is at least its ID, peer link flag and an empty password
+        uint32_t count = reader.readCount(4U + 1U + 2U);
+        if (reader.failed()) {
+            LogError(LOG_HOST, "Serialized peer ID lookup table is invalid, entry count exceeds the table length");
+            return false;
+        }
+
+        table.reserve(count);
+        for (uint32_t i = 0U; i < count && !reader.failed(); i++) {
+            uint32_t id = reader.readUInt32();
+            bool peerLink = reader.readUInt8() == 1U;
+            std::string password = reader.readString();
+
+            table[id] = PeerId(id, password, peerLink, false);
+        }
+
+        if (reader.failed()) {
+            LogError(LOG_HOST, "Serialized peer ID lookup table is truncated, expected %u entries", count);
+            return false;
+        }
+    }
+    else {
+        // the buffer contains the contents of a lookup table file
+        parseBuffer((const char*)data, length, table);
+    }
+
+    size_t size = table.size();
+
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+    m_table.swap(table);
+    m_version++;
+
+    LogInfoEx(LOG_HOST, "Loaded %lu peers into list", size);
+    return true;
+}
+
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
@@ -164,66 +263,26 @@ bool PeerListLookup::load()
         return false;
     }
 
-    std::ifstream file(m_filename, std::ifstream::in);
-    if (file.fail()) {
+    MappedCSVFile file;
+    if (!file.open(m_filename)) {
         LogError(LOG_HOST, "Cannot open the peer ID lookup file - %s", m_filename.c_str());
         return false;
     }
 
-    m_table.clear();
-    std::lock_guard<std::mutex> lock(m_mutex);
+    // the new table is built without holding the lock, and swapped in once complete
+    FlatIdMap<PeerId> table;
+    table.reserve(file.lineCount());
 
-    // read lines from file
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.length() > 0) {
-            // Skip comments with #
-            if (line.at(0) == '#')
-                continue;
+    parseBuffer(file.data(), file.size(), table);
 
-            // tokenize line
-            std::string next;
-            std::vector<std::string> parsed;
-            char delim = ',';
-
-            for (char c : line) {
-                if (c == delim) {
-                    //if (!next.empty()) {
-                        parsed.push_back(next);
-                        next.clear();
-                    //}
-                }
-                else
-                    next += c;
-            }
-            if (!next.empty())
-                parsed.push_back(next);
+    file.close();
 
-            // parse tokenized line
-            uint32_t id = ::atoi(parsed[0].c_str());
-            bool peerLink = false;
-            if (parsed.size() >= 3)
-                peerLink = ::atoi(parsed[2].c_str()) == 1;
+    size_t size = table.size();
 
-            // Check for an optional alias field
-            if (parsed.size() >= 2) {
-                if (!parsed[1].empty()) {
-                    m_table[id] = PeerId(id, parsed[1], peerLink, false);
-                    LogDebug(LOG_HOST, "Loaded peer ID %u into peer ID lookup table, using unique peer password%s", id,
-                        (peerLink) ? ", Peer-Link Enabled" : "");
-                    continue;
-                }
-            }
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+    m_table.swap(table);
+    m_version++;
 
-            m_table[id] = PeerId(id, "", peerLink, false);
-            LogDebug(LOG_HOST, "Loaded peer ID %u into peer ID lookup table, using master password%s", id,
-                (peerLink) ? ", Peer-Link Enabled" : "");
-        }
-    }
-
-    file.close();
-
-    size_t size = m_table.size();
     if (size == 0U)
         return false;
 
@@ -241,16 +300,18 @@ bool PeerListLookup::save()
         return false;
     }
 
-    std::ofstream file(m_filename, std::ofstream::out);
+    // write to a temporary file and rename it into place (see RadioIdLookup::save())
+    std::string tmpFile = m_filename + ".tmp";
+    std::ofstream file(tmpFile, std::ofstream::out);
     if (file.fail()) {
-        LogError(LOG_HOST, "Cannot open the peer ID lookup file - %s", m_filename.c_str());
+        LogError(LOG_HOST, "Cannot open the peer ID lookup file - %s", tmpFile.c_str());
         return false;
     }
 
     // Counter for lines written
     unsigned int lines = 0;
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
 
     // String for writing
     std::string line;
@@ -282,8 +343,16 @@ bool PeerListLookup::save()
 
     file.close();
 
-    if (lines != m_table.size())
+    if (file.fail() || lines != m_table.size()) {
+        ::remove(tmpFile.c_str());
         return false;
+    }
+
+    if (::rename(tmpFile.c_str(), m_filename.c_str()) != 0) {
+        LogError(LOG_HOST, "Cannot replace the peer ID lookup file - %s", m_filename.c_str());
+        ::remove(tmpFile.c_str());
+        return false;
+    }
 
     LogInfoEx(LOG_HOST, "Saved %u entries to lookup table file %s", lines, m_filename.c_str());
 
@@ -29,6 +29,7 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <shared_mutex>
 
 namespace lookups
 {
@@ -211,6 +212,25 @@ namespace lookups
          */
         Mode getMode() const;
 
+        /**
+         * @brief Serializes the lookup table into its compact binary representation.
+         * 
+         * An empty table is serialized as well, so the receiving side clears its table rather than keeping
+         * stale entries.
+         * @param[out] data Buffer to write the serialized table to.
+         */
+        void serialize(std::vector<uint8_t>& data);
+        /**
+         * @brief Replaces the lookup table with the given serialized table.
+         * 
+         * The new table is built in memory and swapped in once it is complete; the buffer may either
+         * contain the compact binary representation of the table or the contents of a lookup table file.
+         * @param data Buffer containing the serialized table.
+         * @param length Length of the buffer.
+         * @returns bool True, if the table was replaced, otherwise false.
+         */
+        bool deserialize(const uint8_t* data, uint32_t length);
+
     protected:
         bool m_acl;
 
@@ -229,7 +249,7 @@ namespace lookups
     private:
         Mode m_mode;
 
-        static std::mutex m_mutex;
+        static std::shared_timed_mutex m_mutex;
     };
 } // namespace lookups
 
@@ -10,21 +10,175 @@
  *
  */
 #include "lookups/RadioIdLookup.h"
+#include "lookups/MappedCSVFile.h"
+#include "lookups/PackedTable.h"
+#include "Thread.h"
 #include "p25/P25Defines.h"
 #include "Log.h"
 
 using namespace lookups;
 
+#include <algorithm>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <fstream>
 
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif // !defined(_WIN32)
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint8_t RID_CACHE_MAGIC[PACKED_TABLE_MAGIC_LEN] = { 'R', 'I', 'C', PACKED_TABLE_VERSION };
+
+const size_t RID_PARALLEL_PARSE_SIZE = 4U * 1024U * 1024U;
+const uint32_t RID_MAX_PARSE_THREADS = 4U;
+
+// ---------------------------------------------------------------------------
+//  Structure Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Represents a chunk of the radio ID lookup file being parsed.
+ */
+struct RIDParseChunk {
+    CSVChunk chunk;                                     //! Chunk of the lookup table file
+    std::vector<std::pair<uint32_t, RadioId>> entries;  //! Parsed entries
+};
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to parse a line of the radio ID lookup file. */
+
+static bool parseLine(const char* line, size_t length, uint32_t& id, RadioId& entry)
+{
+    // skip empty lines and comments with #
+    if (length == 0U || line[0U] == '#')
+        return false;
+
+    CSVField fields[MappedCSVFile::MAX_FIELDS];
+    uint32_t count = MappedCSVFile::split(line, length, fields, true);
+    if (count < 2U)
+        return false;
+
+    id = (uint32_t)fields[0U].toInt();
+    bool radioEnabled = fields[1U].toInt() == 1;
+
+    // check for the optional alias and IP address fields
+    entry = RadioId(radioEnabled, false, (count >= 3U) ? fields[2U].str() : "", (count >= 4U) ? fields[3U].str() : "");
+    return true;
+}
+
+/* Helper to parse a chunk of the radio ID lookup file. */
+
+static void parseChunk(RIDParseChunk* chunk)
+{
+    const char* pos = chunk->chunk.begin;
+    const char* line = nullptr;
+    size_t length = 0U;
+
+    uint32_t id = 0U;
+    RadioId entry;
+    while (MappedCSVFile::nextLine(pos, chunk->chunk.end, line, length)) {
+        if (parseLine(line, length, id, entry)) {
+            chunk->entries.push_back(std::make_pair(id, entry));
+        }
+    }
+}
+
+/* Helper to parse the contents of a radio ID lookup file. */
+
+static void parseBuffer(const char* data, size_t size, FlatIdMap<RadioId>& table)
+{
+    const char* pos = data;
+    const char* end = data + size;
+    const char* line = nullptr;
+    size_t length = 0U;
+
+    uint32_t id = 0U;
+    RadioId entry;
+    while (MappedCSVFile::nextLine(pos, end, line, length)) {
+        if (parseLine(line, length, id, entry)) {
+            table[id] = entry;
+        }
+    }
+}
+
+/* Entry point to a radio ID lookup file parser thread. */
+
+static void* threadParseChunk(void* arg)
+{
+    thread_t* th = (thread_t*)arg;
+    if (th != nullptr) {
+        parseChunk((RIDParseChunk*)th->obj);
+    }
+
+    return nullptr;
+}
+
+/* Helper to determine the number of threads used to parse a radio ID lookup file. */
+
+static uint32_t parseThreadCount(size_t size)
+{
+    if (size < RID_PARALLEL_PARSE_SIZE)
+        return 1U;
+
+#if !defined(_WIN32)
+    long cpus = ::sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus > 1) {
+        return ((uint32_t)cpus < RID_MAX_PARSE_THREADS) ? (uint32_t)cpus : RID_MAX_PARSE_THREADS;
+    }
+#endif // !defined(_WIN32)
+    return 1U;
+}
+
+/* Helper to write the entries of a radio ID table. */
+
+static void writeTable(PackedTableWriter& writer, const FlatIdMap<RadioId>& table)
+{
+    writer.writeUInt32((uint32_t)table.size());
+    for (auto& entry : table) {
+        writer.writeUInt32(entry.first);
+        writer.writeUInt8(entry.second.radioEnabled() ? 1U : 0U);
+        writer.writeString(entry.second.radioAlias());
+        writer.writeString(entry.second.radioIPAddress());
+    }
+}
+
+/* Helper to read the entries of a radio ID table. */
+
+static bool readTable(PackedTableReader& reader, FlatIdMap<RadioId>& table, uint32_t& count)
+{
+    // an entry is at least its ID, enabled flag and two empty strings
+    count = reader.readCount(4U + 1U + 2U + 2U);
+    if (reader.failed())
+        return false;
+
+    table.reserve(count);
+    for (uint32_t i = 0U; i < count && !reader.failed(); i++) {
+        uint32_t id = reader.readUInt32();
+        bool radioEnabled = reader.readUInt8() == 1U;
+        std::string alias = reader.readString();
+        std::string ipAddress = reader.readString();
+
+        table[id] = RadioId(radioEnabled, false, alias, ipAddress);
+    }
+
+    return !reader.failed();
+}
+
 // ---------------------------------------------------------------------------
 //  Static Class Members
 // ---------------------------------------------------------------------------
 
-std::mutex RadioIdLookup::m_mutex;
+std::shared_timed_mutex RadioIdLookup::m_mutex;
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -33,7 +187,8 @@ std::mutex RadioIdLookup::m_mutex;
 /* Initializes a new instance of the RadioIdLookup class. */
 
 RadioIdLookup::RadioIdLookup(const std::string& filename, uint32_t reloadTime, bool ridAcl) : LookupTable(filename, reloadTime),
-    m_acl(ridAcl)
+    m_acl(ridAcl),
+    m_binaryCache(false)
 {
     /* stub */
 }
@@ -42,8 +197,9 @@ RadioIdLookup::RadioIdLookup(const std::string& filename, uint32_t reloadTime, b
 
 void RadioIdLookup::clear()
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
     m_table.clear();
+    m_version++;
 }
 
 /* Toggles the specified radio ID enabled or disabled. */
@@ -64,20 +220,21 @@ void RadioIdLookup::addEntry(uint32_t id, bool enabled, const std::string& alias
 
     RadioId entry = RadioId(enabled, false, alias, ipAddress);
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-    try {
-        RadioId _entry = m_table.at(id);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+    RadioId* _entry = m_table.get(id);
+    if (_entry != nullptr) {
         // if either the alias or the enabled flag doesn't match, update the entry
-        if (_entry.radioEnabled() != enabled || _entry.radioAlias() != alias) {
+        if (_entry->radioEnabled() != enabled || _entry->radioAlias() != alias) {
             //LogDebug(LOG_HOST, "Updating existing RID %d (%s) in ACL", id, alias.c_str());
-            _entry = RadioId(enabled, false, alias, ipAddress);
-            m_table[id] = _entry;
+            *_entry = entry;
+            m_version++;
         } else {
             //LogDebug(LOG_HOST, "No changes made to RID %d (%s) in ACL", id, alias.c_str());
         }
-    } catch (...) {
+    } else {
         //LogDebug(LOG_HOST, "Adding new RID %d (%s) to ACL", id, alias.c_str());
         m_table[id] = entry;
+        m_version++;
     }
 }
 
@@ -85,13 +242,9 @@ void RadioIdLookup::addEntry(uint32_t id, bool enabled, const std::string& alias
 
 void RadioIdLookup::eraseEntry(uint32_t id)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    try {
-        RadioId entry = m_table.at(id); // this value will get discarded
-        (void)entry;                    // but some variants of C++ mark the unordered_map<>::at as nodiscard
-        m_table.erase(id);
-    } catch (...) {
-        /* stub */
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+    if (m_table.erase(id) > 0U) {
+        m_version++;
     }
 }
 
@@ -99,20 +252,17 @@ void RadioIdLookup::eraseEntry(uint32_t id)
 
 RadioId RadioIdLookup::find(uint32_t id)
 {
-    RadioId entry;
-
     if ((id == p25::defines::WUID_ALL) || (id == p25::defines::WUID_FNE)) {
         return RadioId(true, false);
     }
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-    try {
-        entry = m_table.at(id);
-    } catch (...) {
-        entry = RadioId(false, true);
+    std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+    const RadioId* entry = m_table.get(id);
+    if (entry != nullptr) {
+        return *entry;
     }
 
-    return entry;
+    return RadioId(false, true);
 }
 
 /* Saves loaded talkgroup rules. */
@@ -129,6 +279,56 @@ bool RadioIdLookup::getACL()
     return m_acl;
 }
 
+/* Serializes the lookup table into its compact binary representation. */
+
+void RadioIdLookup::serialize(std::vector<uint8_t>& data)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+
+    data.clear();
+    data.reserve(8U + (m_table.size() * 24U));
+
+    PackedTableWriter writer(data);
+    writer.writeMagic(PACKED_TABLE_RID_MAGIC);
+    writeTable(writer, m_table);
+}
+
+/* Replaces the lookup table with the given serialized table. */
+
+bool RadioIdLookup::deserialize(const uint8_t* data, uint32_t length)
+{
+    if (data == nullptr || length == 0U)
+        return false;
+
+    FlatIdMap<RadioId> table;
+    if (PackedTableReader::hasMagic(data, length, PACKED_TABLE_RID_MAGIC)) {
+        PackedTableReader reader(data, length);
+        reader.readMagic(PACKED_TABLE_RID_MAGIC);
+
+        uint32_t count = 0U;
+        if (!readTable(reader, table, count)) {
+            if (count == 0U)
+                LogError(LOG_HOST, "Serialized radio ID lookup table is invalid, entry count exceeds the table length");
+            else
+                LogError(LOG_HOST, "Serialized radio ID lookup table is truncated, expected %u entries", count);
+            return false;
+        }
+    }
+    else {
+        // the buffer contains the contents of a lookup table file
+        parseBuffer((const char*)data, length, table);
+    }
+
+    size_t size = table.size();
+
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+    m_table.swap(table);
+    m_version++;
+
+    LogInfoEx(LOG_HOST, "Loaded %u entries into lookup table", size);
+    return true;
+}
+
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
@@ -141,75 +341,75 @@ bool RadioIdLookup::load()
         return false;
     }
 
-    std::ifstream file (m_filename, std::ifstream::in);
-    if (file.fail()) {
+    MappedCSVFile file;
+    if (!file.open(m_filename)) {
         LogError(LOG_HOST, "Cannot open the radio ID lookup file - %s", m_filename.c_str());
         return false;
     }
 
-    // clear table
-    clear();
+    // the new table is built without holding the lock, and swapped in once complete
+    FlatIdMap<RadioId> table;
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    bool cached = false;
+    if (m_binaryCache) {
+        cached = loadCache(table, file.size(), file.modified());
+    }
 
-    // read lines from file
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.length() > 0) {
-            // Skip comments with #
-            if (line.at(0) == '#')
-                continue;
-
-            // tokenize line
-            std::string next;
-            std::vector<std::string> parsed;
-            char delim = ',';
-
-            for (char c : line) {
-                if (c == delim) {
-                    if (!next.empty()) {
-                        parsed.push_back(next);
-                        next.clear();
-                    }
+    if (!cached) {
+        table.reserve(file.lineCount());
+
+        std::vector<CSVChunk> chunks = file.chunks(parseThreadCount(file.size()));
+        if (chunks.size() > 1U) {
+            // parse chunks of the file in parallel
+            std::vector<RIDParseChunk> parsed(chunks.size());
+            std::vector<thread_t*> threads(chunks.size(), nullptr);
+            for (size_t i = 0U; i < chunks.size(); i++) {
+                parsed[i].chunk = chunks[i];
+                threads[i] = new thread_t();
+                if (!Thread::runAsThread(&parsed[i], threadParseChunk, threads[i])) {
+                    threads[i] = nullptr;
+                    parseChunk(&parsed[i]);
                 }
-                else
-                    next += c;
-            }
-            if (!next.empty())
-                parsed.push_back(next);
-
-            // parse tokenized line
-            uint32_t id = ::atoi(parsed[0].c_str());
-            bool radioEnabled = ::atoi(parsed[1].c_str()) == 1;
-            std::string alias = "";
-            std::string ipAddress = "";
-
-            // check for an optional alias field
-            if (parsed.size() >= 3) {
-                alias = parsed[2];
             }
 
-            // check for an optional IP address field
-            if (parsed.size() >= 4) {
-                ipAddress = parsed[3];
+            // merge the parsed chunks in file order, so later lines replace earlier ones
+            for (size_t i = 0U; i < chunks.size(); i++) {
+                if (threads[i] != nullptr) {
+#if defined(_WIN32)
+                    ::WaitForSingleObject(threads[i]->thread, INFINITE);
+                    ::CloseHandle(threads[i]->thread);
+#else
+                    ::pthread_join(threads[i]->thread, NULL);
+#endif // defined(_WIN32)
+                    delete threads[i];
+                }
+
+                for (auto& entry : parsed[i].entries) {
+                    table[entry.first] = entry.second;
+                }
             }
+        }
+        else {
+            parseBuffer(file.data(), file.size(), table);
+        }
 
-            m_table[id] = RadioId(radioEnabled, false, alias, ipAddress);
-            /*if (alias != "") {
-                LogDebug(LOG_HOST, "Loaded RID %u (%s) into RID lookup table", id, parsed[2].c_str());
-            } else {
-                LogDebug(LOG_HOST, "Loaded RID %u into RID lookup table", id);
-            }*/
+        if (m_binaryCache) {
+            saveCache(table, file.size(), file.modified());
         }
     }
 
     file.close();
 
-    size_t size = m_table.size();
+    size_t size = table.size();
+
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+    m_table.swap(table);
+    m_version++;
+
     if (size == 0U)
         return false;
 
-    LogInfoEx(LOG_HOST, "Loaded %u entries into lookup table", size);
+    LogInfoEx(LOG_HOST, "Loaded %u entries into lookup table%s", size, (cached) ? " (from binary cache)" : "");
 
     return true;
 }
@@ -224,16 +424,19 @@ bool RadioIdLookup::save()
         return false;
     }
 
-    std::ofstream file (m_filename, std::ofstream::out);
+    // the table is written to a temporary file that is renamed over the lookup file once complete; load() maps
+    // the lookup file, and truncating it in place would pull the mapped pages out from under a concurrent reload
+    std::string tmpFile = m_filename + ".tmp";
+    std::ofstream file(tmpFile, std::ofstream::out);
     if (file.fail()) {
-        LogError(LOG_HOST, "Cannot open the radio ID lookup file - %s", m_filename.c_str());
+        LogError(LOG_HOST, "Cannot open the radio ID lookup file - %s", tmpFile.c_str());
         return false;
     }
 
     // Counter for lines written
     unsigned int lines = 0;
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
 
     // String for writing
     std::string line;
@@ -273,10 +476,87 @@ bool RadioIdLookup::save()
 
     file.close();
 
-    if (lines != m_table.size())
+    if (file.fail() || lines != m_table.size()) {
+        ::remove(tmpFile.c_str());
+        return false;
+    }
+
+    if (::rename(tmpFile.c_str(), m_filename.c_str()) != 0) {
+        LogError(LOG_HOST, "Cannot replace the radio ID lookup file - %s", m_filename.c_str());
+        ::remove(tmpFile.c_str());
         return false;
+    }
 
     LogInfoEx(LOG_HOST, "Saved %u entries to lookup table file %s", lines, m_filename.c_str());
 
     return true;
-}
\ No newline at end of file
+}
+
+/* Loads the table from the binary cache file. */
+
+bool RadioIdLookup::loadCache(FlatIdMap<RadioId>& table, size_t size, uint64_t modified)
+{
+    MappedCSVFile cache;
+    if (!cache.open(m_filename + ".cache"))
+        return false;
+
+    const uint8_t* data = (const uint8_t*)cache.data();
+    if (!PackedTableReader::hasMagic(data, cache.size(), RID_CACHE_MAGIC))
+        return false;
+
+    PackedTableReader reader(data, cache.size());
+    reader.readMagic(RID_CACHE_MAGIC);
+
+    uint64_t cacheSize = (uint64_t)reader.readUInt32() << 32;
+    cacheSize |= reader.readUInt32();
+    uint64_t cacheModified = (uint64_t)reader.readUInt32() << 32;
+    cacheModified |= reader.readUInt32();
+
+    // is the cache stale?
+    if (reader.failed() || cacheSize != (uint64_t)size || cacheModified != modified)
+        return false;
+
+    // the entry count is checked against the remainder of the cache before anything is reserved for it
+    uint32_t count = 0U;
+    if (!readTable(reader, table, count)) {
+        LogWarning(LOG_HOST, "Radio ID lookup binary cache is invalid or truncated, ignoring cache");
+        table.clear();
+        return false;
+    }
+
+    return true;
+}
+
+/* Saves the table to the binary cache file. */
+
+void RadioIdLookup::saveCache(const FlatIdMap<RadioId>& table, size_t size, uint64_t modified)
+{
+    std::vector<uint8_t> buffer;
+    buffer.reserve(PACKED_TABLE_MAGIC_LEN + 20U + (table.size() * 24U));
+
+    uint64_t cacheSize = (uint64_t)size;
+
+    PackedTableWriter writer(buffer);
+    writer.writeMagic(RID_CACHE_MAGIC);
+    writer.writeUInt32((uint32_t)(cacheSize >> 32));
+    writer.writeUInt32((uint32_t)cacheSize);
+    writer.writeUInt32((uint32_t)(modified >> 32));
+    writer.writeUInt32((uint32_t)modified);
+    writeTable(writer, table);
+
+    // write to a temporary file and rename it over the cache, so a partially written cache is never loaded
+    std::string cacheFile = m_filename + ".cache";
+    std::string tmpFile = cacheFile + ".tmp";
+    FILE* fp = ::fopen(tmpFile.c_str(), "wb");
+    if (fp == nullptr) {
+        LogWarning(LOG_HOST, "Cannot write the radio ID lookup binary cache - %s", cacheFile.c_str());
+        return;
+    }
+
+    bool written = ::fwrite(buffer.data(), 1U, buffer.size(), fp) == buffer.size();
+    written = (::fclose(fp) == 0) && written;
+    if (!written || ::rename(tmpFile.c_str(), cacheFile.c_str()) != 0) {
+        LogWarning(LOG_HOST, "Cannot write the radio ID lookup binary cache - %s", cacheFile.c_str());
+        ::remove(tmpFile.c_str());
+    }
+}
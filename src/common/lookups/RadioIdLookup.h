@@ -26,7 +26,9 @@
 #include "common/lookups/LookupTable.h"
 
 #include <string>
+#include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace lookups
 {
@@ -192,8 +194,38 @@ namespace lookups
          */
         bool getACL();
 
+        /**
+         * @brief Serializes the lookup table into its compact binary representation.
+         * 
+         * An empty table is serialized as well, so the receiving side clears its table rather than keeping
+         * stale entries.
+         * @param[out] data Buffer to write the serialized table to.
+         */
+        void serialize(std::vector<uint8_t>& data);
+        /**
+         * @brief Replaces the lookup table with the given serialized table.
+         * 
+         * The new table is built in memory and swapped in once it is complete; the buffer may either
+         * contain the compact binary representation of the table or the contents of a lookup table file.
+         * @param data Buffer containing the serialized table.
+         * @param length Length of the buffer.
+         * @returns bool True, if the table was replaced, otherwise false.
+         */
+        bool deserialize(const uint8_t* data, uint32_t length);
+
+        /**
+         * @brief Sets the flag indicating whether the binary cache of the lookup table file is used.
+         * 
+         * When enabled, the parsed lookup table is written to a binary cache file (the lookup table
+         * filename with a ".cache" suffix) and loaded directly from the cache when the lookup table
+         * file has not changed since the cache was written.
+         * @param binaryCache Flag indicating whether the binary cache is used.
+         */
+        void setBinaryCache(bool binaryCache) { m_binaryCache = binaryCache; }
+
     protected:
         bool m_acl;
+        bool m_binaryCache;
 
         /**
          * @brief Loads the table from the passed lookup table file.
@@ -207,8 +239,24 @@ namespace lookups
          */
         bool save() override;
 
+        /**
+         * @brief Loads the table from the binary cache file.
+         * @param[out] table Table to load.
+         * @param size Size of the lookup table file.
+         * @param modified Last modified time of the lookup table file.
+         * @return True, if the binary cache was loaded, otherwise false.
+         */
+        bool loadCache(FlatIdMap<RadioId>& table, size_t size, uint64_t modified);
+        /**
+         * @brief Saves the table to the binary cache file.
+         * @param table Table to save.
+         * @param size Size of the lookup table file.
+         * @param modified Last modified time of the lookup table file.
+         */
+        void saveCache(const FlatIdMap<RadioId>& table, size_t size, uint64_t modified);
+
     private:
-        static std::mutex m_mutex;
+        static std::shared_timed_mutex m_mutex;
     };
 } // namespace lookups
 
@@ -9,6 +9,7 @@
  *
  */
 #include "lookups/TalkgroupRulesLookup.h"
+#include "lookups/PackedTable.h"
 #include "Log.h"
 #include "Timer.h"
 #include "Utils.h"
@@ -17,6 +18,31 @@ using namespace lookups;
 
 #include <string>
 #include <vector>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to get the size and last modified time (in nanoseconds since the epoch) of the given file. */
+
+static bool getFileInfo(const std::string& filename, size_t& size, uint64_t& modified)
+{
+    struct stat st;
+    if (::stat(filename.c_str(), &st) != 0)
+        return false;
+
+    size = (size_t)st.st_size;
+#if defined(_WIN32)
+    modified = (uint64_t)st.st_mtime * 1000000000ULL;
+#elif defined(__APPLE__)
+    modified = ((uint64_t)st.st_mtimespec.tv_sec * 1000000000ULL) + (uint64_t)st.st_mtimespec.tv_nsec;
+#else
+    modified = ((uint64_t)st.st_mtim.tv_sec * 1000000000ULL) + (uint64_t)st.st_mtim.tv_nsec;
+#endif // defined(_WIN32)
+    return true;
+}
 
 // ---------------------------------------------------------------------------
 //  Static Class Members
@@ -33,9 +59,12 @@ std::mutex TalkgroupRulesLookup::m_mutex;
 TalkgroupRulesLookup::TalkgroupRulesLookup(const std::string& filename, uint32_t reloadTime, bool acl) : Thread(),
     m_rulesFile(filename),
     m_reloadTime(reloadTime),
-    m_rules(),
+    m_loadedSize(0U),
+    m_loadedModified(0U),
+    m_loadedVersion(0U),
     m_acl(acl),
     m_stop(false),
+    m_version(0U),
     m_groupHangTime(5U),
     m_sendTalkgroups(false),
     m_groupVoice()
@@ -79,6 +108,10 @@ void TalkgroupRulesLookup::stop(bool noDestroy)
         return;
     }
 
+    // the reload thread has already been stopped
+    if (m_stop)
+        return;
+
     m_stop = true;
 
     wait();
@@ -103,6 +136,7 @@ void TalkgroupRulesLookup::clear()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_groupVoice.clear();
+    m_version++;
 }
 
 /* Adds a new entry to the lookup table by the specified unique ID. */
@@ -150,6 +184,8 @@ void TalkgroupRulesLookup::addEntry(uint32_t id, uint8_t slot, bool enabled, boo
 
         m_groupVoice.push_back(entry);
     }
+
+    m_version++;
 }
 
 /* Adds a new entry to the lookup table by the specified unique ID. */
@@ -179,6 +215,8 @@ void TalkgroupRulesLookup::addEntry(TalkgroupRuleGroupVoice groupVoice)
     else {
         m_groupVoice.push_back(entry);
     }
+
+    m_version++;
 }
 
 /* Erases an existing entry from the lookup table by the specified unique ID. */
@@ -189,6 +227,7 @@ void TalkgroupRulesLookup::eraseEntry(uint32_t id, uint8_t slot)
     auto it = std::find_if(m_groupVoice.begin(), m_groupVoice.end(), [&](TalkgroupRuleGroupVoice x) { return x.source().tgId() == id && x.source().tgSlot() == slot; });
     if (it != m_groupVoice.end()) {
         m_groupVoice.erase(it);
+        m_version++;
     }
 }
 
@@ -268,6 +307,130 @@ bool TalkgroupRulesLookup::getACL()
     return m_acl;
 }
 
+/* Serializes the routing rules into their compact binary representation. */
+
+void TalkgroupRulesLookup::serialize(std::vector<uint8_t>& data)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    data.clear();
+    data.reserve(8U + (m_groupVoice.size() * 64U));
+
+    PackedTableWriter writer(data);
+    writer.writeMagic(PACKED_TABLE_TGR_MAGIC);
+    writer.writeUInt32((uint32_t)m_groupVoice.size());
+    for (auto& entry : m_groupVoice) {
+        TalkgroupRuleConfig config = entry.config();
+
+        writer.writeString(entry.name());
+        writer.writeString(entry.nameAlias());
+        writer.writeUInt32(entry.source().tgId());
+        writer.writeUInt8(entry.source().tgSlot());
+
+        uint8_t flags = (config.active() ? 0x01U : 0x00U) | (config.affiliated() ? 0x02U : 0x00U) |
+            (config.parrot() ? 0x04U : 0x00U) | (config.nonPreferred() ? 0x08U : 0x00U);
+        writer.writeUInt8(flags);
+
+        writer.writeList(config.inclusion());
+        writer.writeList(config.exclusion());
+        writer.writeList(config.alwaysSend());
+        writer.writeList(config.preferred());
+
+        std::vector<TalkgroupRuleRewrite> rewrites = config.rewrite();
+        writer.writeUInt32((uint32_t)rewrites.size());
+        for (auto& rewrite : rewrites) {
+            writer.writeUInt32(rewrite.peerId());
+            writer.writeUInt32(rewrite.tgId());
+            writer.writeUInt8(rewrite.tgSlot());
+        }
+    }
+}
+
+/* Replaces the routing rules with the given serialized routing rules. */
+
+bool TalkgroupRulesLookup::deserialize(const uint8_t* data, uint32_t length)
+{
+    if (data == nullptr || length == 0U)
+        return false;
+
+    if (!PackedTableReader::hasMagic(data, length, PACKED_TABLE_TGR_MAGIC)) {
+        // the buffer contains the contents of a routing rules file
+        yaml::Node rules;
+        try {
+            bool ret = yaml::Parse(rules, (const char*)data, length);
+            if (!ret) {
+                LogError(LOG_HOST, "Cannot parse the serialized talkgroup rules - error parsing YML");
+                return false;
+            }
+        }
+        catch (yaml::OperationException const& e) {
+            LogError(LOG_HOST, "Cannot parse the serialized talkgroup rules (%s)", e.message());
+            return false;
+        }
+
+        return loadRules(rules);
+    }
+
+    PackedTableReader reader(data, length);
+    reader.readMagic(PACKED_TABLE_TGR_MAGIC);
+
+    // a rule is at least its two empty names, source, flags, four empty lists and no rewrites
+    uint32_t count = reader.readCount(2U + 2U + 4U + 1U + 1U + (4U * 4U) + 4U);
+
+    // the new table is built without holding the lock, and swapped in once complete
+    std::vector<TalkgroupRuleGroupVoice> groupVoiceRules;
+    for (uint32_t i = 0U; i < count && !reader.failed(); i++) {
+        TalkgroupRuleGroupVoice groupVoice;
+        groupVoice.name(reader.readString());
+        groupVoice.nameAlias(reader.readString());
+
+        TalkgroupRuleGroupVoiceSource source;
+        source.tgId(reader.readUInt32());
+        source.tgSlot(reader.readUInt8());
+        groupVoice.source(source);
+
+        TalkgroupRuleConfig config;
+        uint8_t flags = reader.readUInt8();
+        config.active((flags & 0x01U) == 0x01U);
+        config.affiliated((flags & 0x02U) == 0x02U);
+        config.parrot((flags & 0x04U) == 0x04U);
+        config.nonPreferred((flags & 0x08U) == 0x08U);
+
+        config.inclusion(reader.readList());
+        config.exclusion(reader.readList());
+        config.alwaysSend(reader.readList());
+        config.preferred(reader.readList());
+
+        std::vector<TalkgroupRuleRewrite> rewrites;
+        uint32_t rewriteCount = reader.readCount(4U + 4U + 1U);
+        for (uint32_t j = 0U; j < rewriteCount && !reader.failed(); j++) {
+            TalkgroupRuleRewrite rewrite;
+            rewrite.peerId(reader.readUInt32());
+            rewrite.tgId(reader.readUInt32());
+            rewrite.tgSlot(reader.readUInt8());
+            rewrites.push_back(rewrite);
+        }
+        config.rewrite(rewrites);
+
+        groupVoice.config(config);
+        groupVoiceRules.push_back(groupVoice);
+    }
+
+    if (reader.failed()) {
+        LogError(LOG_HOST, "Serialized talkgroup rules are truncated, expected %u entries", count);
+        return false;
+    }
+
+    size_t size = groupVoiceRules.size();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_groupVoice.swap(groupVoiceRules);
+    m_version++;
+
+    LogInfoEx(LOG_HOST, "Loaded %u entries into lookup table", size);
+    return true;
+}
+
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
@@ -280,8 +443,20 @@ bool TalkgroupRulesLookup::load()
         return false;
     }
 
+    // skip re-parsing the rules file if neither the file, nor the rules in memory, have changed since
+    // the rules file was last loaded
+    size_t fileSize = 0U;
+    uint64_t fileModified = 0U;
+    bool fileInfo = getFileInfo(m_rulesFile, fileSize, fileModified);
+    if (fileInfo && m_loadedModified != 0U && fileSize == m_loadedSize && fileModified == m_loadedModified &&
+        m_version == m_loadedVersion) {
+        return m_groupVoice.size() > 0U;
+    }
+
+    // the parsed YAML is only needed to build the rules, and is released once the rules are built
+    yaml::Node rules;
     try {
-        bool ret = yaml::Parse(m_rules, m_rulesFile.c_str());
+        bool ret = yaml::Parse(rules, m_rulesFile.c_str());
         if (!ret) {
             LogError(LOG_HOST, "Cannot open the talkgroup rules lookup file - %s - error parsing YML", m_rulesFile.c_str());
             return false;
@@ -292,20 +467,36 @@ bool TalkgroupRulesLookup::load()
         return false;
     }
 
-    // clear table
-    clear();
+    bool ret = loadRules(rules);
+    if (ret && fileInfo) {
+        m_loadedSize = fileSize;
+        m_loadedModified = fileModified;
+        m_loadedVersion = m_version;
+    }
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-    yaml::Node& groupVoiceList = m_rules["groupVoice"];
+    return ret;
+}
 
+/* Loads the table from the passed parsed routing rules. */
+
+bool TalkgroupRulesLookup::loadRules(yaml::Node& rules)
+{
+    // the new table is built without holding the lock, and swapped in once complete
+    std::vector<TalkgroupRuleGroupVoice> groupVoiceRules;
+
+    yaml::Node& groupVoiceList = rules["groupVoice"];
     if (groupVoiceList.size() == 0U) {
         ::LogError(LOG_HOST, "No group voice rules list defined!");
+
+        // clear table
+        clear();
         return false;
     }
 
+    groupVoiceRules.reserve(groupVoiceList.size());
     for (size_t i = 0; i < groupVoiceList.size(); i++) {
         TalkgroupRuleGroupVoice groupVoice = TalkgroupRuleGroupVoice(groupVoiceList[i]);
-        m_groupVoice.push_back(groupVoice);
+        groupVoiceRules.push_back(groupVoice);
 
         std::string groupName = groupVoice.name();
         uint32_t tgId = groupVoice.source().tgId();
@@ -331,9 +522,11 @@ bool TalkgroupRulesLookup::load()
         ::LogInfoEx(LOG_HOST, "Talkgroup NAME: %s SRC_TGID: %u SRC_TS: %u ACTIVE: %u PARROT: %u AFFILIATED: %u INCLUSIONS: %u EXCLUSIONS: %u REWRITES: %u ALWAYS: %u PREFERRED: %u", groupName.c_str(), tgId, tgSlot, active, parrot, affil, incCount, excCount, rewrCount, alwyCount, prefCount);
     }
 
-    size_t size = m_groupVoice.size();
-    if (size == 0U)
-        return false;
+    size_t size = groupVoiceRules.size();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_groupVoice.swap(groupVoiceRules);
+    m_version++;
 
     LogInfoEx(LOG_HOST, "Loaded %u entries into lookup table", size);
 
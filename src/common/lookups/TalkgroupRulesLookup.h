@@ -26,6 +26,7 @@
 #include "common/yaml/Yaml.h"
 #include "common/Utils.h"
 
+#include <atomic>
 #include <string>
 #include <mutex>
 #include <unordered_map>
@@ -588,6 +589,25 @@ namespace lookups
          */
         bool getACL();
 
+        /**
+         * @brief Serializes the routing rules into their compact binary representation.
+         * 
+         * Empty routing rules are serialized as well, so the receiving side clears its rules rather than
+         * keeping stale entries.
+         * @param[out] data Buffer to write the serialized routing rules to.
+         */
+        void serialize(std::vector<uint8_t>& data);
+        /**
+         * @brief Replaces the routing rules with the given serialized routing rules.
+         * 
+         * The new rules are built in memory and swapped in once complete; the buffer may either contain
+         * the compact binary representation of the routing rules or the contents of a routing rules file.
+         * @param data Buffer containing the serialized routing rules.
+         * @param length Length of the buffer.
+         * @returns bool True, if the routing rules were replaced, otherwise false.
+         */
+        bool deserialize(const uint8_t* data, uint32_t length);
+
         /**
          * @brief Returns the filename used to load this lookup table.
          * @return std::string Full-path to the lookup table file.
@@ -597,16 +617,27 @@ namespace lookups
          * @brief Sets the filename used to load this lookup table.
          * @param filename Full-path to the routing rules file.
          */
-        void filename(std::string filename) { m_rulesFile = filename; };
+        void filename(std::string filename) { m_rulesFile = filename; m_loadedModified = 0U; };
+
+        /**
+         * @brief Returns a counter that is incremented every time the talkgroup rules change.
+         * @return uint32_t Talkgroup rules version.
+         */
+        uint32_t version() const { return m_version; }
 
     private:
         std::string m_rulesFile;
         uint32_t m_reloadTime;
-        yaml::Node m_rules;
+
+        size_t m_loadedSize;
+        uint64_t m_loadedModified;
+        uint32_t m_loadedVersion;
 
         bool m_acl;
         bool m_stop;
 
+        std::atomic<uint32_t> m_version;
+
         static std::mutex m_mutex;
 
         /**
@@ -614,6 +645,12 @@ namespace lookups
          * @return True, if lookup table was loaded, otherwise false.
          */
         bool load();
+        /**
+         * @brief Loads the table from the passed parsed routing rules.
+         * @param rules Parsed routing rules.
+         * @return True, if lookup table was loaded, otherwise false.
+         */
+        bool loadRules(yaml::Node& rules);
         /**
          * @brief Saves the table to the passed lookup table file.
          * @return True, if lookup table was saved, otherwise false.
@@ -0,0 +1,269 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "network/RTPAudioCodec.h"
+
+using namespace network;
+
+#include <cassert>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const int ULAW_BIAS = 0x84;
+const int ULAW_CLIP = 32635;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to build the G.711 decode tables.
+ */
+struct G711DecodeTables {
+    short ulaw[256U];
+    short alaw[256U];
+
+    G711DecodeTables()
+    {
+        for (int i = 0; i < 256; i++) {
+            // u-law
+            uint8_t u = ~(uint8_t)i;
+            int exponent = (u >> 4) & 0x07;
+            int mantissa = u & 0x0F;
+            int sample = (((mantissa << 3) + ULAW_BIAS) << exponent) - ULAW_BIAS;
+            ulaw[i] = (short)((u & 0x80) ? -sample : sample);
+
+            // A-law
+            uint8_t a = (uint8_t)i ^ 0x55U;
+            int seg = (a & 0x70) >> 4;
+            int t = (a & 0x0F) << 4;
+            switch (seg) {
+            case 0:
+                t += 8;
+                break;
+            case 1:
+                t += 0x108;
+                break;
+            default:
+                t += 0x108;
+                t <<= seg - 1;
+                break;
+            }
+            alaw[i] = (short)((a & 0x80) ? t : -t);
+        }
+    }
+};
+
+/**
+ * @brief Helper to get the G.711 decode tables.
+ * @returns const G711DecodeTables& G.711 decode tables.
+ */
+static const G711DecodeTables& decodeTables()
+{
+    static const G711DecodeTables tables;
+    return tables;
+}
+
+// ---------------------------------------------------------------------------
+//  Static Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to convert a codec name ("pcm16", "ulaw" or "alaw") to a codec. */
+
+bool RTPAudioCodec::fromName(const std::string& name, RTPAudioCodecType::E& codec)
+{
+    if (name == "pcm16" || name == "l16") {
+        codec = RTPAudioCodecType::PCM16;
+        return true;
+    }
+
+    if (name == "ulaw" || name == "pcmu") {
+        codec = RTPAudioCodecType::ULAW;
+        return true;
+    }
+
+    if (name == "alaw" || name == "pcma") {
+        codec = RTPAudioCodecType::ALAW;
+        return true;
+    }
+
+    return false;
+}
+
+/* Helper to convert a codec to its name. */
+
+std::string RTPAudioCodec::toName(RTPAudioCodecType::E codec)
+{
+    switch (codec) {
+    case RTPAudioCodecType::ULAW:
+        return "ulaw";
+    case RTPAudioCodecType::ALAW:
+        return "alaw";
+    case RTPAudioCodecType::PCM16:
+    default:
+        return "pcm16";
+    }
+}
+
+/* Helper to convert a RTP payload type to a codec. */
+
+bool RTPAudioCodec::fromPayloadType(uint8_t payloadType, RTPAudioCodecType::E& codec)
+{
+    switch (payloadType) {
+    case RTP_PCMU_PAYLOAD_TYPE:
+        codec = RTPAudioCodecType::ULAW;
+        return true;
+    case RTP_PCMA_PAYLOAD_TYPE:
+        codec = RTPAudioCodecType::ALAW;
+        return true;
+    case RTP_L16_PAYLOAD_TYPE:
+        codec = RTPAudioCodecType::PCM16;
+        return true;
+    default:
+        return false;
+    }
+}
+
+/* Helper to convert a codec to its RTP payload type. */
+
+uint8_t RTPAudioCodec::toPayloadType(RTPAudioCodecType::E codec)
+{
+    switch (codec) {
+    case RTPAudioCodecType::ULAW:
+        return RTP_PCMU_PAYLOAD_TYPE;
+    case RTPAudioCodecType::ALAW:
+        return RTP_PCMA_PAYLOAD_TYPE;
+    case RTPAudioCodecType::PCM16:
+    default:
+        return RTP_L16_PAYLOAD_TYPE;
+    }
+}
+
+/* Encodes PCM samples into a RTP audio payload. */
+
+uint32_t RTPAudioCodec::encode(RTPAudioCodecType::E codec, const short* samples, uint32_t count, uint8_t* payload)
+{
+    assert(samples != nullptr);
+    assert(payload != nullptr);
+
+    switch (codec) {
+    case RTPAudioCodecType::ULAW:
+        for (uint32_t i = 0U; i < count; i++)
+            payload[i] = linearToULaw(samples[i]);
+        return count;
+    case RTPAudioCodecType::ALAW:
+        for (uint32_t i = 0U; i < count; i++)
+            payload[i] = linearToALaw(samples[i]);
+        return count;
+    case RTPAudioCodecType::PCM16:
+    default:
+        // RTP carries linear PCM in network byte order (RFC 3551 L16)
+        for (uint32_t i = 0U; i < count; i++) {
+            payload[(i * 2U) + 0U] = (uint8_t)((samples[i] >> 8) & 0xFFU);
+            payload[(i * 2U) + 1U] = (uint8_t)(samples[i] & 0xFFU);
+        }
+        return count * 2U;
+    }
+}
+
+/* Decodes a RTP audio payload into PCM samples. */
+
+uint32_t RTPAudioCodec::decode(RTPAudioCodecType::E codec, const uint8_t* payload, uint32_t length, short* samples)
+{
+    assert(payload != nullptr);
+    assert(samples != nullptr);
+
+    const G711DecodeTables& tables = decodeTables();
+    switch (codec) {
+    case RTPAudioCodecType::ULAW:
+        for (uint32_t i = 0U; i < length; i++)
+            samples[i] = tables.ulaw[payload[i]];
+        return length;
+    case RTPAudioCodecType::ALAW:
+        for (uint32_t i = 0U; i < length; i++)
+            samples[i] = tables.alaw[payload[i]];
+        return length;
+    case RTPAudioCodecType::PCM16:
+    default:
+    {
+        uint32_t count = length / 2U;
+        for (uint32_t i = 0U; i < count; i++)
+            samples[i] = (short)((payload[(i * 2U) + 0U] << 8) | payload[(i * 2U) + 1U]);
+        return count;
+    }
+    }
+}
+
+/* Encodes a PCM sample as G.711 u-law. */
+
+uint8_t RTPAudioCodec::linearToULaw(short sample)
+{
+    int pcm = sample;
+    uint8_t mask = 0xFFU;
+    if (pcm < 0) {
+        pcm = -pcm;
+        mask = 0x7FU;
+    }
+
+    if (pcm > ULAW_CLIP)
+        pcm = ULAW_CLIP;
+    pcm += ULAW_BIAS;
+
+    int exponent = 7;
+    for (int expMask = 0x4000; (pcm & expMask) == 0 && exponent > 0; exponent--, expMask >>= 1)
+        ;
+
+    int mantissa = (pcm >> (exponent + 3)) & 0x0F;
+    return (uint8_t)(((exponent << 4) | mantissa) ^ mask);
+}
+
+/* Decodes a G.711 u-law sample. */
+
+short RTPAudioCodec::ulawToLinear(uint8_t ulaw)
+{
+    return decodeTables().ulaw[ulaw];
+}
+
+/* Encodes a PCM sample as G.711 A-law. */
+
+uint8_t RTPAudioCodec::linearToALaw(short sample)
+{
+    // A-law operates on 13-bit samples
+    int pcm = sample >> 3;
+    uint8_t mask = 0xD5U;
+    if (pcm < 0) {
+        pcm = -pcm - 1;
+        mask = 0x55U;
+    }
+
+    int seg = 0;
+    for (int end = 0x1F; seg < 8 && pcm > end; seg++, end = (end << 1) | 1)
+        ;
+
+    if (seg >= 8)
+        return (uint8_t)(0x7F ^ mask);
+
+    int aval = seg << 4;
+    if (seg < 2)
+        aval |= (pcm >> 1) & 0x0F;
+    else
+        aval |= (pcm >> seg) & 0x0F;
+
+    return (uint8_t)(aval ^ mask);
+}
+
+/* Decodes a G.711 A-law sample. */
+
+short RTPAudioCodec::alawToLinear(uint8_t alaw)
+{
+    return decodeTables().alaw[alaw];
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file RTPAudioCodec.h
+ * @ingroup network_core
+ * @file RTPAudioCodec.cpp
+ * @ingroup network_core
+ */
+#if !defined(__RTP_AUDIO_CODEC_H__)
+#define __RTP_AUDIO_CODEC_H__
+
+#include "common/Defines.h"
+
+#include <string>
+
+namespace network
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    const uint8_t RTP_PCMU_PAYLOAD_TYPE = 0x00U;            //! G.711 u-law (RFC 3551 static payload type)
+    const uint8_t RTP_PCMA_PAYLOAD_TYPE = 0x08U;            //! G.711 A-law (RFC 3551 static payload type)
+    const uint8_t RTP_L16_PAYLOAD_TYPE = 0x60U;             //! 16-bit linear PCM, 8 kHz mono (dynamic payload type)
+
+    /** @brief RTP Audio Codecs */
+    namespace RTPAudioCodecType {
+        /** @brief RTP Audio Codecs */
+        enum E : uint8_t {
+            PCM16 = 0x00U,                                  //! 16-bit Linear PCM (network byte order)
+            ULAW = 0x01U,                                   //! G.711 u-law
+            ALAW = 0x02U                                    //! G.711 A-law
+        };
+    }
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements the audio payload codecs (16-bit linear PCM, and G.711 u-law/A-law) used
+     *  to carry 8 kHz mono audio in RTP packets.
+     * @ingroup network_core
+     */
+    class HOST_SW_API RTPAudioCodec {
+    public:
+        /**
+         * @brief Helper to convert a codec name ("pcm16", "ulaw" or "alaw") to a codec.
+         * @param name Codec name.
+         * @param[out] codec Codec.
+         * @returns bool True, if the codec name is valid, otherwise false.
+         */
+        static bool fromName(const std::string& name, RTPAudioCodecType::E& codec);
+        /**
+         * @brief Helper to convert a codec to its name.
+         * @param codec Codec.
+         * @returns std::string Codec name.
+         */
+        static std::string toName(RTPAudioCodecType::E codec);
+
+        /**
+         * @brief Helper to convert a RTP payload type to a codec.
+         * @param payloadType RTP payload type.
+         * @param[out] codec Codec.
+         * @returns bool True, if the payload type is a supported audio payload type, otherwise false.
+         */
+        static bool fromPayloadType(uint8_t payloadType, RTPAudioCodecType::E& codec);
+        /**
+         * @brief Helper to convert a codec to its RTP payload type.
+         * @param codec Codec.
+         * @returns uint8_t RTP payload type.
+         */
+        static uint8_t toPayloadType(RTPAudioCodecType::E codec);
+
+        /**
+         * @brief Gets the number of payload bytes used for each sample by the codec.
+         * @param codec Codec.
+         * @returns uint32_t Number of bytes per sample.
+         */
+        static uint32_t bytesPerSample(RTPAudioCodecType::E codec) { return (codec == RTPAudioCodecType::PCM16) ? 2U : 1U; }
+
+        /**
+         * @brief Encodes PCM samples into a RTP audio payload.
+         * @param codec Codec.
+         * @param[in] samples PCM samples.
+         * @param count Number of samples.
+         * @param[out] payload Buffer to encode the payload into (count * bytesPerSample() bytes).
+         * @returns uint32_t Length of the encoded payload in bytes.
+         */
+        static uint32_t encode(RTPAudioCodecType::E codec, const short* samples, uint32_t count, uint8_t* payload);
+        /**
+         * @brief Decodes a RTP audio payload into PCM samples.
+         * @param codec Codec.
+         * @param[in] payload Payload to decode.
+         * @param length Length of the payload in bytes.
+         * @param[out] samples Buffer to decode the samples into (length / bytesPerSample() samples).
+         * @returns uint32_t Number of decoded samples.
+         */
+        static uint32_t decode(RTPAudioCodecType::E codec, const uint8_t* payload, uint32_t length, short* samples);
+
+        /**
+         * @brief Encodes a PCM sample as G.711 u-law.
+         * @param sample PCM sample.
+         * @returns uint8_t u-law sample.
+         */
+        static uint8_t linearToULaw(short sample);
+        /**
+         * @brief Decodes a G.711 u-law sample.
+         * @param ulaw u-law sample.
+         * @returns short PCM sample.
+         */
+        static short ulawToLinear(uint8_t ulaw);
+        /**
+         * @brief Encodes a PCM sample as G.711 A-law.
+         * @param sample PCM sample.
+         * @returns uint8_t A-law sample.
+         */
+        static uint8_t linearToALaw(short sample);
+        /**
+         * @brief Decodes a G.711 A-law sample.
+         * @param alaw A-law sample.
+         * @returns short PCM sample.
+         */
+        static short alawToLinear(uint8_t alaw);
+    };
+} // namespace network
+
+#endif // __RTP_AUDIO_CODEC_H__
@@ -108,6 +108,7 @@ namespace network
             PL_PEER_LIST = 0x02U,                   //! FNE Peer-Link Peer List Transfer
 
             PL_ACT_PEER_LIST = 0xA2U,               //! FNE Peer-Link Active Peer List Transfer
+            PL_ACT_PEER_LIST_DELTA = 0xA3U,         //! FNE Peer-Link Active Peer List Changes Transfer (only sent to masters advertising support)
         };
     };
 
@@ -0,0 +1,274 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "network/RTPJitterBuffer.h"
+
+using namespace network;
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the RTPJitterBuffer class. */
+
+RTPJitterBuffer::RTPJitterBuffer(uint32_t frameSamples, uint32_t minDelay, uint32_t maxDelay, uint32_t maxConceal) :
+    m_frameSamples(frameSamples),
+    m_frameMs(frameSamples / SAMPLES_PER_MS),
+    m_minDelay(minDelay),
+    m_maxDelay(maxDelay),
+    m_maxConceal(maxConceal),
+    m_capacity(0U),
+    m_frames(),
+    m_valid(),
+    m_lastFrame(),
+    m_started(false),
+    m_playing(false),
+    m_ssrc(0U),
+    m_baseTimestamp(0U),
+    m_playoutTimestamp(0U),
+    m_endTimestamp(0U),
+    m_now(0U),
+    m_playoutTime(0U),
+    m_haveTransit(false),
+    m_lastTransit(0),
+    m_jitter(0.0),
+    m_concealCount(0U),
+    m_received(0U),
+    m_late(0U),
+    m_duplicates(0U),
+    m_concealedTotal(0U),
+    m_dropped(0U)
+{
+    assert(frameSamples >= SAMPLES_PER_MS);
+
+    if (m_minDelay < 1U)
+        m_minDelay = 1U;
+    if (m_maxDelay < m_minDelay)
+        m_maxDelay = m_minDelay;
+
+    // leave room above the maximum delay to absorb bursts
+    m_capacity = (m_maxDelay * 2U) + 2U;
+
+    m_frames.resize(m_capacity * m_frameSamples, 0);
+    m_valid.resize(m_capacity, false);
+    m_lastFrame.resize(m_frameSamples, 0);
+}
+
+/* Updates the timer by the passed number of milliseconds. */
+
+void RTPJitterBuffer::clock(uint32_t ms)
+{
+    m_now += ms;
+    if (m_playing)
+        m_playoutTime += ms;
+}
+
+/* Writes the samples of a received RTP packet. */
+
+bool RTPJitterBuffer::write(uint32_t ssrc, uint32_t timestamp, const short* samples, uint32_t count)
+{
+    assert(samples != nullptr);
+
+    uint32_t frames = count / m_frameSamples;
+    if (frames == 0U)
+        return false;
+
+    if (!m_started || ssrc != m_ssrc)
+        start(ssrc, timestamp);
+
+    // update the interarrival jitter estimate (RFC 3550 A.8), in timestamp units
+    int64_t transit = (int64_t)(m_now * SAMPLES_PER_MS) - (int32_t)(timestamp - m_baseTimestamp);
+    if (m_haveTransit) {
+        double d = (double)std::llabs(transit - m_lastTransit);
+        m_jitter += (d - m_jitter) / 16.0;
+    }
+
+    m_lastTransit = transit;
+    m_haveTransit = true;
+
+    bool buffered = false;
+    for (uint32_t i = 0U; i < frames; i++) {
+        uint32_t ts = timestamp + (i * m_frameSamples);
+
+        int32_t offset = (int32_t)(ts - m_playoutTimestamp);
+        if (offset < 0) {
+            // before playout starts, a reordered packet may still move the playout point back
+            if (m_playing || (uint32_t)(m_endTimestamp - ts) / m_frameSamples >= m_capacity ||
+                (uint32_t)(m_playoutTimestamp - m_baseTimestamp) < (uint32_t)-offset) {
+                m_late++;
+                continue;
+            }
+
+            m_playoutTimestamp = ts;
+            offset = 0;
+        }
+
+        uint32_t frameOffset = (uint32_t)offset / m_frameSamples;
+        if (frameOffset >= m_capacity) {
+            if (!m_playing || frameOffset >= m_capacity * 2U) {
+                // the timestamps jumped (or the sender restarted); resynchronize on this frame
+                start(ssrc, ts);
+                m_lastTransit = (int64_t)(m_now * SAMPLES_PER_MS);
+            }
+            else {
+                // discard the oldest frames to make room
+                while (frameOffset >= m_capacity) {
+                    if (m_valid[slot(m_playoutTimestamp)])
+                        m_dropped++;
+                    advance();
+                    frameOffset--;
+                }
+            }
+        }
+
+        uint32_t s = slot(ts);
+        if (m_valid[s]) {
+            m_duplicates++;
+            continue;
+        }
+
+        ::memcpy(m_frames.data() + (s * m_frameSamples), samples + (i * m_frameSamples), m_frameSamples * sizeof(short));
+        m_valid[s] = true;
+        m_received++;
+        buffered = true;
+
+        if ((int32_t)(ts + m_frameSamples - m_endTimestamp) > 0)
+            m_endTimestamp = ts + m_frameSamples;
+    }
+
+    return buffered;
+}
+
+/* Reads the next frame, if one is due to be played out. */
+
+bool RTPJitterBuffer::read(short* samples)
+{
+    assert(samples != nullptr);
+
+    if (!m_started)
+        return false;
+
+    if (!m_playing) {
+        if (depth() < targetDelay())
+            return false;
+
+        m_playing = true;
+        m_playoutTime = m_frameMs;
+    }
+
+    if (m_playoutTime < m_frameMs)
+        return false;
+    m_playoutTime -= m_frameMs;
+
+    uint32_t s = slot(m_playoutTimestamp);
+    if (m_valid[s]) {
+        ::memcpy(samples, m_frames.data() + (s * m_frameSamples), m_frameSamples * sizeof(short));
+        ::memcpy(m_lastFrame.data(), samples, m_frameSamples * sizeof(short));
+        m_concealCount = 0U;
+    }
+    else {
+        if (depth() == 0U && m_concealCount >= m_maxConceal) {
+            // nothing more has arrived; the stream has ended
+            reset();
+            return false;
+        }
+
+        m_concealCount++;
+        m_concealedTotal++;
+
+        if (m_concealCount <= m_maxConceal) {
+            // repeat the last frame, fading out over the concealment period
+            float gain = (float)(m_maxConceal + 1U - m_concealCount) / (float)(m_maxConceal + 1U);
+            for (uint32_t i = 0U; i < m_frameSamples; i++)
+                samples[i] = (short)(m_lastFrame[i] * gain);
+        }
+        else {
+            ::memset(samples, 0x00U, m_frameSamples * sizeof(short));
+        }
+    }
+
+    advance();
+
+    // shrink the playout delay if more has been buffered than the jitter requires
+    if (depth() > targetDelay() + 2U) {
+        if (m_valid[slot(m_playoutTimestamp)])
+            m_dropped++;
+        advance();
+    }
+
+    return true;
+}
+
+/* Resets the buffer, discarding all buffered frames. */
+
+void RTPJitterBuffer::reset()
+{
+    std::fill(m_valid.begin(), m_valid.end(), false);
+
+    m_started = false;
+    m_playing = false;
+    m_playoutTime = 0U;
+    m_haveTransit = false;
+    m_concealCount = 0U;
+}
+
+/* Gets the number of frames buffered ahead of the playout point (including gaps). */
+
+uint32_t RTPJitterBuffer::depth() const
+{
+    if (!m_started)
+        return 0U;
+
+    int32_t diff = (int32_t)(m_endTimestamp - m_playoutTimestamp);
+    if (diff <= 0)
+        return 0U;
+
+    return (uint32_t)diff / m_frameSamples;
+}
+
+/* Gets the current target playout delay (in frames). */
+
+uint32_t RTPJitterBuffer::targetDelay() const
+{
+    uint32_t delay = m_minDelay + (uint32_t)std::ceil((2.0 * m_jitter) / m_frameSamples);
+    return std::min(delay, m_maxDelay);
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to start a new stream at the given timestamp. */
+
+void RTPJitterBuffer::start(uint32_t ssrc, uint32_t timestamp)
+{
+    reset();
+
+    m_started = true;
+    m_ssrc = ssrc;
+    // slots are counted from a base before the first frame, so reordered earlier frames still map to a slot
+    m_baseTimestamp = timestamp - (m_capacity * m_frameSamples);
+    m_playoutTimestamp = timestamp;
+    m_endTimestamp = timestamp;
+}
+
+/* Helper to advance the playout point by one frame, releasing its slot. */
+
+void RTPJitterBuffer::advance()
+{
+    m_valid[slot(m_playoutTimestamp)] = false;
+    m_playoutTimestamp += m_frameSamples;
+}
@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file RTPJitterBuffer.h
+ * @ingroup network_core
+ * @file RTPJitterBuffer.cpp
+ * @ingroup network_core
+ */
+#if !defined(__RTP_JITTER_BUFFER_H__)
+#define __RTP_JITTER_BUFFER_H__
+
+#include "common/Defines.h"
+
+#include <vector>
+
+namespace network
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    const uint32_t RTP_JITTER_DEFAULT_FRAME_SAMPLES = 160U;     //! 20ms at 8 kHz
+    const uint32_t RTP_JITTER_DEFAULT_MIN_DELAY = 2U;           //! Minimum playout delay (in frames)
+    const uint32_t RTP_JITTER_DEFAULT_MAX_DELAY = 10U;          //! Maximum playout delay (in frames)
+    const uint32_t RTP_JITTER_DEFAULT_MAX_CONCEAL = 5U;         //! Maximum concealed frames before the stream is considered ended
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements an adaptive jitter buffer for 8 kHz RTP audio.
+     * @ingroup network_core
+     *
+     * Packets are placed by their RTP timestamp (a packet may carry several frames), so reordered
+     * packets are played in order, and late or duplicate packets are discarded. Frames are played
+     * out at a fixed rate as the buffer is clocked. Playout starts once the buffer holds the target
+     * delay, which adapts to the interarrival jitter (RFC 3550 estimator) between the minimum and
+     * maximum delay. Missing frames are concealed by repeating the last frame with decaying gain;
+     * after the maximum concealed frames with nothing buffered, the stream is considered ended.
+     *
+     * The buffer is not thread-safe; packets are expected to be written and frames read from the
+     * same thread.
+     */
+    class HOST_SW_API RTPJitterBuffer {
+    public:
+        /**
+         * @brief Initializes a new instance of the RTPJitterBuffer class.
+         * @param frameSamples Number of samples per frame.
+         * @param minDelay Minimum playout delay (in frames).
+         * @param maxDelay Maximum playout delay (in frames).
+         * @param maxConceal Maximum number of consecutive frames concealed.
+         */
+        RTPJitterBuffer(uint32_t frameSamples = RTP_JITTER_DEFAULT_FRAME_SAMPLES, uint32_t minDelay = RTP_JITTER_DEFAULT_MIN_DELAY,
+            uint32_t maxDelay = RTP_JITTER_DEFAULT_MAX_DELAY, uint32_t maxConceal = RTP_JITTER_DEFAULT_MAX_CONCEAL);
+
+        /**
+         * @brief Updates the timer by the passed number of milliseconds.
+         * @param ms Number of milliseconds.
+         */
+        void clock(uint32_t ms);
+
+        /**
+         * @brief Writes the samples of a received RTP packet.
+         * @param ssrc RTP synchronization source.
+         * @param timestamp RTP timestamp of the first sample.
+         * @param[in] samples PCM samples.
+         * @param count Number of samples (any trailing partial frame is ignored).
+         * @returns bool True, if any of the frames were buffered, otherwise false.
+         */
+        bool write(uint32_t ssrc, uint32_t timestamp, const short* samples, uint32_t count);
+        /**
+         * @brief Reads the next frame, if one is due to be played out.
+         * @param[out] samples Buffer to read the frame into (frameSamples() samples).
+         * @returns bool True, if a frame was read, otherwise false.
+         */
+        bool read(short* samples);
+
+        /**
+         * @brief Resets the buffer, discarding all buffered frames.
+         */
+        void reset();
+
+        /**
+         * @brief Gets the number of samples per frame.
+         * @returns uint32_t Number of samples per frame.
+         */
+        uint32_t frameSamples() const { return m_frameSamples; }
+        /**
+         * @brief Helper to determine if frames are being played out.
+         * @returns bool True, if frames are being played out, otherwise false.
+         */
+        bool isPlaying() const { return m_playing; }
+        /**
+         * @brief Gets the number of frames buffered ahead of the playout point (including gaps).
+         * @returns uint32_t Number of frames buffered.
+         */
+        uint32_t depth() const;
+        /**
+         * @brief Gets the current target playout delay (in frames).
+         * @returns uint32_t Target playout delay.
+         */
+        uint32_t targetDelay() const;
+        /**
+         * @brief Gets the current interarrival jitter estimate (in milliseconds).
+         * @returns uint32_t Interarrival jitter.
+         */
+        uint32_t jitter() const { return (uint32_t)(m_jitter / SAMPLES_PER_MS); }
+
+        /**
+         * @brief Gets the number of frames received.
+         * @returns uint32_t Number of frames received.
+         */
+        uint32_t received() const { return m_received; }
+        /**
+         * @brief Gets the number of frames discarded for arriving after they were due.
+         * @returns uint32_t Number of late frames.
+         */
+        uint32_t late() const { return m_late; }
+        /**
+         * @brief Gets the number of duplicate frames discarded.
+         * @returns uint32_t Number of duplicate frames.
+         */
+        uint32_t duplicates() const { return m_duplicates; }
+        /**
+         * @brief Gets the number of frames concealed.
+         * @returns uint32_t Number of concealed frames.
+         */
+        uint32_t concealed() const { return m_concealedTotal; }
+        /**
+         * @brief Gets the number of frames discarded to reduce the playout delay.
+         * @returns uint32_t Number of discarded frames.
+         */
+        uint32_t dropped() const { return m_dropped; }
+
+    private:
+        static const uint32_t SAMPLES_PER_MS = 8U;
+
+        uint32_t m_frameSamples;
+        uint32_t m_frameMs;
+        uint32_t m_minDelay;
+        uint32_t m_maxDelay;
+        uint32_t m_maxConceal;
+        uint32_t m_capacity;
+
+        std::vector<short> m_frames;
+        std::vector<bool> m_valid;
+        std::vector<short> m_lastFrame;
+
+        bool m_started;
+        bool m_playing;
+        uint32_t m_ssrc;
+        uint32_t m_baseTimestamp;
+        uint32_t m_playoutTimestamp;
+        uint32_t m_endTimestamp;
+
+        uint64_t m_now;
+        uint32_t m_playoutTime;
+
+        bool m_haveTransit;
+        int64_t m_lastTransit;
+        double m_jitter;
+
+        uint32_t m_concealCount;
+
+        uint32_t m_received;
+        uint32_t m_late;
+        uint32_t m_duplicates;
+        uint32_t m_concealedTotal;
+        uint32_t m_dropped;
+
+        /**
+         * @brief Helper to start a new stream at the given timestamp.
+         * @param ssrc RTP synchronization source.
+         * @param timestamp RTP timestamp.
+         */
+        void start(uint32_t ssrc, uint32_t timestamp);
+        /**
+         * @brief Helper to get the slot for the frame at the given timestamp.
+         * @param timestamp RTP timestamp.
+         * @returns uint32_t Slot index.
+         */
+        uint32_t slot(uint32_t timestamp) const { return ((timestamp - m_baseTimestamp) / m_frameSamples) % m_capacity; }
+        /**
+         * @brief Helper to advance the playout point by one frame, releasing its slot.
+         */
+        void advance();
+    };
+} // namespace network
+
+#endif // __RTP_JITTER_BUFFER_H__
@@ -201,6 +201,8 @@ namespace json
         template <typename Iter> static void _indent(Iter os, int indent);
         template <typename Iter> void _serialize(Iter os, int indent) const;
         std::string _serialize(int indent) const;
+        static void _indent_buf(std::string &out, int indent);
+        void _serialize_buf(std::string &out, int indent) const;
         void clear();
     };
 
@@ -765,10 +767,191 @@ namespace json
 
     inline std::string value::_serialize(int indent) const {
         std::string s;
-        _serialize(std::back_inserter(s), indent);
+        s.reserve(256);
+        _serialize_buf(s, indent);
         return s;
     }
 
+    /*
+    ** serializing to a std::string appends runs of characters and formats integers directly, rather than
+    ** going through an output iterator one character at a time and formatting every number with snprintf
+    */
+
+    inline void _append_uint(std::string &out, uint64_t v) {
+        char buf[24];
+        char *p = buf + sizeof(buf);
+        do {
+            *--p = static_cast<char>('0' + (v % 10));
+            v /= 10;
+        } while (v != 0);
+        out.append(p, buf + sizeof(buf) - p);
+    }
+
+    inline void _append_int(std::string &out, int64_t v) {
+        if (v < 0) {
+            out.push_back('-');
+            _append_uint(out, 0 - static_cast<uint64_t>(v));
+        } else {
+            _append_uint(out, static_cast<uint64_t>(v));
+        }
+    }
+
+    inline void serialize_str_buf(const std::string &s, std::string &out) {
+        out.push_back('"');
+
+        const char *run = s.data();
+        const char *end = s.data() + s.size();
+        for (const char *p = run; p != end; ++p) {
+            unsigned char c = static_cast<unsigned char>(*p);
+            if (c >= 0x20 && c != '"' && c != '\\' && c != '/' && c != 0x7f) {
+                continue;
+            }
+
+            out.append(run, p - run);
+            run = p + 1;
+            switch (c) {
+            case '"': out.append("\\\"", 2); break;
+            case '\\': out.append("\\\\", 2); break;
+            case '/': out.append("\\/", 2); break;
+            case '\b': out.append("\\b", 2); break;
+            case '\f': out.append("\\f", 2); break;
+            case '\n': out.append("\\n", 2); break;
+            case '\r': out.append("\\r", 2); break;
+            case '\t': out.append("\\t", 2); break;
+            default:
+                {
+                    char buf[7];
+                    SNPRINTF(buf, sizeof(buf), "\\u%04x", c);
+                    out.append(buf, 6);
+                }
+                break;
+            }
+        }
+
+        out.append(run, end - run);
+        out.push_back('"');
+    }
+
+    inline void value::_indent_buf(std::string &out, int indent) {
+        out.push_back('\n');
+        out.append(static_cast<size_t>(indent * INDENT_WIDTH), ' ');
+    }
+
+    inline void value::_serialize_buf(std::string &out, int indent) const {
+        switch (type_) {
+        case null_type:
+            out.append("null", 4);
+            break;
+        case boolean_type:
+            if (u_.boolean_)
+                out.append("true", 4);
+            else
+                out.append("false", 5);
+            break;
+        case number_type:
+            {
+                // integral numbers (i.e. parsed values) don't need the floating point formatter
+                double tmp;
+                if (fabs(u_.number_) < (1ULL << 53) && modf(u_.number_, &tmp) == 0 && !(u_.number_ == 0 && std::signbit(u_.number_))) {
+                    _append_int(out, static_cast<int64_t>(u_.number_));
+                } else {
+                    out.append(to_str());
+                }
+            }
+            break;
+        case int32_type:
+            _append_int(out, u_.int32_);
+            break;
+        case uint64_type:
+            _append_int(out, static_cast<int64_t>(u_.uint64_));
+            break;
+        case uint32_type:
+            _append_uint(out, u_.uint32_);
+            break;
+        case uint16_type:
+            _append_uint(out, u_.uint16_);
+            break;
+        case uint8_type:
+            _append_uint(out, u_.uint8_);
+            break;
+        case string_type:
+            serialize_str_buf(*u_.string_, out);
+            break;
+        case array_type:
+            {
+                out.push_back('[');
+                if (indent != -1) {
+                    ++indent;
+                }
+
+                for (array::const_iterator i = u_.array_->begin(); i != u_.array_->end(); ++i) {
+                    if (i != u_.array_->begin()) {
+                        out.push_back(',');
+                    }
+
+                    if (indent != -1) {
+                        _indent_buf(out, indent);
+                    }
+
+                    i->_serialize_buf(out, indent);
+                }
+
+                if (indent != -1) {
+                    --indent;
+
+                    if (!u_.array_->empty()) {
+                        _indent_buf(out, indent);
+                    }
+                }
+                out.push_back(']');
+                break;
+            }
+        case object_type:
+            {
+                out.push_back('{');
+                if (indent != -1) {
+                    ++indent;
+                }
+
+                for (object::const_iterator i = u_.object_->begin(); i != u_.object_->end(); ++i) {
+                    if (i != u_.object_->begin()) {
+                        out.push_back(',');
+                    }
+
+                    if (indent != -1) {
+                        _indent_buf(out, indent);
+                    }
+
+                    serialize_str_buf(i->first, out);
+                    out.push_back(':');
+
+                    if (indent != -1) {
+                        out.push_back(' ');
+                    }
+
+                    i->second._serialize_buf(out, indent);
+                }
+
+                if (indent != -1) {
+                    --indent;
+
+                    if (!u_.object_->empty()) {
+                        _indent_buf(out, indent);
+                    }
+                }
+                out.push_back('}');
+                break;
+            }
+        default:
+            out.append(to_str());
+            break;
+        }
+
+        if (indent == 0) {
+            out.push_back('\n');
+        }
+    }
+
     // ---------------------------------------------------------------------------
     //  Class Declaration
     //
@@ -827,6 +1010,27 @@ namespace json
             }
         }
 
+        template <typename String> void take_plain(String &out) {
+            // consume the run of characters in a string that need no unescaping in one pass
+            if (consumed_) {
+                if (*cur_ == '\n') {
+                    ++line_;
+                }
+                ++cur_;
+                consumed_ = false;
+            }
+
+            while (cur_ != end_) {
+                int ch = *cur_ & 0xff;
+                if (ch == '"' || ch == '\\' || ch < ' ') {
+                    break;
+                }
+
+                out.push_back(static_cast<char>(ch));
+                ++cur_;
+            }
+        }
+
         bool expect(const int expected) {
             skip_ws();
             if (getc() != expected) {
@@ -920,6 +1124,7 @@ namespace json
 
     template <typename String, typename Iter> inline bool _parse_string(String &out, input<Iter> &in) {
         while (1) {
+            in.take_plain(out);
             int ch = in.getc();
             if (ch < ' ') {
                 in.ungetc();
@@ -1025,6 +1230,32 @@ namespace json
         return num_str;
     }
 
+    inline bool _parse_integer(const std::string &num_str, double &out) {
+        // plain integers of up to 15 digits are exactly representable, and don't need strtod
+        size_t i = (num_str[0] == '-') ? 1U : 0U;
+        if (num_str.size() - i == 0U || num_str.size() - i > 15U) {
+            return false;
+        }
+
+        // leave negative zero to strtod
+        if (i == 1U && num_str.find_first_not_of('0', 1U) == std::string::npos) {
+            return false;
+        }
+
+        int64_t v = 0;
+        for (; i < num_str.size(); i++) {
+            char ch = num_str[i];
+            if (ch < '0' || ch > '9') {
+                return false;
+            }
+
+            v = v * 10 + (ch - '0');
+        }
+
+        out = static_cast<double>(num_str[0] == '-' ? -v : v);
+        return true;
+    }
+
     template <typename Context, typename Iter> inline bool _parse(Context &ctx, input<Iter> &in) {
         in.skip_ws();
         int ch = in.getc();
@@ -1057,6 +1288,11 @@ namespace json
                     return false;
                 }
 
+                if (_parse_integer(num_str, f)) {
+                    ctx.set_number(f);
+                    return true;
+                }
+
                 f = strtod(num_str.c_str(), &endp);
                 if (endp == num_str.c_str() + num_str.size()) {
                     ctx.set_number(f);
@@ -1179,7 +1415,16 @@ namespace json
 
         template <typename Iter> bool parse_object_item(input<Iter> &in, const std::string &key) {
             object &o = out_->get<object>();
-            default_parse_context ctx(&o[key], depths_);
+
+            // serialized objects list their keys in order; appending at the end of the map skips searching it
+            object::iterator it;
+            if (o.empty() || o.rbegin()->first < key) {
+                it = o.emplace_hint(o.end(), key, value());
+            } else {
+                it = o.insert(std::make_pair(key, value())).first;
+            }
+
+            default_parse_context ctx(&it->second, depths_);
             return _parse(ctx, in);
         }
 
@@ -1300,7 +1545,7 @@ namespace json
 
     inline std::string parse(value &out, const std::string &s) {
         std::string err;
-        parse(out, s.begin(), s.end(), &err);
+        parse(out, s.data(), s.data() + s.size(), &err);
         return err;
     }
 
@@ -4,7 +4,7 @@
  * GPLv2 Open Source. Use is subject to license terms.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
- *  Copyright (C) 2023 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2023-2024 Bryan Biedenkapp, N2PLL
  *
  */
 /**
@@ -25,11 +25,15 @@
 #include "common/network/rest/http/HTTPPayload.h"
 #include "common/Log.h"
 
+#include <algorithm>
+#include <cctype>
 #include <functional>
 #include <map>
 #include <string>
 #include <regex>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace network
 {
@@ -41,17 +45,35 @@ namespace network
 
         /**
          * @brief Structure representing a REST API request match.
+         * 
+         * Like a std::smatch, the first entry is the entire matched URI, and the following entries are
+         * the captured path parameters.
          * @ingroup rest
          */
-        struct RequestMatch : std::smatch {
+        struct RequestMatch {
             /**
              * @brief Initializes a new instance of the RequestMatch structure.
-             * @param m String matcher.
+             * @param m Matched URI and captured path parameters.
              * @param c Content.
              */
-            RequestMatch(const std::smatch& m, const std::string& c) : std::smatch(m), content(c) { /* stub */ }
+            RequestMatch(const std::vector<std::string>& m, const std::string& c) : content(c), m_groups(m) { /* stub */ }
+
+            /**
+             * @brief Gets the number of matched entries.
+             * @returns size_t Number of matched entries.
+             */
+            size_t size() const { return m_groups.size(); }
+            /**
+             * @brief Gets the given matched entry.
+             * @param n Index of the matched entry.
+             * @returns std::string Matched entry, or an empty string if the entry does not exist.
+             */
+            std::string str(size_t n = 0U) const { return (n < m_groups.size()) ? m_groups[n] : std::string(); }
 
             std::string content;
+
+        private:
+            std::vector<std::string> m_groups;
         };
 
         // ---------------------------------------------------------------------------
@@ -135,12 +157,13 @@ namespace network
              * @param reply HTTP reply.
              * @param what What matched.
              */
-            void handleRequest(const Request& request, Reply& reply, const std::smatch &what) {
+            void handleRequest(const Request& request, Reply& reply, const std::vector<std::string>& what) {
                 // dispatching to matching based on handler
                 RequestMatch match(what, request.content);
-                auto& handler = m_handlers[request.method];
-                if (handler) {
-                    handler(request, reply, match);
+                // lookup only; requests may be dispatched from several threads at once
+                auto it = m_handlers.find(request.method);
+                if (it != m_handlers.end() && it->second) {
+                    it->second(request, reply, match);
                 }
             }
 
@@ -166,21 +189,28 @@ namespace network
             /**
              * @brief Initializes a new instance of the RequestDispatcher class.
              */
-            RequestDispatcher() : m_basePath(), m_debug(false) { /* stub */ }
+            RequestDispatcher() : m_basePath(), m_matchers(), m_nodes(1U, RouteNode{ {}, 0U, -1 }), m_routes(), m_regexRoutes(),
+                m_partialRoutes(), m_debug(false) { /* stub */ }
             /**
              * @brief Initializes a new instance of the RequestDispatcher class.
              * @param debug Flag indicating whether or not verbose logging should be enabled.
              */
-            RequestDispatcher(bool debug) : m_basePath(), m_debug(debug) { /* stub */ }
+            RequestDispatcher(bool debug) : m_basePath(), m_matchers(), m_nodes(1U, RouteNode{ {}, 0U, -1 }), m_routes(), m_regexRoutes(),
+                m_partialRoutes(), m_debug(debug) { /* stub */ }
             /**
              * @brief Initializes a new instance of the RequestDispatcher class.
              * @param basePath 
              * @param debug Flag indicating whether or not verbose logging should be enabled.
              */
-            RequestDispatcher(const std::string& basePath, bool debug) : m_basePath(basePath), m_debug(debug) { /* stub */ }
+            RequestDispatcher(const std::string& basePath, bool debug) : m_basePath(basePath), m_matchers(), m_nodes(1U, RouteNode{ {}, 0U, -1 }),
+                m_routes(), m_regexRoutes(), m_partialRoutes(), m_debug(debug) { /* stub */ }
 
             /**
              * @brief Helper to match a request patch.
+             * 
+             * Expressions are compiled into the route table when they are registered. Plain expressions and
+             * regular expressions made only of literal and "(\\d+)" path segments are placed into a segment
+             * trie; any other regular expression is compiled once and tried after the trie.
              * @param expression Matching expression.
              * @param regex Flag indicating whether or not this match is a regular expression.
              * @returns MatcherType Instance of a request matcher.
@@ -200,6 +230,7 @@ namespace network
                 }
 
                 p->setRegEx(regex);
+                compileRoutes();
                 return *p;
             }
 
@@ -210,37 +241,57 @@ namespace network
              */
             void handleRequest(const Request& request, Reply& reply)
             {
-                for (const auto& matcher : m_matchers) {
-                    std::smatch what;
-                    if (!matcher.second->regex()) {
-                        if (request.uri.find(matcher.first) != std::string::npos) {
-                            if (m_debug) {
-                                ::LogDebug(LOG_REST, "non-regex endpoint, uri = %s, expression = %s", request.uri.c_str(), matcher.first.c_str());
-                            }
-
-                            //what = matcher.first;
-
-                            // ensure CORS headers are added
-                            reply.headers.add("Access-Control-Allow-Origin", "*");
-                            reply.headers.add("Access-Control-Allow-Methods", "*");
-                            reply.headers.add("Access-Control-Allow-Headers", "*");
-                            
-                            if (request.method == HTTP_OPTIONS) {
-                                reply.status = http::HTTPPayload::OK;
-                            }
-                            
-                            matcher.second->handleRequest(request, reply, what);
-                            return;
+                std::vector<std::string> what;
+
+                // the trie matches the URI path (without any query string or trailing slash)
+                size_t pathLen = request.uri.find('?');
+                if (pathLen == std::string::npos)
+                    pathLen = request.uri.length();
+                while (pathLen > 1U && request.uri[pathLen - 1U] == '/')
+                    pathLen--;
+
+                std::vector<std::pair<size_t, size_t>> segments;
+                splitPath(request.uri, pathLen, segments);
+
+                what.push_back(request.uri);
+                const Route* route = findRoute(0U, request.uri, segments, 0U, what);
+                if (route != nullptr) {
+                    if (m_debug) {
+                        ::LogDebug(LOG_REST, "%s endpoint, uri = %s, expression = %s", route->regex ? "regex" : "non-regex", 
+                            request.uri.c_str(), route->expression.c_str());
+                    }
+
+                    dispatch(*route, request, reply, what);
+                    return;
+                }
+
+                // regular expressions that could not be compiled into the trie
+                for (const RegExRoute& entry : m_regexRoutes) {
+                    std::smatch m;
+                    if (std::regex_match(request.uri, m, entry.pattern)) {
+                        if (m_debug) {
+                            ::LogDebug(LOG_REST, "regex endpoint, uri = %s, expression = %s", request.uri.c_str(), entry.route.expression.c_str());
                         }
-                    } else {
-                        if (std::regex_match(request.uri, what, std::regex(matcher.first))) {
-                            if (m_debug) {
-                                ::LogDebug(LOG_REST, "regex endpoint, uri = %s, expression = %s", request.uri.c_str(), matcher.first.c_str());
-                            }
-
-                            matcher.second->handleRequest(request, reply, what);
-                            return;
+
+                        what.clear();
+                        for (size_t i = 0U; i < m.size(); i++)
+                            what.push_back(m.str(i));
+
+                        dispatch(entry.route, request, reply, what);
+                        return;
+                    }
+                }
+
+                // plain expressions also match anywhere within the URI (longest expression first)
+                for (const Route& entry : m_partialRoutes) {
+                    if (request.uri.find(entry.expression) != std::string::npos) {
+                        if (m_debug) {
+                            ::LogDebug(LOG_REST, "non-regex endpoint, uri = %s, expression = %s", request.uri.c_str(), entry.expression.c_str());
                         }
+
+                        what.clear();
+                        dispatch(entry, request, reply, what);
+                        return;
                     }
                 }
 
@@ -251,10 +302,210 @@ namespace network
         private:
             typedef std::shared_ptr<MatcherType> MatcherTypePtr;
 
+            /**
+             * @brief Represents a compiled route.
+             */
+            struct Route {
+                std::string expression;
+                bool regex;
+                MatcherTypePtr matcher;
+            };
+
+            /**
+             * @brief Represents a compiled regular expression route.
+             */
+            struct RegExRoute {
+                std::regex pattern;
+                Route route;
+            };
+
+            /**
+             * @brief Represents a node of the route segment trie.
+             */
+            struct RouteNode {
+                std::unordered_map<std::string, uint32_t> children;
+                uint32_t numeric;       // child node for a "(\\d+)" path segment (0 if none)
+                int32_t route;          // index into the trie routes (-1 if none)
+            };
+
             std::string m_basePath;
             std::map<std::string, MatcherTypePtr> m_matchers;
 
+            std::vector<RouteNode> m_nodes;
+            std::vector<Route> m_routes;
+            std::vector<RegExRoute> m_regexRoutes;
+            std::vector<Route> m_partialRoutes;
+
             bool m_debug;
+
+            /**
+             * @brief Helper to split a URI path into its segments.
+             * @param uri URI.
+             * @param length Length of the URI path.
+             * @param[out] segments Offset and length of each path segment.
+             */
+            static void splitPath(const std::string& uri, size_t length, std::vector<std::pair<size_t, size_t>>& segments)
+            {
+                size_t start = 0U;
+                while (start < length) {
+                    if (uri[start] == '/') {
+                        start++;
+                        continue;
+                    }
+
+                    size_t end = uri.find('/', start);
+                    if (end == std::string::npos || end > length)
+                        end = length;
+
+                    segments.push_back(std::make_pair(start, end - start));
+                    start = end;
+                }
+            }
+
+            /**
+             * @brief Helper to (re)build the route table from the registered request matchers.
+             */
+            void compileRoutes()
+            {
+                m_nodes.clear();
+                m_nodes.push_back(RouteNode{ {}, 0U, -1 });
+                m_routes.clear();
+                m_regexRoutes.clear();
+                m_partialRoutes.clear();
+
+                for (const auto& matcher : m_matchers) {
+                    Route route = Route{ matcher.first, matcher.second->regex(), matcher.second };
+                    if (!addRoute(route)) {
+                        m_regexRoutes.push_back(RegExRoute{ std::regex(matcher.first), route });
+                    }
+
+                    if (!route.regex) {
+                        m_partialRoutes.push_back(route);
+                    }
+                }
+
+                std::stable_sort(m_partialRoutes.begin(), m_partialRoutes.end(), [](const Route& a, const Route& b) {
+                    return a.expression.length() > b.expression.length();
+                });
+            }
+
+            /**
+             * @brief Helper to add a route to the segment trie.
+             * @param route Route.
+             * @returns bool True, if the route was added to the trie, otherwise false.
+             */
+            bool addRoute(const Route& route)
+            {
+                const std::string& expression = route.expression;
+
+                std::vector<std::pair<size_t, size_t>> segments;
+                size_t length = expression.length();
+                while (length > 1U && expression[length - 1U] == '/')
+                    length--;
+                splitPath(expression, length, segments);
+
+                // check the expression can be represented in the trie before touching it
+                static const std::string NUMERIC_PARAM = "(\\d+)";
+                static const std::string REGEX_CHARS = "\\^$.|?*+()[]{}";
+                for (auto& seg : segments) {
+                    std::string segment = expression.substr(seg.first, seg.second);
+                    if (route.regex && segment != NUMERIC_PARAM && segment.find_first_of(REGEX_CHARS) != std::string::npos)
+                        return false;
+                }
+
+                uint32_t node = 0U;
+                for (auto& seg : segments) {
+                    std::string segment = expression.substr(seg.first, seg.second);
+                    if (route.regex && segment == NUMERIC_PARAM) {
+                        if (m_nodes[node].numeric == 0U) {
+                            m_nodes.push_back(RouteNode{ {}, 0U, -1 });
+                            m_nodes[node].numeric = (uint32_t)(m_nodes.size() - 1U);
+                        }
+
+                        node = m_nodes[node].numeric;
+                    }
+                    else {
+                        auto it = m_nodes[node].children.find(segment);
+                        if (it == m_nodes[node].children.end()) {
+                            m_nodes.push_back(RouteNode{ {}, 0U, -1 });
+                            uint32_t child = (uint32_t)(m_nodes.size() - 1U);
+                            m_nodes[node].children[segment] = child;
+                            node = child;
+                        }
+                        else {
+                            node = it->second;
+                        }
+                    }
+                }
+
+                if (m_nodes[node].route < 0) {
+                    m_routes.push_back(route);
+                    m_nodes[node].route = (int32_t)(m_routes.size() - 1U);
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Helper to find the route for the given URI path segments.
+             * @param node Current trie node.
+             * @param uri URI.
+             * @param segments Offset and length of each path segment.
+             * @param index Index of the current path segment.
+             * @param[out] what Captured path parameters.
+             * @returns Route* Matched route, or nullptr if no route matched.
+             */
+            const Route* findRoute(uint32_t node, const std::string& uri, const std::vector<std::pair<size_t, size_t>>& segments,
+                size_t index, std::vector<std::string>& what) const
+            {
+                const RouteNode& current = m_nodes[node];
+                if (index == segments.size()) {
+                    return (current.route >= 0) ? &m_routes[current.route] : nullptr;
+                }
+
+                std::string segment = uri.substr(segments[index].first, segments[index].second);
+
+                // literal segments take priority over path parameters
+                auto it = current.children.find(segment);
+                if (it != current.children.end()) {
+                    const Route* route = findRoute(it->second, uri, segments, index + 1U, what);
+                    if (route != nullptr)
+                        return route;
+                }
+
+                if (current.numeric != 0U && std::all_of(segment.begin(), segment.end(), [](char c) { return ::isdigit((unsigned char)c) != 0; })) {
+                    what.push_back(segment);
+                    const Route* route = findRoute(current.numeric, uri, segments, index + 1U, what);
+                    if (route != nullptr)
+                        return route;
+                    what.pop_back();
+                }
+
+                return nullptr;
+            }
+
+            /**
+             * @brief Helper to dispatch the request to the matched route.
+             * @param route Matched route.
+             * @param request HTTP request.
+             * @param reply HTTP reply.
+             * @param what What matched.
+             */
+            void dispatch(const Route& route, const Request& request, Reply& reply, const std::vector<std::string>& what)
+            {
+                if (!route.regex) {
+                    // ensure CORS headers are added
+                    reply.headers.add("Access-Control-Allow-Origin", "*");
+                    reply.headers.add("Access-Control-Allow-Methods", "*");
+                    reply.headers.add("Access-Control-Allow-Headers", "*");
+
+                    if (request.method == HTTP_OPTIONS) {
+                        reply.status = http::HTTPPayload::OK;
+                    }
+                }
+
+                route.matcher->handleRequest(request, reply, what);
+            }
         };
 
         // ---------------------------------------------------------------------------
@@ -19,6 +19,8 @@
 #include "common/network/rest/http/HTTPRequestHandler.h"
 #include "common/Thread.h"
 
+#include <atomic>
+#include <functional>
 #include <thread>
 #include <string>
 #include <signal.h>
@@ -88,6 +90,19 @@ namespace network
                     m_requestHandler = RequestHandlerType(std::forward<Handler>(handler));
                 }
 
+                /**
+                 * @brief Helper to set the handler called when the connection to the HTTP server is lost
+                 *  (or could not be established). The handler is called from the client thread.
+                 * @param handler Disconnect handler.
+                 */
+                void setDisconnectHandler(std::function<void()> handler) { m_disconnectHandler = handler; }
+
+                /**
+                 * @brief Helper to determine if the client is connected (or still connecting) to the HTTP server.
+                 * @returns bool True, if the client is connected, otherwise false.
+                 */
+                bool isConnected() const { return m_connected; }
+
                 /**
                  * @brief Send HTTP request to HTTP server.
                  * @param request HTTP request.
@@ -120,7 +135,13 @@ namespace network
                         return false;
                     }
 
-                    return run();
+                    m_connected = true;
+                    if (!run()) {
+                        m_connected = false;
+                        return false;
+                    }
+
+                    return true;
                 }
 
                 /**
@@ -148,10 +169,10 @@ namespace network
                         return;
                     }
 
-                    asio::ip::tcp::resolver resolver(m_ioContext);
-                    auto endpoints = resolver.resolve(m_address, std::to_string(m_port));
-
                     try {
+                        asio::ip::tcp::resolver resolver(m_ioContext);
+                        auto endpoints = resolver.resolve(m_address, std::to_string(m_port));
+
                         connect(endpoints);
 
                         // the entry() call will block until all asynchronous operations
@@ -160,9 +181,14 @@ namespace network
                     }
                     catch (std::exception&) { /* stub */ }
 
+                    m_connected = false;
                     if (m_connection != nullptr) {
                         m_connection->stop();
                     }
+
+                    if (!m_completed && m_disconnectHandler) {
+                        m_disconnectHandler();
+                    }
                 }
 
                 /**
@@ -185,11 +211,13 @@ namespace network
                 std::unique_ptr<ConnectionType> m_connection;
 
                 bool m_completed = false;
+                std::atomic<bool> m_connected{false};
                 asio::io_context m_ioContext;
 
                 asio::ip::tcp::socket m_socket;
 
                 RequestHandlerType m_requestHandler;
+                std::function<void()> m_disconnectHandler;
 
                 std::mutex m_lock;
             };
@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "network/rest/http/HTTPEventStream.h"
+#include "Log.h"
+
+using namespace network::rest::http;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the HTTPEventStream class. */
+
+HTTPEventStream::HTTPEventStream(size_t maxQueued) :
+    m_maxQueued(maxQueued),
+    m_queue(),
+    m_closed(false),
+    m_overflowed(false),
+    m_notifyPending(false),
+    m_notify(),
+    m_lock()
+{
+    /* stub */
+}
+
+/* Helper to format an event in the Server-Sent Events wire format. */
+
+std::string HTTPEventStream::format(const std::string& event, const std::string& data)
+{
+    std::string ret = "event: " + event + "\n";
+
+    // every line of the data is sent as its own data field
+    size_t start = 0U;
+    while (start <= data.size()) {
+        size_t end = data.find('\n', start);
+        if (end == std::string::npos)
+            end = data.size();
+
+        ret += "data: " + data.substr(start, end - start) + "\n";
+        start = end + 1U;
+    }
+
+    ret += "\n";
+    return ret;
+}
+
+/* Queues a formatted event. */
+
+bool HTTPEventStream::push(const std::string& event)
+{
+    std::function<void()> notify;
+    bool open = true;
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (m_closed) {
+            return false;
+        }
+
+        if (m_queue.size() >= m_maxQueued) {
+            // the subscriber isn't keeping up; drop it rather than queueing without bound
+            m_queue.clear();
+            m_overflowed = true;
+            m_closed = true;
+            open = false;
+            notify = m_notify;
+        }
+        else {
+            m_queue.push_back(event);
+            if (!m_notifyPending && m_notify) {
+                m_notifyPending = true;
+                notify = m_notify;
+            }
+        }
+    }
+
+    if (notify) {
+        notify();
+    }
+
+    // the stream may be closed by another thread once the lock is released; report the state this push left it in
+    return open;
+}
+
+/* Takes all queued events. */
+
+bool HTTPEventStream::take(std::string& data)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_notifyPending = false;
+
+    if (m_queue.empty()) {
+        return !m_closed;
+    }
+
+    for (const std::string& event : m_queue)
+        data += event;
+    m_queue.clear();
+    return true;
+}
+
+/* Closes the stream. */
+
+void HTTPEventStream::close()
+{
+    std::function<void()> notify;
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (m_closed) {
+            return;
+        }
+
+        m_closed = true;
+        notify = m_notify;
+    }
+
+    if (notify) {
+        notify();
+    }
+}
+
+/* Sets the handler called when events become available to take (or the stream is closed). */
+
+void HTTPEventStream::setNotify(std::function<void()>&& handler)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_notify = handler;
+    m_notifyPending = false;
+}
+
+/* Initializes a new instance of the HTTPEventPublisher class. */
+
+HTTPEventPublisher::HTTPEventPublisher(size_t maxQueued) :
+    m_maxQueued(maxQueued),
+    m_streams(),
+    m_count(0U),
+    m_lock()
+{
+    /* stub */
+}
+
+/* Finalizes a instance of the HTTPEventPublisher class. */
+
+HTTPEventPublisher::~HTTPEventPublisher()
+{
+    closeAll();
+}
+
+/* Creates a new subscriber. */
+
+std::shared_ptr<HTTPEventStream> HTTPEventPublisher::subscribe()
+{
+    std::shared_ptr<HTTPEventStream> stream = std::make_shared<HTTPEventStream>(m_maxQueued);
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_streams.push_back(stream);
+    m_count = (uint32_t)m_streams.size();
+    return stream;
+}
+
+/* Publishes an event to all subscribers. */
+
+void HTTPEventPublisher::publish(const std::string& event, json::object& data)
+{
+    if (m_count == 0U) {
+        return;
+    }
+
+    // the event is serialized once, regardless of the number of subscribers
+    std::string formatted = HTTPEventStream::format(event, json::value(data).serialize());
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    for (auto it = m_streams.begin(); it != m_streams.end();) {
+        if (!(*it)->push(formatted)) {
+            if ((*it)->isOverflowed()) {
+                ::LogWarning(LOG_REST, "event stream subscriber is not keeping up, dropping subscriber");
+            }
+
+            it = m_streams.erase(it);
+            continue;
+        }
+
+        ++it;
+    }
+
+    m_count = (uint32_t)m_streams.size();
+}
+
+/* Closes all subscribers. */
+
+void HTTPEventPublisher::closeAll()
+{
+    std::vector<std::shared_ptr<HTTPEventStream>> streams;
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        streams.swap(m_streams);
+        m_count = 0U;
+    }
+
+    for (auto& stream : streams)
+        stream->close();
+}
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file HTTPEventStream.h
+ * @ingroup http
+ * @file HTTPEventStream.cpp
+ * @ingroup http
+ */
+#if !defined(__REST_HTTP__HTTP_EVENT_STREAM_H__)
+#define __REST_HTTP__HTTP_EVENT_STREAM_H__
+
+#include "common/Defines.h"
+#include "common/network/json/json.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace network
+{
+    namespace rest
+    {
+        namespace http
+        {
+            // ---------------------------------------------------------------------------
+            //  Constants
+            // ---------------------------------------------------------------------------
+
+            /**
+             * @brief Default maximum number of events queued for a single event stream subscriber.
+             */
+            const size_t HTTP_EVENT_STREAM_MAX_QUEUED = 1024U;
+
+            // ---------------------------------------------------------------------------
+            //  Class Declaration
+            // ---------------------------------------------------------------------------
+
+            /**
+             * @brief This class implements the bounded queue of events pending for a single
+             *  Server-Sent Events (text/event-stream) subscriber.
+             *
+             * Events are pushed by the publishing thread and taken by the server connection the
+             * stream is attached to. A subscriber that falls so far behind that its queue would
+             * exceed the maximum is closed (and must subscribe again), so a stalled subscriber
+             * never holds more than a bounded amount of memory.
+             * @ingroup http
+             */
+            class HOST_SW_API HTTPEventStream {
+            public:
+                /**
+                 * @brief Initializes a new instance of the HTTPEventStream class.
+                 * @param maxQueued Maximum number of queued events.
+                 */
+                HTTPEventStream(size_t maxQueued = HTTP_EVENT_STREAM_MAX_QUEUED);
+
+                /**
+                 * @brief Helper to format an event in the Server-Sent Events wire format.
+                 * @param event Event type.
+                 * @param data Event data.
+                 * @returns std::string Formatted event.
+                 */
+                static std::string format(const std::string& event, const std::string& data);
+
+                /**
+                 * @brief Queues a formatted event.
+                 * @param event Formatted event.
+                 * @returns bool True, if the event was queued, otherwise false (the stream is closed).
+                 */
+                bool push(const std::string& event);
+                /**
+                 * @brief Takes all queued events.
+                 * @param[out] data Queued events.
+                 * @returns bool True, if the stream is open or events were taken, otherwise false.
+                 */
+                bool take(std::string& data);
+
+                /**
+                 * @brief Closes the stream.
+                 */
+                void close();
+                /**
+                 * @brief Helper to determine if the stream is closed.
+                 * @returns bool True, if the stream is closed, otherwise false.
+                 */
+                bool isClosed() const { return m_closed; }
+                /**
+                 * @brief Helper to determine if the stream was closed because its queue overflowed.
+                 * @returns bool True, if the stream overflowed, otherwise false.
+                 */
+                bool isOverflowed() const { return m_overflowed; }
+
+                /**
+                 * @brief Sets the handler called when events become available to take (or the stream
+                 *  is closed). The handler is called from the publishing thread, and is not called
+                 *  again until the queued events were taken.
+                 * @param handler Notify handler.
+                 */
+                void setNotify(std::function<void()>&& handler);
+
+            private:
+                size_t m_maxQueued;
+
+                std::deque<std::string> m_queue;
+                std::atomic<bool> m_closed;
+                std::atomic<bool> m_overflowed;
+                bool m_notifyPending;
+                std::function<void()> m_notify;
+
+                std::mutex m_lock;
+            };
+
+            // ---------------------------------------------------------------------------
+            //  Class Declaration
+            // ---------------------------------------------------------------------------
+
+            /**
+             * @brief This class implements a publisher of events to a set of Server-Sent Events
+             *  subscribers.
+             *
+             * Callers should test hasSubscribers() before building an event, so that publishing
+             * costs nothing while nobody is subscribed.
+             * @ingroup http
+             */
+            class HOST_SW_API HTTPEventPublisher {
+            public:
+                /**
+                 * @brief Initializes a new instance of the HTTPEventPublisher class.
+                 * @param maxQueued Maximum number of queued events per subscriber.
+                 */
+                HTTPEventPublisher(size_t maxQueued = HTTP_EVENT_STREAM_MAX_QUEUED);
+                /**
+                 * @brief Finalizes a instance of the HTTPEventPublisher class.
+                 */
+                ~HTTPEventPublisher();
+
+                /**
+                 * @brief Helper to determine if there are any subscribers.
+                 * @returns bool True, if there are subscribers, otherwise false.
+                 */
+                bool hasSubscribers() const { return m_count > 0U; }
+                /**
+                 * @brief Gets the number of subscribers.
+                 * @returns uint32_t Number of subscribers.
+                 */
+                uint32_t subscribers() const { return m_count; }
+
+                /**
+                 * @brief Creates a new subscriber.
+                 * @returns std::shared_ptr<HTTPEventStream> Event stream for the subscriber.
+                 */
+                std::shared_ptr<HTTPEventStream> subscribe();
+
+                /**
+                 * @brief Publishes an event to all subscribers.
+                 * @param event Event type.
+                 * @param data Event data.
+                 */
+                void publish(const std::string& event, json::object& data);
+
+                /**
+                 * @brief Closes all subscribers.
+                 */
+                void closeAll();
+
+            private:
+                size_t m_maxQueued;
+
+                std::vector<std::shared_ptr<HTTPEventStream>> m_streams;
+                std::atomic<uint32_t> m_count;
+
+                std::mutex m_lock;
+            };
+        } // namespace http
+    } // namespace rest
+} // namespace network
+
+#endif // __REST_HTTP__HTTP_EVENT_STREAM_H__
@@ -16,6 +16,7 @@
 using namespace network::rest::http;
 
 #include <cctype>
+#include <cstdlib>
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -23,10 +24,13 @@ using namespace network::rest::http;
 
 /* Initializes a new instance of the HTTPLexer class. */
 
-HTTPLexer::HTTPLexer(bool clientLexer) :
+HTTPLexer::HTTPLexer(bool clientLexer, bool parseContent) :
     m_headers(),
+    m_status(0U),
     m_clientLexer(clientLexer),
+    m_parseContent(parseContent),
     m_consumed(0U),
+    m_contentRemaining(0U),
     m_state(METHOD_START)
 {
     if (m_clientLexer) {
@@ -44,6 +48,9 @@ void HTTPLexer::reset()
     }
 
     m_headers = std::vector<LexedHeader>();
+    m_status = 0U;
+    m_consumed = 0U;
+    m_contentRemaining = 0U;
 }
 
 // ---------------------------------------------------------------------------
@@ -362,6 +369,25 @@ HTTPLexer::ResultType HTTPLexer::consume(HTTPPayload& req, char input)
                 req.headers.add(header.name, header.value);
             }
 
+            if (m_parseContent) {
+                std::string contentLength = req.headers.find("Content-Length");
+                if (contentLength != "") {
+                    char* end = nullptr;
+                    unsigned long long length = ::strtoull(contentLength.c_str(), &end, 10);
+                    if (end == contentLength.c_str() || *end != '\0' || length > HTTP_MAX_CONTENT_LENGTH)
+                        return BAD;
+
+                    req.contentLength = (size_t)length;
+                    req.content = std::string();
+                    if (length > 0U) {
+                        req.content.reserve((size_t)length);
+                        m_contentRemaining = (size_t)length;
+                        m_state = CONTENT;
+                        return INDETERMINATE;
+                    }
+                }
+            }
+
             return GOOD;
         } else {
             return BAD;
@@ -372,6 +398,15 @@ HTTPLexer::ResultType HTTPLexer::consume(HTTPPayload& req, char input)
     }
 }
 
+/* Handle a contiguous block of payload body input. */
+
+void HTTPLexer::consumeContent(HTTPPayload& req, const char* data, size_t len)
+{
+    req.content.append(data, len);
+    m_consumed += (uint32_t)len;
+    m_contentRemaining -= len;
+}
+
 /* Check if a byte is an HTTP character. */
 
 bool HTTPLexer::isChar(int c)
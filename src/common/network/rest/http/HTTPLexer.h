@@ -19,6 +19,8 @@
 
 #include "common/Defines.h"
 
+#include <algorithm>
+#include <iterator>
 #include <tuple>
 #include <vector>
 
@@ -35,6 +37,19 @@ namespace network
 
             struct HTTPPayload;
 
+            // ---------------------------------------------------------------------------
+            //  Constants
+            // ---------------------------------------------------------------------------
+
+            /**
+             * @brief Maximum length of a payload body accepted by a content parsing lexer.
+             */
+            const size_t HTTP_MAX_CONTENT_LENGTH = 4U * 1024U * 1024U;
+            /**
+             * @brief Time (in seconds) a server connection may wait for the next request before it is closed.
+             */
+            const uint32_t HTTP_KEEP_ALIVE_TIMEOUT = 30U;
+
             // ---------------------------------------------------------------------------
             //  Class Declaration
             // ---------------------------------------------------------------------------
@@ -52,8 +67,10 @@ namespace network
                 /**
                  * @brief Initializes a new instance of the HTTPLexer class.
                  * @param clientLexer Flag indicating this lexer is used for a HTTP client.
+                 * @param parseContent Flag indicating the lexer should also consume the payload body
+                 *  (as given by the Content-Length header) before reporting a complete payload.
                  */
-                HTTPLexer(bool clientLexer);
+                HTTPLexer(bool clientLexer, bool parseContent = false);
 
                 /**
                  * @brief Reset to initial parser state.
@@ -64,7 +81,8 @@ namespace network
                  * @brief Parse some data. The enum return value is good when a complete request has
                  *  been parsed, bad if the data is invalid, indeterminate when more data is
                  *  required. The InputIterator return value indicates how much of the input
-                 *  has been consumed.
+                 *  has been consumed; any input following a complete request belongs to the next
+                 *  (pipelined) request.
                  * @tparam InputIterator
                  * @param payload HTTP request payload.
                  * @param begin 
@@ -75,6 +93,17 @@ namespace network
                 std::tuple<ResultType, InputIterator> parse(HTTPPayload& payload, InputIterator begin, InputIterator end)
                 {
                     while (begin != end) {
+                        if (m_state == CONTENT) {
+                            // body bytes are copied in bulk instead of being lexed
+                            size_t len = std::min((size_t)std::distance(begin, end), m_contentRemaining);
+                            consumeContent(payload, &(*begin), len);
+                            std::advance(begin, len);
+
+                            if (m_contentRemaining == 0U)
+                                return std::make_tuple(GOOD, begin);
+                            continue;
+                        }
+
                         ResultType result = consume(payload, *begin++);
                         if (result == GOOD || result == BAD)
                             return std::make_tuple(result, begin);
@@ -95,6 +124,13 @@ namespace network
                  * @param input Character.
                  */
                 ResultType consume(HTTPPayload& payload, char input);
+                /**
+                 * @brief Handle a contiguous block of payload body input.
+                 * @param payload HTTP request payload.
+                 * @param data Body bytes.
+                 * @param len Number of body bytes.
+                 */
+                void consumeContent(HTTPPayload& payload, const char* data, size_t len);
 
                 /**
                  * @brief Check if a byte is an HTTP character.
@@ -150,7 +186,9 @@ namespace network
                 std::vector<LexedHeader> m_headers;
                 uint16_t m_status;
                 bool m_clientLexer = false;
+                bool m_parseContent;
                 uint32_t m_consumed;
+                size_t m_contentRemaining;
 
                 /**
                  * @brief Lexer machine state.
@@ -187,7 +225,9 @@ namespace network
                     HEADER_VALUE,               //! Header Value
 
                     EXPECTING_NEWLINE_2,        //!
-                    EXPECTING_NEWLINE_3         //!
+                    EXPECTING_NEWLINE_3,        //!
+
+                    CONTENT                     //! Payload Body
                 } m_state;
             };
         } // namespace http
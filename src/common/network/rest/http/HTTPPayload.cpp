@@ -267,6 +267,17 @@ namespace stock_replies {
 //  Public Class Members
 // ---------------------------------------------------------------------------
 
+/* Helper to determine if the connection should be kept open after this request. */
+
+bool HTTPPayload::isKeepAlive() const
+{
+    std::string connection = ::strtolower(headers.find("Connection"));
+    if (httpVersionMajor > 1 || (httpVersionMajor == 1 && httpVersionMinor >= 1))
+        return connection != "close";
+
+    return connection == "keep-alive";
+}
+
 /* Convert the reply into a vector of buffers. The buffers do not own the underlying memory blocks, therefore the reply object must remain valid and not be changed until the write operation has completed. */
 
 std::vector<asio::const_buffer> HTTPPayload::toBuffers()
@@ -335,6 +346,20 @@ void HTTPPayload::payload(std::string& c, HTTPPayload::StatusType s, const std::
     ensureDefaultHeaders(contentType);
 }
 
+/* Prepares payload as the start of a Server-Sent Events stream. */
+
+void HTTPPayload::eventStream(std::shared_ptr<HTTPEventStream> eventStream)
+{
+    stream = eventStream;
+    content = "";
+    status = OK;
+
+    // the stream has no length; it ends when the connection is closed
+    headers.add("Content-Type", "text/event-stream");
+    headers.add("Cache-Control", "no-cache");
+    headers.add("Server", std::string(("DVM/" __VER__)));
+}
+
 // ---------------------------------------------------------------------------
 //  Static Members
 // ---------------------------------------------------------------------------
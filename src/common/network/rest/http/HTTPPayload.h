@@ -20,7 +20,9 @@
 #include "common/Defines.h"
 #include "common/network/json/json.h"
 #include "common/network/rest/http/HTTPHeaders.h"
+#include "common/network/rest/http/HTTPEventStream.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -90,6 +92,19 @@ namespace network
 
                 bool isClientPayload = false;
 
+                /**
+                 * @brief Event stream the connection writes once this reply is sent (if any).
+                 */
+                std::shared_ptr<HTTPEventStream> stream;
+
+                /**
+                 * @brief Helper to determine if the connection should be kept open after this request.
+                 *  HTTP/1.1 requests are persistent unless they carry "Connection: close", HTTP/1.0
+                 *  requests are persistent only when they carry "Connection: keep-alive".
+                 * @returns bool True, if the connection should be kept open, otherwise false.
+                 */
+                bool isKeepAlive() const;
+
                 /**
                  * @brief Convert the payload into a vector of buffers. The buffers do not own the
                  *  underlying memory blocks, therefore the payload object must remain valid and
@@ -111,6 +126,12 @@ namespace network
                  * @param contentType HTTP content type.
                  */
                 void payload(std::string& content, StatusType status = OK, const std::string& contentType = "text/html");
+                /**
+                 * @brief Prepares payload as the start of a Server-Sent Events stream; the connection is
+                 *  kept open, and the events published to the stream are written to it as they occur.
+                 * @param eventStream Event stream.
+                 */
+                void eventStream(std::shared_ptr<HTTPEventStream> eventStream);
 
                 /**
                  * @brief Get a request payload.
@@ -25,6 +25,7 @@
 #include <signal.h>
 #include <utility>
 #include <memory>
+#include <vector>
 
 #include <asio.hpp>
 
@@ -57,13 +58,16 @@ namespace network
                  * @param address Hostname/IP Address.
                  * @param port Port.
                  * @param debug Flag indicating whether or not verbose logging should be enabled.
+                 * @param threads Number of worker threads running request handlers.
                  */
-                explicit HTTPServer(const std::string& address, uint16_t port, bool debug) :
+                explicit HTTPServer(const std::string& address, uint16_t port, bool debug, uint32_t threads = 1U) :
                     m_ioService(),
+                    m_strand(asio::make_strand(m_ioService)),
                     m_acceptor(m_ioService),
                     m_connectionManager(),
                     m_socket(m_ioService),
                     m_requestHandler(),
+                    m_handlerPool(threads > 0U ? threads : 1U),
                     m_debug(debug)
                 {
                     // open the acceptor with the option to reuse the address (i.e. SO_REUSEADDR)
@@ -105,8 +109,11 @@ namespace network
                     // the run() call will block until all asynchronous operations
                     // have finished; while the server is running, there is always at least one
                     // asynchronous operation outstanding: the asynchronous accept call waiting
-                    // for new incoming connections
+                    // for new incoming connections; request handlers run on the handler pool, so
+                    // a slow request handler does not hold up requests on other connections
                     m_ioService.run();
+
+                    m_handlerPool.join();
                 }
 
                 /**
@@ -116,18 +123,27 @@ namespace network
                 {
                     // the server is stopped by cancelling all outstanding asynchronous
                     // operations; once all operations have finished the m_ioService::run()
-                    // call will exit
-                    m_acceptor.close();
-                    m_connectionManager.stopAll();
+                    // call will exit; the acceptor is not thread-safe, so it is closed on the
+                    // strand its accept completions run on
+                    asio::dispatch(m_strand, [this]() {
+                        m_acceptor.close();
+                        m_connectionManager.stopAll();
+                    });
                 }
 
+                /**
+                 * @brief Gets the port the TCP acceptor is bound to (i.e. when opened on port 0).
+                 * @returns uint16_t Bound port.
+                 */
+                uint16_t port() const { return m_acceptor.local_endpoint().port(); }
+
             private:
                 /**
                  * @brief Perform an asynchronous accept operation.
                  */
                 void accept()
                 {
-                    m_acceptor.async_accept(m_socket, [this](asio::error_code ec) {
+                    m_acceptor.async_accept(m_socket, asio::bind_executor(m_strand, [this](asio::error_code ec) {
                         // check whether the server was stopped by a signal before this
                         // completion handler had a chance to run
                         if (!m_acceptor.is_open()) {
@@ -135,17 +151,18 @@ namespace network
                         }
 
                         if (!ec) {
-                            m_connectionManager.start(std::make_shared<ConnectionType>(std::move(m_socket), m_connectionManager, m_requestHandler, false, m_debug));
+                            m_connectionManager.start(std::make_shared<ConnectionType>(std::move(m_socket), m_connectionManager, m_requestHandler, m_handlerPool, false, m_debug));
                         }
 
                         accept();
-                    });
+                    }));
                 }
 
                 typedef ConnectionImpl<RequestHandlerType> ConnectionType;
                 typedef std::shared_ptr<ConnectionType> ConnectionTypePtr;
 
                 asio::io_service m_ioService;
+                asio::strand<asio::io_service::executor_type> m_strand;
                 asio::ip::tcp::acceptor m_acceptor;
 
                 asio::ip::tcp::endpoint m_endpoint;
@@ -155,6 +172,7 @@ namespace network
                 asio::ip::tcp::socket m_socket;
 
                 RequestHandlerType m_requestHandler;
+                asio::thread_pool m_handlerPool;
                 bool m_debug;
             };
         } // namespace http
@@ -63,10 +63,14 @@ namespace network
                 explicit SecureClientConnection(asio::ip::tcp::socket socket, asio::ssl::context& context, RequestHandlerType& handler) :
                     m_socket(std::move(socket), context),
                     m_requestHandler(handler),
-                    m_lexer(HTTPLexer(true))
+                    m_lexer(HTTPLexer(true, true))
                 {
                     m_socket.set_verify_mode(asio::ssl::verify_none);
                     m_socket.set_verify_callback(std::bind(&SecureClientConnection::verify_certificate, this, std::placeholders::_1, std::placeholders::_2));
+
+                    // requests are written as soon as they are ready; don't let them wait on the ACK of a prior request
+                    asio::error_code ignored_ec;
+                    m_socket.lowest_layer().set_option(asio::ip::tcp::no_delay(true), ignored_ec);
                 }
 
                 /**
@@ -140,71 +144,36 @@ namespace network
                 {
                     m_socket.async_read_some(asio::buffer(m_buffer), [=](asio::error_code ec, std::size_t bytes_transferred) {
                         if (!ec) {
-                            HTTPLexer::ResultType result;
-                            char* content;
-
                             try
                             {
-                                if (m_sizeToTransfer > 0U && (m_bytesTransferred + bytes_transferred) < m_sizeToTransfer) {
-                                    ::memcpy(m_fullBuffer.data() + m_bytesTransferred, m_buffer.data(), bytes_transferred);
-                                    m_bytesTransferred += bytes_transferred;
-
-                                    read();
-                                }
-                                else {
-                                    if (m_sizeToTransfer > 0U) {
-                                        // final copy
-                                        ::memcpy(m_fullBuffer.data() + m_bytesTransferred, m_buffer.data(), bytes_transferred);
-                                        m_bytesTransferred += bytes_transferred;
-
-                                        m_sizeToTransfer = 0U;
-                                        bytes_transferred = m_bytesTransferred;
-
-                                        // reset lexer and re-parse the full content
-                                        m_lexer.reset();
-                                        std::tie(result, content) = m_lexer.parse(m_request, m_fullBuffer.data(), m_fullBuffer.data() + bytes_transferred);
-                                    } else {
-                                        ::memcpy(m_fullBuffer.data() + m_bytesTransferred, m_buffer.data(), bytes_transferred);
-                                        m_bytesTransferred += bytes_transferred;
-
-                                        std::tie(result, content) = m_lexer.parse(m_request, m_buffer.data(), m_buffer.data() + bytes_transferred);
-                                    }
-
-                                    // determine content length
-                                    std::string contentLength = m_request.headers.find("Content-Length");
-                                    if (contentLength != "") {
-                                        size_t length = (size_t)::strtoul(contentLength.c_str(), NULL, 10);
+                                // a single read may complete several pipelined responses, or only part of one
+                                char* begin = m_buffer.data();
+                                char* end = m_buffer.data() + bytes_transferred;
+                                while (begin != end) {
+                                    HTTPLexer::ResultType result;
+                                    std::tie(result, begin) = m_lexer.parse(m_request, begin, end);
 
-                                        // setup a full read if necessary
-                                        if (length > bytes_transferred && m_sizeToTransfer == 0U) {
-                                            m_sizeToTransfer = length;
-                                        }
-
-                                        if (m_sizeToTransfer > 0U) {
-                                            result = HTTPLexer::CONTINUE;
-                                        } else {
-                                            m_request.content = std::string(content, length);
-                                        }
-                                    }
-
-                                    m_request.headers.add("RemoteHost", m_socket.lowest_layer().remote_endpoint().address().to_string());
                                     if (result == HTTPLexer::GOOD) {
-                                        m_sizeToTransfer = m_bytesTransferred = 0U;
+                                        asio::error_code ignored_ec;
+                                        m_request.headers.add("RemoteHost", m_socket.lowest_layer().remote_endpoint(ignored_ec).address().to_string());
                                         m_requestHandler.handleRequest(m_request, m_reply);
+
+                                        m_lexer.reset();
+                                        m_request = HTTPPayload();
                                     }
                                     else if (result == HTTPLexer::BAD) {
-                                        m_sizeToTransfer = m_bytesTransferred = 0U;
+                                        ::LogError(LOG_REST, "SecureClientConnection::read(), malformed response");
+                                        stop();
                                         return;
                                     }
-                                    else {
-                                        read();
-                                    }
                                 }
                             }
-                            catch(const std::exception& e) { ::LogError(LOG_REST, "SecureClientConnection::read(), %s", ec.message().c_str()); }
+                            catch(const std::exception& e) { ::LogError(LOG_REST, "SecureClientConnection::read(), %s", e.what()); }
+
+                            read();
                         }
                         else if (ec != asio::error::operation_aborted) {
-                            if (ec) {
+                            if (ec && ec != asio::error::eof) {
                                 ::LogError(LOG_REST, "SecureClientConnection::read(), %s, code = %u", ec.message().c_str(), ec.value());
                             }
                             stop();
@@ -220,8 +189,6 @@ namespace network
                 {
                     try
                     {
-                        m_socket.handshake(asio::ssl::stream_base::client);
-
                         auto buffers = request.toBuffers();
                         asio::write(m_socket, buffers);
                     }
@@ -248,10 +215,6 @@ namespace network
 
                 RequestHandlerType& m_requestHandler;
 
-                std::size_t m_sizeToTransfer;
-                std::size_t m_bytesTransferred;
-                std::array<char, 65535> m_fullBuffer;
-
                 std::array<char, 4096> m_buffer;
 
                 HTTPPayload m_request;
@@ -22,6 +22,7 @@
 #include "common/Utils.h"
 
 #include <array>
+#include <chrono>
 #include <memory>
 #include <utility>
 #include <iterator>
@@ -46,7 +47,10 @@ namespace network
             // ---------------------------------------------------------------------------
 
             /**
-             * @brief This class represents a single connection from a client.
+             * @brief This class represents a single connection from a client. A connection serves
+             *  requests one after another for as long as the client keeps it alive; pipelined requests
+             *  are answered in order. All operations of a connection are serialized on a strand, so the
+             *  connection may be serviced by a pool of IO threads.
              * @tparam RequestHandlerType Type representing a request handler.
              * @ingroup http
              */
@@ -65,21 +69,32 @@ namespace network
                  * @param socket TCP socket for this connection.
                  * @param manager Connection manager for this connection.
                  * @param handler Request handler for this connection.
+                 * @param handlerPool Thread pool request handlers are run on.
                  * @param persistent Flag indicating whether or not the connection is persistent.
                  * @param debug Flag indicating whether or not verbose logging should be enabled.
                  */
                 explicit ServerConnection(asio::ip::tcp::socket socket, ConnectionManagerType& manager, RequestHandlerType& handler,
-                    bool persistent = false, bool debug = false) :
+                    asio::thread_pool& handlerPool, bool persistent = false, bool debug = false) :
                     m_socket(std::move(socket)),
+                    m_strand(asio::make_strand(m_socket.get_executor())),
+                    m_timer(m_socket.get_executor()),
                     m_connectionManager(manager),
                     m_requestHandler(handler),
-                    m_lexer(HTTPLexer(false)),
-                    m_continue(false),
-                    m_contResult(HTTPLexer::INDETERMINATE),
+                    m_handlerPool(handlerPool),
+                    m_bufferOffs(0U),
+                    m_bufferLen(0U),
+                    m_lexer(HTTPLexer(false, true)),
+                    m_stream(),
+                    m_streamBuffer(),
+                    m_streamWriting(false),
+                    m_keepAlive(false),
+                    m_deadlineArmed(false),
                     m_persistent(persistent),
                     m_debug(debug)
                 {
-                    /* stub */
+                    // replies are written as soon as they are ready; don't let them wait on the ACK of a prior reply
+                    asio::error_code ignored_ec;
+                    m_socket.set_option(asio::ip::tcp::no_delay(true), ignored_ec);
                 }
 
                 /**
@@ -91,13 +106,25 @@ namespace network
                  */
                 void stop()
                 {
-                    try
-                    {
-                        if (m_socket.is_open()) {
-                            m_socket.close();
+                    // the socket may only be touched from the connection strand; a stop requested by
+                    // another thread (e.g. the server shutting down) is run on the strand
+                    auto self(this->shared_from_this());
+                    asio::dispatch(m_strand, [this, self]() {
+                        try
+                        {
+                            asio::error_code ignored_ec;
+                            m_timer.cancel(ignored_ec);
+
+                            if (m_stream != nullptr) {
+                                m_stream->close();
+                            }
+
+                            if (m_socket.is_open()) {
+                                m_socket.close();
+                            }
                         }
-                    }
-                    catch(const std::exception&) { /* ignore */ }
+                        catch(const std::exception&) { /* ignore */ }
+                    });
                 }
 
             private:
@@ -106,158 +133,279 @@ namespace network
                  */
                 void read()
                 {
-                    if (!m_persistent) {
-                        auto self(this->shared_from_this());
+                    // hold a reference to the connection until the operation completes
+                    auto self(this->shared_from_this());
+
+                    // close connections that do not complete their next request in time; the deadline is armed
+                    // once per request, so a client trickling in a request cannot extend it with partial reads
+                    if (!m_persistent && !m_deadlineArmed) {
+                        m_deadlineArmed = true;
+                        m_timer.expires_after(std::chrono::seconds(HTTP_KEEP_ALIVE_TIMEOUT));
+                        m_timer.async_wait(asio::bind_executor(m_strand, [this, self](asio::error_code ec) {
+                            // ignore an expiry that raced with the completion of the request
+                            if (!ec && m_timer.expiry() <= std::chrono::steady_clock::now()) {
+                                if (m_debug) {
+                                    LogDebug(LOG_REST, "HTTP connection request timeout");
+                                }
+
+                                m_connectionManager.stop(self);
+                            }
+                        }));
                     }
 
-                    m_socket.async_read_some(asio::buffer(m_buffer), [=](asio::error_code ec, std::size_t recvLength) {
+                    m_socket.async_read_some(asio::buffer(m_buffer), asio::bind_executor(m_strand, [this, self](asio::error_code ec, std::size_t recvLength) {
                         if (!ec) {
-                            HTTPLexer::ResultType result = HTTPLexer::GOOD;
-                            char* content;
+                            m_bufferOffs = 0U;
+                            m_bufferLen = recvLength;
+                            process();
+                        }
+                        else if (ec != asio::error::operation_aborted) {
+                            if (ec && ec != asio::error::eof && ec != asio::error::connection_reset) {
+                                ::LogError(LOG_REST, "ServerConnection::read(), %s, code = %u", ec.message().c_str(), ec.value());
+                            }
+                            m_connectionManager.stop(self);
+                        }
+                    }));
+                }
 
-                            // catch exceptions here so we don't blatently crash the system
-                            try
-                            {
-                                if (!m_continue) {
-                                    std::tie(result, content) = m_lexer.parse(m_request, m_buffer.data(), m_buffer.data() + recvLength);
-
-                                    m_request.content = std::string();
-                                    std::string contentLength = m_request.headers.find("Content-Length");
-                                    if (contentLength != "" && (::strlen(content) != 0)) {
-                                        size_t length = (size_t)::strtoul(contentLength.c_str(), NULL, 10);
-                                        m_request.contentLength = length;
-                                        m_request.content = std::string(content, length);
-                                    }
-
-                                    m_request.headers.add("RemoteHost", m_socket.remote_endpoint().address().to_string());
-
-                                    uint32_t consumed = m_lexer.consumed();
-                                    if (result == HTTPLexer::GOOD && consumed == recvLength && 
-                                        ((m_request.method == HTTP_POST) || (m_request.method == HTTP_PUT))) {
-                                        if (m_debug) {
-                                            LogDebug(LOG_REST, "HTTP Partial Request, recvLength = %u, consumed = %u, result = %u", recvLength, consumed, result);
-                                            Utils::dump(1U, "m_buffer", (uint8_t*)m_buffer.data(), recvLength);
-                                        }
-
-                                        m_contResult = result = HTTPLexer::INDETERMINATE;
-                                        m_continue = true;
-                                    }
-                                } else {
-                                    if (m_debug) {
-                                        LogDebug(LOG_REST, "HTTP Partial Request, recvLength = %u, result = %u", recvLength, result);
-                                        Utils::dump(1U, "m_buffer", (uint8_t*)m_buffer.data(), recvLength);
-                                    }
-
-                                    if (m_contResult == HTTPLexer::INDETERMINATE) {
-                                        m_request.content = std::string(m_buffer.data(), recvLength);
-                                    } else {
-                                        m_request.content.append(std::string(m_buffer.data(), recvLength));
-                                    }
-
-                                    if (m_request.contentLength != 0 && recvLength < m_request.contentLength) {
-                                        m_contResult = result = HTTPLexer::CONTINUE;
-                                        m_continue = true;
-                                    }
-                                }
+                /**
+                 * @brief Parse the buffered input, and dispatch a request once it is complete.
+                 */
+                void process()
+                {
+                    HTTPLexer::ResultType result = HTTPLexer::BAD;
+
+                    // catch exceptions here so we don't blatently crash the system
+                    try
+                    {
+                        char* consumed;
+                        std::tie(result, consumed) = m_lexer.parse(m_request, m_buffer.data() + m_bufferOffs, m_buffer.data() + m_bufferLen);
+                        m_bufferOffs = consumed - m_buffer.data();
+                    }
+                    catch(const std::exception& e) {
+                        ::LogError(LOG_REST, "ServerConnection::process(), %s", e.what());
+                        result = HTTPLexer::BAD;
+                    }
 
-                                if (result == HTTPLexer::GOOD) {
-                                    if (m_debug) {
-                                        Utils::dump(1U, "HTTP Request Content", (uint8_t*)m_request.content.c_str(), m_request.content.length());
-                                    }
+                    if (result != HTTPLexer::GOOD && result != HTTPLexer::BAD) {
+                        read();
+                        return;
+                    }
 
-                                    m_continue = false;
-                                    m_contResult = HTTPLexer::INDETERMINATE;
-                                    m_requestHandler.handleRequest(m_request, m_reply);
+                    // the request is complete, the deadline only covers receiving it
+                    asio::error_code ignored_ec;
+                    m_timer.cancel(ignored_ec);
+                    m_deadlineArmed = false;
 
-                                    if (m_debug) {
-                                        Utils::dump(1U, "HTTP Reply Content", (uint8_t*)m_reply.content.c_str(), m_reply.content.length());
-                                    }
+                    if (result == HTTPLexer::BAD) {
+                        m_keepAlive = false;
+                        m_reply = HTTPPayload::statusPayload(HTTPPayload::BAD_REQUEST);
+                        write();
+                        return;
+                    }
 
-                                    write();
-                                }
-                                else if (result == HTTPLexer::BAD) {
-                                    m_continue = false;
-                                    m_contResult = HTTPLexer::INDETERMINATE;
-                                    m_reply = HTTPPayload::statusPayload(HTTPPayload::BAD_REQUEST);
-                                    write();
-                                }
-                                else {
-                                    read();
-                                }
-                            }
-                            catch(const std::exception& e) { 
-                                ::LogError(LOG_REST, "ServerConnection::read(), %s", ec.message().c_str());
-                                m_continue = false;
-                                m_contResult = HTTPLexer::INDETERMINATE;
-                            }
-                        }
-                        else if (ec != asio::error::operation_aborted) {
-                            if (ec) {
-                                ::LogError(LOG_REST, "ServerConnection::read(), %s, code = %u", ec.message().c_str(), ec.value());
+                    m_request.headers.add("RemoteHost", m_socket.remote_endpoint(ignored_ec).address().to_string());
+                    m_keepAlive = m_persistent || m_request.isKeepAlive();
+
+                    if (m_debug) {
+                        Utils::dump(1U, "HTTP Request Content", (uint8_t*)m_request.content.c_str(), m_request.content.length());
+                    }
+
+                    // the request handler is run on the handler pool, so a slow handler does not hold up the IO thread;
+                    // the connection does no other IO until the reply is written, leaving the request and reply to the handler
+                    auto self(this->shared_from_this());
+                    asio::post(m_handlerPool, [this, self]() {
+                        handle();
+
+                        asio::post(m_strand, [this, self]() {
+                            if (m_socket.is_open()) {
+                                write();
                             }
-                            m_connectionManager.stop(this->shared_from_this());
-                            m_continue = false;
-                            m_contResult = HTTPLexer::INDETERMINATE;
-                        }
+                        });
                     });
                 }
 
+                /**
+                 * @brief Run the request handler for the current request.
+                 */
+                void handle()
+                {
+                    // catch exceptions here so we don't blatently crash the system
+                    try
+                    {
+                        m_requestHandler.handleRequest(m_request, m_reply);
+
+                        if (m_debug) {
+                            Utils::dump(1U, "HTTP Reply Content", (uint8_t*)m_reply.content.c_str(), m_reply.content.length());
+                        }
+                    }
+                    catch(const std::exception& e) {
+                        ::LogError(LOG_REST, "ServerConnection::handle(), %s", e.what());
+                        m_keepAlive = false;
+                        m_reply = HTTPPayload::statusPayload(HTTPPayload::BAD_REQUEST);
+                    }
+                }
+
                 /**
                  * @brief Perform an asynchronous write operation.
                  */
                 void write()
                 {
-                    if (!m_persistent) {
-                        auto self(this->shared_from_this());
-                    } else {
-                        m_reply.headers.add("Connection", "keep-alive");
+                    // hold a reference to the connection until the operation completes
+                    auto self(this->shared_from_this());
+
+                    // an event stream has no length, it lasts until either end closes the connection
+                    if (m_reply.stream != nullptr) {
+                        m_keepAlive = false;
+                        m_reply.headers.add("Connection", "close");
+                    }
+                    else {
+                        // a persistent connection can only find the end of a reply by its length
+                        if (m_reply.headers.find("Content-Length") == "") {
+                            m_reply.headers.add("Content-Length", std::to_string(m_reply.content.size()));
+                        }
+                        m_reply.headers.add("Connection", m_keepAlive ? "keep-alive" : "close");
                     }
 
                     auto buffers = m_reply.toBuffers();
-                    asio::async_write(m_socket, buffers, [=](asio::error_code ec, std::size_t) {
-                        if (m_persistent) {
+                    asio::async_write(m_socket, buffers, asio::bind_executor(m_strand, [this, self](asio::error_code ec, std::size_t) {
+                        if (!ec && m_reply.stream != nullptr) {
+                            stream();
+                            return;
+                        }
+
+                        if (!ec && m_keepAlive) {
                             m_lexer.reset();
                             m_reply.headers = HTTPHeaders();
                             m_reply.status = HTTPPayload::OK;
                             m_reply.content = "";
                             m_request = HTTPPayload();
-                            read();
+
+                            // continue with a pipelined request already in the buffer, otherwise wait for the next one
+                            if (m_bufferOffs < m_bufferLen) {
+                                process();
+                            }
+                            else {
+                                read();
+                            }
+                            return;
                         }
-                        else {
-                            if (!ec) {
-                                try
-                                {
-                                    // initiate graceful connection closure
-                                    asio::error_code ignored_ec;
-                                    m_socket.shutdown(asio::ip::tcp::socket::shutdown_both, ignored_ec);
-                                }
-                                catch(const std::exception& e) { ::LogError(LOG_REST, "ServerConnection::write(), %s", ec.message().c_str()); }
+
+                        if (!ec) {
+                            try
+                            {
+                                // initiate graceful connection closure
+                                asio::error_code ignored_ec;
+                                m_socket.shutdown(asio::ip::tcp::socket::shutdown_both, ignored_ec);
                             }
+                            catch(const std::exception& e) { ::LogError(LOG_REST, "ServerConnection::write(), %s", ec.message().c_str()); }
+                        }
 
-                            if (ec != asio::error::operation_aborted) {
-                                if (ec) {
-                                    ::LogError(LOG_REST, "ServerConnection::write(), %s, code = %u", ec.message().c_str(), ec.value());
-                                }
-                                m_connectionManager.stop(this->shared_from_this());
+                        if (ec != asio::error::operation_aborted) {
+                            if (ec) {
+                                ::LogError(LOG_REST, "ServerConnection::write(), %s, code = %u", ec.message().c_str(), ec.value());
                             }
+                            m_connectionManager.stop(self);
+                        }
+                    }));
+                }
+
+                /**
+                 * @brief Switch the connection to writing the events of the reply event stream.
+                 */
+                void stream()
+                {
+                    m_stream = m_reply.stream;
+
+                    // events are published by other threads; the notification only schedules the write on the strand
+                    std::weak_ptr<selfType> weak = this->shared_from_this();
+                    m_stream->setNotify([weak]() {
+                        selfTypePtr conn = weak.lock();
+                        if (conn != nullptr) {
+                            asio::post(conn->m_strand, [conn]() { conn->writeStream(); });
                         }
                     });
+
+                    readStream();
+                    writeStream();
+                }
+
+                /**
+                 * @brief Perform an asynchronous read operation on an event stream connection.
+                 */
+                void readStream()
+                {
+                    // hold a reference to the connection until the operation completes
+                    auto self(this->shared_from_this());
+
+                    // the subscriber has nothing more to send; reading only detects it going away
+                    m_socket.async_read_some(asio::buffer(m_buffer), asio::bind_executor(m_strand, [this, self](asio::error_code ec, std::size_t) {
+                        if (!ec) {
+                            readStream();
+                        }
+                        else if (ec != asio::error::operation_aborted) {
+                            m_connectionManager.stop(self);
+                        }
+                    }));
+                }
+
+                /**
+                 * @brief Perform an asynchronous write of the pending events of an event stream.
+                 */
+                void writeStream()
+                {
+                    if (m_streamWriting) {
+                        return;
+                    }
+
+                    // hold a reference to the connection until the operation completes
+                    auto self(this->shared_from_this());
+
+                    m_streamBuffer.clear();
+                    if (!m_stream->take(m_streamBuffer)) {
+                        m_connectionManager.stop(self);
+                        return;
+                    }
+
+                    if (m_streamBuffer.empty()) {
+                        return;
+                    }
+
+                    m_streamWriting = true;
+                    asio::async_write(m_socket, asio::buffer(m_streamBuffer), asio::bind_executor(m_strand, [this, self](asio::error_code ec, std::size_t) {
+                        m_streamWriting = false;
+                        if (!ec) {
+                            // events published during the write were left queued
+                            writeStream();
+                        }
+                        else if (ec != asio::error::operation_aborted) {
+                            m_connectionManager.stop(self);
+                        }
+                    }));
                 }
 
                 asio::ip::tcp::socket m_socket;
+                asio::strand<asio::ip::tcp::socket::executor_type> m_strand;
+                asio::steady_timer m_timer;
 
                 ConnectionManagerType& m_connectionManager;
                 RequestHandlerType& m_requestHandler;
+                asio::thread_pool& m_handlerPool;
 
                 std::array<char, 8192> m_buffer;
+                size_t m_bufferOffs;
+                size_t m_bufferLen;
 
                 HTTPPayload m_request;
                 HTTPLexer m_lexer;
                 HTTPPayload m_reply;
 
-                bool m_continue;
-                HTTPLexer::ResultType m_contResult;
+                std::shared_ptr<HTTPEventStream> m_stream;
+                std::string m_streamBuffer;
+                bool m_streamWriting;
 
+                bool m_keepAlive;
+                bool m_deadlineArmed;
                 bool m_persistent;
                 bool m_debug;
             };
@@ -27,6 +27,8 @@
 #include "common/p25/dfsi/frames/MotVoiceHeader2.h"
 #include "common/p25/dfsi/frames/MotTSBKFrame.h"
 #include "common/p25/dfsi/frames/MotPDUFrame.h"
+#include "common/p25/dfsi/frames/MotVoiceFrameView.h"
+#include "common/p25/dfsi/frames/MotLDUSuperframe.h"
 
 // FSC
 #include "common/p25/dfsi/frames/fsc/FSCMessage.h"
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/p25/dfsi/frames/MotLDUSuperframe.h"
+#include "common/p25/dfsi/frames/MotVoiceFrameView.h"
+
+#include <cassert>
+#include <cstring>
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::dfsi;
+using namespace p25::dfsi::defines;
+using namespace p25::dfsi::frames;
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint8_t MotLDUSuperframe::FRAME_COUNT;
+const uint32_t MotLDUSuperframe::LENGTH;
+
+const uint32_t MotLDUSuperframe::LDU_IMBE_OFFSETS[MotLDUSuperframe::FRAME_COUNT] = { 10U, 26U, 55U, 80U, 105U, 130U, 155U, 180U, 204U };
+
+/* offsets of each voice frame within the superframe buffer */
+static const uint32_t FRAME_OFFSETS[MotLDUSuperframe::FRAME_COUNT] = { 0U, 22U, 36U, 53U, 70U, 87U, 104U, 121U, 138U };
+/* lengths of each voice frame within the superframe buffer */
+static const uint32_t FRAME_LENGTHS[MotLDUSuperframe::FRAME_COUNT] = { 22U, 14U, 17U, 17U, 17U, 17U, 17U, 17U, 16U };
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the MotLDUSuperframe class. */
+
+MotLDUSuperframe::MotLDUSuperframe() :
+    m_duid(DUID::LDU1),
+    m_rt(RTFlag::DISABLED),
+    m_icw(ICWFlag::DIU),
+    m_source(SourceFlag::QUANTAR),
+    m_lsd1(0U),
+    m_lsd2(0U),
+    m_rs()
+{
+    ::memset(m_rs, 0x00U, P25_LDU_LC_FEC_LENGTH_BYTES);
+}
+
+/* Decode a superframe of voice frames. */
+
+bool MotLDUSuperframe::decode(const uint8_t* data, uint32_t length, uint8_t* ldu)
+{
+    assert(data != nullptr);
+    assert(ldu != nullptr);
+
+    if (length < LENGTH)
+        return false;
+
+    DFSIFrameType::E first = (DFSIFrameType::E)data[0U];
+    if (first != DFSIFrameType::LDU1_VOICE1 && first != DFSIFrameType::LDU2_VOICE10)
+        return false;
+
+    m_duid = (first == DFSIFrameType::LDU1_VOICE1) ? DUID::LDU1 : DUID::LDU2;
+    m_rt = (RTFlag::E)data[2U];
+    m_icw = (ICWFlag::E)data[5U];
+
+    for (uint8_t n = 0U; n < FRAME_COUNT; n++) {
+        MotVoiceFrameView voice = MotVoiceFrameView(data + FRAME_OFFSETS[n]);
+        if (voice.getFrameType() != (DFSIFrameType::E)(first + n))
+            return false;
+
+        ::memcpy(ldu + LDU_IMBE_OFFSETS[n], voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+
+        const uint8_t* additionalData = voice.getAdditionalData();
+        if (n == 0U) {
+            m_source = voice.getSource();
+        }
+        else if (n == 8U) {
+            m_lsd1 = additionalData[0U];
+            m_lsd2 = additionalData[1U];
+        }
+        else if (additionalData != nullptr) {
+            ::memcpy(m_rs + ((n - 2U) * 3U), additionalData, 3U);
+        }
+    }
+
+    return true;
+}
+
+/* Encode a superframe of voice frames. */
+
+uint32_t MotLDUSuperframe::encode(uint8_t* data, const uint8_t* ldu)
+{
+    assert(data != nullptr);
+    assert(ldu != nullptr);
+
+    DFSIFrameType::E first = (m_duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE1 : DFSIFrameType::LDU2_VOICE10;
+    for (uint8_t n = 0U; n < FRAME_COUNT; n++) {
+        MotVoiceFrameView voice = MotVoiceFrameView(data + FRAME_OFFSETS[n]);
+        voice.initialize((DFSIFrameType::E)(first + n));
+        voice.setIMBE(ldu + LDU_IMBE_OFFSETS[n]);
+
+        switch (n) {
+        case 0U: // VOICE1/10
+            voice.setRT(m_rt);
+            voice.setICW(m_icw);
+            voice.setSource(m_source);
+            break;
+        case 1U: // VOICE2/11
+            voice.setSource(m_source);
+            break;
+        case 8U: // VOICE9/18
+        {
+            uint8_t lsd[2U] = { m_lsd1, m_lsd2 };
+            voice.setAdditionalData(lsd, 2U);
+        }
+        break;
+        default: // VOICE3 - 8/12 - 17
+            voice.setAdditionalData(m_rs + ((n - 2U) * 3U), 3U);
+            break;
+        }
+    }
+
+    return LENGTH;
+}
+
+/* Gets the Reed-Solomon coded link control/encryption sync data. */
+
+void MotLDUSuperframe::getRS(uint8_t* rs) const
+{
+    assert(rs != nullptr);
+    ::memcpy(rs, m_rs, P25_LDU_LC_FEC_LENGTH_BYTES);
+}
+
+/* Sets the Reed-Solomon coded link control/encryption sync data. */
+
+void MotLDUSuperframe::setRS(const uint8_t* rs)
+{
+    assert(rs != nullptr);
+    ::memcpy(m_rs, rs, P25_LDU_LC_FEC_LENGTH_BYTES);
+}
+
+/* Gets the offset of the given voice frame within the superframe buffer. */
+
+uint32_t MotLDUSuperframe::frameOffset(uint8_t n)
+{
+    assert(n < FRAME_COUNT);
+    return FRAME_OFFSETS[n];
+}
+
+/* Gets the length of the given voice frame within the superframe buffer. */
+
+uint32_t MotLDUSuperframe::frameLength(uint8_t n)
+{
+    assert(n < FRAME_COUNT);
+    return FRAME_LENGTHS[n];
+}
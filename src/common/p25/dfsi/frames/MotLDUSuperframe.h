@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file MotLDUSuperframe.h
+ * @ingroup dfsi_frames
+ * @file MotLDUSuperframe.cpp
+ * @ingroup dfsi_frames
+ */
+#if !defined(__MOT_LDU_SUPERFRAME_H__)
+#define __MOT_LDU_SUPERFRAME_H__
+
+#include "Defines.h"
+#include "common/Defines.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/dfsi/DFSIDefines.h"
+#include "common/p25/dfsi/frames/FrameDefines.h"
+
+namespace p25
+{
+    namespace dfsi
+    {
+        namespace frames
+        {
+            // ---------------------------------------------------------------------------
+            //  Class Declaration
+            // ---------------------------------------------------------------------------
+
+            /**
+             * @brief Implements batch conversion of a whole P25 LDU1/LDU2 superframe to and from the 9 Motorola
+             *  voice frames (VOICE1 - VOICE9 or VOICE10 - VOICE18) that carry it.
+             *
+             * The voice frames are laid out back to back in a single contiguous buffer of LENGTH bytes; use
+             * frameOffset() and frameLength() to locate the individual frames within the buffer. The IMBE
+             * codewords are read from (and written to) a LDU buffer using the same layout as the network
+             * LDU buffers (see LDU_IMBE_OFFSETS).
+             * @ingroup dfsi_frames
+             */
+            class HOST_SW_API MotLDUSuperframe {
+            public:
+                static const uint8_t FRAME_COUNT = 9U;
+                static const uint32_t LENGTH = 154U;
+
+                static const uint32_t LDU_IMBE_OFFSETS[FRAME_COUNT];
+
+                /**
+                 * @brief Initializes a new instance of the MotLDUSuperframe class.
+                 */
+                MotLDUSuperframe();
+
+                /**
+                 * @brief Decode a superframe of voice frames.
+                 * @param[in] data Buffer containing the voice frames to decode.
+                 * @param length Length of the buffer.
+                 * @param[out] ldu Buffer to copy the IMBE codewords into.
+                 * @returns bool True, if the voice frames were decoded, otherwise false.
+                 */
+                bool decode(const uint8_t* data, uint32_t length, uint8_t* ldu);
+                /**
+                 * @brief Encode a superframe of voice frames.
+                 * @param[out] data Buffer to encode the voice frames into (must be at least LENGTH bytes).
+                 * @param[in] ldu Buffer containing the IMBE codewords.
+                 * @returns uint32_t Number of bytes encoded.
+                 */
+                uint32_t encode(uint8_t* data, const uint8_t* ldu);
+
+                /**
+                 * @brief Gets the Reed-Solomon coded link control/encryption sync data.
+                 * @param[out] rs Buffer to copy the RS data into (P25_LDU_LC_FEC_LENGTH_BYTES).
+                 */
+                void getRS(uint8_t* rs) const;
+                /**
+                 * @brief Sets the Reed-Solomon coded link control/encryption sync data.
+                 * @param[in] rs Buffer containing the RS data (P25_LDU_LC_FEC_LENGTH_BYTES).
+                 */
+                void setRS(const uint8_t* rs);
+
+                /**
+                 * @brief Gets the offset of the given voice frame within the superframe buffer.
+                 * @param n Voice frame index (0 - 8).
+                 * @returns uint32_t Offset of the voice frame.
+                 */
+                static uint32_t frameOffset(uint8_t n);
+                /**
+                 * @brief Gets the length of the given voice frame within the superframe buffer.
+                 * @param n Voice frame index (0 - 8).
+                 * @returns uint32_t Length of the voice frame.
+                 */
+                static uint32_t frameLength(uint8_t n);
+
+            public:
+                /**
+                 * @brief P25 DUID (LDU1 or LDU2).
+                 */
+                __PROPERTY(p25::defines::DUID::E, duid, DUID);
+                /**
+                 * @brief RT/RT Flag.
+                 */
+                __PROPERTY(RTFlag::E, rt, RT);
+                /**
+                 * @brief ICW Flag.
+                 */
+                __PROPERTY(ICWFlag::E, icw, ICW);
+                /**
+                 * @brief V.24 Data Source (for VOICE1/2 and VOICE10/11).
+                 */
+                __PROPERTY(SourceFlag::E, source, Source);
+                /**
+                 * @brief Low Speed Data 1.
+                 */
+                __PROPERTY(uint8_t, lsd1, LSD1);
+                /**
+                 * @brief Low Speed Data 2.
+                 */
+                __PROPERTY(uint8_t, lsd2, LSD2);
+
+            private:
+                uint8_t m_rs[p25::defines::P25_LDU_LC_FEC_LENGTH_BYTES];
+            };
+        } // namespace frames
+    } // namespace dfsi
+} // namespace p25
+
+#endif // __MOT_LDU_SUPERFRAME_H__
@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/p25/dfsi/frames/MotVoiceFrameView.h"
+#include "common/p25/dfsi/frames/MotStartOfStream.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/dfsi/DFSIDefines.h"
+
+#include <cassert>
+#include <cstring>
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::dfsi;
+using namespace p25::dfsi::defines;
+using namespace p25::dfsi::frames;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the MotVoiceFrameView class. */
+
+MotVoiceFrameView::MotVoiceFrameView(uint8_t* data) :
+    m_data(data),
+    m_readOnly(false)
+{
+    assert(data != nullptr);
+}
+
+/* Initializes a new instance of the MotVoiceFrameView class. */
+
+MotVoiceFrameView::MotVoiceFrameView(const uint8_t* data) :
+    m_data(const_cast<uint8_t*>(data)),
+    m_readOnly(true)
+{
+    assert(data != nullptr);
+}
+
+/* Helper to initialize the fixed fields of a voice frame in the buffer. */
+
+void MotVoiceFrameView::initialize(DFSIFrameType::E frameType)
+{
+    assert(!m_readOnly);
+    assert(isVoice(frameType));
+
+    ::memset(m_data, 0x00U, length(frameType));
+    m_data[0U] = frameType;
+
+    if (frameType == DFSIFrameType::LDU1_VOICE1 || frameType == DFSIFrameType::LDU2_VOICE10) {
+        m_data[1U] = MotStartOfStream::FIXED_MARKER;
+        m_data[2U] = RTFlag::DISABLED;
+        m_data[3U] = StartStopFlag::START;
+        m_data[4U] = StreamTypeFlag::VOICE;
+        m_data[5U] = ICWFlag::DIU;
+        m_data[7U] = RssiValidityFlag::INVALID;
+    }
+
+    setSource(SourceFlag::QUANTAR);
+}
+
+/* Sets the raw IMBE codeword in the buffer. */
+
+void MotVoiceFrameView::setIMBE(const uint8_t* imbe)
+{
+    assert(!m_readOnly);
+    assert(imbe != nullptr);
+
+    ::memcpy(m_data + imbeOffset(getFrameType()), imbe, RAW_IMBE_LENGTH_BYTES);
+}
+
+/* Gets a pointer to the additional data in the buffer. */
+
+const uint8_t* MotVoiceFrameView::getAdditionalData() const
+{
+    // VOICE1/2/10/11 carry no additional data
+    uint32_t offset = imbeOffset(getFrameType());
+    if (offset != 4U && offset != 5U)
+        return nullptr;
+
+    return m_data + 1U;
+}
+
+/* Sets the additional data in the buffer. */
+
+void MotVoiceFrameView::setAdditionalData(const uint8_t* data, uint8_t length)
+{
+    assert(!m_readOnly);
+    assert(data != nullptr);
+
+    if (getAdditionalData() == nullptr)
+        return;
+
+    // the additional data runs right up to the IMBE codeword (which is 1 byte shorter for VOICE9/18)
+    uint32_t maxLength = imbeOffset(getFrameType()) - 1U;
+    if (length > maxLength)
+        length = (uint8_t)maxLength;
+
+    ::memcpy(m_data + 1U, data, length);
+}
+
+/* Gets the V.24 data source. */
+
+SourceFlag::E MotVoiceFrameView::getSource() const
+{
+    return (SourceFlag::E)m_data[imbeOffset(getFrameType()) + RAW_IMBE_LENGTH_BYTES];
+}
+
+/* Sets the V.24 data source. */
+
+void MotVoiceFrameView::setSource(SourceFlag::E source)
+{
+    assert(!m_readOnly);
+    m_data[imbeOffset(getFrameType()) + RAW_IMBE_LENGTH_BYTES] = source;
+}
+
+/* Sets the RT/RT flag (VOICE1/10 only). */
+
+void MotVoiceFrameView::setRT(RTFlag::E rt)
+{
+    assert(!m_readOnly);
+    if (getFrameType() == DFSIFrameType::LDU1_VOICE1 || getFrameType() == DFSIFrameType::LDU2_VOICE10)
+        m_data[2U] = rt;
+}
+
+/* Sets the ICW flag (VOICE1/10 only). */
+
+void MotVoiceFrameView::setICW(ICWFlag::E icw)
+{
+    assert(!m_readOnly);
+    if (getFrameType() == DFSIFrameType::LDU1_VOICE1 || getFrameType() == DFSIFrameType::LDU2_VOICE10)
+        m_data[5U] = icw;
+}
+
+/* Helper indicating if the given frame type is a voice frame. */
+
+bool MotVoiceFrameView::isVoice(DFSIFrameType::E frameType)
+{
+    return (frameType >= DFSIFrameType::LDU1_VOICE1 && frameType <= DFSIFrameType::LDU2_VOICE18);
+}
+
+/* Gets the length of the given voice frame type. */
+
+uint32_t MotVoiceFrameView::length(DFSIFrameType::E frameType)
+{
+    switch (frameType) {
+    case DFSIFrameType::LDU1_VOICE1:
+    case DFSIFrameType::LDU2_VOICE10:
+        return DFSI_LDU1_VOICE1_FRAME_LENGTH_BYTES;
+    case DFSIFrameType::LDU1_VOICE2:
+    case DFSIFrameType::LDU2_VOICE11:
+        return DFSI_LDU1_VOICE2_FRAME_LENGTH_BYTES;
+    case DFSIFrameType::LDU1_VOICE9:
+    case DFSIFrameType::LDU2_VOICE18:
+        return DFSI_LDU1_VOICE9_FRAME_LENGTH_BYTES;
+    default:
+        return DFSI_LDU1_VOICE3_FRAME_LENGTH_BYTES;
+    }
+}
+
+/* Gets the offset of the IMBE codeword in the given voice frame type. */
+
+uint32_t MotVoiceFrameView::imbeOffset(DFSIFrameType::E frameType)
+{
+    switch (frameType) {
+    case DFSIFrameType::LDU1_VOICE1:
+    case DFSIFrameType::LDU2_VOICE10:
+        return 10U;
+    case DFSIFrameType::LDU1_VOICE2:
+    case DFSIFrameType::LDU2_VOICE11:
+        return 1U;
+    // frames 0x6A and 0x73 are missing the 0x00 padding byte, so IMBE data starts 1 byte earlier
+    case DFSIFrameType::LDU1_VOICE9:
+    case DFSIFrameType::LDU2_VOICE18:
+        return 4U;
+    default:
+        return 5U;
+    }
+}
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file MotVoiceFrameView.h
+ * @ingroup dfsi_frames
+ * @file MotVoiceFrameView.cpp
+ * @ingroup dfsi_frames
+ */
+#if !defined(__MOT_VOICE_FRAME_VIEW_H__)
+#define __MOT_VOICE_FRAME_VIEW_H__
+
+#include "Defines.h"
+#include "common/Defines.h"
+#include "common/p25/dfsi/DFSIDefines.h"
+#include "common/p25/dfsi/frames/FrameDefines.h"
+
+namespace p25
+{
+    namespace dfsi
+    {
+        namespace frames
+        {
+            // ---------------------------------------------------------------------------
+            //  Class Declaration
+            // ---------------------------------------------------------------------------
+
+            /**
+             * @brief Implements a non-owning view over a P25 Motorola voice frame (VOICE1 - VOICE18) held in
+             *  a transport buffer.
+             *
+             * Unlike MotFullRateVoice and MotStartVoiceFrame, this does not copy any data out of the buffer; all
+             * fields are read from, and written to, the buffer the view was created over. The buffer must be at
+             * least size() bytes in length and must outlive the view.
+             *
+             * Voice frame layouts:
+             * \code{.unparsed}
+             * VOICE1/10     FT | Start of Stream (4) | ICW | RSSI | RSSI Valid | nRSSI | Adj MM | IMBE (11) | Src
+             * VOICE2/11     FT | IMBE (11) | Src
+             * VOICE3-8/12-17 FT | Addtl Data (4) | IMBE (11) | Src
+             * VOICE9/18     FT | Addtl Data (3) | IMBE (11) | Src
+             * \endcode
+             * @ingroup dfsi_frames
+             */
+            class HOST_SW_API MotVoiceFrameView {
+            public:
+                /**
+                 * @brief Initializes a new instance of the MotVoiceFrameView class.
+                 * @param data Buffer containing a voice frame to read and write.
+                 */
+                MotVoiceFrameView(uint8_t* data);
+                /**
+                 * @brief Initializes a new instance of the MotVoiceFrameView class.
+                 * @param data Buffer containing a voice frame to read.
+                 */
+                MotVoiceFrameView(const uint8_t* data);
+
+                /**
+                 * @brief Helper to initialize the fixed fields of a voice frame in the buffer.
+                 * @param frameType DFSI voice frame type.
+                 */
+                void initialize(defines::DFSIFrameType::E frameType);
+
+                /**
+                 * @brief Gets the DFSI frame type.
+                 * @returns DFSIFrameType::E DFSI frame type.
+                 */
+                defines::DFSIFrameType::E getFrameType() const { return (defines::DFSIFrameType::E)m_data[0U]; }
+                /**
+                 * @brief Helper indicating if the buffer contains a voice frame.
+                 * @returns bool True, if the buffer contains a voice frame, otherwise false.
+                 */
+                bool isVoice() const { return isVoice(getFrameType()); }
+                /**
+                 * @brief Gets the length of the voice frame.
+                 * @returns uint32_t Length of the voice frame in bytes.
+                 */
+                uint32_t size() const { return length(getFrameType()); }
+
+                /**
+                 * @brief Gets a pointer to the raw IMBE codeword in the buffer.
+                 * @returns const uint8_t* Pointer to the IMBE codeword.
+                 */
+                const uint8_t* getIMBE() const { return m_data + imbeOffset(getFrameType()); }
+                /**
+                 * @brief Sets the raw IMBE codeword in the buffer.
+                 * @param[in] imbe Buffer containing the IMBE codeword.
+                 */
+                void setIMBE(const uint8_t* imbe);
+
+                /**
+                 * @brief Gets a pointer to the additional data in the buffer.
+                 * @returns const uint8_t* Pointer to the additional data, or nullptr if the frame has none.
+                 */
+                const uint8_t* getAdditionalData() const;
+                /**
+                 * @brief Sets the additional data in the buffer.
+                 * @param[in] data Buffer containing the additional data.
+                 * @param length Length of the additional data.
+                 */
+                void setAdditionalData(const uint8_t* data, uint8_t length);
+
+                /**
+                 * @brief Gets the V.24 data source.
+                 * @returns SourceFlag::E V.24 data source.
+                 */
+                SourceFlag::E getSource() const;
+                /**
+                 * @brief Sets the V.24 data source.
+                 * @param source V.24 data source.
+                 */
+                void setSource(SourceFlag::E source);
+
+                /**
+                 * @brief Sets the RT/RT flag (VOICE1/10 only).
+                 * @param rt RT/RT flag.
+                 */
+                void setRT(RTFlag::E rt);
+                /**
+                 * @brief Sets the ICW flag (VOICE1/10 only).
+                 * @param icw ICW flag.
+                 */
+                void setICW(ICWFlag::E icw);
+
+                /**
+                 * @brief Helper indicating if the given frame type is a voice frame.
+                 * @param frameType DFSI frame type.
+                 * @returns bool True, if the frame type is a voice frame, otherwise false.
+                 */
+                static bool isVoice(defines::DFSIFrameType::E frameType);
+                /**
+                 * @brief Gets the length of the given voice frame type.
+                 * @param frameType DFSI frame type.
+                 * @returns uint32_t Length of the voice frame in bytes.
+                 */
+                static uint32_t length(defines::DFSIFrameType::E frameType);
+                /**
+                 * @brief Gets the offset of the IMBE codeword in the given voice frame type.
+                 * @param frameType DFSI frame type.
+                 * @returns uint32_t Offset of the IMBE codeword.
+                 */
+                static uint32_t imbeOffset(defines::DFSIFrameType::E frameType);
+
+            private:
+                uint8_t* m_data;
+                bool m_readOnly;
+            };
+        } // namespace frames
+    } // namespace dfsi
+} // namespace p25
+
+#endif // __MOT_VOICE_FRAME_VIEW_H__
@@ -79,7 +79,8 @@ TDULC::TDULC() :
     m_siteIdenEntry(lookups::IdenTable()),
     m_rs(),
     m_implicit(false),
-    m_callTimer(0U)
+    m_callTimer(0U),
+    m_decodedRS(nullptr)
 {
     m_grpVchNo = m_siteData.channelNo();
 }
@@ -143,6 +144,12 @@ bool TDULC::decode(const uint8_t* data, uint8_t* payload)
     assert(data != nullptr);
     assert(payload != nullptr);
 
+    // if the factory already decoded the FEC for this TDULC, there is no reason to decode it again
+    if (m_decodedRS != nullptr) {
+        ::memcpy(payload, m_decodedRS + 1U, P25_TDULC_PAYLOAD_LENGTH_BYTES);
+        return true;
+    }
+
     uint8_t rs[P25_TDULC_LENGTH_BYTES];
     ::memset(rs, 0x00U, P25_TDULC_LENGTH_BYTES);
 
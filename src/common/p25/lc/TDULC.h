@@ -37,6 +37,7 @@ namespace p25
 
         class HOST_SW_API LC;
         class HOST_SW_API TSBK;
+        namespace tdulc { class HOST_SW_API TDULCFactory; }
 
         // ---------------------------------------------------------------------------
         //  Class Declaration
@@ -194,6 +195,10 @@ namespace p25
             void encode(uint8_t* data, const uint8_t* payload);
 
             __PROTECTED_COPY(TDULC);
+
+        private:
+            friend class tdulc::TDULCFactory;
+            const uint8_t* m_decodedRS;
         };
     } // namespace lc
 } // namespace p25
@@ -88,7 +88,11 @@ TSBK::TSBK() :
     m_siteIdenEntry(lookups::IdenTable()),
     m_rs(),
     m_trellis(),
-    m_raw(nullptr)
+    m_raw(nullptr),
+    m_preDecoded(false),
+    m_encodedValid(),
+    m_encodedTSBK(),
+    m_encodedFEC()
 {
     if (m_siteCallsign == nullptr) {
         m_siteCallsign = new uint8_t[MOT_CALLSIGN_LENGTH_BYTES];
@@ -200,7 +204,8 @@ bool TSBK::decode(const uint8_t* data, uint8_t* payload, bool rawTSBK)
     {
         ::memcpy(tsbk, data, P25_TSBK_LENGTH_BYTES);
 
-        bool ret = edac::CRC::checkCCITT162(tsbk, P25_TSBK_LENGTH_BYTES);
+        // if the factory already decoded and CRC checked this TSBK, there is no reason to check it again
+        bool ret = m_preDecoded || edac::CRC::checkCCITT162(tsbk, P25_TSBK_LENGTH_BYTES);
         if (!ret) {
             if (m_warnCRC) {
                 // if we're already warning instead of erroring CRC, don't announce invalid CRC in the 
@@ -252,7 +257,8 @@ bool TSBK::decode(const uint8_t* data, uint8_t* payload, bool rawTSBK)
         Utils::dump(2U, "TSBK::decode(), TSBK Value", tsbk, P25_TSBK_LENGTH_BYTES);
     }
 
-    m_raw = new uint8_t[P25_TSBK_LENGTH_BYTES];
+    if (m_raw == nullptr)
+        m_raw = new uint8_t[P25_TSBK_LENGTH_BYTES];
     ::memcpy(m_raw, tsbk, P25_TSBK_LENGTH_BYTES);
 
     m_lco = tsbk[0U] & 0x3F;                                                        // LCO
@@ -278,18 +284,31 @@ void TSBK::encode(uint8_t* data, const uint8_t* payload, bool rawTSBK, bool noTr
     tsbk[0U] |= (m_lastBlock) ? 0x80U : 0x00U;                                      // Last Block Marker
     tsbk[1U] = m_mfId;                                                              // Mfg Id.
 
-    // compute CRC-CCITT 16
-    edac::CRC::addCCITT162(tsbk, P25_TSBK_LENGTH_BYTES);
+    uint8_t raw[P25_TSBK_FEC_LENGTH_BYTES];
+    ::memset(raw, 0x00U, P25_TSBK_FEC_LENGTH_BYTES);
 
-    if (m_verbose) {
-        Utils::dump(2U, "TSBK::encode(), TSBK Value", tsbk, P25_TSBK_LENGTH_BYTES);
+    // instances that are reused to repeatedly encode the same block (i.e. control channel broadcasts) only
+    // need the CRC and Trellis coding computed when the block content actually changes
+    uint8_t cacheIdx = m_lastBlock ? 1U : 0U;
+    if (m_encodedValid[cacheIdx] && ::memcmp(m_encodedTSBK[cacheIdx], tsbk, P25_TSBK_LENGTH_BYTES - 2U) == 0) {
+        ::memcpy(tsbk, m_encodedTSBK[cacheIdx], P25_TSBK_LENGTH_BYTES);
+        ::memcpy(raw, m_encodedFEC[cacheIdx], P25_TSBK_FEC_LENGTH_BYTES);
     }
+    else {
+        // compute CRC-CCITT 16
+        edac::CRC::addCCITT162(tsbk, P25_TSBK_LENGTH_BYTES);
 
-    uint8_t raw[P25_TSBK_FEC_LENGTH_BYTES];
-    ::memset(raw, 0x00U, P25_TSBK_FEC_LENGTH_BYTES);
+        // encode 1/2 rate Trellis
+        m_trellis.encode12(tsbk, raw);
+
+        ::memcpy(m_encodedTSBK[cacheIdx], tsbk, P25_TSBK_LENGTH_BYTES);
+        ::memcpy(m_encodedFEC[cacheIdx], raw, P25_TSBK_FEC_LENGTH_BYTES);
+        m_encodedValid[cacheIdx] = true;
+    }
 
-    // encode 1/2 rate Trellis
-    m_trellis.encode12(tsbk, raw);
+    if (m_verbose) {
+        Utils::dump(2U, "TSBK::encode(), TSBK Value", tsbk, P25_TSBK_LENGTH_BYTES);
+    }
 
     // are we encoding a raw TSBK?
     if (rawTSBK) {
@@ -20,6 +20,7 @@
 #include "common/edac/Trellis.h"
 #include "common/p25/lc/LC.h"
 #include "common/p25/lc/TDULC.h"
+#include "common/p25/P25Defines.h"
 #include "common/p25/SiteData.h"
 #include "common/edac/RS634717.h"
 #include "common/lookups/IdenTableLookup.h"
@@ -46,6 +47,7 @@ namespace p25
 
         class HOST_SW_API LC;
         class HOST_SW_API TDULC;
+        namespace tsbk { class HOST_SW_API TSBKFactory; }
 
         // ---------------------------------------------------------------------------
         //  Class Declaration
@@ -277,7 +279,14 @@ namespace p25
             __PROTECTED_COPY(TSBK);
 
         private:
+            friend class tsbk::TSBKFactory;
             uint8_t* m_raw;
+
+            bool m_preDecoded;
+
+            bool m_encodedValid[2U];
+            uint8_t m_encodedTSBK[2U][defines::P25_TSBK_LENGTH_BYTES];
+            uint8_t m_encodedFEC[2U][defines::P25_TSBK_FEC_LENGTH_BYTES];
         };
     } // namespace lc
 } // namespace p25
@@ -74,11 +74,11 @@ std::unique_ptr<TDULC> TDULCFactory::createTDULC(const uint8_t* data)
     // standard P25 reference opcodes
     switch (lco) {
     case LCO::GROUP:
-        return decode(new LC_GROUP(), data);
+        return decode(new LC_GROUP(), data, rs);
     case LCO::PRIVATE:
-        return decode(new LC_PRIVATE(), data);
+        return decode(new LC_PRIVATE(), data, rs);
     case LCO::TEL_INT_VCH_USER:
-        return decode(new LC_TEL_INT_VCH_USER(), data);
+        return decode(new LC_TEL_INT_VCH_USER(), data, rs);
     default:
         LogError(LOG_P25, "TDULCFactory::create(), unknown TDULC LCO value, lco = $%02X", lco);
         break;
@@ -93,12 +93,20 @@ std::unique_ptr<TDULC> TDULCFactory::createTDULC(const uint8_t* data)
 
 /* Decode a TDULC. */
 
-std::unique_ptr<TDULC> TDULCFactory::decode(TDULC* tdulc, const uint8_t* data)
+std::unique_ptr<TDULC> TDULCFactory::decode(TDULC* tdulc, const uint8_t* data, const uint8_t* rs)
 {
     assert(tdulc != nullptr);
     assert(data != nullptr);
+    assert(rs != nullptr);
 
-    if (!tdulc->decode(data)) {
+    // the Golay and RS FEC has already been decoded above, hand the decoded data to the TDULC so it
+    // only has to parse the payload
+    tdulc->m_decodedRS = rs;
+    bool ret = tdulc->decode(data);
+    tdulc->m_decodedRS = nullptr;
+
+    if (!ret) {
+        delete tdulc;
         return nullptr;
     }
 
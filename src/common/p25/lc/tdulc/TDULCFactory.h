@@ -73,9 +73,10 @@ namespace p25
                  * @brief Decode a TDULC.
                  * @param tdulc Instance of a TDULC.
                  * @param[in] data Buffer containing TDULC packet data to decode.
+                 * @param[in] rs Buffer containing the FEC decoded TDULC data.
                  * @returns TDULC* Instance of a TDULC representing the decoded data.
                  */
-                static std::unique_ptr<TDULC> decode(TDULC* tdulc, const uint8_t* data);
+                static std::unique_ptr<TDULC> decode(TDULC* tdulc, const uint8_t* data, const uint8_t* rs);
             };
         } // namespace tdulc
     } // namespace lc
@@ -149,7 +149,7 @@ std::unique_ptr<TSBK> TSBKFactory::createTSBK(const uint8_t* data, bool rawTSBK)
     if (mfId == MFG_DVM_OCS) {
         switch (lco) {
         case LCO::CALL_TERM:
-            return decode(new OSP_DVM_LC_CALL_TERM(), data, rawTSBK);
+            return decode(new OSP_DVM_LC_CALL_TERM(), tsbk);
         default:
             mfId = MFG_STANDARD;
             break;
@@ -166,57 +166,57 @@ std::unique_ptr<TSBK> TSBKFactory::createTSBK(const uint8_t* data, bool rawTSBK)
     // standard P25 reference opcodes
     switch (lco) {
     case TSBKO::IOSP_GRP_VCH:
-        return decode(new IOSP_GRP_VCH(), data, rawTSBK);
+        return decode(new IOSP_GRP_VCH(), tsbk);
     case TSBKO::OSP_GRP_VCH_GRANT_UPD:
-        return decode(new OSP_GRP_VCH_GRANT_UPD(), data, rawTSBK);
+        return decode(new OSP_GRP_VCH_GRANT_UPD(), tsbk);
     case TSBKO::IOSP_UU_VCH:
-        return decode(new IOSP_UU_VCH(), data, rawTSBK);
+        return decode(new IOSP_UU_VCH(), tsbk);
     case TSBKO::OSP_UU_VCH_GRANT_UPD:
-        return decode(new OSP_UU_VCH_GRANT_UPD(), data, rawTSBK);
+        return decode(new OSP_UU_VCH_GRANT_UPD(), tsbk);
     case TSBKO::IOSP_UU_ANS:
-        return decode(new IOSP_UU_ANS(), data, rawTSBK);
+        return decode(new IOSP_UU_ANS(), tsbk);
     case TSBKO::ISP_SNDCP_CH_REQ:
-        return decode(new ISP_SNDCP_CH_REQ(), data, rawTSBK);
+        return decode(new ISP_SNDCP_CH_REQ(), tsbk);
     case TSBKO::ISP_SNDCP_REC_REQ:
-        return decode(new ISP_SNDCP_REC_REQ(), data, rawTSBK);
+        return decode(new ISP_SNDCP_REC_REQ(), tsbk);
     case TSBKO::IOSP_STS_UPDT:
-        return decode(new IOSP_STS_UPDT(), data, rawTSBK);
+        return decode(new IOSP_STS_UPDT(), tsbk);
     case TSBKO::IOSP_MSG_UPDT:
-        return decode(new IOSP_MSG_UPDT(), data, rawTSBK);
+        return decode(new IOSP_MSG_UPDT(), tsbk);
     case TSBKO::IOSP_RAD_MON:
-        return decode(new IOSP_RAD_MON(), data, rawTSBK);
+        return decode(new IOSP_RAD_MON(), tsbk);
     case TSBKO::IOSP_CALL_ALRT:
-        return decode(new IOSP_CALL_ALRT(), data, rawTSBK);
+        return decode(new IOSP_CALL_ALRT(), tsbk);
     case TSBKO::IOSP_ACK_RSP:
-        return decode(new IOSP_ACK_RSP(), data, rawTSBK);
+        return decode(new IOSP_ACK_RSP(), tsbk);
     case TSBKO::ISP_EMERG_ALRM_REQ:
-        return decode(new ISP_EMERG_ALRM_REQ(), data, rawTSBK);
+        return decode(new ISP_EMERG_ALRM_REQ(), tsbk);
     case TSBKO::IOSP_EXT_FNCT:
-        return decode(new IOSP_EXT_FNCT(), data, rawTSBK);
+        return decode(new IOSP_EXT_FNCT(), tsbk);
     case TSBKO::IOSP_GRP_AFF:
-        return decode(new IOSP_GRP_AFF(), data, rawTSBK);
+        return decode(new IOSP_GRP_AFF(), tsbk);
     case TSBKO::IOSP_U_REG:
-        return decode(new IOSP_U_REG(), data, rawTSBK);
+        return decode(new IOSP_U_REG(), tsbk);
     case TSBKO::ISP_CAN_SRV_REQ:
-        return decode(new ISP_CAN_SRV_REQ(), data, rawTSBK);
+        return decode(new ISP_CAN_SRV_REQ(), tsbk);
     case TSBKO::ISP_GRP_AFF_Q_RSP:
-        return decode(new ISP_GRP_AFF_Q_RSP(), data, rawTSBK);
+        return decode(new ISP_GRP_AFF_Q_RSP(), tsbk);
     case TSBKO::OSP_QUE_RSP:
-        return decode(new OSP_QUE_RSP(), data, rawTSBK);
+        return decode(new OSP_QUE_RSP(), tsbk);
     case TSBKO::ISP_U_DEREG_REQ:
-        return decode(new ISP_U_DEREG_REQ(), data, rawTSBK);
+        return decode(new ISP_U_DEREG_REQ(), tsbk);
     case TSBKO::OSP_U_DEREG_ACK:
-        return decode(new OSP_U_DEREG_ACK(), data, rawTSBK);
+        return decode(new OSP_U_DEREG_ACK(), tsbk);
     case TSBKO::ISP_LOC_REG_REQ:
-        return decode(new ISP_LOC_REG_REQ(), data, rawTSBK);
+        return decode(new ISP_LOC_REG_REQ(), tsbk);
     case TSBKO::ISP_AUTH_RESP:
-        return decode(new ISP_AUTH_RESP(), data, rawTSBK);
+        return decode(new ISP_AUTH_RESP(), tsbk);
     case TSBKO::ISP_AUTH_FNE_RST:
-        return decode(new ISP_AUTH_FNE_RST(), data, rawTSBK);
+        return decode(new ISP_AUTH_FNE_RST(), tsbk);
     case TSBKO::ISP_AUTH_SU_DMD:
-        return decode(new ISP_AUTH_SU_DMD(), data, rawTSBK);
+        return decode(new ISP_AUTH_SU_DMD(), tsbk);
     case TSBKO::OSP_ADJ_STS_BCAST:
-        return decode(new OSP_ADJ_STS_BCAST(), data, rawTSBK);
+        return decode(new OSP_ADJ_STS_BCAST(), tsbk);
     default:
         LogError(LOG_P25, "TSBKFactory::create(), unknown TSBK LCO value, mfId = $%02X, lco = $%02X", mfId, lco);
         break;
@@ -315,15 +315,20 @@ std::unique_ptr<AMBT> TSBKFactory::createAMBT(const data::DataHeader& dataHeader
 
 /* Decode a TSBK. */
 
-std::unique_ptr<TSBK> TSBKFactory::decode(TSBK* tsbk, const uint8_t* data, bool rawTSBK)
+std::unique_ptr<TSBK> TSBKFactory::decode(TSBK* tsbk, const uint8_t* data)
 {
     assert(tsbk != nullptr);
     assert(data != nullptr);
 
-    if (!tsbk->decode(data, rawTSBK)) {
+    // the block has already been deinterleaved, Trellis decoded and CRC checked above, hand the
+    // decoded block to the TSBK as raw so it only has to parse the payload
+    tsbk->m_preDecoded = true;
+    if (!tsbk->decode(data, true)) {
+        delete tsbk;
         return nullptr;
     }
 
+    tsbk->m_preDecoded = false;
     return std::unique_ptr<TSBK>(tsbk);
 }
 
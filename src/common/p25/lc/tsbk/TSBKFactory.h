@@ -150,11 +150,10 @@ namespace p25
                 /**
                  * @brief Decode a TSBK.
                  * @param tsbk Instance of a TSBK.
-                 * @param[in] data Buffer containing TSBK packet data to decode.
-                 * @param rawTSBK Flag indicating whether or not the passed buffer is raw.
+                 * @param[in] data Buffer containing the decoded (raw) TSBK block.
                  * @returns TSBK* Instance of a TSBK representing the decoded data.
                  */
-                static std::unique_ptr<TSBK> decode(TSBK* tsbk, const uint8_t* data, bool rawTSBK = false);
+                static std::unique_ptr<TSBK> decode(TSBK* tsbk, const uint8_t* data);
                 /**
                  * @brief Decode an AMBT.
                  * @param tsbk Instance of a TSBK.
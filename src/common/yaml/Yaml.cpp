@@ -10,6 +10,8 @@
  */
 #include "yaml/Yaml.h"
 
+#include <cstring>
+#include <deque>
 #include <memory>
 #include <fstream>
 #include <sstream>
@@ -313,10 +315,10 @@ namespace yaml
         /*  */
         virtual Node* getNode(const std::string& key)
         {
-            auto it = m_Map.find(key);
-            if (it == m_Map.end()) {
+            auto it = m_Map.lower_bound(key);
+            if (it == m_Map.end() || it->first != key) {
                 Node* pNode = new Node;
-                m_Map.insert({ key, pNode });
+                m_Map.insert(it, { key, pNode });
                 return pNode;
             }
             return it->second;
@@ -1260,9 +1262,9 @@ namespace yaml
     class ReaderLine {
     public:
         /* Initializes a new instance of the ReaderLine class. */
-        ReaderLine(const std::string& data = "", const size_t no = 0, const size_t offset = 0,
+        ReaderLine(std::string data = "", const size_t no = 0, const size_t offset = 0,
                    const Node::eType type = Node::None, const uint8_t flags = 0) :
-            Data(data),
+            Data(std::move(data)),
             No(no),
             Offset(offset),
             Type(type),
@@ -1330,15 +1332,16 @@ namespace yaml
         /* Finalizes a new instance of the ParseImp class. */
         ~ParseImp() { clearLines(); }
 
-        /* Run full parsing procedure. */
-        void parse(Node& root, std::iostream& stream)
+        /* Run full parsing procedure. Returns the number of bytes of the buffer consumed by the document. */
+        size_t parse(Node& root, const char* data, const size_t size)
         {
             try
             {
                 root.clear();
-                readLines(stream);
+                size_t consumed = readLines(data, size);
                 postProcessLines();
                 parseRoot(root);
+                return consumed;
             }
             catch (Exception const& e)
             {
@@ -1351,30 +1354,42 @@ namespace yaml
         /* Copies a instance of the ParseImp class to new instance of the ParseImp class. */
         ParseImp(const ParseImp& copy) { /* stub */ }
 
-        /* Read all lines. */
-        void readLines(std::iostream& stream)
+        /* Allocate a new line from the line pool. */
+        ReaderLine* newLine(std::string data, const size_t no, const size_t offset, const Node::eType type = Node::None)
+        {
+            m_Pool.emplace_back(std::move(data), no, offset, type);
+            return &m_Pool.back();
+        }
+
+        /* Read all lines. Returns the number of bytes of the buffer consumed. */
+        size_t readLines(const char* data, const size_t size)
         {
-            std::string line = "";
             size_t lineNo = 0;
             bool documentStartFound = false;
             bool foundFirstNotEmpty = false;
-            std::streampos streamPos = 0;
 
-            // read all lines, as long as the stream is ok
-            while (!stream.eof() && !stream.fail()) {
+            // read all lines, directly from the buffer
+            size_t pos = 0;
+            while (pos < size) {
                 // read line
-                streamPos = stream.tellg();
-                std::getline(stream, line);
+                const size_t linePos = pos;
+                const char* lineEnd = static_cast<const char*>(::memchr(data + pos, '\n', size - pos));
+                size_t length = (lineEnd != nullptr) ? static_cast<size_t>(lineEnd - (data + pos)) : size - pos;
+                pos += (lineEnd != nullptr) ? length + 1 : length;
                 lineNo++;
 
+                const char* line = data + linePos;
+
                 // remove comment
-                const size_t commentPos = FindNotCited(line, '#');
-                if (commentPos != std::string::npos) {
-                    line.resize(commentPos);
+                if (::memchr(line, '#', length) != nullptr) {
+                    const size_t commentPos = FindNotCited(std::string(line, length), '#');
+                    if (commentPos != std::string::npos) {
+                        length = commentPos;
+                    }
                 }
 
                 // start of document
-                if (!documentStartFound && line == "---") {
+                if (!documentStartFound && length == 3 && ::memcmp(line, "---", 3) == 0) {
                     // erase all lines before this line
                     clearLines();
                     documentStartFound = true;
@@ -1382,49 +1397,55 @@ namespace yaml
                 }
 
                 // end of document
-                if (line == "...") {
+                if (length == 3 && ::memcmp(line, "...", 3) == 0) {
                     break;
                 }
-                else if (line == "---") {
-                    stream.seekg(streamPos);
+                else if (length == 3 && ::memcmp(line, "---", 3) == 0) {
+                    pos = linePos;
                     break;
                 }
 
                 // remove trailing return
-                if (line.size()) {
-                    if (line[line.size() - 1] == '\r') {
-                        line.resize(line.size() - 1);
-                    }
+                if (length > 0 && line[length - 1] == '\r') {
+                    length--;
                 }
 
-                // validate characters
-                for (size_t i = 0; i < line.size(); i++) {
-                    if (line[i] != '\t' && (line[i] < 32 || line[i] > 125)) {
+                // validate characters, and find the first tab and the first character
+                size_t firstTabPos = std::string::npos;
+                size_t startOffset = std::string::npos;
+                for (size_t i = 0; i < length; i++) {
+                    const char c = line[i];
+                    if (c == '\t') {
+                        if (firstTabPos == std::string::npos) {
+                            firstTabPos = i;
+                        }
+                        continue;
+                    }
+
+                    if (c < 32 || c > 125) {
                         throw ParsingException(ExceptionMessage(g_ErrorInvalidCharacter, lineNo, i + 1));
                     }
-                }
 
-                // validate tabs
-                const size_t firstTabPos = line.find_first_of('\t');
-                size_t startOffset = line.find_first_not_of(" \t");
+                    if (startOffset == std::string::npos && c != ' ') {
+                        startOffset = i;
+                    }
+                }
 
                 // make sure no tabs are in the very front
                 if (startOffset != std::string::npos) {
                     if (firstTabPos < startOffset) {
                         throw ParsingException(ExceptionMessage(g_ErrorTabInOffset, lineNo, firstTabPos));
                     }
-
-                    // remove front spaces
-                    line = line.substr(startOffset);
                 }
                 else {
+                    // empty line
                     startOffset = 0;
-                    line = "";
+                    length = 0;
                 }
 
                 // add line
                 if (!foundFirstNotEmpty) {
-                    if (line.size()) {
+                    if (length > 0) {
                         foundFirstNotEmpty = true;
                     }
                     else {
@@ -1432,9 +1453,11 @@ namespace yaml
                     }
                 }
 
-                ReaderLine* pLine = new ReaderLine(line, lineNo, startOffset);
-                m_Lines.push_back(pLine);
+                // remove front spaces
+                m_Lines.push_back(newLine(std::string(line + startOffset, length - startOffset), lineNo, startOffset));
             }
+
+            return pos;
         }
 
         /* Run post-processing on all lines. Basically split lines into multiple lines if needed, to follow the parsing algorithm. */
@@ -1494,9 +1517,8 @@ namespace yaml
             }
 
             // create new line and insert
-            std::string newLine = pLine->Data.substr(valueStart);
-            it = m_Lines.insert(it, new ReaderLine(newLine, pLine->No, pLine->Offset + valueStart));
-            pLine->Data = "";
+            it = m_Lines.insert(it, newLine(pLine->Data.substr(valueStart), pLine->No, pLine->Offset + valueStart));
+            pLine->Data.clear();
 
             return false;
         }
@@ -1552,7 +1574,7 @@ namespace yaml
                 throw ParsingException(ExceptionMessage(g_ErrorBlockSequenceNotAllowed, *pLine, valueStart));
             }
 
-            pLine->Data = key;
+            pLine->Data = std::move(key);
 
             // remove all empty lines after map key
             clearTrailingEmptyLines(++it);
@@ -1576,7 +1598,7 @@ namespace yaml
                 newLineOffset = pLine->Offset;
             }
 
-            ReaderLine* pNewLine = new ReaderLine(value, pLine->No, newLineOffset, Node::ScalarType);
+            ReaderLine* pNewLine = newLine(std::move(value), pLine->No, newLineOffset, Node::ScalarType);
             it = m_Lines.insert(it, pNewLine);
 
             // return false in order to handle next line(scalar value)
@@ -1784,7 +1806,7 @@ namespace yaml
                         data += "\n";
                     }
                     else {
-                        data += pLine->Data.substr(0, endOffset + 1);
+                        data.append(pLine->Data, 0, endOffset + 1);
                     }
 
                     // move to next line
@@ -1873,10 +1895,8 @@ namespace yaml
         /*  */
         void clearLines()
         {
-            for (auto it = m_Lines.begin(); it != m_Lines.end(); it++) {
-                delete* it;
-            }
             m_Lines.clear();
+            m_Pool.clear();
         }
 
         /*  */
@@ -1885,7 +1905,6 @@ namespace yaml
             while (it != m_Lines.end()) {
                 ReaderLine* pLine = *it;
                 if (pLine->Data.size() == 0) {
-                    delete* it;
                     it = m_Lines.erase(it);
                 }
                 else {
@@ -1948,6 +1967,7 @@ namespace yaml
 
     public:
         std::list<ReaderLine*> m_Lines;    // List of lines.
+        std::deque<ReaderLine> m_Pool;     // Storage for all lines (lines are never freed individually).
     };
 
     // ---------------------------------------------------------------------------
@@ -1978,18 +1998,22 @@ namespace yaml
 
     bool Parse(Node& root, std::iostream& stream)
     {
-        ParseImp* pImp = nullptr;
+        // read the remainder of the stream into memory
+        std::streampos streamPos = stream.tellg();
+        std::string data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
 
         try
         {
-            pImp = new ParseImp;
-            pImp->parse(root, stream);
-            delete pImp;
+            ParseImp imp;
+            size_t consumed = imp.parse(root, data.data(), data.size());
+
+            // leave the stream positioned at the start of the next document
+            stream.clear();
+            stream.seekg(streamPos + static_cast<std::streamoff>(consumed));
             return true;
         }
         catch (Exception const& e)
         {
-            delete pImp;
             return false;
         }
     }
@@ -1998,16 +2022,23 @@ namespace yaml
 
     bool Parse(Node& root, const std::string& string)
     {
-        std::stringstream ss(string);
-        return Parse(root, ss);
+        return Parse(root, string.data(), string.size());
     }
     
     /* Populate given root node with deserialized data. */
 
     bool Parse(Node& root, const char* buffer, const size_t size)
     {
-        std::stringstream ss(std::string(buffer, size));
-        return Parse(root, ss);
+        try
+        {
+            ParseImp imp;
+            imp.parse(root, buffer, size);
+            return true;
+        }
+        catch (Exception const& e)
+        {
+            return false;
+        }
     }
 
     // ---------------------------------------------------------------------------
@@ -72,6 +72,33 @@ static bool ActivityLogOpen()
     return m_actFpLog != nullptr;
 }
 
+/* Helper to write a activity log entry to the activity log outputs. */
+
+static void ActivityLogWrite(const char* buffer)
+{
+    bool ret = ::ActivityLogOpen();
+    if (!ret)
+        return;
+
+    if (CurrentLogFileLevel() == 0U)
+        return;
+
+    ::fprintf(m_actFpLog, "%s\n", buffer);
+
+    if (2U >= g_logDisplayLevel && g_logDisplayLevel != 0U) {
+        ::fprintf(stdout, "%s" EOL, buffer);
+    }
+}
+
+/* Helper to flush the activity log outputs. */
+
+static void ActivityLogFlush()
+{
+    if (m_actFpLog != nullptr)
+        ::fflush(m_actFpLog);
+    ::fflush(stdout);
+}
+
 /* Initializes the activity log. */
 
 bool ActivityLogInitialise(const std::string& filePath, const std::string& fileRoot)
@@ -82,6 +109,7 @@ bool ActivityLogInitialise(const std::string& filePath, const std::string& fileR
     m_actFilePath = filePath;
     m_actFileRoot = fileRoot;
 
+    ::LogSetActivitySink(ActivityLogWrite, ActivityLogFlush);
     return ::ActivityLogOpen();
 }
 
@@ -89,11 +117,16 @@ bool ActivityLogInitialise(const std::string& filePath, const std::string& fileR
 
 void ActivityLogFinalise()
 {
-#if defined(CATCH2_TEST_COMPILATION)
-    return;
-#endif
-    if (m_actFpLog != nullptr)
+#if !defined(CATCH2_TEST_COMPILATION)
+    // the log writer may still be writing queued activity entries to the file
+    ::LogStopAsyncWriter();
+
+    ::LogSetActivitySink(nullptr, nullptr);
+    if (m_actFpLog != nullptr) {
         ::fclose(m_actFpLog);
+        m_actFpLog = nullptr;
+    }
+#endif // !defined(CATCH2_TEST_COMPILATION)
 }
 
 /* Writes a new entry to the activity log. */
@@ -107,28 +140,10 @@ void ActivityLog(const char* msg, ...)
 
     char buffer[ACT_LOG_BUFFER_LEN];
 
-    va_list vl, vl_len;
+    va_list vl;
     va_start(vl, msg);
-    va_copy(vl_len, vl);
-
-    size_t len = ::vsnprintf(nullptr, 0U, msg, vl_len);
-    ::vsnprintf(buffer, len + 1U, msg, vl);
-
-    va_end(vl_len);
+    ::vsnprintf(buffer, ACT_LOG_BUFFER_LEN, msg, vl);
     va_end(vl);
 
-    bool ret = ::ActivityLogOpen();
-    if (!ret)
-        return;
-
-    if (CurrentLogFileLevel() == 0U)
-        return;
-
-    ::fprintf(m_actFpLog, "%s\n", buffer);
-    ::fflush(m_actFpLog);
-
-    if (2U >= g_logDisplayLevel && g_logDisplayLevel != 0U) {
-        ::fprintf(stdout, "%s" EOL, buffer);
-        ::fflush(stdout);
-    }
+    ::LogQueueActivity(buffer);
 }
@@ -150,6 +150,9 @@ int HostFNE::run()
     }
 #endif // !defined(_WIN32)
 
+    // start the asynchronous log writer (this must happen after any forking)
+    ::LogStartAsyncWriter();
+
     ::LogInfo(__BANNER__ "\r\n" __PROG_NAME__ " " __VER__ " (built " __BUILD__ ")\r\n" \
         "Copyright (c) 2017-2024 Bryan Biedenkapp, N2PLL and DVMProject (https://github.com/dvmproject) Authors.\r\n" \
         "Portions Copyright (c) 2015-2021 by Jonathan Naylor, G4KLX and others\r\n" \
@@ -165,13 +168,16 @@ int HostFNE::run()
     // try to load radio IDs table
     std::string ridLookupFile = systemConf["radio_id"]["file"].as<std::string>();
     uint32_t ridReloadTime = systemConf["radio_id"]["time"].as<uint32_t>(0U);
+    bool ridBinaryCache = systemConf["radio_id"]["binaryCache"].as<bool>(false);
 
     LogInfo("Radio Id Lookups");
     LogInfo("    File: %s", ridLookupFile.length() > 0U ? ridLookupFile.c_str() : "None");
     if (ridReloadTime > 0U)
         LogInfo("    Reload: %u mins", ridReloadTime);
-    
+    LogInfo("    Binary Cache: %s", ridBinaryCache ? "yes" : "no");
+
     m_ridLookup = new RadioIdLookup(ridLookupFile, ridReloadTime, true);
+    m_ridLookup->setBinaryCache(ridBinaryCache);
     m_ridLookup->read();
 
     // initialize REST API
@@ -407,6 +413,9 @@ bool HostFNE::initializeRESTAPI()
     std::string restApiSSLCert = systemConf["restSslCertificate"].as<std::string>("web.crt");
     std::string restApiSSLKey = systemConf["restSslKey"].as<std::string>("web.key");
     bool restApiDebug = systemConf["restDebug"].as<bool>(false);
+    uint32_t restApiThreads = systemConf["restThreads"].as<uint32_t>(4U);
+    if (restApiThreads == 0U)
+        restApiThreads = 1U;
 
     if (restApiPassword.length() > 64) {
         std::string password = restApiPassword;
@@ -439,6 +448,7 @@ bool HostFNE::initializeRESTAPI()
         LogInfo("    REST API SSL Enabled: %s", restApiEnableSSL ? "yes" : "no");
         LogInfo("    REST API SSL Certificate: %s", restApiSSLCert.c_str());
         LogInfo("    REST API SSL Private Key: %s", restApiSSLKey.c_str());
+        LogInfo("    REST API Threads: %u", restApiThreads);
 
         if (restApiDebug) {
             LogInfo("    REST API Debug: yes");
@@ -447,7 +457,7 @@ bool HostFNE::initializeRESTAPI()
 
     // initialize network remote command
     if (restApiEnable) {
-        m_RESTAPI = new RESTAPI(restApiAddress, restApiPort, restApiPassword, restApiSSLKey, restApiSSLCert, restApiEnableSSL, this, restApiDebug);
+        m_RESTAPI = new RESTAPI(restApiAddress, restApiPort, restApiPassword, restApiSSLKey, restApiSSLCert, restApiEnableSSL, this, restApiDebug, restApiThreads);
         m_RESTAPI->setLookups(m_ridLookup, m_tidLookup, m_peerListLookup);
         bool ret = m_RESTAPI->open();
         if (!ret) {
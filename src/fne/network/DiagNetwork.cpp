@@ -19,6 +19,7 @@ using namespace network;
 using namespace network::callhandler;
 
 #include <cassert>
+#include <unordered_set>
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -415,6 +416,8 @@ void* DiagNetwork::threadedNetworkRx(void* arg)
                                     }
                                     else {
                                         json::array arr = v.get<json::array>();
+
+                                        std::lock_guard<std::mutex> lock(network->m_peerMutex);
                                         network->m_peerLinkPeers[peerId] = arr;
                                     }
                                 }
@@ -425,6 +428,73 @@ void* DiagNetwork::threadedNetworkRx(void* arg)
                         }
                     }
                 }
+                else if (req->fneHeader.getSubFunction() == NET_SUBFUNC::PL_ACT_PEER_LIST_DELTA) { // Peer-Link Active Peer List Changes
+                    if (peerId > 0 && (network->m_peers.find(peerId) != network->m_peers.end())) {
+                        FNEPeerConnection* connection = network->m_peers[peerId];
+                        if (connection != nullptr) {
+                            std::string ip = udp::Socket::address(req->address);
+
+                            // validate peer (simple validation really)
+                            if (connection->connected() && connection->address() == ip && connection->isExternalPeer() &&
+                                connection->isPeerLink()) {
+                                std::string payload((char*)req->buffer + 8U, req->length - 8U);
+
+                                // parse JSON body
+                                json::value v;
+                                std::string err = json::parse(v, payload);
+                                if (!err.empty() || !v.is<json::object>()) {
+                                    break;
+                                }
+
+                                json::object changes = v.get<json::object>();
+                                if (!changes["updated"].is<json::array>() || !changes["removed"].is<json::array>()) {
+                                    break;
+                                }
+
+                                json::array updated = changes["updated"].get<json::array>();
+                                json::array removed = changes["removed"].get<json::array>();
+
+                                // collect the peer IDs being replaced or removed
+                                std::unordered_set<uint32_t> replaced;
+                                for (auto entry : removed) {
+                                    if (entry.is<uint32_t>())
+                                        replaced.insert(entry.get<uint32_t>());
+                                }
+                                for (auto entry : updated) {
+                                    if (entry.is<json::object>()) {
+                                        json::object peerObj = entry.get<json::object>();
+                                        if (peerObj["peerId"].is<uint32_t>())
+                                            replaced.insert(peerObj["peerId"].get<uint32_t>());
+                                    }
+                                }
+
+                                // merge the changes into the last known active peer list
+                                std::lock_guard<std::mutex> lock(network->m_peerMutex);
+                                json::array arr = json::array();
+                                for (auto entry : network->m_peerLinkPeers[peerId]) {
+                                    if (entry.is<json::object>()) {
+                                        json::object peerObj = entry.get<json::object>();
+                                        if (peerObj["peerId"].is<uint32_t>() && 
+                                            replaced.find(peerObj["peerId"].get<uint32_t>()) != replaced.end())
+                                            continue;
+                                    }
+
+                                    arr.push_back(entry);
+                                }
+
+                                for (auto entry : updated) {
+                                    if (entry.is<json::object>())
+                                        arr.push_back(entry);
+                                }
+
+                                network->m_peerLinkPeers[peerId] = arr;
+                            }
+                            else {
+                                network->writePeerNAK(peerId, TAG_PEER_LINK, NET_CONN_NAK_FNE_UNAUTHORIZED);
+                            }
+                        }
+                    }
+                }
                 break;
 
             default:
@@ -14,6 +14,7 @@
 #include "common/Log.h"
 #include "common/Utils.h"
 #include "network/FNENetwork.h"
+#include "network/RESTDefines.h"
 #include "network/callhandler/TagDMRData.h"
 #include "network/callhandler/TagP25Data.h"
 #include "network/callhandler/TagNXDNData.h"
@@ -36,6 +37,8 @@ using namespace network::callhandler;
 const uint32_t MAX_HARD_CONN_CAP = 250U;
 const uint8_t MAX_PEER_LIST_BEFORE_FLUSH = 10U;
 const uint32_t MAX_RID_LIST_CHUNK = 50U;
+const uint32_t ACL_UPDATE_PACING = 10U;
+const uint32_t PEER_LINK_FULL_SYNC_INTERVAL = 12U;
 
 // ---------------------------------------------------------------------------
 //  Static Class Members
@@ -75,10 +78,39 @@ FNENetwork::FNENetwork(HostFNE* host, const std::string& address, uint16_t port,
     m_peerLinkPeers(),
     m_peerAffiliations(),
     m_ccPeerMap(),
+    m_peerGeneration(0U),
+    m_peerStatusVersion(0U),
+    m_peerLinkSync(),
+    m_peerLinkSyncQueue(),
+    m_peerLinkSyncSpacing(0U),
+    m_peerLinkSyncElapsed(0U),
+    m_affPeersMutex(),
+    m_tgAffPeers(),
+    m_affExemptPeers(),
+    m_vcPeers(),
+    m_affPeersGeneration(0U),
+    m_aclUpdateMutex(),
+    m_aclUpdateQueue(),
+    m_aclUpdateRunning(false),
+    m_aclCacheMutex(),
+    m_aclDeflate(),
+    m_aclDeflateInit(false),
+    m_aclRIDPayload(),
+    m_aclTGIDPayload(),
+    m_aclPIDPayload(),
+    m_aclRIDFilePayload(),
+    m_aclTGIDFilePayload(),
+    m_aclPIDFilePayload(),
+    m_aclRIDListValid(false),
+    m_aclRIDListVersion(0U),
+    m_aclRIDWhitelist(),
+    m_aclRIDBlacklist(),
     m_maintainenceTimer(1000U, pingTime),
     m_updateLookupTime(updateLookupTime * 60U),
     m_softConnLimit(0U),
     m_callInProgress(false),
+    m_routePlanHits(0U),
+    m_routePlanRebuilds(0U),
     m_disallowAdjStsBcast(false),
     m_disallowExtAdjStsBcast(true),
     m_allowConvSiteAffOverride(false),
@@ -96,6 +128,7 @@ FNENetwork::FNENetwork(HostFNE* host, const std::string& address, uint16_t port,
     m_disablePacketData(false),
     m_dumpPacketData(false),
     m_verbosePacketData(false),
+    m_eventPublisher(),
     m_reportPeerPing(reportPeerPing),
     m_verbose(verbose)
 {
@@ -116,6 +149,10 @@ FNENetwork::~FNENetwork()
     delete m_tagDMR;
     delete m_tagP25;
     delete m_tagNXDN;
+
+    if (m_aclDeflateInit) {
+        deflateEnd(&m_aclDeflate);
+    }
 }
 
 /* Helper to set configuration options. */
@@ -294,6 +331,7 @@ void FNENetwork::clock(uint32_t ms)
         for (uint32_t peerId : peersToRemove) {
             FNEPeerConnection* connection = m_peers[peerId];
             m_peers.erase(peerId);
+            m_peerGeneration++;
             if (connection != nullptr) {
                 delete connection;
             }
@@ -307,32 +345,26 @@ void FNENetwork::clock(uint32_t ms)
             m_frameQueue->clearTimestamps();
         }
 
-        // send active peer list to Peer-Link masters
-        if (m_host->m_peerNetworks.size() > 0) {
-            for (auto peer : m_host->m_peerNetworks) {
-                if (peer.second != nullptr) {
-                    if (peer.second->isEnabled() && peer.second->isPeerLink()) {
-                        if (m_peers.size() > 0) {
-                            json::array peers = json::array();
-                            for (auto entry : m_peers) {
-                                uint32_t peerId = entry.first;
-                                network::FNEPeerConnection* peerConn = entry.second;
-                                if (peerConn != nullptr) {
-                                    json::object peerObj = fneConnObject(peerId, peerConn);
-                                    uint32_t peerNetPeerId = peer.second->getPeerId();
-                                    peerObj["parentPeerId"].set<uint32_t>(peerNetPeerId);
-                                    peers.push_back(json::value(peerObj));
-                                }
-                            }
+        // schedule sending the active peer list to Peer-Link masters
+        schedulePeerLinkSync();
 
-                            peer.second->writePeerLinkPeers(&peers);
-                        }
-                    }
-                }
+        m_maintainenceTimer.start();
+    }
+
+    // send active peer list to the next scheduled Peer-Link master
+    if (!m_peerLinkSyncQueue.empty()) {
+        m_peerLinkSyncElapsed += ms;
+        if (m_peerLinkSyncElapsed >= m_peerLinkSyncSpacing) {
+            m_peerLinkSyncElapsed = 0U;
+
+            std::string name = m_peerLinkSyncQueue.front();
+            m_peerLinkSyncQueue.pop_front();
+
+            auto it = m_host->m_peerNetworks.find(name);
+            if (it != m_host->m_peerNetworks.end() && it->second != nullptr) {
+                writePeerLinkSync(name, it->second);
             }
         }
-
-        m_maintainenceTimer.start();
     }
 
     m_parrotDelayTimer.clock(ms);
@@ -403,6 +435,9 @@ void FNENetwork::close()
 
     m_socket->close();
 
+    // end any REST API event streams
+    m_eventPublisher.closeAll();
+
     m_maintainenceTimer.stop();
 
     m_status = NET_STAT_INVALID;
@@ -738,9 +773,11 @@ void* FNENetwork::threadedNetworkRx(void* arg)
 
                                     if (validHash) {
                                         connection->connectionState(NET_STAT_WAITING_CONFIG);
+                                        network->peerStatusChanged(connection);
                                         network->writePeerACK(peerId);
                                         LogInfoEx(LOG_NET, "PEER %u RPTK ACK, completed the login exchange", peerId);
                                         network->m_peers[peerId] = connection;
+                                        network->m_peerGeneration++;
                                     }
                                     else {
                                         LogWarning(LOG_NET, "PEER %u RPTK NAK, failed the login exchange", peerId);
@@ -801,6 +838,7 @@ void* FNENetwork::threadedNetworkRx(void* arg)
                                         connection->pingsReceived(0U);
                                         connection->lastPing(now);
                                         connection->lastACLUpdate(now);
+                                        network->peerStatusChanged(connection);
                                         network->m_peers[peerId] = connection;
 
                                         // attach extra notification data to the RPTC ACK to notify the peer of 
@@ -811,6 +849,10 @@ void* FNENetwork::threadedNetworkRx(void* arg)
                                             buffer[0U] = 0x80U;
                                         }
 
+                                        // notify the peer this master accepts active peer list changes; peers that predate
+                                        // them ignore this flag
+                                        buffer[0U] |= PEER_LINK_PEER_LIST_DELTA_FLAG;
+
                                         network->writePeerACK(peerId, buffer, 1U);
                                         LogInfoEx(LOG_NET, "PEER %u RPTC ACK, completed the configuration exchange", peerId);
 
@@ -844,13 +886,24 @@ void* FNENetwork::threadedNetworkRx(void* arg)
                                             }
                                         }
 
+                                        // can the peer decode the compact binary form of the Peer-Link lookup tables? (peers
+                                        // that don't report this are sent the lookup table file contents, as before)
+                                        if (peerConfig["packedTables"].is<bool>()) {
+                                            bool packedTables = peerConfig["packedTables"].get<bool>();
+                                            connection->packedTables(packedTables);
+                                        }
+
                                         // is the peer reporting it is a conventional peer?
                                         if (peerConfig["conventionalPeer"].is<bool>()) {
                                             if (network->m_allowConvSiteAffOverride) {
                                                 bool convPeer = peerConfig["conventionalPeer"].get<bool>();
                                                 connection->isConventionalPeer(convPeer);
-                                                if (convPeer)
+                                                if (convPeer) {
                                                     LogInfoEx(LOG_NET, "PEER %u reports conventional peer", peerId);
+
+                                                    std::lock_guard<std::mutex> lock(network->m_affPeersMutex);
+                                                    network->m_affExemptPeers.insert(peerId);
+                                                }
                                             }
                                         }
 
@@ -858,10 +911,16 @@ void* FNENetwork::threadedNetworkRx(void* arg)
                                         if (peerConfig["sysView"].is<bool>()) {
                                             bool sysView = peerConfig["sysView"].get<bool>();
                                             connection->isSysView(sysView);
-                                            if (sysView)
+                                            if (sysView) {
                                                 LogInfoEx(LOG_NET, "PEER %u reports SysView peer", peerId);
+
+                                                std::lock_guard<std::mutex> lock(network->m_affPeersMutex);
+                                                network->m_affExemptPeers.insert(peerId);
+                                            }
                                         }
 
+                                        network->m_peerGeneration++;
+
                                         if (peerConfig["software"].is<std::string>()) {
                                             std::string software = peerConfig["software"].get<std::string>();
                                             LogInfoEx(LOG_NET, "PEER %u reports software %s", peerId, software.c_str());
@@ -872,6 +931,8 @@ void* FNENetwork::threadedNetworkRx(void* arg)
                                         peerName << "PEER " << peerId;
                                         network->createPeerAffiliations(peerId, peerName.str());
 
+                                        network->publishPeerEvent(FNE_EVENT_PEER_CONNECTED, peerId, connection);
+
                                         // spin up a thread and send ACL list over to peer
                                         network->peerACLUpdate(peerId);
                                     }
@@ -1137,6 +1198,8 @@ void* FNENetwork::threadedNetworkRx(void* arg)
                                     aff->groupUnaff(srcId);
                                     aff->groupAff(srcId, dstId);
 
+                                    network->publishAffEvent(FNE_EVENT_GRP_AFFIL, peerId, srcId, dstId);
+
                                     // attempt to repeat traffic to Peer-Link masters
                                     if (network->m_host->m_peerNetworks.size() > 0) {
                                         for (auto peer : network->m_host->m_peerNetworks) {
@@ -1171,6 +1234,8 @@ void* FNENetwork::threadedNetworkRx(void* arg)
                                     uint32_t srcId = __GET_UINT16(req->buffer, 0U);             // Source Address
                                     aff->unitReg(srcId);
 
+                                    network->publishAffEvent(FNE_EVENT_UNIT_REG, peerId, srcId, 0U);
+
                                     // attempt to repeat traffic to Peer-Link masters
                                     if (network->m_host->m_peerNetworks.size() > 0) {
                                         for (auto peer : network->m_host->m_peerNetworks) {
@@ -1205,6 +1270,8 @@ void* FNENetwork::threadedNetworkRx(void* arg)
                                     uint32_t srcId = __GET_UINT16(req->buffer, 0U);             // Source Address
                                     aff->unitDereg(srcId);
 
+                                    network->publishAffEvent(FNE_EVENT_UNIT_DEREG, peerId, srcId, 0U);
+
                                     // attempt to repeat traffic to Peer-Link masters
                                     if (network->m_host->m_peerNetworks.size() > 0) {
                                         for (auto peer : network->m_host->m_peerNetworks) {
@@ -1239,6 +1306,8 @@ void* FNENetwork::threadedNetworkRx(void* arg)
                                     uint32_t srcId = __GET_UINT16(req->buffer, 0U);             // Source Address
                                     aff->groupUnaff(srcId);
 
+                                    network->publishAffEvent(FNE_EVENT_GRP_UNAFFIL, peerId, srcId, 0U);
+
                                     // attempt to repeat traffic to Peer-Link masters
                                     if (network->m_host->m_peerNetworks.size() > 0) {
                                         for (auto peer : network->m_host->m_peerNetworks) {
@@ -1324,13 +1393,19 @@ void* FNENetwork::threadedNetworkRx(void* arg)
                                             FNEPeerConnection* vcConnection = network->m_peers[vcPeerId];
                                             if (vcConnection != nullptr) {
                                                 vcConnection->ccPeerId(peerId);
+                                                network->peerStatusChanged(vcConnection);
                                                 vcPeers.push_back(vcPeerId);
+                                                network->m_peerGeneration++;
+
+                                                std::lock_guard<std::mutex> lock(network->m_affPeersMutex);
+                                                network->m_vcPeers.insert(vcPeerId);
                                             }
                                         }
                                         offs += 4U;
                                     }
                                     LogMessage(LOG_NET, "PEER %u (%s) announced %u VCs", peerId, connection->identity().c_str(), len);
                                     network->m_ccPeerMap[peerId] = vcPeers;
+                                    network->peerStatusChanged(connection);
 
                                     // attempt to repeat traffic to Peer-Link masters
                                     if (network->m_host->m_peerNetworks.size() > 0) {
@@ -1385,6 +1460,21 @@ bool FNENetwork::checkU2UDroppedPeer(uint32_t peerId)
     return false;
 }
 
+/* Helper to get the current routing generation. */
+
+uint64_t FNENetwork::routeGeneration() const
+{
+    // all of the individual counters only ever increase, so the sum changes whenever any of them do; affiliation
+    // changes only affect routing when a peer gains or loses its affiliations to a talkgroup
+    uint64_t generation = (uint64_t)m_peerGeneration + m_affPeersGeneration;
+    if (m_ridLookup != nullptr)
+        generation += m_ridLookup->version();
+    if (m_tidLookup != nullptr)
+        generation += m_tidLookup->version();
+
+    return generation;
+}
+
 /* Helper to create a peer on the peers affiliations list. */
 
 void FNENetwork::createPeerAffiliations(uint32_t peerId, std::string peerName)
@@ -1395,6 +1485,10 @@ void FNENetwork::createPeerAffiliations(uint32_t peerId, std::string peerName)
     lookups::ChannelLookup* chLookup = new lookups::ChannelLookup();
     m_peerAffiliations[peerId] = new lookups::AffiliationLookup(peerName, chLookup, m_verbose);
     m_peerAffiliations[peerId]->setDisableUnitRegTimeout(true); // FNE doesn't allow unit registration timeouts (notification must come from the peers)
+    m_peerAffiliations[peerId]->setGroupAffCallback([this, peerId](uint32_t dstId, bool affiliated) {
+        updateAffiliatedPeer(peerId, dstId, affiliated);
+    });
+    m_peerGeneration++;
 }
 
 /* Helper to erase the peer from the peers affiliations list. */
@@ -1412,6 +1506,18 @@ bool FNENetwork::erasePeerAffiliations(uint32_t peerId)
             delete aff;
         }
         m_peerAffiliations.erase(peerId);
+        m_peerGeneration++;
+
+        // remove the peer from the talkgroup affiliation index
+        std::lock_guard<std::mutex> affLock(m_affPeersMutex);
+        for (auto tgIt = m_tgAffPeers.begin(); tgIt != m_tgAffPeers.end();) {
+            tgIt->second.erase(peerId);
+            if (tgIt->second.empty())
+                tgIt = m_tgAffPeers.erase(tgIt);
+            else
+                ++tgIt;
+        }
+        m_affPeersGeneration++;
 
         return true;
     }
@@ -1419,6 +1525,168 @@ bool FNENetwork::erasePeerAffiliations(uint32_t peerId)
     return false;
 }
 
+/* Helper to update the talkgroup affiliation index. */
+
+void FNENetwork::updateAffiliatedPeer(uint32_t peerId, uint32_t dstId, bool affiliated)
+{
+    std::lock_guard<std::mutex> lock(m_affPeersMutex);
+    if (affiliated) {
+        m_tgAffPeers[dstId].insert(peerId);
+    }
+    else {
+        auto it = m_tgAffPeers.find(dstId);
+        if (it != m_tgAffPeers.end()) {
+            it->second.erase(peerId);
+            if (it->second.empty())
+                m_tgAffPeers.erase(it);
+        }
+    }
+
+    m_affPeersGeneration++;
+}
+
+/* Helper to schedule the active peer list synchronization to the Peer-Link masters. */
+
+void FNENetwork::schedulePeerLinkSync()
+{
+    // any Peer-Link master still waiting from the previous interval is picked up again below
+    m_peerLinkSyncQueue.clear();
+
+    for (auto peer : m_host->m_peerNetworks) {
+        if (peer.second != nullptr) {
+            if (peer.second->isEnabled() && peer.second->isPeerLink()) {
+                m_peerLinkSyncQueue.push_back(peer.first);
+            }
+            else {
+                m_peerLinkSync.erase(peer.first);
+            }
+        }
+    }
+
+    if (m_peerLinkSyncQueue.empty()) {
+        return;
+    }
+
+    // spread the Peer-Link masters evenly across the maintenance interval, the first is sent immediately
+    m_peerLinkSyncSpacing = (m_host->m_pingTime * 1000U) / m_peerLinkSyncQueue.size();
+    m_peerLinkSyncElapsed = m_peerLinkSyncSpacing;
+}
+
+/* Helper to synchronize the active peer list to the given Peer-Link master. */
+
+void FNENetwork::writePeerLinkSync(const std::string& name, PeerNetwork* peerNetwork)
+{
+    if (!peerNetwork->isEnabled() || !peerNetwork->isPeerLink()) {
+        return;
+    }
+
+    uint32_t peerNetPeerId = peerNetwork->getPeerId();
+    PeerLinkSyncState& state = m_peerLinkSync[name];
+
+    // determine which peers have changed since the last sync
+    std::vector<uint32_t> changed;
+    for (auto entry : m_peers) {
+        if (entry.second == nullptr)
+            continue;
+
+        auto it = state.sent.find(entry.first);
+        if (it == state.sent.end() || it->second != entry.second->statusVersion()) {
+            changed.push_back(entry.first);
+        }
+    }
+
+    json::array removed = json::array();
+    for (auto entry : state.sent) {
+        auto it = m_peers.find(entry.first);
+        if (it == m_peers.end() || it->second == nullptr) {
+            removed.push_back(json::value((double)entry.first));
+        }
+    }
+
+    // a full list is sent periodically (or when most peers changed), this refreshes the ping counters
+    // and recovers a Peer-Link master that missed any changes; masters that predate the active peer
+    // list changes ignore them, and are always sent the full list
+    bool full = !peerNetwork->hasPeerListDelta() || state.sent.empty() || state.deltaCount >= PEER_LINK_FULL_SYNC_INTERVAL ||
+        changed.size() > (m_peers.size() / 2U);
+
+    if (full) {
+        state.sent.clear();
+        state.deltaCount = 0U;
+
+        if (m_peers.size() == 0U) {
+            if (!removed.empty() && peerNetwork->hasPeerListDelta()) {
+                json::array updated = json::array();
+                peerNetwork->writePeerLinkPeerChanges(&updated, &removed);
+            }
+
+            return;
+        }
+
+        json::array peers = json::array();
+        for (auto entry : m_peers) {
+            uint32_t peerId = entry.first;
+            network::FNEPeerConnection* peerConn = entry.second;
+            if (peerConn != nullptr) {
+                json::object peerObj = fneConnObject(peerId, peerConn);
+                peerObj["parentPeerId"].set<uint32_t>(peerNetPeerId);
+                peers.push_back(json::value(peerObj));
+
+                state.sent[peerId] = peerConn->statusVersion();
+            }
+        }
+
+        peerNetwork->writePeerLinkPeers(&peers);
+        return;
+    }
+
+    state.deltaCount++;
+    if (changed.empty() && removed.empty()) {
+        return;
+    }
+
+    json::array updated = json::array();
+    for (uint32_t peerId : changed) {
+        network::FNEPeerConnection* peerConn = m_peers[peerId];
+
+        json::object peerObj = fneConnObject(peerId, peerConn);
+        peerObj["parentPeerId"].set<uint32_t>(peerNetPeerId);
+        updated.push_back(json::value(peerObj));
+
+        state.sent[peerId] = peerConn->statusVersion();
+    }
+
+    for (auto entry : removed) {
+        state.sent.erase(entry.get<uint32_t>());
+    }
+
+    peerNetwork->writePeerLinkPeerChanges(&updated, &removed);
+}
+
+/* Helper to get the peers that may be permitted traffic for a talkgroup that requires affiliations. */
+
+std::vector<uint32_t> FNENetwork::affiliatedPeers(uint32_t dstId, const std::vector<uint32_t>& alwaysSend)
+{
+    std::lock_guard<std::mutex> lock(m_affPeersMutex);
+    std::unordered_set<uint32_t> peers(m_affExemptPeers);
+    peers.insert(alwaysSend.begin(), alwaysSend.end());
+
+    auto it = m_tgAffPeers.find(dstId);
+    if (it != m_tgAffPeers.end()) {
+        peers.insert(it->second.begin(), it->second.end());
+
+        // voice channel peers are permitted by the affiliations of their control channel peer
+        for (uint32_t vcPeerId : m_vcPeers) {
+            auto peerIt = m_peers.find(vcPeerId);
+            if (peerIt != m_peers.end() && peerIt->second != nullptr) {
+                if (it->second.find(peerIt->second->ccPeerId()) != it->second.end())
+                    peers.insert(vcPeerId);
+            }
+        }
+    }
+
+    return std::vector<uint32_t>(peers.begin(), peers.end());
+}
+
 /* Helper to erase the peer from the peers list. */
 
 bool FNENetwork::erasePeer(uint32_t peerId)
@@ -1427,10 +1695,22 @@ bool FNENetwork::erasePeer(uint32_t peerId)
     {
         auto it = std::find_if(m_peers.begin(), m_peers.end(), [&](PeerMapPair x) { return x.first == peerId; });
         if (it != m_peers.end()) {
+            if (it->second != nullptr && it->second->connected()) {
+                publishPeerEvent(FNE_EVENT_PEER_DISCONNECTED, peerId, nullptr);
+            }
+
             m_peers.erase(peerId);
+            m_peerGeneration++;
         }
     }
 
+    // erase any affiliation index entries for this peer
+    {
+        std::lock_guard<std::mutex> affLock(m_affPeersMutex);
+        m_affExemptPeers.erase(peerId);
+        m_vcPeers.erase(peerId);
+    }
+
     // erase any CC maps for this peer
     {
         auto it = std::find_if(m_ccPeerMap.begin(), m_ccPeerMap.end(), [&](auto x) { return x.first == peerId; });
@@ -1516,6 +1796,75 @@ bool FNENetwork::resetPeer(uint32_t peerId)
     return false;
 }
 
+/* Helper to publish a peer connection event to the REST API event stream subscribers. */
+
+void FNENetwork::publishPeerEvent(const std::string& event, uint32_t peerId, FNEPeerConnection* connection)
+{
+    if (!m_eventPublisher.hasSubscribers()) {
+        return;
+    }
+
+    json::object data = json::object();
+    if (connection != nullptr) {
+        data = fneConnObject(peerId, connection);
+    }
+    else {
+        data["peerId"].set<uint32_t>(peerId);
+    }
+
+    uint64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    data["timestamp"].set<uint64_t>(timestamp);
+
+    m_eventPublisher.publish(event, data);
+}
+
+/* Helper to publish an affiliation event to the REST API event stream subscribers. */
+
+void FNENetwork::publishAffEvent(const std::string& event, uint32_t peerId, uint32_t srcId, uint32_t dstId)
+{
+    if (!m_eventPublisher.hasSubscribers()) {
+        return;
+    }
+
+    json::object data = json::object();
+    data["peerId"].set<uint32_t>(peerId);
+    data["srcId"].set<uint32_t>(srcId);
+    if (dstId != 0U) {
+        data["dstId"].set<uint32_t>(dstId);
+    }
+
+    uint64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    data["timestamp"].set<uint64_t>(timestamp);
+
+    m_eventPublisher.publish(event, data);
+}
+
+/* Helper to publish a call event to the REST API event stream subscribers. */
+
+void FNENetwork::publishCallEvent(const std::string& event, const std::string& mode, uint32_t peerId, uint32_t srcId, uint32_t dstId,
+    uint32_t streamId, uint64_t duration)
+{
+    if (!m_eventPublisher.hasSubscribers()) {
+        return;
+    }
+
+    json::object data = json::object();
+    std::string modeStr = mode;
+    data["mode"].set<std::string>(modeStr);
+    data["peerId"].set<uint32_t>(peerId);
+    data["srcId"].set<uint32_t>(srcId);
+    data["dstId"].set<uint32_t>(dstId);
+    data["streamId"].set<uint32_t>(streamId);
+    if (event == FNE_EVENT_CALL_END) {
+        data["duration"].set<uint64_t>(duration);
+    }
+
+    uint64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    data["timestamp"].set<uint64_t>(timestamp);
+
+    m_eventPublisher.publish(event, data);
+}
+
 /* Helper to resolve the peer ID to its identity string. */
 
 std::string FNENetwork::resolvePeerIdentity(uint32_t peerId)
@@ -1542,7 +1891,11 @@ void FNENetwork::setupRepeaterLogin(uint32_t peerId, FNEPeerConnection* connecti
     LogInfoEx(LOG_NET, "PEER %u started login from, %s:%u", peerId, connection->address().c_str(), connection->port());
 
     connection->connectionState(NET_STAT_WAITING_AUTHORISATION);
-    m_peers[peerId] = connection;
+    {
+        std::lock_guard<std::mutex> lock(m_peerMutex);
+        m_peers[peerId] = connection;
+        m_peerGeneration++;
+    }
 
     // transmit salt to peer
     uint8_t salt[4U];
@@ -1553,188 +1906,294 @@ void FNENetwork::setupRepeaterLogin(uint32_t peerId, FNEPeerConnection* connecti
     LogInfoEx(LOG_NET, "PEER %u RPTL ACK, challenge response sent for login", peerId);
 }
 
-/* Helper to send the ACL lists to the specified peer in a separate thread. */
+/* Helper to queue sending the ACL lists to the specified peer. */
 
 void FNENetwork::peerACLUpdate(uint32_t peerId)
 {
-    ACLUpdateRequest* req = new ACLUpdateRequest();
-    req->peerId = peerId;
+    std::lock_guard<std::mutex> lock(m_aclUpdateMutex);
+
+    // a peer already waiting for an update will receive the latest lists when it is serviced
+    auto it = std::find(m_aclUpdateQueue.begin(), m_aclUpdateQueue.end(), peerId);
+    if (it == m_aclUpdateQueue.end()) {
+        m_aclUpdateQueue.push_back(peerId);
+    }
 
-    std::stringstream peerName;
-    peerName << peerId << ":acl-update";
+    if (m_aclUpdateRunning) {
+        return;
+    }
 
-    if (!Thread::runAsThread(this, threadedACLUpdate, req)) {
-        delete req;
+    thread_t* thread = new thread_t();
+    thread->obj = this;
+
+    // runAsThread() releases the thread structure itself if the thread cannot be started
+    if (!Thread::runAsThread(this, threadedACLUpdate, thread)) {
         return;
     }
 
+    m_aclUpdateRunning = true;
+
     // pthread magic to rename the thread properly
 #ifdef _GNU_SOURCE
-    ::pthread_setname_np(req->thread, peerName.str().c_str());
+    ::pthread_setname_np(thread->thread, "fne:acl-update");
 #endif // _GNU_SOURCE
 }
 
-/* Helper to send the ACL lists to the specified peer in a separate thread. */
+/* Entry point to send the ACL lists to the queued peers. */
 
 void* FNENetwork::threadedACLUpdate(void* arg)
 {
-    ACLUpdateRequest* req = (ACLUpdateRequest*)arg;
-    if (req != nullptr) {
+    thread_t* th = (thread_t*)arg;
+    if (th != nullptr) {
 #if defined(_WIN32)
-        ::CloseHandle(req->thread);
+        ::CloseHandle(th->thread);
 #else
-        ::pthread_detach(req->thread);
+        ::pthread_detach(th->thread);
 #endif // defined(_WIN32)
 
-        FNENetwork* network = static_cast<FNENetwork*>(req->obj);
+        FNENetwork* network = static_cast<FNENetwork*>(th->obj);
         if (network == nullptr) {
-            delete req;
+            delete th;
             return nullptr;
         }
 
-        std::string peerIdentity = network->resolvePeerIdentity(req->peerId);
-
-        FNEPeerConnection* connection = network->m_peers[req->peerId];
-        if (connection != nullptr) {
-            // if the connection is an external peer, and peer is participating in peer link,
-            // send the peer proper configuration data
-            if (connection->isExternalPeer() && connection->isPeerLink()) {
-                LogInfoEx(LOG_NET, "PEER %u (%s) sending Peer-Link ACL list updates", req->peerId, peerIdentity.c_str());
-
-                network->writeWhitelistRIDs(req->peerId, true);
-                network->writeTGIDs(req->peerId, true);
+        while (true) {
+            uint32_t peerId = 0U;
+            {
+                std::lock_guard<std::mutex> lock(network->m_aclUpdateMutex);
+                if (network->m_aclUpdateQueue.empty()) {
+                    network->m_aclUpdateRunning = false;
+                    break;
+                }
 
-                connection->pktLastSeq(RTP_END_OF_CALL_SEQ - 1U);
-                network->writePeerList(req->peerId);
+                peerId = network->m_aclUpdateQueue.front();
+                network->m_aclUpdateQueue.pop_front();
             }
-            else {
-                LogInfoEx(LOG_NET, "PEER %u (%s) sending ACL list updates", req->peerId, peerIdentity.c_str());
 
-                network->writeWhitelistRIDs(req->peerId, false);
-                network->writeBlacklistRIDs(req->peerId);
-                network->writeTGIDs(req->peerId, false);
+            network->writePeerACLs(peerId);
 
-                connection->pktLastSeq(RTP_END_OF_CALL_SEQ - 1U);
-                network->writeDeactiveTGIDs(req->peerId);
-            }
+            // pace the updates so a full list push doesn't burst every peer at once
+            Thread::sleep(ACL_UPDATE_PACING);
         }
 
-        delete req;
+        delete th;
     }
 
     return nullptr;
 }
 
-/* Helper to send the list of whitelisted RIDs to the specified peer. */
+/* Helper to send the ACL lists to the specified peer. */
 
-void FNENetwork::writeWhitelistRIDs(uint32_t peerId, bool isExternalPeer)
+void FNENetwork::writePeerACLs(uint32_t peerId)
 {
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    auto it = m_peers.find(peerId);
+    if (it == m_peers.end() || it->second == nullptr) {
+        return;
+    }
 
-    // sending PEER_LINK style RID list to external peers
-    if (isExternalPeer) {
-        FNEPeerConnection* connection = m_peers[peerId];
-        if (connection != nullptr) {
-            std::string filename = m_ridLookup->filename();
-            if (filename.empty()) {
-                return;
-            }
+    FNEPeerConnection* connection = it->second;
+    std::string peerIdentity = resolvePeerIdentity(peerId);
 
-            // read entire file into string buffer
-            std::stringstream b;
-            std::ifstream stream(filename);
-            if (stream.is_open()) {
-                while (stream.peek() != EOF) {
-                    b << (char)stream.get();
-                }
+    // if the connection is an external peer, and peer is participating in peer link,
+    // send the peer proper configuration data
+    if (connection->isExternalPeer() && connection->isPeerLink()) {
+        LogInfoEx(LOG_NET, "PEER %u (%s) sending Peer-Link ACL list updates", peerId, peerIdentity.c_str());
 
-                stream.close();
-            }
+        writeWhitelistRIDs(peerId, true);
+        writeTGIDs(peerId, true);
 
-            // convert to a byte array
-            uint32_t len = b.str().size();
-            UInt8Array __buffer = std::make_unique<uint8_t[]>(len);
-            uint8_t* buffer = __buffer.get();
-            ::memset(buffer, 0x00U, len);
-            ::memcpy(buffer, b.str().data(), len);
-
-            // compression structures
-            z_stream strm;
-            strm.zalloc = Z_NULL;
-            strm.zfree = Z_NULL;
-            strm.opaque = Z_NULL;
-
-            // initialize compression
-            if (deflateInit(&strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
-                LogError(LOG_NET, "PEER %u (%s) error initializing ZLIB", peerId, connection->identity().c_str());
-                return;
-            }
+        connection->pktLastSeq(RTP_END_OF_CALL_SEQ - 1U);
+        writePeerList(peerId);
+    }
+    else {
+        LogInfoEx(LOG_NET, "PEER %u (%s) sending ACL list updates", peerId, peerIdentity.c_str());
 
-            // set input data
-            strm.avail_in = len;
-            strm.next_in = buffer;
-
-            // compress data
-            std::vector<uint8_t> compressedData;
-            int ret;
-            do {
-                // resize the output buffer as needed
-                compressedData.resize(compressedData.size() + 16384);
-                strm.avail_out = 16384;
-                strm.next_out = compressedData.data() + compressedData.size() - 16384;
-
-                ret = deflate(&strm, Z_FINISH);
-                if (ret == Z_STREAM_ERROR) {
-                    LogError(LOG_NET, "PEER %u (%s) error compressing TGID list", peerId, connection->identity().c_str());
-                    deflateEnd(&strm);
-                    return;
-                }
-            } while (ret != Z_STREAM_END);
+        writeWhitelistRIDs(peerId, false);
+        writeBlacklistRIDs(peerId);
+        writeTGIDs(peerId, false);
 
-            // resize the output buffer to the actual compressed data size
-            compressedData.resize(strm.total_out);
+        connection->pktLastSeq(RTP_END_OF_CALL_SEQ - 1U);
+        writeDeactiveTGIDs(peerId);
+    }
+}
 
-            // cleanup
-            deflateEnd(&strm);
+/* Helper to get the cached compressed Peer-Link payload for a lookup table. */
 
-            uint32_t compressedLen = strm.total_out;
-            uint8_t* compressed = compressedData.data();
+bool FNENetwork::peerLinkACLPayload(PeerLinkACLPayload& cache, uint32_t version, const std::function<bool(std::vector<uint8_t>&)>& serialize,
+    PeerLinkACLPayload& payload)
+{
+    std::lock_guard<std::mutex> lock(m_aclCacheMutex);
+    if (cache.valid && cache.version == version) {
+        payload = cache;
+        return true;
+    }
 
-            // Utils::dump(1U, "Compressed Payload", compressed, compressedLen);
+    cache.valid = false;
 
-            // transmit TGIDs
-            uint8_t blockCnt = (compressedLen / PEER_LINK_BLOCK_SIZE) + (compressedLen % PEER_LINK_BLOCK_SIZE ? 1U : 0U);
-            uint32_t offs = 0U;
-            for (uint8_t i = 0U; i < blockCnt; i++) {
-                // build dataset
-                uint16_t bufSize = 10U + (PEER_LINK_BLOCK_SIZE);
-                UInt8Array __payload = std::make_unique<uint8_t[]>(bufSize);
-                uint8_t* payload = __payload.get();
-                ::memset(payload, 0x00U, bufSize);
+    // serialize the lookup table into its compact binary representation
+    std::vector<uint8_t> serialized;
+    if (!serialize(serialized)) {
+        return false;
+    }
 
-                if (i == 0U) {
-                    __SET_UINT32(len, payload, 0U);
-                    __SET_UINT32(compressedLen, payload, 4U);
-                }
+    // the deflate stream is initialized once and reset for each payload
+    if (!m_aclDeflateInit) {
+        m_aclDeflate.zalloc = Z_NULL;
+        m_aclDeflate.zfree = Z_NULL;
+        m_aclDeflate.opaque = Z_NULL;
 
-                payload[8U] = i;
-                payload[9U] = blockCnt - 1U;
+        if (deflateInit(&m_aclDeflate, Z_DEFAULT_COMPRESSION) != Z_OK) {
+            LogError(LOG_NET, "error initializing ZLIB");
+            return false;
+        }
 
-                uint32_t blockSize = PEER_LINK_BLOCK_SIZE;
-                if (offs + PEER_LINK_BLOCK_SIZE > compressedLen)
-                    blockSize = PEER_LINK_BLOCK_SIZE - ((offs + PEER_LINK_BLOCK_SIZE) - compressedLen);
+        m_aclDeflateInit = true;
+    }
+    else {
+        deflateReset(&m_aclDeflate);
+    }
 
-                ::memcpy(payload + 10U, compressed + offs, blockSize);
+    // the output buffer is sized to the worst case, so the payload compresses in a single pass
+    cache.compressed.resize(deflateBound(&m_aclDeflate, serialized.size()));
 
-                if (m_debug)
-                    Utils::dump(1U, "Peer-Link RID Block Payload", payload, bufSize);
+    m_aclDeflate.avail_in = serialized.size();
+    m_aclDeflate.next_in = serialized.data();
+    m_aclDeflate.avail_out = cache.compressed.size();
+    m_aclDeflate.next_out = cache.compressed.data();
 
-                offs += PEER_LINK_BLOCK_SIZE;
+    int ret = deflate(&m_aclDeflate, Z_FINISH);
+    if (ret != Z_STREAM_END) {
+        LogError(LOG_NET, "error compressing Peer-Link ACL list, ret = %d", ret);
+        cache.compressed.clear();
+        return false;
+    }
+
+    cache.compressed.resize(m_aclDeflate.total_out);
+    cache.length = serialized.size();
+    cache.version = version;
+    cache.valid = true;
+
+    // Utils::dump(1U, "Compressed Payload", cache.compressed.data(), cache.compressed.size());
+
+    payload = cache;
+    return true;
+}
+
+/* Helper to send a compressed Peer-Link payload to the specified peer. */
+
+void FNENetwork::writePeerLinkPayload(uint32_t peerId, NET_SUBFUNC::ENUM subFunc, const PeerLinkACLPayload& payload)
+{
+    uint32_t compressedLen = payload.compressed.size();
+    const uint8_t* compressed = payload.compressed.data();
+
+    // build dataset
+    uint16_t bufSize = 10U + (PEER_LINK_BLOCK_SIZE);
+    UInt8Array __buffer = std::make_unique<uint8_t[]>(bufSize);
+    uint8_t* buffer = __buffer.get();
+
+    // transmit blocks
+    uint8_t blockCnt = (compressedLen / PEER_LINK_BLOCK_SIZE) + (compressedLen % PEER_LINK_BLOCK_SIZE ? 1U : 0U);
+    uint32_t offs = 0U;
+    for (uint8_t i = 0U; i < blockCnt; i++) {
+        ::memset(buffer, 0x00U, bufSize);
+
+        if (i == 0U) {
+            __SET_UINT32(payload.length, buffer, 0U);
+            __SET_UINT32(compressedLen, buffer, 4U);
+        }
+
+        buffer[8U] = i;
+        buffer[9U] = blockCnt - 1U;
+
+        uint32_t blockSize = PEER_LINK_BLOCK_SIZE;
+        if (offs + PEER_LINK_BLOCK_SIZE > compressedLen)
+            blockSize = PEER_LINK_BLOCK_SIZE - ((offs + PEER_LINK_BLOCK_SIZE) - compressedLen);
+
+        ::memcpy(buffer + 10U, compressed + offs, blockSize);
+
+        if (m_debug)
+            Utils::dump(1U, "Peer-Link Block Payload", buffer, bufSize);
+
+        offs += PEER_LINK_BLOCK_SIZE;
 
-                writePeer(peerId, { NET_FUNC::PEER_LINK, NET_SUBFUNC::PL_RID_LIST }, 
-                    payload, bufSize, 0U, false, true, true);
+        writePeer(peerId, { NET_FUNC::PEER_LINK, subFunc }, buffer, bufSize, 0U, false, true, true);
+    }
+}
+
+/* Helper to read the contents of a lookup table file. */
+
+bool FNENetwork::lookupFileContents(const std::string& filename, std::vector<uint8_t>& data)
+{
+    if (filename.empty()) {
+        return false;
+    }
+
+    std::ifstream stream(filename, std::ifstream::binary);
+    if (!stream.is_open()) {
+        LogError(LOG_NET, "Cannot open the lookup table file - %s", filename.c_str());
+        return false;
+    }
+
+    data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    stream.close();
+    return true;
+}
+
+/* Helper to get the cached radio ID whitelist and blacklist. */
+
+void FNENetwork::ridACLLists(std::vector<uint32_t>& whitelist, std::vector<uint32_t>& blacklist)
+{
+    std::lock_guard<std::mutex> lock(m_aclCacheMutex);
+
+    uint32_t version = m_ridLookup->version();
+    if (!m_aclRIDListValid || m_aclRIDListVersion != version) {
+        m_aclRIDWhitelist.clear();
+        m_aclRIDBlacklist.clear();
+
+        auto ridLookups = m_ridLookup->table();
+        for (auto entry : ridLookups) {
+            uint32_t id = entry.first;
+            if (entry.second.radioEnabled()) {
+                m_aclRIDWhitelist.push_back(id);
+            }
+            else {
+                m_aclRIDBlacklist.push_back(id);
             }
+        }
 
+        m_aclRIDListVersion = version;
+        m_aclRIDListValid = true;
+    }
+
+    whitelist = m_aclRIDWhitelist;
+    blacklist = m_aclRIDBlacklist;
+}
+
+/* Helper to send the list of whitelisted RIDs to the specified peer. */
+
+void FNENetwork::writeWhitelistRIDs(uint32_t peerId, bool isExternalPeer)
+{
+    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+    // sending PEER_LINK style RID list to external peers
+    if (isExternalPeer) {
+        FNEPeerConnection* connection = m_peers[peerId];
+        if (connection != nullptr) {
+            PeerLinkACLPayload payload;
+            bool ret = false;
+            if (connection->packedTables()) {
+                ret = peerLinkACLPayload(m_aclRIDPayload, m_ridLookup->version(),
+                    [&](std::vector<uint8_t>& data) { m_ridLookup->serialize(data); return true; }, payload);
+            }
+            else {
+                ret = peerLinkACLPayload(m_aclRIDFilePayload, m_ridLookup->version(),
+                    [&](std::vector<uint8_t>& data) { return lookupFileContents(m_ridLookup->filename(), data); }, payload);
+            }
+
+            if (!ret) {
+                return;
+            }
+
+            writePeerLinkPayload(peerId, NET_SUBFUNC::PL_RID_LIST, payload);
             connection->lastPing(now);
         }
 
@@ -1742,15 +2201,8 @@ void FNENetwork::writeWhitelistRIDs(uint32_t peerId, bool isExternalPeer)
     }
 
     // send radio ID white/black lists
-    std::vector<uint32_t> ridWhitelist;
-
-    auto ridLookups = m_ridLookup->table();
-    for (auto entry : ridLookups) {
-        uint32_t id = entry.first;
-        if (entry.second.radioEnabled()) {
-            ridWhitelist.push_back(id);
-        }
-    }
+    std::vector<uint32_t> ridWhitelist, ridBlacklist;
+    ridACLLists(ridWhitelist, ridBlacklist);
 
     if (ridWhitelist.size() == 0U) {
         return;
@@ -1816,15 +2268,8 @@ void FNENetwork::writeBlacklistRIDs(uint32_t peerId)
     uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
     // send radio ID blacklist
-    std::vector<uint32_t> ridBlacklist;
-
-    auto ridLookups = m_ridLookup->table();
-    for (auto entry : ridLookups) {
-        uint32_t id = entry.first;
-        if (!entry.second.radioEnabled()) {
-            ridBlacklist.push_back(id);
-        }
-    }
+    std::vector<uint32_t> ridWhitelist, ridBlacklist;
+    ridACLLists(ridWhitelist, ridBlacklist);
 
     if (ridBlacklist.size() == 0U) {
         return;
@@ -1897,106 +2342,22 @@ void FNENetwork::writeTGIDs(uint32_t peerId, bool isExternalPeer)
     if (isExternalPeer) {
         FNEPeerConnection* connection = m_peers[peerId];
         if (connection != nullptr) {
-            std::string filename = m_tidLookup->filename();
-            if (filename.empty()) {
-                return;
+            PeerLinkACLPayload payload;
+            bool ret = false;
+            if (connection->packedTables()) {
+                ret = peerLinkACLPayload(m_aclTGIDPayload, m_tidLookup->version(),
+                    [&](std::vector<uint8_t>& data) { m_tidLookup->serialize(data); return true; }, payload);
             }
-
-            // read entire file into string buffer
-            std::stringstream b;
-            std::ifstream stream(filename);
-            if (stream.is_open()) {
-                while (stream.peek() != EOF) {
-                    b << (char)stream.get();
-                }
-
-                stream.close();
+            else {
+                ret = peerLinkACLPayload(m_aclTGIDFilePayload, m_tidLookup->version(),
+                    [&](std::vector<uint8_t>& data) { return lookupFileContents(m_tidLookup->filename(), data); }, payload);
             }
 
-            // convert to a byte array
-            uint32_t len = b.str().size();
-            UInt8Array __buffer = std::make_unique<uint8_t[]>(len);
-            uint8_t* buffer = __buffer.get();
-            ::memset(buffer, 0x00U, len);
-            ::memcpy(buffer, b.str().data(), len);
-
-            // compression structures
-            z_stream strm;
-            strm.zalloc = Z_NULL;
-            strm.zfree = Z_NULL;
-            strm.opaque = Z_NULL;
-
-            // initialize compression
-            if (deflateInit(&strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
-                LogError(LOG_NET, "PEER %u (%s) error initializing ZLIB", peerId, connection->identity().c_str());
+            if (!ret) {
                 return;
             }
 
-            // set input data
-            strm.avail_in = len;
-            strm.next_in = buffer;
-
-            // compress data
-            std::vector<uint8_t> compressedData;
-            int ret;
-            do {
-                // resize the output buffer as needed
-                compressedData.resize(compressedData.size() + 16384);
-                strm.avail_out = 16384;
-                strm.next_out = compressedData.data() + compressedData.size() - 16384;
-
-                ret = deflate(&strm, Z_FINISH);
-                if (ret == Z_STREAM_ERROR) {
-                    LogError(LOG_NET, "PEER %u (%s) error compressing TGID list", peerId, connection->identity().c_str());
-                    deflateEnd(&strm);
-                    return;
-                }
-            } while (ret != Z_STREAM_END);
-
-            // resize the output buffer to the actual compressed data size
-            compressedData.resize(strm.total_out);
-
-            // cleanup
-            deflateEnd(&strm);
-
-            uint32_t compressedLen = strm.total_out;
-            uint8_t* compressed = compressedData.data();
-
-            // Utils::dump(1U, "Compressed Payload", compressed, compressedLen);
-
-            // transmit TGIDs
-            uint8_t blockCnt = (compressedLen / PEER_LINK_BLOCK_SIZE) + (compressedLen % PEER_LINK_BLOCK_SIZE ? 1U : 0U);
-            uint32_t offs = 0U;
-            for (uint8_t i = 0U; i < blockCnt; i++) {
-                // build dataset
-                uint16_t bufSize = 10U + (PEER_LINK_BLOCK_SIZE);
-                UInt8Array __payload = std::make_unique<uint8_t[]>(bufSize);
-                uint8_t* payload = __payload.get();
-                ::memset(payload, 0x00U, bufSize);
-
-                if (i == 0U) {
-                    __SET_UINT32(len, payload, 0U);
-                    __SET_UINT32(compressedLen, payload, 4U);
-                }
-
-                payload[8U] = i;
-                payload[9U] = blockCnt - 1U;
-
-                uint32_t blockSize = PEER_LINK_BLOCK_SIZE;
-                if (offs + PEER_LINK_BLOCK_SIZE > compressedLen)
-                    blockSize = PEER_LINK_BLOCK_SIZE - ((offs + PEER_LINK_BLOCK_SIZE) - compressedLen);
-
-                ::memcpy(payload + 10U, compressed + offs, blockSize);
-
-                if (m_debug)
-                    Utils::dump(1U, "Peer-Link TGID Block Payload", payload, bufSize);
-
-                offs += PEER_LINK_BLOCK_SIZE;
-
-                writePeer(peerId, { NET_FUNC::PEER_LINK, NET_SUBFUNC::PL_TALKGROUP_LIST }, 
-                    payload, bufSize, 0U, false, true, true);
-            }
-
+            writePeerLinkPayload(peerId, NET_SUBFUNC::PL_TALKGROUP_LIST, payload);
             connection->lastPing(now);
         }
 
@@ -2152,106 +2513,22 @@ void FNENetwork::writePeerList(uint32_t peerId)
     // sending PEER_LINK style RID list to external peers
     FNEPeerConnection* connection = m_peers[peerId];
     if (connection != nullptr) {
-        std::string filename = m_peerListLookup->filename();
-        if (filename.empty()) {
-            return;
+        PeerLinkACLPayload payload;
+        bool ret = false;
+        if (connection->packedTables()) {
+            ret = peerLinkACLPayload(m_aclPIDPayload, m_peerListLookup->version(),
+                [&](std::vector<uint8_t>& data) { m_peerListLookup->serialize(data); return true; }, payload);
         }
-
-        // read entire file into string buffer
-        std::stringstream b;
-        std::ifstream stream(filename);
-        if (stream.is_open()) {
-            while (stream.peek() != EOF) {
-                b << (char)stream.get();
-            }
-
-            stream.close();
+        else {
+            ret = peerLinkACLPayload(m_aclPIDFilePayload, m_peerListLookup->version(),
+                [&](std::vector<uint8_t>& data) { return lookupFileContents(m_peerListLookup->filename(), data); }, payload);
         }
 
-        // convert to a byte array
-        uint32_t len = b.str().size();
-        UInt8Array __buffer = std::make_unique<uint8_t[]>(len);
-        uint8_t* buffer = __buffer.get();
-        ::memset(buffer, 0x00U, len);
-        ::memcpy(buffer, b.str().data(), len);
-
-        // compression structures
-        z_stream strm;
-        strm.zalloc = Z_NULL;
-        strm.zfree = Z_NULL;
-        strm.opaque = Z_NULL;
-
-        // initialize compression
-        if (deflateInit(&strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
-            LogError(LOG_NET, "PEER %u (%s) error initializing ZLIB", peerId, connection->identity().c_str());
+        if (!ret) {
             return;
         }
 
-        // set input data
-        strm.avail_in = len;
-        strm.next_in = buffer;
-
-        // compress data
-        std::vector<uint8_t> compressedData;
-        int ret;
-        do {
-            // resize the output buffer as needed
-            compressedData.resize(compressedData.size() + 16384);
-            strm.avail_out = 16384;
-            strm.next_out = compressedData.data() + compressedData.size() - 16384;
-
-            ret = deflate(&strm, Z_FINISH);
-            if (ret == Z_STREAM_ERROR) {
-                LogError(LOG_NET, "PEER %u (%s) error compressing TGID list", peerId, connection->identity().c_str());
-                deflateEnd(&strm);
-                return;
-            }
-        } while (ret != Z_STREAM_END);
-
-        // resize the output buffer to the actual compressed data size
-        compressedData.resize(strm.total_out);
-
-        // cleanup
-        deflateEnd(&strm);
-
-        uint32_t compressedLen = strm.total_out;
-        uint8_t* compressed = compressedData.data();
-
-        // Utils::dump(1U, "Compressed Payload", compressed, compressedLen);
-
-        // transmit TGIDs
-        uint8_t blockCnt = (compressedLen / PEER_LINK_BLOCK_SIZE) + (compressedLen % PEER_LINK_BLOCK_SIZE ? 1U : 0U);
-        uint32_t offs = 0U;
-        for (uint8_t i = 0U; i < blockCnt; i++) {
-            // build dataset
-            uint16_t bufSize = 10U + (PEER_LINK_BLOCK_SIZE);
-            UInt8Array __payload = std::make_unique<uint8_t[]>(bufSize);
-            uint8_t* payload = __payload.get();
-            ::memset(payload, 0x00U, bufSize);
-
-            if (i == 0U) {
-                __SET_UINT32(len, payload, 0U);
-                __SET_UINT32(compressedLen, payload, 4U);
-            }
-
-            payload[8U] = i;
-            payload[9U] = blockCnt - 1U;
-
-            uint32_t blockSize = PEER_LINK_BLOCK_SIZE;
-            if (offs + PEER_LINK_BLOCK_SIZE > compressedLen)
-                blockSize = PEER_LINK_BLOCK_SIZE - ((offs + PEER_LINK_BLOCK_SIZE) - compressedLen);
-
-            ::memcpy(payload + 10U, compressed + offs, blockSize);
-
-            if (m_debug)
-                Utils::dump(1U, "Peer-Link Peer List Block Payload", payload, bufSize);
-
-            offs += PEER_LINK_BLOCK_SIZE;
-
-            writePeer(peerId, { NET_FUNC::PEER_LINK, NET_SUBFUNC::PL_PEER_LIST }, 
-                payload, bufSize, 0U, false, true, true);
-        }
-
+        writePeerLinkPayload(peerId, NET_SUBFUNC::PL_PEER_LIST, payload);
         connection->lastPing(now);
     }
 
@@ -27,16 +27,21 @@
 #include "fne/Defines.h"
 #include "common/network/BaseNetwork.h"
 #include "common/network/json/json.h"
+#include "common/network/rest/http/HTTPEventStream.h"
 #include "common/lookups/AffiliationLookup.h"
 #include "common/lookups/RadioIdLookup.h"
 #include "common/lookups/TalkgroupRulesLookup.h"
 #include "common/lookups/PeerListLookup.h"
+#include "common/zlib/zlib.h"
 #include "fne/network/influxdb/InfluxDB.h"
 #include "host/network/Network.h"
 
+#include <atomic>
 #include <string>
 #include <cstdint>
+#include <deque>
 #include <unordered_map>
+#include <unordered_set>
 #include <mutex>
 
 // ---------------------------------------------------------------------------
@@ -82,6 +87,7 @@ namespace network
 
     class HOST_SW_API DiagNetwork;
     class HOST_SW_API FNENetwork;
+    class HOST_SW_API PeerNetwork;
 
     // ---------------------------------------------------------------------------
     //  Class Declaration
@@ -118,7 +124,9 @@ namespace network
             m_isConventionalPeer(false),
             m_isSysView(false),
             m_isPeerLink(false),
+            m_packedTables(false),
             m_config(),
+            m_statusVersion(0U),
             m_pktLastSeq(RTP_END_OF_CALL_SEQ),
             m_pktNextSeq(1U)
         {
@@ -148,7 +156,9 @@ namespace network
             m_isConventionalPeer(false),
             m_isSysView(false),
             m_isPeerLink(false),
+            m_packedTables(false),
             m_config(),
+            m_statusVersion(0U),
             m_pktLastSeq(RTP_END_OF_CALL_SEQ),
             m_pktNextSeq(1U)
         {
@@ -240,11 +250,20 @@ namespace network
          * @brief Flag indicating this connection is from an external peer that is peer link enabled.
          */
         __PROPERTY_PLAIN(bool, isPeerLink);
+        /**
+         * @brief Flag indicating this peer can decode Peer-Link lookup tables in their compact binary form.
+         */
+        __PROPERTY_PLAIN(bool, packedTables);
 
         /**
          * @brief JSON objecting containing peer configuration information.
          */
         __PROPERTY_PLAIN(json::object, config);
+        /**
+         * @brief Status version; changes whenever the peer status reported to Peer-Link masters changes
+         *  (excluding the ping counters).
+         */
+        __PROPERTY_PLAIN(uint32_t, statusVersion);
 
         /**
          * @brief Last received RTP sequence.
@@ -261,11 +280,28 @@ namespace network
     // ---------------------------------------------------------------------------
 
     /**
-     * @brief Represents the data required for a peer ACL update request thread.
+     * @brief Represents a compressed Peer-Link ACL payload; the compact binary form of a lookup table,
+     *  compressed once and cached until the lookup table changes.
+     * @ingroup fne_network
+     */
+    struct PeerLinkACLPayload {
+        bool valid;                         //! Flag indicating the payload has been built.
+        uint32_t version;                   //! Lookup table version the payload was built from.
+        uint32_t length;                    //! Length of the uncompressed payload.
+        std::vector<uint8_t> compressed;    //! Compressed payload.
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Structure Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Represents the active peer list synchronization state for a Peer-Link master.
      * @ingroup fne_network
      */
-    struct ACLUpdateRequest : thread_t {
-        uint32_t peerId;        //! Peer ID for this request.
+    struct PeerLinkSyncState {
+        std::unordered_map<uint32_t, uint32_t> sent;    //! Status version of each peer last sent.
+        uint32_t deltaCount;                            //! Number of change syncs since the last full sync.
     };
 
     // ---------------------------------------------------------------------------
@@ -445,6 +481,38 @@ namespace network
         typedef std::pair<const uint32_t, lookups::AffiliationLookup*> PeerAffiliationMapPair;
         std::unordered_map<uint32_t, lookups::AffiliationLookup*> m_peerAffiliations;
         std::unordered_map<uint32_t, std::vector<uint32_t>> m_ccPeerMap;
+        std::atomic<uint32_t> m_peerGeneration;
+        std::atomic<uint32_t> m_peerStatusVersion;
+
+        std::unordered_map<std::string, PeerLinkSyncState> m_peerLinkSync;
+        std::deque<std::string> m_peerLinkSyncQueue;
+        uint32_t m_peerLinkSyncSpacing;
+        uint32_t m_peerLinkSyncElapsed;
+
+        std::mutex m_affPeersMutex;
+        //                 dstId     peerIds
+        std::unordered_map<uint32_t, std::unordered_set<uint32_t>> m_tgAffPeers;
+        std::unordered_set<uint32_t> m_affExemptPeers;
+        std::unordered_set<uint32_t> m_vcPeers;
+        std::atomic<uint32_t> m_affPeersGeneration;
+
+        std::mutex m_aclUpdateMutex;
+        std::deque<uint32_t> m_aclUpdateQueue;
+        bool m_aclUpdateRunning;
+
+        std::mutex m_aclCacheMutex;
+        z_stream m_aclDeflate;
+        bool m_aclDeflateInit;
+        PeerLinkACLPayload m_aclRIDPayload;
+        PeerLinkACLPayload m_aclTGIDPayload;
+        PeerLinkACLPayload m_aclPIDPayload;
+        PeerLinkACLPayload m_aclRIDFilePayload;
+        PeerLinkACLPayload m_aclTGIDFilePayload;
+        PeerLinkACLPayload m_aclPIDFilePayload;
+        bool m_aclRIDListValid;
+        uint32_t m_aclRIDListVersion;
+        std::vector<uint32_t> m_aclRIDWhitelist;
+        std::vector<uint32_t> m_aclRIDBlacklist;
 
         Timer m_maintainenceTimer;
 
@@ -453,6 +521,9 @@ namespace network
 
         bool m_callInProgress;
 
+        std::atomic<uint64_t> m_routePlanHits;
+        std::atomic<uint64_t> m_routePlanRebuilds;
+
         bool m_disallowAdjStsBcast;
         bool m_disallowExtAdjStsBcast;
         bool m_allowConvSiteAffOverride;
@@ -478,6 +549,8 @@ namespace network
         bool m_dumpPacketData;
         bool m_verbosePacketData;
 
+        network::rest::http::HTTPEventPublisher m_eventPublisher;
+
         bool m_reportPeerPing;
         bool m_verbose;
 
@@ -495,6 +568,14 @@ namespace network
          */
         bool checkU2UDroppedPeer(uint32_t peerId);
 
+        /**
+         * @brief Helper to get the current routing generation. The routing generation changes whenever the
+         *  peer set, peer affiliations, radio ID ACL or talkgroup rules change and is used to invalidate
+         *  any per-stream route plans.
+         * @returns uint64_t Routing generation.
+         */
+        uint64_t routeGeneration() const;
+
         /**
          * @brief Helper to create a peer on the peers affiliations list.
          * @param peerId Peer ID.
@@ -507,6 +588,42 @@ namespace network
          * @returns bool True, if the peer affiliations were deleted, otherwise false.
          */
         bool erasePeerAffiliations(uint32_t peerId);
+        /**
+         * @brief Helper to update the talkgroup affiliation index when a peer gains the first affiliation
+         *  or loses the last affiliation to a talkgroup.
+         * @param peerId Peer ID.
+         * @param dstId Talkgroup ID.
+         * @param affiliated Flag indicating whether the peer has affiliations to the talkgroup.
+         */
+        void updateAffiliatedPeer(uint32_t peerId, uint32_t dstId, bool affiliated);
+
+        /**
+         * @brief Helper to flag the status of the given peer connection as changed.
+         * @param connection FNE Peer Connection.
+         */
+        void peerStatusChanged(FNEPeerConnection* connection) { connection->statusVersion(++m_peerStatusVersion); }
+        /**
+         * @brief Helper to schedule the active peer list synchronization to the Peer-Link masters, spread
+         *  evenly across the maintenance interval.
+         */
+        void schedulePeerLinkSync();
+        /**
+         * @brief Helper to synchronize the active peer list to the given Peer-Link master. Only the peers
+         *  that changed since the last synchronization are sent, with a periodic full list to refresh the
+         *  ping counters and recover from any lost changes.
+         * @param name Peer network name.
+         * @param peerNetwork Peer network.
+         */
+        void writePeerLinkSync(const std::string& name, PeerNetwork* peerNetwork);
+        /**
+         * @brief Helper to get the peers that may be permitted traffic for a talkgroup that requires affiliations.
+         *  These are the peers with affiliations to the talkgroup, the voice channel peers of those peers, the peers
+         *  that are not subject to affiliation checks and the given always send peers.
+         * @param dstId Talkgroup ID.
+         * @param alwaysSend List of peer IDs that always receive traffic for the talkgroup.
+         * @returns std::vector<uint32_t> List of peer IDs.
+         */
+        std::vector<uint32_t> affiliatedPeers(uint32_t dstId, const std::vector<uint32_t>& alwaysSend);
         /**
          * @brief Helper to erase the peer from the peers list.
          * @param peerId Peer ID.
@@ -514,6 +631,34 @@ namespace network
          */
         bool erasePeer(uint32_t peerId);
 
+        /**
+         * @brief Helper to publish a peer connection event to the REST API event stream subscribers.
+         * @param event Event type.
+         * @param peerId Peer ID.
+         * @param connection Instance of the FNEPeerConnection class (if any).
+         */
+        void publishPeerEvent(const std::string& event, uint32_t peerId, FNEPeerConnection* connection);
+        /**
+         * @brief Helper to publish an affiliation event to the REST API event stream subscribers.
+         * @param event Event type.
+         * @param peerId Peer ID.
+         * @param srcId Source Radio ID.
+         * @param dstId Destination ID.
+         */
+        void publishAffEvent(const std::string& event, uint32_t peerId, uint32_t srcId, uint32_t dstId);
+        /**
+         * @brief Helper to publish a call event to the REST API event stream subscribers.
+         * @param event Event type.
+         * @param mode Digital mode.
+         * @param peerId Peer ID.
+         * @param srcId Source Radio ID.
+         * @param dstId Destination ID.
+         * @param streamId Stream ID.
+         * @param duration Call duration (ms).
+         */
+        void publishCallEvent(const std::string& event, const std::string& mode, uint32_t peerId, uint32_t srcId, uint32_t dstId,
+            uint32_t streamId, uint64_t duration = 0U);
+
         /**
          * @brief Helper to resolve the peer ID to its identity string.
          * @param peerId Peer ID.
@@ -529,16 +674,56 @@ namespace network
         void setupRepeaterLogin(uint32_t peerId, FNEPeerConnection* connection);
 
         /**
-         * @brief Helper to send the ACL lists to the specified peer in a separate thread.
+         * @brief Helper to queue sending the ACL lists to the specified peer. The ACL lists are sent to
+         *  queued peers, one peer at a time, by a single ACL update thread.
          * @param peerId Peer ID.
          */
         void peerACLUpdate(uint32_t peerId);
         /**
-         * @brief Entry point to send the ACL lists to the specified peer in a separate thread.
-         * @param arg Instance of the ACLUpdateRequest structure.
+         * @brief Entry point to send the ACL lists to the queued peers.
+         * @param arg Instance of the thread_t structure.
          * @returns void* (Ignore)
          */
         static void* threadedACLUpdate(void* arg);
+        /**
+         * @brief Helper to send the ACL lists to the specified peer.
+         * @param peerId Peer ID.
+         */
+        void writePeerACLs(uint32_t peerId);
+
+        /**
+         * @brief Helper to get the cached compressed Peer-Link payload for a lookup table, (re)building it
+         *  if the lookup table has changed.
+         * @param cache Cached payload.
+         * @param version Current lookup table version.
+         * @param serialize Function to serialize the lookup table.
+         * @param[out] payload Compressed payload.
+         * @returns bool True, if the payload is available, otherwise false.
+         */
+        bool peerLinkACLPayload(PeerLinkACLPayload& cache, uint32_t version, const std::function<bool(std::vector<uint8_t>&)>& serialize,
+            PeerLinkACLPayload& payload);
+        /**
+         * @brief Helper to send a compressed Peer-Link payload to the specified peer.
+         * @param peerId Peer ID.
+         * @param subFunc Peer-Link network sub-function.
+         * @param payload Compressed payload.
+         */
+        void writePeerLinkPayload(uint32_t peerId, NET_SUBFUNC::ENUM subFunc, const PeerLinkACLPayload& payload);
+        /**
+         * @brief Helper to read the contents of a lookup table file, for Peer-Link peers that cannot decode the
+         *  compact binary form of the lookup tables.
+         * @param filename Lookup table file.
+         * @param[out] data Buffer to read the file contents into.
+         * @returns bool True, if the file was read, otherwise false.
+         */
+        bool lookupFileContents(const std::string& filename, std::vector<uint8_t>& data);
+        /**
+         * @brief Helper to get the cached radio ID whitelist and blacklist, (re)building them if the radio ID
+         *  table has changed.
+         * @param[out] whitelist Whitelisted radio IDs.
+         * @param[out] blacklist Blacklisted radio IDs.
+         */
+        void ridACLLists(std::vector<uint32_t>& whitelist, std::vector<uint32_t>& blacklist);
 
         /**
          * @brief Helper to send the list of whitelisted RIDs to the specified peer.
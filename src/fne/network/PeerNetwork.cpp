@@ -18,8 +18,6 @@ using namespace network;
 #include <cstdio>
 #include <cassert>
 #include <algorithm>
-#include <fstream>
-#include <streambuf>
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -83,16 +81,28 @@ bool PeerNetwork::writePeerLinkPeers(json::array* peerList)
 
     if (peerList->size() > 0 && m_peerLink) {
         json::value v = json::value(*peerList);
-        std::string json = std::string(v.serialize());
+        return writePeerLinkJSON(NET_SUBFUNC::PL_ACT_PEER_LIST, v);
+    }
 
-        CharArray __buffer = std::make_unique<char[]>(json.length() + 9U);
-        char* buffer = __buffer.get();
+    return false;
+}
 
-        ::memcpy(buffer + 0U, TAG_PEER_LINK, 4U);
-        ::snprintf(buffer + 8U, json.length() + 1U, "%s", json.c_str());
+/* Writes the changes to this CFNE's active peer list to the network. */
 
-        return writeMaster({ NET_FUNC::PEER_LINK, NET_SUBFUNC::PL_ACT_PEER_LIST }, 
-            (uint8_t*)buffer, json.length() + 8U, RTP_END_OF_CALL_SEQ, createStreamId(), false, true);
+bool PeerNetwork::writePeerLinkPeerChanges(json::array* updatedPeers, json::array* removedPeers)
+{
+    if (updatedPeers == nullptr || removedPeers == nullptr)
+        return false;
+    if (updatedPeers->size() == 0 && removedPeers->size() == 0)
+        return false;
+
+    if (m_peerLink) {
+        json::object changes = json::object();
+        changes["updated"].set<json::array>(*updatedPeers);
+        changes["removed"].set<json::array>(*removedPeers);
+
+        json::value v = json::value(changes);
+        return writePeerLinkJSON(NET_SUBFUNC::PL_ACT_PEER_LIST_DELTA, v);
     }
 
     return false;
@@ -193,38 +203,14 @@ void PeerNetwork::userPacketHandler(uint32_t peerId, FrameQueue::OpcodePair opco
 
                         // check that we got the appropriate data
                         if (decompressedLen == m_tgidSize) {
-                            // store to file
-                            std::unique_ptr<char[]> __str = std::make_unique<char[]>(decompressedLen + 1U);
-                            char* str = __str.get();
-                            ::memcpy(str, decompressed, decompressedLen);
-                            str[decompressedLen] = 0; // null termination
-
-                            // randomize filename
-                            std::ostringstream s;
-                            std::random_device rd;
-                            std::mt19937 mt(rd());
-                            std::uniform_int_distribution<uint32_t> dist(0x00U, 0xFFFFFFFFU);
-                            s << "/tmp/talkgroup_rules.yml." << dist(mt);
-
-                            std::string filename = s.str();
-                            std::ofstream file(filename, std::ofstream::out);
-                            if (file.fail()) {
-                                LogError(LOG_NET, "Cannot open the talkgroup ID lookup file - %s", filename.c_str());
-                                goto tid_lookup_cleanup; // yes - I hate myself; but this is quick
-                            }
-
-                            file << str;
-                            file.close();
-
+                            // the talkgroup rules are now maintained over Peer-Link; stop reloading them from the local file
                             m_tidLookup->stop(true);
-                            m_tidLookup->filename(filename);
-                            m_tidLookup->reload();
-
-                            // flag this peer as Peer-Link enabled
-                            m_peerLink = true;
 
-                            // cleanup temporary file
-                            ::remove(filename.c_str());
+                            // decode the transferred talkgroup rules directly into the lookup table
+                            if (m_tidLookup->deserialize(decompressed, decompressedLen)) {
+                                // flag this peer as Peer-Link enabled
+                                m_peerLink = true;
+                            }
                         }
                         else {
                             LogError(LOG_NET, "PEER %u error decompressed TGID list, was not of expected size! %u != %u", peerId, decompressedLen, m_tgidSize);
@@ -325,38 +311,14 @@ void PeerNetwork::userPacketHandler(uint32_t peerId, FrameQueue::OpcodePair opco
 
                         // check that we got the appropriate data
                         if (decompressedLen == m_ridSize) {
-                            // store to file
-                            std::unique_ptr<char[]> __str = std::make_unique<char[]>(decompressedLen + 1U);
-                            char* str = __str.get();
-                            ::memcpy(str, decompressed, decompressedLen);
-                            str[decompressedLen] = 0; // null termination
-
-                            // randomize filename
-                            std::ostringstream s;
-                            std::random_device rd;
-                            std::mt19937 mt(rd());
-                            std::uniform_int_distribution<uint32_t> dist(0x00U, 0xFFFFFFFFU);
-                            s << "/tmp/rid_acl.dat." << dist(mt);
-
-                            std::string filename = s.str();
-                            std::ofstream file(filename, std::ofstream::out);
-                            if (file.fail()) {
-                                LogError(LOG_NET, "Cannot open the radio ID lookup file - %s", filename.c_str());
-                                goto rid_lookup_cleanup; // yes - I hate myself; but this is quick
-                            }
-
-                            file << str;
-                            file.close();
-
+                            // the radio ID table is now maintained over Peer-Link; stop reloading it from the local file
                             m_ridLookup->stop(true);
-                            m_ridLookup->filename(filename);
-                            m_ridLookup->reload();
 
-                            // flag this peer as Peer-Link enabled
-                            m_peerLink = true;
-
-                            // cleanup temporary file
-                            ::remove(filename.c_str());
+                            // decode the transferred radio ID table directly into the lookup table
+                            if (m_ridLookup->deserialize(decompressed, decompressedLen)) {
+                                // flag this peer as Peer-Link enabled
+                                m_peerLink = true;
+                            }
                         }
                         else {
                             LogError(LOG_NET, "PEER %u error decompressed RID list, was not of expected size! %u != %u", peerId, decompressedLen, m_ridSize);
@@ -457,38 +419,14 @@ void PeerNetwork::userPacketHandler(uint32_t peerId, FrameQueue::OpcodePair opco
 
                         // check that we got the appropriate data
                         if (decompressedLen == m_pidSize) {
-                            // store to file
-                            std::unique_ptr<char[]> __str = std::make_unique<char[]>(decompressedLen + 1U);
-                            char* str = __str.get();
-                            ::memcpy(str, decompressed, decompressedLen);
-                            str[decompressedLen] = 0; // null termination
-
-                            // randomize filename
-                            std::ostringstream s;
-                            std::random_device rd;
-                            std::mt19937 mt(rd());
-                            std::uniform_int_distribution<uint32_t> dist(0x00U, 0xFFFFFFFFU);
-                            s << "/tmp/peer_list.dat." << dist(mt);
-
-                            std::string filename = s.str();
-                            std::ofstream file(filename, std::ofstream::out);
-                            if (file.fail()) {
-                                LogError(LOG_NET, "Cannot open the peer ID lookup file - %s", filename.c_str());
-                                goto pid_lookup_cleanup; // yes - I hate myself; but this is quick
-                            }
-
-                            file << str;
-                            file.close();
-
+                            // the peer ID table is now maintained over Peer-Link; stop reloading it from the local file
                             m_pidLookup->stop(true);
-                            m_pidLookup->filename(filename);
-                            m_pidLookup->reload();
 
-                            // flag this peer as Peer-Link enabled
-                            m_peerLink = true;
-
-                            // cleanup temporary file
-                            ::remove(filename.c_str());
+                            // decode the transferred peer ID table directly into the lookup table
+                            if (m_pidLookup->deserialize(decompressed, decompressedLen)) {
+                                // flag this peer as Peer-Link enabled
+                                m_peerLink = true;
+                            }
                         }
                         else {
                             LogError(LOG_NET, "PEER %u error decompressed peer ID list, was not of expected size! %u != %u", peerId, decompressedLen, m_pidSize);
@@ -563,6 +501,8 @@ bool PeerNetwork::writeConfig()
     bool external = true;
     config["externalPeer"].set<bool>(external);                                     // External Peer Marker
     config["software"].set<std::string>(std::string(software));                     // Software ID
+    bool packedTables = true;
+    config["packedTables"].set<bool>(packedTables);                                 // Peer-Link Compact Lookup Tables
 
     json::value v = json::value(config);
     std::string json = v.serialize();
@@ -579,3 +519,23 @@ bool PeerNetwork::writeConfig()
 
     return writeMaster({ NET_FUNC::RPTC, NET_SUBFUNC::NOP }, (uint8_t*)buffer, json.length() + 8U, pktSeq(), m_loginStreamId);
 }
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to write a Peer-Link JSON message to the network. */
+
+bool PeerNetwork::writePeerLinkJSON(NET_SUBFUNC::ENUM subFunc, json::value& v)
+{
+    std::string json = std::string(v.serialize());
+
+    CharArray __buffer = std::make_unique<char[]>(json.length() + 9U);
+    char* buffer = __buffer.get();
+
+    ::memcpy(buffer + 0U, TAG_PEER_LINK, 4U);
+    ::snprintf(buffer + 8U, json.length() + 1U, "%s", json.c_str());
+
+    return writeMaster({ NET_FUNC::PEER_LINK, subFunc }, 
+        (uint8_t*)buffer, json.length() + 8U, RTP_END_OF_CALL_SEQ, createStreamId(), false, true);
+}
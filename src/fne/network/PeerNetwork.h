@@ -26,6 +26,16 @@
 
 namespace network
 {
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief RPTC ACK flag set by masters that accept active peer list changes (PL_ACT_PEER_LIST_DELTA).
+     * @ingroup fne_network
+     */
+    const uint8_t PEER_LINK_PEER_LIST_DELTA_FLAG = 0x40U;
+
     // ---------------------------------------------------------------------------
     //  Class Declaration
     // ---------------------------------------------------------------------------
@@ -85,12 +95,28 @@ namespace network
          * @returns bool True, if list was sent, otherwise false.
          */
         bool writePeerLinkPeers(json::array* peerList);
+        /**
+         * @brief Writes the changes to this CFNE's active peer list to the network.
+         * 
+         *  Only masters that set PEER_LINK_PEER_LIST_DELTA_FLAG in their RPTC ACK accept changes; older
+         *  masters silently drop PL_ACT_PEER_LIST_DELTA, and must be sent complete lists instead (see
+         *  hasPeerListDelta()).
+         * @param updatedPeers List of new or changed active peers.
+         * @param removedPeers List of peer IDs no longer active.
+         * @returns bool True, if changes were sent, otherwise false.
+         */
+        bool writePeerLinkPeerChanges(json::array* updatedPeers, json::array* removedPeers);
 
         /**
          * @brief Returns flag indicating whether or not this peer connection is Peer-Link enabled.
          * @returns bool True, if Peer-Link enabled, otherwise false.
          */
         bool isPeerLink() const { return m_peerLink; }
+        /**
+         * @brief Returns flag indicating whether or not the master accepts changes to the active peer list.
+         * @returns bool True, if the master accepts active peer list changes, otherwise false.
+         */
+        bool hasPeerListDelta() const { return (m_masterFlags & PEER_LINK_PEER_LIST_DELTA_FLAG) == PEER_LINK_PEER_LIST_DELTA_FLAG; }
 
     protected:
         std::vector<uint32_t> m_blockTrafficToTable;
@@ -130,6 +156,14 @@ namespace network
         uint32_t m_pidSize;
 
         uint8_t* m_pidBuffer;
+
+        /**
+         * @brief Helper to write a Peer-Link JSON message to the network.
+         * @param subFunc Peer-Link network sub-function.
+         * @param v JSON value.
+         * @returns bool True, if message was sent, otherwise false.
+         */
+        bool writePeerLinkJSON(NET_SUBFUNC::ENUM subFunc, json::value& v);
     };
 } // namespace network
 
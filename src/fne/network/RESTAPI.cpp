@@ -39,6 +39,10 @@ using namespace lookups;
 // ---------------------------------------------------------------------------
 
 #define REST_API_BIND(funcAddr, classInstance) std::bind(&funcAddr, classInstance, std::placeholders::_1,  std::placeholders::_2, std::placeholders::_3)
+#define REST_API_BIND_SERIAL(funcAddr, classInstance) [classInstance](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) { \
+        std::lock_guard<std::mutex> lock(classInstance->m_serialMutex); \
+        (classInstance->*(&funcAddr))(request, reply, match); \
+    }
 
 // ---------------------------------------------------------------------------
 //  Global Functions
@@ -458,11 +462,11 @@ TalkgroupRuleGroupVoice jsonToTG(json::object& req, HTTPPayload& reply)
 /* Initializes a new instance of the RESTAPI class. */
 
 RESTAPI::RESTAPI(const std::string& address, uint16_t port, const std::string& password,
-    const std::string& keyFile, const std::string& certFile, bool enableSSL, HostFNE* host, bool debug) :
+    const std::string& keyFile, const std::string& certFile, bool enableSSL, HostFNE* host, bool debug, uint32_t threads) :
     m_dispatcher(debug),
-    m_restServer(address, port, debug),
+    m_restServer(address, port, debug, threads),
 #if defined(ENABLE_TCP_SSL)
-    m_restSecureServer(address, port, debug),
+    m_restSecureServer(address, port, debug, threads),
     m_enableSSL(enableSSL),
 #endif // ENABLE_TCP_SSL
     m_random(),
@@ -474,7 +478,8 @@ RESTAPI::RESTAPI(const std::string& address, uint16_t port, const std::string& p
     m_ridLookup(nullptr),
     m_tidLookup(nullptr),
     m_peerListLookup(nullptr),
-    m_authTokens()
+    m_authTokens(),
+    m_authTokenMutex()
 {
     assert(!address.empty());
     assert(port > 0U);
@@ -598,48 +603,51 @@ void RESTAPI::initializeEndpoints()
 
     m_dispatcher.match(FNE_GET_PEER_QUERY).get(REST_API_BIND(RESTAPI::restAPI_GetPeerQuery, this));
     m_dispatcher.match(FNE_GET_PEER_COUNT).get(REST_API_BIND(RESTAPI::restAPI_GetPeerCount, this));
-    m_dispatcher.match(FNE_PUT_PEER_RESET).put(REST_API_BIND(RESTAPI::restAPI_PutPeerReset, this));
+    m_dispatcher.match(FNE_PUT_PEER_RESET).put(REST_API_BIND_SERIAL(RESTAPI::restAPI_PutPeerReset, this));
 
-    m_dispatcher.match(FNE_GET_RID_QUERY).get(REST_API_BIND(RESTAPI::restAPI_GetRIDQuery, this));
-    m_dispatcher.match(FNE_PUT_RID_ADD).put(REST_API_BIND(RESTAPI::restAPI_PutRIDAdd, this));
-    m_dispatcher.match(FNE_PUT_RID_DELETE).put(REST_API_BIND(RESTAPI::restAPI_PutRIDDelete, this));
-    m_dispatcher.match(FNE_GET_RID_COMMIT).get(REST_API_BIND(RESTAPI::restAPI_GetRIDCommit, this));
+    m_dispatcher.match(FNE_GET_RID_QUERY).get(REST_API_BIND_SERIAL(RESTAPI::restAPI_GetRIDQuery, this));
+    m_dispatcher.match(FNE_PUT_RID_ADD).put(REST_API_BIND_SERIAL(RESTAPI::restAPI_PutRIDAdd, this));
+    m_dispatcher.match(FNE_PUT_RID_DELETE).put(REST_API_BIND_SERIAL(RESTAPI::restAPI_PutRIDDelete, this));
+    m_dispatcher.match(FNE_GET_RID_COMMIT).get(REST_API_BIND_SERIAL(RESTAPI::restAPI_GetRIDCommit, this));
 
-    m_dispatcher.match(FNE_GET_TGID_QUERY).get(REST_API_BIND(RESTAPI::restAPI_GetTGQuery, this));
-    m_dispatcher.match(FNE_PUT_TGID_ADD).put(REST_API_BIND(RESTAPI::restAPI_PutTGAdd, this));
-    m_dispatcher.match(FNE_PUT_TGID_DELETE).put(REST_API_BIND(RESTAPI::restAPI_PutTGDelete, this));
-    m_dispatcher.match(FNE_GET_TGID_COMMIT).get(REST_API_BIND(RESTAPI::restAPI_GetTGCommit, this));
+    m_dispatcher.match(FNE_GET_TGID_QUERY).get(REST_API_BIND_SERIAL(RESTAPI::restAPI_GetTGQuery, this));
+    m_dispatcher.match(FNE_PUT_TGID_ADD).put(REST_API_BIND_SERIAL(RESTAPI::restAPI_PutTGAdd, this));
+    m_dispatcher.match(FNE_PUT_TGID_DELETE).put(REST_API_BIND_SERIAL(RESTAPI::restAPI_PutTGDelete, this));
+    m_dispatcher.match(FNE_GET_TGID_COMMIT).get(REST_API_BIND_SERIAL(RESTAPI::restAPI_GetTGCommit, this));
 
-    m_dispatcher.match(FNE_GET_PEER_LIST).get(REST_API_BIND(RESTAPI::restAPI_GetPeerList, this));
-    m_dispatcher.match(FNE_PUT_PEER_ADD).put(REST_API_BIND(RESTAPI::restAPI_PutPeerAdd, this));
-    m_dispatcher.match(FNE_PUT_PEER_DELETE).put(REST_API_BIND(RESTAPI::restAPI_PutPeerDelete, this));
-    m_dispatcher.match(FNE_GET_PEER_COMMIT).get(REST_API_BIND(RESTAPI::restAPI_GetPeerCommit, this));
-    m_dispatcher.match(FNE_GET_PEER_MODE).get(REST_API_BIND(RESTAPI::restAPI_GetPeerMode, this));
+    m_dispatcher.match(FNE_GET_PEER_LIST).get(REST_API_BIND_SERIAL(RESTAPI::restAPI_GetPeerList, this));
+    m_dispatcher.match(FNE_PUT_PEER_ADD).put(REST_API_BIND_SERIAL(RESTAPI::restAPI_PutPeerAdd, this));
+    m_dispatcher.match(FNE_PUT_PEER_DELETE).put(REST_API_BIND_SERIAL(RESTAPI::restAPI_PutPeerDelete, this));
+    m_dispatcher.match(FNE_GET_PEER_COMMIT).get(REST_API_BIND_SERIAL(RESTAPI::restAPI_GetPeerCommit, this));
+    m_dispatcher.match(FNE_GET_PEER_MODE).get(REST_API_BIND_SERIAL(RESTAPI::restAPI_GetPeerMode, this));
 
-    m_dispatcher.match(FNE_GET_FORCE_UPDATE).get(REST_API_BIND(RESTAPI::restAPI_GetForceUpdate, this));
+    m_dispatcher.match(FNE_GET_FORCE_UPDATE).get(REST_API_BIND_SERIAL(RESTAPI::restAPI_GetForceUpdate, this));
 
-    m_dispatcher.match(FNE_GET_RELOAD_TGS).get(REST_API_BIND(RESTAPI::restAPI_GetReloadTGs, this));
-    m_dispatcher.match(FNE_GET_RELOAD_RIDS).get(REST_API_BIND(RESTAPI::restAPI_GetReloadRIDs, this));
+    m_dispatcher.match(FNE_GET_RELOAD_TGS).get(REST_API_BIND_SERIAL(RESTAPI::restAPI_GetReloadTGs, this));
+    m_dispatcher.match(FNE_GET_RELOAD_RIDS).get(REST_API_BIND_SERIAL(RESTAPI::restAPI_GetReloadRIDs, this));
 
     m_dispatcher.match(FNE_GET_AFF_LIST).get(REST_API_BIND(RESTAPI::restAPI_GetAffList, this));
 
+    m_dispatcher.match(FNE_GET_EVENTS).get(REST_API_BIND(RESTAPI::restAPI_GetEvents, this));
+
     /*
     ** Digital Mobile Radio
     */
 
-    m_dispatcher.match(PUT_DMR_RID).put(REST_API_BIND(RESTAPI::restAPI_PutDMRRID, this));
+    m_dispatcher.match(PUT_DMR_RID).put(REST_API_BIND_SERIAL(RESTAPI::restAPI_PutDMRRID, this));
 
     /*
     ** Project 25
     */
 
-    m_dispatcher.match(PUT_P25_RID).put(REST_API_BIND(RESTAPI::restAPI_PutP25RID, this));
+    m_dispatcher.match(PUT_P25_RID).put(REST_API_BIND_SERIAL(RESTAPI::restAPI_PutP25RID, this));
 }
 
 /* Helper to invalidate a host token. */
 
 void RESTAPI::invalidateHostToken(const std::string host)
 {
+    std::lock_guard<std::mutex> lock(m_authTokenMutex);
     auto token = std::find_if(m_authTokens.begin(), m_authTokens.end(), [&](const AuthTokenValueType& tok) { return tok.first == host; });
     if (token != m_authTokens.end()) {
         m_authTokens.erase(host);
@@ -660,6 +668,7 @@ bool RESTAPI::validateAuth(const HTTPPayload& request, HTTPPayload& reply)
         return false;
     }
 
+    std::lock_guard<std::mutex> lock(m_authTokenMutex);
     for (auto& token : m_authTokens) {
 #if DEBUG_HTTP_PAYLOAD
         ::LogDebug(LOG_REST, "RESTAPI::validateAuth() valid list, host = %s, token = %s", token.first.c_str(), std::to_string(token.second).c_str());
@@ -748,11 +757,16 @@ void RESTAPI::restAPI_PutAuth(const HTTPPayload& request, HTTPPayload& reply, co
 
     delete[] passwordHash;
 
-    invalidateHostToken(host);
-    std::uniform_int_distribution<uint64_t> dist(DVM_RAND_MIN, DVM_REST_RAND_MAX);
-    uint64_t salt = dist(m_random);
+    // issuing a new token replaces any token previously issued to the host
+    uint64_t salt = 0U;
+    {
+        std::lock_guard<std::mutex> lock(m_authTokenMutex);
+        std::uniform_int_distribution<uint64_t> dist(DVM_RAND_MIN, DVM_REST_RAND_MAX);
+        salt = dist(m_random);
+
+        m_authTokens[host] = salt;
+    }
 
-    m_authTokens[host] = salt;
     response["token"].set<std::string>(std::to_string(salt));
     reply.payload(response);
 }
@@ -794,6 +808,13 @@ void RESTAPI::restAPI_GetStatus(const HTTPPayload& request, HTTPPayload& reply,
 
         uint32_t peerId = masterConf["peerId"].as<uint32_t>();
         response["peerId"].set<uint32_t>(peerId);
+
+        if (m_network != nullptr) {
+            uint64_t routePlanHits = m_network->m_routePlanHits.load();
+            response["routePlanHits"].set<uint64_t>(routePlanHits);
+            uint64_t routePlanRebuilds = m_network->m_routePlanRebuilds.load();
+            response["routePlanRebuilds"].set<uint64_t>(routePlanRebuilds);
+        }
     }
 
     reply.payload(response);
@@ -812,6 +833,8 @@ void RESTAPI::restAPI_GetPeerQuery(const HTTPPayload& request, HTTPPayload& repl
 
     json::array peers = json::array();
     if (m_network != nullptr) {
+        // REST requests are serviced by the handler pool; the peer tables are only walked under the peer lock
+        std::lock_guard<std::mutex> lock(m_network->m_peerMutex);
         if (m_network->m_peers.size() > 0) {
             for (auto entry : m_network->m_peers) {
                 uint32_t peerId = entry.first;
@@ -865,6 +888,7 @@ void RESTAPI::restAPI_GetPeerCount(const HTTPPayload& request, HTTPPayload& repl
 
     json::array peers = json::array();
     if (m_network != nullptr) {
+        std::lock_guard<std::mutex> lock(m_network->m_peerMutex);
         uint32_t count = m_network->m_peers.size();
         response["peerCount"].set<uint32_t>(count);
     }
@@ -1358,12 +1382,18 @@ void RESTAPI::restAPI_GetAffList(const HTTPPayload& request, HTTPPayload& reply,
 
     json::array affs = json::array();
     if (m_network != nullptr) {
+        std::lock_guard<std::mutex> lock(m_network->m_peerMutex);
         if (m_network->m_peers.size() > 0) {
             for (auto entry : m_network->m_peers) {
                 uint32_t peerId = entry.first;
                 network::FNEPeerConnection* peer = entry.second;
                 if (peer != nullptr) {
-                    lookups::AffiliationLookup* affLookup = m_network->m_peerAffiliations[peerId];
+                    auto it = m_network->m_peerAffiliations.find(peerId);
+                    if (it == m_network->m_peerAffiliations.end()) {
+                        continue;
+                    }
+
+                    lookups::AffiliationLookup* affLookup = it->second;
                     if (affLookup != nullptr) {
                         std::unordered_map<uint32_t, uint32_t> affTable = affLookup->grpAffTable();
 
@@ -1395,6 +1425,23 @@ void RESTAPI::restAPI_GetAffList(const HTTPPayload& request, HTTPPayload& reply,
     reply.payload(response);
 }
 
+/* REST API endpoint; implements get event stream request. */
+
+void RESTAPI::restAPI_GetEvents(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    if (m_network == nullptr) {
+        errorPayload(reply, "network is not available", HTTPPayload::SERVICE_UNAVAILABLE);
+        return;
+    }
+
+    // the connection stays open, and the network events are pushed to it as they occur
+    reply.eventStream(m_network->m_eventPublisher.subscribe());
+}
+
 /*
 ** Digital Mobile Radio
 */
@@ -28,6 +28,7 @@
 #include <vector>
 #include <string>
 #include <random>
+#include <mutex>
 
 // ---------------------------------------------------------------------------
 //  Class Prototypes
@@ -56,9 +57,10 @@ public:
      * @param enableSSL Flag indicating SSL should be used for HTTPS support.
      * @param host Instance of the HostFNE class.
      * @param debug Flag indicating verbose logging should be enabled.
+     * @param threads Number of threads servicing REST API requests.
      */
     RESTAPI(const std::string& address, uint16_t port, const std::string& password, const std::string& keyFile, const std::string& certFile,
-        bool enableSSL, HostFNE* host, bool debug);
+        bool enableSSL, HostFNE* host, bool debug, uint32_t threads);
     /**
      * @brief Finalizes a instance of the RESTAPI class.
      */
@@ -113,6 +115,9 @@ private:
 
     typedef std::unordered_map<std::string, uint64_t>::value_type AuthTokenValueType;
     std::unordered_map<std::string, uint64_t> m_authTokens;
+    std::mutex m_authTokenMutex;
+
+    std::mutex m_serialMutex;
 
     /**
      * @brief Thread entry point. This function is provided to run the thread
@@ -307,6 +312,14 @@ private:
      * @param match HTTP request matcher.
      */
     void restAPI_GetAffList(const HTTPPayload& request, HTTPPayload& reply, const network::rest::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements get event stream request. The reply is a Server-Sent Events
+     *  stream of peer connection, affiliation, call and grant events.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetEvents(const HTTPPayload& request, HTTPPayload& reply, const network::rest::RequestMatch& match);
 
     /*
     ** Digital Mobile Radio
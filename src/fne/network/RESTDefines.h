@@ -52,4 +52,16 @@
 
 #define FNE_GET_AFF_LIST                "/report-affiliations"
 
+#define FNE_GET_EVENTS                  "/events"
+
+#define FNE_EVENT_PEER_CONNECTED        "peer_connected"
+#define FNE_EVENT_PEER_DISCONNECTED     "peer_disconnected"
+#define FNE_EVENT_GRP_AFFIL             "group_affiliation"
+#define FNE_EVENT_GRP_UNAFFIL           "group_unaffiliation"
+#define FNE_EVENT_UNIT_REG              "unit_registration"
+#define FNE_EVENT_UNIT_DEREG            "unit_deregistration"
+#define FNE_EVENT_CALL_START            "call_start"
+#define FNE_EVENT_CALL_END              "call_end"
+#define FNE_EVENT_GRANT                 "grant"
+
 #endif // __FNE_REST_DEFINES_H__
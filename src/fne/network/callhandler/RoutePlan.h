@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file RoutePlan.h
+ * @ingroup fne_callhandler
+ */
+#if !defined(__CALLHANDLER__ROUTE_PLAN_H__)
+#define __CALLHANDLER__ROUTE_PLAN_H__
+
+#include "fne/Defines.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace network
+{
+    namespace callhandler
+    {
+        // ---------------------------------------------------------------------------
+        //  Class Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Represents a single destination of a call stream route plan.
+         * @ingroup fne_callhandler
+         */
+        class HOST_SW_API RouteDestination {
+        public:
+            /**
+             * @brief Initializes a new instance of the RouteDestination class.
+             * @param peerId Destination peer ID.
+             * @param rewrite Flag indicating the destination ID is rewritten for this peer.
+             * @param dstId Rewritten destination ID.
+             * @param slotNo Rewritten DMR slot number.
+             */
+            RouteDestination(uint32_t peerId = 0U, bool rewrite = false, uint32_t dstId = 0U, uint32_t slotNo = 0U) :
+                peerId(peerId),
+                rewrite(rewrite),
+                dstId(dstId),
+                slotNo(slotNo)
+            {
+                /* stub */
+            }
+
+        public:
+            uint32_t peerId;        //! Destination Peer ID
+            bool rewrite;           //! Flag indicating the destination ID is rewritten
+            uint32_t dstId;         //! Rewritten Destination ID
+            uint32_t slotNo;        //! Rewritten DMR Slot Number
+        };
+
+        // ---------------------------------------------------------------------------
+        //  Class Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Represents the precomputed routing for a call stream; the result of validating the stream
+         *  and the set of peers (and their rewritten destination IDs) the stream is repeated to.
+         *
+         * A route plan is built at the first voice frame of a stream and reused for every following frame
+         * of the same stream until the FNE routing generation changes (i.e. the peer set, affiliations,
+         * radio ID ACL or talkgroup rules change). Once published to a RoutePlanCache a plan is immutable.
+         * @ingroup fne_callhandler
+         */
+        class HOST_SW_API RoutePlan {
+        public:
+            /**
+             * @brief Initializes a new instance of the RoutePlan class.
+             */
+            RoutePlan() :
+                streamId(0U),
+                peerId(0U),
+                srcId(0U),
+                dstId(0U),
+                key(0U),
+                generation(0U),
+                permitted(false),
+                inbound(),
+                peers(),
+                external()
+            {
+                /* stub */
+            }
+
+            /**
+             * @brief Helper to determine if this route plan is valid for the given call stream.
+             * @param streamId Stream ID.
+             * @param peerId Source peer ID.
+             * @param srcId Source ID.
+             * @param dstId Destination ID (as received, before any rewrite).
+             * @param key Mode specific key (LCO, FLCO, slot, etc).
+             * @param generation Current FNE routing generation.
+             * @returns bool True, if the route plan can be reused, otherwise false.
+             */
+            bool matches(uint32_t streamId, uint32_t peerId, uint32_t srcId, uint32_t dstId, uint32_t key, uint64_t generation) const
+            {
+                return this->streamId == streamId && this->peerId == peerId && this->srcId == srcId &&
+                    this->dstId == dstId && this->key == key && this->generation == generation;
+            }
+
+            /**
+             * @brief Helper to find the external peer destination for the given peer ID.
+             * @param peerId External peer ID.
+             * @returns const RouteDestination* Destination, or nullptr if the stream is not routed to the peer.
+             */
+            const RouteDestination* findExternal(uint32_t peerId) const
+            {
+                for (const RouteDestination& dest : external) {
+                    if (dest.peerId == peerId)
+                        return &dest;
+                }
+
+                return nullptr;
+            }
+
+        public:
+            uint32_t streamId;      //! Stream ID
+            uint32_t peerId;        //! Source Peer ID
+            uint32_t srcId;         //! Source ID
+            uint32_t dstId;         //! Destination ID (as received)
+            uint32_t key;           //! Mode Specific Key
+            uint64_t generation;    //! FNE Routing Generation
+
+            bool permitted;         //! Flag indicating the stream is valid and the source peer is permitted
+            RouteDestination inbound;   //! Inbound (source peer) destination rewrite
+
+            std::vector<RouteDestination> peers;    //! Connected peer destinations
+            std::vector<RouteDestination> external; //! External peer destinations
+        };
+
+        // ---------------------------------------------------------------------------
+        //  Class Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Implements a thread-safe cache of route plans.
+         *
+         * Packets are handled on their own threads, so plans are published as immutable shared snapshots;
+         * a reader keeps the plan it was handed alive for as long as it routes with it, regardless of a newer
+         * plan replacing it in the cache. Plans are cached per source peer, destination and mode specific key,
+         * so concurrent streams to the same destination do not evict each other.
+         * @ingroup fne_callhandler
+         */
+        class HOST_SW_API RoutePlanCache {
+        public:
+            /**
+             * @brief Initializes a new instance of the RoutePlanCache class.
+             */
+            RoutePlanCache() :
+                m_plans(),
+                m_lock()
+            {
+                /* stub */
+            }
+
+            /**
+             * @brief Helper to find a cached route plan valid for the given call stream.
+             * @param streamId Stream ID.
+             * @param peerId Source peer ID.
+             * @param srcId Source ID.
+             * @param dstId Destination ID (as received, before any rewrite).
+             * @param key Mode specific key (LCO, FLCO, slot, etc).
+             * @param generation Current FNE routing generation.
+             * @returns std::shared_ptr<const RoutePlan> Route plan, or nullptr if the plan must be built.
+             */
+            std::shared_ptr<const RoutePlan> find(uint32_t streamId, uint32_t peerId, uint32_t srcId, uint32_t dstId, uint32_t key, uint64_t generation)
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+                auto it = m_plans.find(cacheKey(peerId, dstId, key));
+                if (it != m_plans.end() && it->second->matches(streamId, peerId, srcId, dstId, key, generation))
+                    return it->second;
+
+                return nullptr;
+            }
+
+            /**
+             * @brief Helper to publish a newly built route plan.
+             *
+             *  Cached plans built for an older routing generation than the new plan are dropped.
+             * @param plan Route plan.
+             */
+            void store(const std::shared_ptr<const RoutePlan>& plan)
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+
+                // a new routing generation invalidates every cached plan
+                for (auto it = m_plans.begin(); it != m_plans.end();) {
+                    if (it->second->generation < plan->generation)
+                        it = m_plans.erase(it);
+                    else
+                        ++it;
+                }
+
+                m_plans[cacheKey(plan->peerId, plan->dstId, plan->key)] = plan;
+            }
+
+        private:
+            std::unordered_map<uint64_t, std::shared_ptr<const RoutePlan>> m_plans;
+            std::mutex m_lock;
+
+            /**
+             * @brief Helper to generate the cache key for a route plan.
+             * @param peerId Source peer ID.
+             * @param dstId Destination ID (24-bit).
+             * @param key Mode specific key.
+             * @returns uint64_t Cache key.
+             */
+            static uint64_t cacheKey(uint32_t peerId, uint32_t dstId, uint32_t key)
+            {
+                return ((uint64_t)peerId << 32) | ((uint64_t)(key & 0xFFU) << 24) | (dstId & 0xFFFFFFU);
+            }
+        };
+    } // namespace callhandler
+} // namespace network
+
+#endif // __CALLHANDLER__ROUTE_PLAN_H__
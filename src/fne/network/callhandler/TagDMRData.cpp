@@ -17,6 +17,7 @@
 #include "common/Log.h"
 #include "common/Utils.h"
 #include "network/FNENetwork.h"
+#include "network/RESTDefines.h"
 #include "network/callhandler/TagDMRData.h"
 #include "HostFNE.h"
 
@@ -47,6 +48,7 @@ TagDMRData::TagDMRData(FNENetwork* network, bool debug) :
     m_parrotFrames(),
     m_parrotFramesReady(false),
     m_status(),
+    m_routePlans(),
     m_debug(debug)
 {
     assert(network != nullptr);
@@ -122,14 +124,27 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
     uint8_t frame[DMR_FRAME_LENGTH_BYTES];
     dmrData.getData(frame);
 
+    // voice frames are routed using the route plan computed at the start of the call stream
+    std::shared_ptr<const RoutePlan> plan;
+    if (!dataSync) {
+        plan = routePlan(peerId, dmrData, streamId);
+    }
+
     // perform TGID route rewrites if configured
-    routeRewrite(buffer, peerId, dmrData, dataType, dstId, slotNo, false);
+    if (plan != nullptr) {
+        if (plan->inbound.rewrite)
+            routeRewrite(buffer, plan->inbound);
+    }
+    else {
+        routeRewrite(buffer, peerId, dmrData, dataType, dstId, slotNo, false);
+    }
     dstId = __GET_UINT16(buffer, 8U);
 
     // is the stream valid?
-    if (validate(peerId, dmrData, streamId)) {
+    bool valid = (plan != nullptr) ? plan->permitted : validate(peerId, dmrData, streamId);
+    if (valid) {
         // is this peer ignored?
-        if (!isPeerPermitted(peerId, dmrData, streamId)) {
+        if (plan == nullptr && !isPeerPermitted(peerId, dmrData, streamId)) {
             return false;
         }
 
@@ -168,6 +183,8 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                 LogMessage(LOG_NET, "DMR, Call End, peer = %u, srcId = %u, dstId = %u, duration = %u, streamId = %u, external = %u",
                             peerId, srcId, dstId, duration / 1000, streamId, external);
 
+                m_network->publishCallEvent(FNE_EVENT_CALL_END, "DMR", peerId, srcId, dstId, streamId, duration);
+
                 // report call event to InfluxDB
                 if (m_network->m_enableInfluxDB) {
                     influxdb::QueryBuilder()
@@ -239,6 +256,8 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
 
                 LogMessage(LOG_NET, "DMR, Call Start, peer = %u, srcId = %u, dstId = %u, streamId = %u, external = %u", peerId, srcId, dstId, streamId, external);
 
+                m_network->publishCallEvent(FNE_EVENT_CALL_START, "DMR", peerId, srcId, dstId, streamId);
+
                 m_network->m_callInProgress = true;
             }
         }
@@ -276,8 +295,37 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
 
         m_status[dstId].lastPacket = hrc::now();
 
+        // repeat traffic to the connected peers (using the route plan)
+        if (plan != nullptr && m_network->m_peers.size() > 0U) {
+            uint32_t i = 0U;
+            for (const RouteDestination& dest : plan->peers) {
+                // every 5 peers flush the queue
+                if (i % 5U == 0U) {
+                    m_network->m_frameQueue->flushQueue();
+                }
+
+                UInt8Array __outboundPeerBuffer = std::make_unique<uint8_t[]>(len);
+                uint8_t* outboundPeerBuffer = __outboundPeerBuffer.get();
+                ::memcpy(outboundPeerBuffer, buffer, len);
+
+                // perform TGID route rewrites if configured
+                if (dest.rewrite)
+                    routeRewrite(outboundPeerBuffer, dest);
+
+                m_network->writePeer(dest.peerId, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR }, outboundPeerBuffer, len, pktSeq, streamId, true);
+                if (m_network->m_debug) {
+                    LogDebug(LOG_NET, "DMR, srcPeer = %u, dstPeer = %u, seqNo = %u, srcId = %u, dstId = %u, flco = $%02X, slotNo = %u, len = %u, pktSeq = %u, stream = %u, external = %u", 
+                        peerId, dest.peerId, seqNo, srcId, dstId, flco, slotNo, len, pktSeq, streamId, external);
+                }
+
+                if (!m_network->m_callInProgress)
+                    m_network->m_callInProgress = true;
+                i++;
+            }
+            m_network->m_frameQueue->flushQueue();
+        }
         // repeat traffic to the connected peers
-        if (m_network->m_peers.size() > 0U) {
+        else if (m_network->m_peers.size() > 0U) {
             uint32_t i = 0U;
             for (auto peer : m_network->m_peers) {
                 if (peerId != peer.first) {
@@ -322,7 +370,14 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                 // is coming from a external peer
                 if (dstPeerId != peerId) {
                     // is this peer ignored?
-                    if (!isPeerPermitted(dstPeerId, dmrData, streamId, true)) {
+                    const RouteDestination* dest = nullptr;
+                    if (plan != nullptr) {
+                        dest = plan->findExternal(dstPeerId);
+                        if (dest == nullptr) {
+                            continue;
+                        }
+                    }
+                    else if (!isPeerPermitted(dstPeerId, dmrData, streamId, true)) {
                         continue;
                     }
 
@@ -342,7 +397,13 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                     ::memcpy(outboundPeerBuffer, buffer, len);
 
                     // perform TGID route rewrites if configured
-                    routeRewrite(outboundPeerBuffer, dstPeerId, dmrData, dataType, dstId, slotNo);
+                    if (dest != nullptr) {
+                        if (dest->rewrite)
+                            routeRewrite(outboundPeerBuffer, *dest);
+                    }
+                    else {
+                        routeRewrite(outboundPeerBuffer, dstPeerId, dmrData, dataType, dstId, slotNo);
+                    }
 
                     peer.second->writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR }, outboundPeerBuffer, len, pktSeq, streamId);
                     if (m_network->m_debug) {
@@ -399,6 +460,8 @@ bool TagDMRData::processGrantReq(uint32_t srcId, uint32_t dstId, uint8_t slot, b
         }
     }
 
+    m_network->publishCallEvent(FNE_EVENT_GRANT, "DMR", peerId, srcId, dstId, streamId);
+
     return true;
 }
 
@@ -563,6 +626,20 @@ bool TagDMRData::peerRewrite(uint32_t peerId, uint32_t& dstId, uint32_t& slotNo,
     return rewrote;
 }
 
+/* Helper to apply a route plan rewrite to the network data buffer. */
+
+void TagDMRData::routeRewrite(uint8_t* buffer, const RouteDestination& dest)
+{
+    // rewrite destination TGID in the frame
+    __SET_UINT16(dest.dstId, buffer, 8U);
+
+    // set or clear the e.Slot flag (if 0x80 is set Slot 2 otherwise Slot 1)
+    if (dest.slotNo == 2U)
+        buffer[15U] |= 0x80U;
+    if (dest.slotNo == 1U)
+        buffer[15U] &= ~0x80U;
+}
+
 /* Helper to process CSBKs being passed from a peer. */
 
 bool TagDMRData::processCSBK(uint8_t* buffer, uint32_t peerId, dmr::data::NetData& dmrData)
@@ -833,6 +910,87 @@ bool TagDMRData::validate(uint32_t peerId, data::NetData& data, uint32_t streamI
     return true;
 }
 
+/* Helper to get the route plan for a DMR voice call stream. */
+
+std::shared_ptr<const RoutePlan> TagDMRData::routePlan(uint32_t peerId, data::NetData& dmrData, uint32_t streamId)
+{
+    uint32_t srcId = dmrData.getSrcId();
+    uint32_t dstId = dmrData.getDstId();
+    uint32_t slotNo = dmrData.getSlotNo();
+    uint32_t key = (slotNo << 1) + ((dmrData.getFLCO() == FLCO::PRIVATE) ? 1U : 0U);
+    uint64_t generation = m_network->routeGeneration();
+
+    std::shared_ptr<const RoutePlan> cached = m_routePlans.find(streamId, peerId, srcId, dstId, key, generation);
+    if (cached != nullptr) {
+        m_network->m_routePlanHits++;
+        return cached;
+    }
+
+    m_network->m_routePlanRebuilds++;
+
+    // the plan is built privately and only published once complete
+    std::shared_ptr<RoutePlan> plan = std::make_shared<RoutePlan>();
+    plan->streamId = streamId;
+    plan->peerId = peerId;
+    plan->srcId = srcId;
+    plan->dstId = dstId;
+    plan->key = key;
+    plan->generation = generation;
+
+    // perform TGID route rewrites if configured
+    uint32_t rewriteDstId = dstId;
+    uint32_t rewriteSlotNo = slotNo;
+    if (peerRewrite(peerId, rewriteDstId, rewriteSlotNo, false)) {
+        plan->inbound = RouteDestination(peerId, true, rewriteDstId, rewriteSlotNo);
+    }
+
+    // is the stream valid and is this peer permitted?
+    plan->permitted = validate(peerId, dmrData, streamId) && isPeerPermitted(peerId, dmrData, streamId);
+    if (!plan->permitted) {
+        m_routePlans.store(plan);
+        return plan;
+    }
+
+    // for talkgroups requiring affiliations, only the peers with affiliations need to be checked
+    std::vector<uint32_t> peers;
+    lookups::TalkgroupRuleGroupVoice tg = m_network->m_tidLookup->find(dstId, slotNo);
+    if (dmrData.getFLCO() == FLCO::GROUP && tg.config().affiliated()) {
+        peers = m_network->affiliatedPeers(dstId, tg.config().alwaysSend());
+    }
+    else {
+        peers.reserve(m_network->m_peers.size());
+        for (auto peer : m_network->m_peers)
+            peers.push_back(peer.first);
+    }
+
+    for (uint32_t dstPeerId : peers) {
+        if (peerId == dstPeerId || m_network->m_peers.find(dstPeerId) == m_network->m_peers.end() ||
+            !isPeerPermitted(dstPeerId, dmrData, streamId)) {
+            continue;
+        }
+
+        uint32_t peerDstId = rewriteDstId;
+        uint32_t peerSlotNo = slotNo;
+        bool rewrite = peerRewrite(dstPeerId, peerDstId, peerSlotNo);
+        plan->peers.push_back(RouteDestination(dstPeerId, rewrite, peerDstId, peerSlotNo));
+    }
+
+    for (auto peer : m_network->m_host->m_peerNetworks) {
+        uint32_t dstPeerId = peer.second->getPeerId();
+        if (dstPeerId == peerId || !isPeerPermitted(dstPeerId, dmrData, streamId, true)) {
+            continue;
+        }
+
+        uint32_t peerDstId = rewriteDstId;
+        uint32_t peerSlotNo = slotNo;
+        bool rewrite = peerRewrite(dstPeerId, peerDstId, peerSlotNo);
+        plan->external.push_back(RouteDestination(dstPeerId, rewrite, peerDstId, peerSlotNo));
+    }
+
+    m_routePlans.store(plan);
+    return plan;
+}
+
 /* Helper to write a grant packet. */
 
 bool TagDMRData::write_CSBK_Grant(uint32_t peerId, uint32_t srcId, uint32_t dstId, uint8_t serviceOptions, bool grp)
@@ -23,6 +23,7 @@
 #include "common/Clock.h"
 #include "network/FNENetwork.h"
 #include "network/callhandler/packetdata/DMRPacketData.h"
+#include "network/callhandler/RoutePlan.h"
 
 #include <deque>
 
@@ -147,6 +148,7 @@ namespace network
             };
             typedef std::pair<const uint32_t, RxStatus> StatusMapPair;
             std::unordered_map<uint32_t, RxStatus> m_status;
+            RoutePlanCache m_routePlans;
 
             friend class packetdata::DMRPacketData;
             packetdata::DMRPacketData* m_packetData;
@@ -173,6 +175,12 @@ namespace network
              * @returns bool True, if rewritten successfully, otherwise false.
              */
             bool peerRewrite(uint32_t peerId, uint32_t& dstId, uint32_t& slotNo, bool outbound = true);
+            /**
+             * @brief Helper to apply a route plan rewrite to the network data buffer (voice frames only).
+             * @param buffer Frame buffer.
+             * @param dest Route plan destination.
+             */
+            void routeRewrite(uint8_t* buffer, const RouteDestination& dest);
 
             /**
              * @brief Helper to process CSBKs being passed from a peer.
@@ -200,6 +208,15 @@ namespace network
              * @returns bool True, if valid, otherwise false.
              */
             bool validate(uint32_t peerId, dmr::data::NetData& data, uint32_t streamId);
+            /**
+             * @brief Helper to get the route plan for a DMR voice call stream, building it if the stream
+             *  has no valid route plan.
+             * @param peerId Peer ID.
+             * @param dmrData Instance of data::NetData DMR data container class (as received, before any route rewrite).
+             * @param streamId Stream ID.
+             * @returns std::shared_ptr<const RoutePlan> Route plan for the call stream.
+             */
+            std::shared_ptr<const RoutePlan> routePlan(uint32_t peerId, dmr::data::NetData& dmrData, uint32_t streamId);
 
             /**
              * @brief Helper to write a grant packet.
@@ -19,6 +19,7 @@
 #include "common/Log.h"
 #include "common/Utils.h"
 #include "network/FNENetwork.h"
+#include "network/RESTDefines.h"
 #include "network/callhandler/TagNXDNData.h"
 #include "HostFNE.h"
 
@@ -48,6 +49,7 @@ TagNXDNData::TagNXDNData(FNENetwork* network, bool debug) :
     m_parrotFrames(),
     m_parrotFramesReady(false),
     m_status(),
+    m_routePlans(),
    m_debug(debug)
 {
     assert(network != nullptr);
@@ -79,8 +81,29 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
             return false;
     }
 
+    bool group = (data[15U] & 0x40U) == 0x40U ? false : true;
+
+    // voice frames are routed using the route plan computed at the start of the call stream
+    std::shared_ptr<const RoutePlan> plan;
+    if (messageType == MessageType::RTCH_VCALL) {
+        lc::RTCH rxLC;
+        rxLC.setMessageType(messageType);
+        rxLC.setSrcId((uint16_t)srcId & 0xFFFFU);
+        rxLC.setDstId((uint16_t)dstId & 0xFFFFU);
+        rxLC.setGroup(group);
+
+        plan = routePlan(peerId, rxLC, messageType, streamId);
+    }
+
     // perform TGID route rewrites if configured
-    routeRewrite(buffer, peerId, messageType, dstId, false);
+    if (plan != nullptr) {
+        if (plan->inbound.rewrite) {
+            __SET_UINT16(plan->inbound.dstId, buffer, 8U);
+        }
+    }
+    else {
+        routeRewrite(buffer, peerId, messageType, dstId, false);
+    }
     dstId = __GET_UINT16(buffer, 8U);
 
     lc::RTCH lc;
@@ -88,14 +111,13 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
     lc.setMessageType(messageType);
     lc.setSrcId((uint16_t)srcId & 0xFFFFU);
     lc.setDstId((uint16_t)dstId & 0xFFFFU);
-
-    bool group = (data[15U] & 0x40U) == 0x40U ? false : true;
     lc.setGroup(group);
 
     // is the stream valid?
-    if (validate(peerId, lc, messageType, streamId)) {
+    bool valid = (plan != nullptr) ? plan->permitted : validate(peerId, lc, messageType, streamId);
+    if (valid) {
         // is this peer ignored?
-        if (!isPeerPermitted(peerId, lc, messageType, streamId)) {
+        if (plan == nullptr && !isPeerPermitted(peerId, lc, messageType, streamId)) {
             return false;
         }
 
@@ -129,6 +151,8 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                     LogMessage(LOG_NET, "NXDN, Call End, peer = %u, srcId = %u, dstId = %u, duration = %u, streamId = %u, external = %u",
                         peerId, srcId, dstId, duration / 1000, streamId, external);
 
+                    m_network->publishCallEvent(FNE_EVENT_CALL_END, "NXDN", peerId, srcId, dstId, streamId, duration);
+
                     // report call event to InfluxDB
                     if (m_network->m_enableInfluxDB) {
                         influxdb::QueryBuilder()
@@ -198,6 +222,8 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
 
                     LogMessage(LOG_NET, "NXDN, Call Start, peer = %u, srcId = %u, dstId = %u, streamId = %u, external = %u", peerId, srcId, dstId, streamId, external);
 
+                    m_network->publishCallEvent(FNE_EVENT_CALL_START, "NXDN", peerId, srcId, dstId, streamId);
+
                     m_network->m_callInProgress = true;
                 }
             }
@@ -229,8 +255,38 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
 
         m_status[dstId].lastPacket = hrc::now();
 
+        // repeat traffic to the connected peers (using the route plan)
+        if (plan != nullptr && m_network->m_peers.size() > 0U) {
+            uint32_t i = 0U;
+            for (const RouteDestination& dest : plan->peers) {
+                // every 5 peers flush the queue
+                if (i % 5U == 0U) {
+                    m_network->m_frameQueue->flushQueue();
+                }
+
+                UInt8Array __outboundPeerBuffer = std::make_unique<uint8_t[]>(len);
+                uint8_t* outboundPeerBuffer = __outboundPeerBuffer.get();
+                ::memcpy(outboundPeerBuffer, buffer, len);
+
+                // perform TGID route rewrites if configured
+                if (dest.rewrite) {
+                    __SET_UINT16(dest.dstId, outboundPeerBuffer, 8U);
+                }
+
+                m_network->writePeer(dest.peerId, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_NXDN }, outboundPeerBuffer, len, pktSeq, streamId, true);
+                if (m_network->m_debug) {
+                    LogDebug(LOG_NET, "NXDN, srcPeer = %u, dstPeer = %u, messageType = $%02X, srcId = %u, dstId = %u, len = %u, pktSeq = %u, streamId = %u, external = %u", 
+                        peerId, dest.peerId, messageType, srcId, dstId, len, pktSeq, streamId, external);
+                }
+
+                if (!m_network->m_callInProgress)
+                    m_network->m_callInProgress = true;
+                i++;
+            }
+            m_network->m_frameQueue->flushQueue();
+        }
         // repeat traffic to the connected peers
-        if (m_network->m_peers.size() > 0U) {
+        else if (m_network->m_peers.size() > 0U) {
             uint32_t i = 0U;
             for (auto peer : m_network->m_peers) {
                 if (peerId != peer.first) {
@@ -275,7 +331,14 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                 // is coming from a external peer
                 if (dstPeerId != peerId) {
                     // is this peer ignored?
-                    if (!isPeerPermitted(dstPeerId, lc, messageType, streamId, true)) {
+                    const RouteDestination* dest = nullptr;
+                    if (plan != nullptr) {
+                        dest = plan->findExternal(dstPeerId);
+                        if (dest == nullptr) {
+                            continue;
+                        }
+                    }
+                    else if (!isPeerPermitted(dstPeerId, lc, messageType, streamId, true)) {
                         continue;
                     }
 
@@ -295,7 +358,14 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                     ::memcpy(outboundPeerBuffer, buffer, len);
 
                     // perform TGID route rewrites if configured
-                    routeRewrite(outboundPeerBuffer, dstPeerId, messageType, dstId);
+                    if (dest != nullptr) {
+                        if (dest->rewrite) {
+                            __SET_UINT16(dest->dstId, outboundPeerBuffer, 8U);
+                        }
+                    }
+                    else {
+                        routeRewrite(outboundPeerBuffer, dstPeerId, messageType, dstId);
+                    }
 
                     peer.second->writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_NXDN }, outboundPeerBuffer, len, pktSeq, streamId);
                     if (m_network->m_debug) {
@@ -352,6 +422,8 @@ bool TagNXDNData::processGrantReq(uint32_t srcId, uint32_t dstId, bool unitToUni
         }
     }
 
+    m_network->publishCallEvent(FNE_EVENT_GRANT, "NXDN", peerId, srcId, dstId, streamId);
+
     return true;
 }
 
@@ -626,6 +698,86 @@ bool TagNXDNData::validate(uint32_t peerId, lc::RTCH& lc, uint8_t messageType, u
     return true;
 }
 
+/* Helper to get the route plan for a NXDN voice call stream. */
+
+std::shared_ptr<const RoutePlan> TagNXDNData::routePlan(uint32_t peerId, lc::RTCH& lc, uint8_t messageType, uint32_t streamId)
+{
+    uint32_t srcId = lc.getSrcId();
+    uint32_t dstId = lc.getDstId();
+    uint32_t key = lc.getGroup() ? 0U : 1U;
+    uint64_t generation = m_network->routeGeneration();
+
+    std::shared_ptr<const RoutePlan> cached = m_routePlans.find(streamId, peerId, srcId, dstId, key, generation);
+    if (cached != nullptr) {
+        m_network->m_routePlanHits++;
+        return cached;
+    }
+
+    m_network->m_routePlanRebuilds++;
+
+    // the plan is built privately and only published once complete
+    std::shared_ptr<RoutePlan> plan = std::make_shared<RoutePlan>();
+    plan->streamId = streamId;
+    plan->peerId = peerId;
+    plan->srcId = srcId;
+    plan->dstId = dstId;
+    plan->key = key;
+    plan->generation = generation;
+
+    // perform TGID route rewrites if configured
+    uint32_t rewriteDstId = dstId;
+    if (peerRewrite(peerId, rewriteDstId, false)) {
+        plan->inbound = RouteDestination(peerId, true, rewriteDstId);
+    }
+
+    lc::RTCH rtch = lc;
+    rtch.setDstId((uint16_t)rewriteDstId & 0xFFFFU);
+
+    // is the stream valid and is this peer permitted?
+    plan->permitted = validate(peerId, rtch, messageType, streamId) && isPeerPermitted(peerId, rtch, messageType, streamId);
+    if (!plan->permitted) {
+        m_routePlans.store(plan);
+        return plan;
+    }
+
+    // for talkgroups requiring affiliations, only the peers with affiliations need to be checked
+    std::vector<uint32_t> peers;
+    lookups::TalkgroupRuleGroupVoice tg = m_network->m_tidLookup->find(rtch.getDstId());
+    if (rtch.getGroup() && tg.config().affiliated()) {
+        peers = m_network->affiliatedPeers(rtch.getDstId(), tg.config().alwaysSend());
+    }
+    else {
+        peers.reserve(m_network->m_peers.size());
+        for (auto peer : m_network->m_peers)
+            peers.push_back(peer.first);
+    }
+
+    for (uint32_t dstPeerId : peers) {
+        if (peerId == dstPeerId || m_network->m_peers.find(dstPeerId) == m_network->m_peers.end() ||
+            !isPeerPermitted(dstPeerId, rtch, messageType, streamId)) {
+            continue;
+        }
+
+        uint32_t peerDstId = rewriteDstId;
+        bool rewrite = peerRewrite(dstPeerId, peerDstId);
+        plan->peers.push_back(RouteDestination(dstPeerId, rewrite, peerDstId));
+    }
+
+    for (auto peer : m_network->m_host->m_peerNetworks) {
+        uint32_t dstPeerId = peer.second->getPeerId();
+        if (dstPeerId == peerId || !isPeerPermitted(dstPeerId, rtch, messageType, streamId, true)) {
+            continue;
+        }
+
+        uint32_t peerDstId = rewriteDstId;
+        bool rewrite = peerRewrite(dstPeerId, peerDstId);
+        plan->external.push_back(RouteDestination(dstPeerId, rewrite, peerDstId));
+    }
+
+    m_routePlans.store(plan);
+    return plan;
+}
+
 /* Helper to write a grant packet. */
 
 bool TagNXDNData::write_Message_Grant(uint32_t peerId, uint32_t srcId, uint32_t dstId, uint8_t serviceOptions, bool grp)
@@ -22,6 +22,7 @@
 #include "common/nxdn/lc/RTCH.h"
 #include "common/nxdn/lc/RCCH.h"
 #include "network/FNENetwork.h"
+#include "network/callhandler/RoutePlan.h"
 
 #include <deque>
 
@@ -118,6 +119,7 @@ namespace network
             };
             typedef std::pair<const uint32_t, RxStatus> StatusMapPair;
             std::unordered_map<uint32_t, RxStatus> m_status;
+            RoutePlanCache m_routePlans;
 
             bool m_debug;
 
@@ -158,6 +160,16 @@ namespace network
              * @returns bool True, if valid, otherwise false.
              */
             bool validate(uint32_t peerId, nxdn::lc::RTCH& control, uint8_t messageType, uint32_t streamId);
+            /**
+             * @brief Helper to get the route plan for a NXDN voice call stream, building it if the stream
+             *  has no valid route plan.
+             * @param peerId Peer ID.
+             * @param lc Instance of nxdn::lc::RTCH (as received, before any route rewrite).
+             * @param messageType Message Type.
+             * @param streamId Stream ID.
+             * @returns std::shared_ptr<const RoutePlan> Route plan for the call stream.
+             */
+            std::shared_ptr<const RoutePlan> routePlan(uint32_t peerId, nxdn::lc::RTCH& lc, uint8_t messageType, uint32_t streamId);
 
             /**
              * @brief Helper to write a grant packet.
@@ -15,6 +15,7 @@
 #include "common/Thread.h"
 #include "common/Utils.h"
 #include "network/FNENetwork.h"
+#include "network/RESTDefines.h"
 #include "network/callhandler/TagP25Data.h"
 #include "HostFNE.h"
 
@@ -47,6 +48,7 @@ TagP25Data::TagP25Data(FNENetwork* network, bool debug) :
     m_parrotFramesReady(false),
     m_parrotFirstFrame(true),
     m_status(),
+    m_routePlans(),
     m_packetData(nullptr),
     m_debug(debug)
 {
@@ -92,8 +94,26 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
         return m_packetData->processFrame(data, len, peerId, pktSeq, streamId, external);
     }
 
+    // voice frames are routed using the route plan computed at the start of the call stream
+    std::shared_ptr<const RoutePlan> plan;
+    if (duid == DUID::LDU1 || duid == DUID::LDU2) {
+        lc::LC rxControl;
+        rxControl.setLCO(lco);
+        rxControl.setSrcId(srcId);
+        rxControl.setDstId(dstId);
+
+        plan = routePlan(peerId, rxControl, duid, streamId);
+    }
+
     // perform TGID route rewrites if configured
-    routeRewrite(buffer, peerId, duid, dstId, false);
+    if (plan != nullptr) {
+        if (plan->inbound.rewrite) {
+            __SET_UINT16(plan->inbound.dstId, buffer, 8U);
+        }
+    }
+    else {
+        routeRewrite(buffer, peerId, duid, dstId, false);
+    }
     dstId = __GET_UINT16(buffer, 8U);
 
     lc::LC control;
@@ -151,9 +171,10 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
     }
 
     // is the stream valid?
-    if (validate(peerId, control, duid, tsbk.get(), streamId)) {
+    bool valid = (plan != nullptr) ? plan->permitted : validate(peerId, control, duid, tsbk.get(), streamId);
+    if (valid) {
         // is this peer ignored?
-        if (!isPeerPermitted(peerId, control, duid, streamId)) {
+        if (plan == nullptr && !isPeerPermitted(peerId, control, duid, streamId)) {
             return false;
         }
 
@@ -201,6 +222,8 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                         LogMessage(LOG_NET, "P25, Call End, peer = %u, srcId = %u, dstId = %u, duration = %u, streamId = %u, external = %u",
                             peerId, srcId, dstId, duration / 1000, streamId, external);
 
+                        m_network->publishCallEvent(FNE_EVENT_CALL_END, "P25", peerId, srcId, dstId, streamId, duration);
+
                         // report call event to InfluxDB
                         if (m_network->m_enableInfluxDB) {
                             influxdb::QueryBuilder()
@@ -271,6 +294,8 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
 
                     LogMessage(LOG_NET, "P25, Call Start, peer = %u, srcId = %u, dstId = %u, streamId = %u, external = %u", peerId, srcId, dstId, streamId, external);
 
+                    m_network->publishCallEvent(FNE_EVENT_CALL_START, "P25", peerId, srcId, dstId, streamId);
+
                     m_network->m_callInProgress = true;
                 }
             }
@@ -307,8 +332,38 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
 
         m_status[dstId].lastPacket = hrc::now();
 
+        // repeat traffic to the connected peers (using the route plan)
+        if (plan != nullptr && m_network->m_peers.size() > 0U) {
+            uint32_t i = 0U;
+            for (const RouteDestination& dest : plan->peers) {
+                // every 5 peers flush the queue
+                if (i % 5U == 0U) {
+                    m_network->m_frameQueue->flushQueue();
+                }
+
+                UInt8Array __outboundPeerBuffer = std::make_unique<uint8_t[]>(len);
+                uint8_t* outboundPeerBuffer = __outboundPeerBuffer.get();
+                ::memcpy(outboundPeerBuffer, buffer, len);
+
+                // perform TGID route rewrites if configured
+                if (dest.rewrite) {
+                    __SET_UINT16(dest.dstId, outboundPeerBuffer, 8U);
+                }
+
+                m_network->writePeer(dest.peerId, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, outboundPeerBuffer, len, pktSeq, streamId, true);
+                if (m_network->m_debug) {
+                    LogDebug(LOG_NET, "P25, srcPeer = %u, dstPeer = %u, duid = $%02X, lco = $%02X, MFId = $%02X, srcId = %u, dstId = %u, len = %u, pktSeq = %u, streamId = %u, external = %u", 
+                        peerId, dest.peerId, duid, lco, MFId, srcId, dstId, len, pktSeq, streamId, external);
+                }
+
+                if (!m_network->m_callInProgress)
+                    m_network->m_callInProgress = true;
+                i++;
+            }
+            m_network->m_frameQueue->flushQueue();
+        }
         // repeat traffic to the connected peers
-        if (m_network->m_peers.size() > 0U) {
+        else if (m_network->m_peers.size() > 0U) {
             uint32_t i = 0U;
             for (auto peer : m_network->m_peers) {
                 if (peerId != peer.first) {
@@ -358,7 +413,14 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                 // is coming from a external peer
                 if (dstPeerId != peerId) {
                     // is this peer ignored?
-                    if (!isPeerPermitted(dstPeerId, control, duid, streamId, true)) {
+                    const RouteDestination* dest = nullptr;
+                    if (plan != nullptr) {
+                        dest = plan->findExternal(dstPeerId);
+                        if (dest == nullptr) {
+                            continue;
+                        }
+                    }
+                    else if (!isPeerPermitted(dstPeerId, control, duid, streamId, true)) {
                         continue;
                     }
 
@@ -378,7 +440,14 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                     ::memcpy(outboundPeerBuffer, buffer, len);
 
                     // perform TGID route rewrites if configured
-                    routeRewrite(outboundPeerBuffer, dstPeerId, duid, dstId);
+                    if (dest != nullptr) {
+                        if (dest->rewrite) {
+                            __SET_UINT16(dest->dstId, outboundPeerBuffer, 8U);
+                        }
+                    }
+                    else {
+                        routeRewrite(outboundPeerBuffer, dstPeerId, duid, dstId);
+                    }
 
                     // process TSDUs going to external peers
                     if (processTSDUToExternal(outboundPeerBuffer, peerId, dstPeerId, duid)) {
@@ -438,6 +507,8 @@ bool TagP25Data::processGrantReq(uint32_t srcId, uint32_t dstId, bool unitToUnit
         }
     }
 
+    m_network->publishCallEvent(FNE_EVENT_GRANT, "P25", peerId, srcId, dstId, streamId);
+
     return true;
 }
 
@@ -1136,6 +1207,85 @@ bool TagP25Data::validate(uint32_t peerId, lc::LC& control, DUID::E duid, const
     return true;
 }
 
+/* Helper to get the route plan for a P25 voice call stream. */
+
+std::shared_ptr<const RoutePlan> TagP25Data::routePlan(uint32_t peerId, lc::LC& control, DUID::E duid, uint32_t streamId)
+{
+    uint32_t srcId = control.getSrcId();
+    uint32_t dstId = control.getDstId();
+    uint32_t key = (control.getLCO() == LCO::PRIVATE) ? 1U : 0U;
+    uint64_t generation = m_network->routeGeneration();
+
+    std::shared_ptr<const RoutePlan> cached = m_routePlans.find(streamId, peerId, srcId, dstId, key, generation);
+    if (cached != nullptr) {
+        m_network->m_routePlanHits++;
+        return cached;
+    }
+
+    m_network->m_routePlanRebuilds++;
+
+    // the plan is built privately and only published once complete
+    std::shared_ptr<RoutePlan> plan = std::make_shared<RoutePlan>();
+    plan->streamId = streamId;
+    plan->peerId = peerId;
+    plan->srcId = srcId;
+    plan->dstId = dstId;
+    plan->key = key;
+    plan->generation = generation;
+
+    // perform TGID route rewrites if configured
+    uint32_t rewriteDstId = dstId;
+    if (peerRewrite(peerId, rewriteDstId, false)) {
+        plan->inbound = RouteDestination(peerId, true, rewriteDstId);
+    }
+
+    lc::LC lc = control;
+    lc.setDstId(rewriteDstId);
+
+    // is the stream valid and is this peer permitted?
+    plan->permitted = validate(peerId, lc, duid, nullptr, streamId) && isPeerPermitted(peerId, lc, duid, streamId);
+    if (!plan->permitted) {
+        m_routePlans.store(plan);
+        return plan;
+    }
+
+    // for talkgroups requiring affiliations, only the peers with affiliations need to be checked
+    std::vector<uint32_t> peers;
+    lookups::TalkgroupRuleGroupVoice tg = m_network->m_tidLookup->find(rewriteDstId);
+    if (lc.getLCO() != LCO::PRIVATE && tg.config().affiliated()) {
+        peers = m_network->affiliatedPeers(rewriteDstId, tg.config().alwaysSend());
+    }
+    else {
+        peers.reserve(m_network->m_peers.size());
+        for (auto peer : m_network->m_peers)
+            peers.push_back(peer.first);
+    }
+
+    for (uint32_t dstPeerId : peers) {
+        if (peerId == dstPeerId || m_network->m_peers.find(dstPeerId) == m_network->m_peers.end() ||
+            !isPeerPermitted(dstPeerId, lc, duid, streamId)) {
+            continue;
+        }
+
+        uint32_t peerDstId = rewriteDstId;
+        bool rewrite = peerRewrite(dstPeerId, peerDstId);
+        plan->peers.push_back(RouteDestination(dstPeerId, rewrite, peerDstId));
+    }
+
+    for (auto peer : m_network->m_host->m_peerNetworks) {
+        uint32_t dstPeerId = peer.second->getPeerId();
+        if (dstPeerId == peerId || !isPeerPermitted(dstPeerId, lc, duid, streamId, true)) {
+            continue;
+        }
+
+        uint32_t peerDstId = rewriteDstId;
+        bool rewrite = peerRewrite(dstPeerId, peerDstId);
+        plan->external.push_back(RouteDestination(dstPeerId, rewrite, peerDstId));
+    }
+
+    m_routePlans.store(plan);
+    return plan;
+}
 
 /* Helper to write a grant packet. */
 
@@ -28,6 +28,7 @@
 #include "common/p25/lc/TDULC.h"
 #include "network/FNENetwork.h"
 #include "network/callhandler/packetdata/P25PacketData.h"
+#include "network/callhandler/RoutePlan.h"
 
 #include <deque>
 
@@ -167,6 +168,7 @@ namespace network
             };
             typedef std::pair<const uint32_t, RxStatus> StatusMapPair;
             std::unordered_map<uint32_t, RxStatus> m_status;
+            RoutePlanCache m_routePlans;
 
             friend class packetdata::P25PacketData;
             packetdata::P25PacketData *m_packetData;
@@ -237,6 +239,16 @@ namespace network
              * @returns bool True, if valid, otherwise false.
              */
             bool validate(uint32_t peerId, p25::lc::LC& control, P25DEF::DUID::E duid, const p25::lc::TSBK* tsbk, uint32_t streamId);
+            /**
+             * @brief Helper to get the route plan for a P25 voice call stream, building it if the stream
+             *  has no valid route plan.
+             * @param peerId Peer ID.
+             * @param control Instance of p25::lc::LC (as received, before any route rewrite).
+             * @param duid DUID.
+             * @param streamId Stream ID.
+             * @returns std::shared_ptr<const RoutePlan> Route plan for the call stream.
+             */
+            std::shared_ptr<const RoutePlan> routePlan(uint32_t peerId, p25::lc::LC& control, P25DEF::DUID::E duid, uint32_t streamId);
 
             /**
              * @brief Helper to write a grant packet.
@@ -84,6 +84,38 @@ static bool ActivityLogOpen()
     return m_actFpLog != nullptr;
 }
 
+/* Helper to write a activity log entry to the activity log outputs. */
+
+static void ActivityLogWrite(const char* buffer)
+{
+    bool ret = ::ActivityLogOpen();
+    if (!ret)
+        return;
+
+    if (LogGetNetwork() != nullptr) {
+        network::BaseNetwork* network = (network::BaseNetwork*)LogGetNetwork();;
+        network->writeActLog(buffer);
+    }
+
+    if (CurrentLogFileLevel() == 0U)
+        return;
+
+    ::fprintf(m_actFpLog, "%s\n", buffer);
+
+    if (2U >= g_logDisplayLevel && g_logDisplayLevel != 0U) {
+        ::fprintf(stdout, "%s" EOL, buffer);
+    }
+}
+
+/* Helper to flush the activity log outputs. */
+
+static void ActivityLogFlush()
+{
+    if (m_actFpLog != nullptr)
+        ::fflush(m_actFpLog);
+    ::fflush(stdout);
+}
+
 /* Initializes the activity log. */
 
 bool ActivityLogInitialise(const std::string& filePath, const std::string& fileRoot)
@@ -94,6 +126,7 @@ bool ActivityLogInitialise(const std::string& filePath, const std::string& fileR
     m_actFilePath = filePath;
     m_actFileRoot = fileRoot;
 
+    ::LogSetActivitySink(ActivityLogWrite, ActivityLogFlush);
     return ::ActivityLogOpen();
 }
 
@@ -101,11 +134,16 @@ bool ActivityLogInitialise(const std::string& filePath, const std::string& fileR
 
 void ActivityLogFinalise()
 {
-#if defined(CATCH2_TEST_COMPILATION)
-    return;
-#endif
-    if (m_actFpLog != nullptr)
+#if !defined(CATCH2_TEST_COMPILATION)
+    // the log writer may still be writing queued activity entries to the file
+    ::LogStopAsyncWriter();
+
+    ::LogSetActivitySink(nullptr, nullptr);
+    if (m_actFpLog != nullptr) {
         ::fclose(m_actFpLog);
+        m_actFpLog = nullptr;
+    }
+#endif // !defined(CATCH2_TEST_COMPILATION)
 }
 
 /* Writes a new entry to the activity log. */
@@ -119,47 +157,21 @@ void ActivityLog(const char *mode, const bool sourceRf, const char* msg, ...)
     assert(msg != nullptr);
 
     char buffer[ACT_LOG_BUFFER_LEN];
-    time_t now;
-    ::time(&now);
-    struct tm* tm = ::localtime(&now);
-
-    struct timeval nowMillis;
-    ::gettimeofday(&nowMillis, NULL);
+    char timestamp[24U];
+    ::LogFormatTimestamp(timestamp);
 
+    uint32_t len = 0U;
     if (strcmp(mode, "") == 0) {
-        ::sprintf(buffer, "A: %04d-%02d-%02d %02d:%02d:%02d.%03lu ", tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday, tm->tm_hour, tm->tm_min, tm->tm_sec, nowMillis.tv_usec / 1000U);
+        len = ::snprintf(buffer, ACT_LOG_BUFFER_LEN, "A: %s ", timestamp);
     }
     else {
-        ::sprintf(buffer, "A: %04d-%02d-%02d %02d:%02d:%02d.%03lu %s %s ", tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday, tm->tm_hour, tm->tm_min, tm->tm_sec, nowMillis.tv_usec / 1000U, mode, (sourceRf) ? "RF" : "Net");
+        len = ::snprintf(buffer, ACT_LOG_BUFFER_LEN, "A: %s %s %s ", timestamp, mode, (sourceRf) ? "RF" : "Net");
     }
 
-    va_list vl, vl_len;
+    va_list vl;
     va_start(vl, msg);
-    va_copy(vl_len, vl);
-
-    size_t len = ::vsnprintf(nullptr, 0U, msg, vl_len);
-    ::vsnprintf(buffer + ::strlen(buffer), len + 1U, msg, vl);
-
-    va_end(vl_len);
+    ::vsnprintf(buffer + len, ACT_LOG_BUFFER_LEN - len, msg, vl);
     va_end(vl);
 
-    bool ret = ::ActivityLogOpen();
-    if (!ret)
-        return;
-
-    if (LogGetNetwork() != nullptr) {
-        network::BaseNetwork* network = (network::BaseNetwork*)LogGetNetwork();;
-        network->writeActLog(buffer);
-    }
-
-    if (CurrentLogFileLevel() == 0U)
-        return;
-
-    ::fprintf(m_actFpLog, "%s\n", buffer);
-    ::fflush(m_actFpLog);
-
-    if (2U >= g_logDisplayLevel && g_logDisplayLevel != 0U) {
-        ::fprintf(stdout, "%s" EOL, buffer);
-        ::fflush(stdout);
-    }
+    ::LogQueueActivity(buffer);
 }
@@ -62,6 +62,7 @@ void* Host::threadDMRReader1(void* arg)
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
 
+        TickScheduler ticker;
         if (host->m_dmr != nullptr) {
             while (!g_killed) {
                 // scope is intentional
@@ -152,10 +153,7 @@ void* Host::threadDMRReader1(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                ticker.wait((host->m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
             }
         }
 
@@ -195,6 +193,7 @@ void* Host::threadDMRWriter1(void* arg)
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
 
+        TickScheduler ticker(&host->m_dmrTx1Jitter);
         StopWatch stopWatch;
         stopWatch.start();
 
@@ -281,10 +280,7 @@ void* Host::threadDMRWriter1(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                ticker.wait((host->m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
             }
         }
 
@@ -324,6 +320,7 @@ void* Host::threadDMRReader2(void* arg)
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
 
+        TickScheduler ticker;
         if (host->m_dmr != nullptr) {
             while (!g_killed) {
                 // scope is intentional
@@ -413,10 +410,7 @@ void* Host::threadDMRReader2(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                ticker.wait((host->m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
             }
         }
 
@@ -456,6 +450,7 @@ void* Host::threadDMRWriter2(void* arg)
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
 
+        TickScheduler ticker(&host->m_dmrTx2Jitter);
         StopWatch stopWatch;
         stopWatch.start();
 
@@ -542,10 +537,7 @@ void* Host::threadDMRWriter2(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                ticker.wait((host->m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
             }
         }
 
@@ -49,6 +49,7 @@ void* Host::threadNXDNReader(void* arg)
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
 
+        TickScheduler ticker;
         if (host->m_nxdn != nullptr) {
             while (!g_killed) {
                 // scope is intentional
@@ -101,10 +102,7 @@ void* Host::threadNXDNReader(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                ticker.wait((host->m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
             }
         }
 
@@ -144,6 +142,7 @@ void* Host::threadNXDNWriter(void* arg)
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
 
+        TickScheduler ticker(&host->m_nxdnTxJitter);
         StopWatch stopWatch;
         stopWatch.start();
 
@@ -217,10 +216,7 @@ void* Host::threadNXDNWriter(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                ticker.wait((host->m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
             }
         }
 
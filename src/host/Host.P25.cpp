@@ -50,6 +50,7 @@ void* Host::threadP25Reader(void* arg)
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
 
+        TickScheduler ticker;
         if (host->m_p25 != nullptr) {
             while (!g_killed) {
                 // scope is intentional
@@ -143,10 +144,7 @@ void* Host::threadP25Reader(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                ticker.wait((host->m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
             }
         }
 
@@ -186,6 +184,7 @@ void* Host::threadP25Writer(void* arg)
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
 
+        TickScheduler ticker(&host->m_p25TxJitter);
         StopWatch stopWatch;
         stopWatch.start();
 
@@ -302,10 +301,7 @@ void* Host::threadP25Writer(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                ticker.wait((host->m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
             }
         }
 
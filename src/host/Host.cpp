@@ -149,6 +149,11 @@ Host::Host(const std::string& confFile) :
     m_p25OverflowCnt(0U),
     m_nxdnOverflowCnt(0U),
     m_disableWatchdogOverflow(false),
+    m_modemJitter(),
+    m_dmrTx1Jitter(),
+    m_dmrTx2Jitter(),
+    m_p25TxJitter(),
+    m_nxdnTxJitter(),
     m_restAddress("0.0.0.0"),
     m_restPort(REST_API_DEFAULT_PORT),
     m_RESTAPI(nullptr),
@@ -238,6 +243,9 @@ int Host::run()
     }
 #endif // !defined(_WIN32)
 
+    // start the asynchronous log writer (this must happen after any forking)
+    ::LogStartAsyncWriter();
+
     ::LogInfo(__BANNER__ "\r\n" __PROG_NAME__ " " __VER__ " (built " __BUILD__ ")\r\n" \
         "Copyright (c) 2017-2024 Bryan Biedenkapp, N2PLL and DVMProject (https://github.com/dvmproject) Authors.\r\n" \
         "Portions Copyright (c) 2015-2021 by Jonathan Naylor, G4KLX and others\r\n" \
@@ -310,14 +318,17 @@ int Host::run()
     std::string ridLookupFile = systemConf["radio_id"]["file"].as<std::string>();
     uint32_t ridReloadTime = systemConf["radio_id"]["time"].as<uint32_t>(0U);
     bool ridAcl = systemConf["radio_id"]["acl"].as<bool>(false);
+    bool ridBinaryCache = systemConf["radio_id"]["binaryCache"].as<bool>(false);
 
     LogInfo("Radio Id Lookups");
     LogInfo("    File: %s", ridLookupFile.length() > 0U ? ridLookupFile.c_str() : "None");
     if (ridReloadTime > 0U)
         LogInfo("    Reload: %u mins", ridReloadTime);
     LogInfo("    ACL: %s", ridAcl ? "yes" : "no");
+    LogInfo("    Binary Cache: %s", ridBinaryCache ? "yes" : "no");
 
     m_ridLookup = new RadioIdLookup(ridLookupFile, ridReloadTime, ridAcl);
+    m_ridLookup->setBinaryCache(ridBinaryCache);
     m_ridLookup->read();
 
     // try to load talkgroup IDs table
@@ -856,6 +867,7 @@ int Host::run()
 
     ::LogInfoEx(LOG_HOST, "[ OK ] Host is up and running on %s %s %s", utsinfo.sysname, utsinfo.release, utsinfo.machine);
 #endif // defined(_WIN32)
+    TickScheduler ticker;
     while (!killed) {
         if (m_modem->hasLockout() && m_state != HOST_STATE_LOCKOUT)
             setState(HOST_STATE_LOCKOUT);
@@ -1259,16 +1271,23 @@ int Host::run()
 
         m_modeTimer.clock(ms);
 
-        if ((m_state != STATE_IDLE) && ms <= m_activeTickDelay)
-            Thread::sleep(m_activeTickDelay);
-        if (m_state == STATE_IDLE)
-            Thread::sleep(m_idleTickDelay);
+        ticker.wait((m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
     }
 
     if (rssi != nullptr) {
         delete rssi;
     }
 
+    LogInfoEx(LOG_HOST, "Modem clock jitter, %s", m_modemJitter.toString().c_str());
+    if (m_dmr != nullptr) {
+        LogInfoEx(LOG_HOST, "DMR, slot 1 Tx jitter, %s", m_dmrTx1Jitter.toString().c_str());
+        LogInfoEx(LOG_HOST, "DMR, slot 2 Tx jitter, %s", m_dmrTx2Jitter.toString().c_str());
+    }
+    if (m_p25 != nullptr)
+        LogInfoEx(LOG_HOST, "P25, Tx jitter, %s", m_p25TxJitter.toString().c_str());
+    if (m_nxdn != nullptr)
+        LogInfoEx(LOG_HOST, "NXDN, Tx jitter, %s", m_nxdnTxJitter.toString().c_str());
+
     setState(HOST_STATE_QUIT);
     return EXIT_SUCCESS;
 }
@@ -1479,6 +1498,49 @@ json::object Host::getStatus()
         response["modem"].set<json::object>(modemInfo);
     }
 
+    // frame processor tick jitter
+    {
+        auto jitterObj = [](const JitterHistogram& jitter) -> json::object {
+            json::object obj = json::object();
+
+            uint64_t count = jitter.count();
+            obj["samples"].set<uint64_t>(count);
+            uint64_t min = jitter.min();
+            obj["minUs"].set<uint64_t>(min);
+            uint64_t mean = jitter.mean();
+            obj["meanUs"].set<uint64_t>(mean);
+            uint64_t max = jitter.max();
+            obj["maxUs"].set<uint64_t>(max);
+
+            json::array buckets = json::array();
+            for (uint8_t i = 0U; i < JITTER_HISTOGRAM_BUCKETS; i++) {
+                uint64_t bucket = jitter.bucket(i);
+                buckets.push_back(json::value((double)bucket));
+            }
+            obj["buckets"].set<json::array>(buckets);
+
+            return obj;
+        };
+
+        json::object jitterInfo = json::object();
+        jitterInfo["modem"].set<json::object>(jitterObj(m_modemJitter));
+        if (m_dmr != nullptr) {
+            jitterInfo["dmrTx1"].set<json::object>(jitterObj(m_dmrTx1Jitter));
+            jitterInfo["dmrTx2"].set<json::object>(jitterObj(m_dmrTx2Jitter));
+        }
+        if (m_p25 != nullptr)
+            jitterInfo["p25Tx"].set<json::object>(jitterObj(m_p25TxJitter));
+        if (m_nxdn != nullptr)
+            jitterInfo["nxdnTx"].set<json::object>(jitterObj(m_nxdnTxJitter));
+        if (m_isModemDFSI) {
+            modem::ModemV24* modemV24 = dynamic_cast<modem::ModemV24*>(m_modem);
+            if (modemV24 != nullptr)
+                jitterInfo["v24Tx"].set<json::object>(jitterObj(modemV24->getTxJitter()));
+        }
+
+        response["jitter"].set<json::object>(jitterInfo);
+    }
+
     return response;
 }
 
@@ -1706,6 +1768,7 @@ void* Host::threadModem(void* arg)
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
 
+        TickScheduler ticker(&host->m_modemJitter);
         StopWatch stopWatch;
         stopWatch.start();
 
@@ -1724,10 +1787,7 @@ void* Host::threadModem(void* arg)
                 host->m_modem->clock(ms);
             }
 
-            if (host->m_state != STATE_IDLE)
-                Thread::sleep(m_activeTickDelay);
-            if (host->m_state == STATE_IDLE)
-                Thread::sleep(m_idleTickDelay);
+            ticker.wait((host->m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
         }
 
         LogDebug(LOG_HOST, "[STOP] %s", threadName.c_str());
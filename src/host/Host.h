@@ -26,6 +26,7 @@
 #define __HOST_H__
 
 #include "Defines.h"
+#include "common/TickScheduler.h"
 #include "common/Timer.h"
 #include "common/lookups/AffiliationLookup.h"
 #include "common/lookups/ChannelLookup.h"
@@ -209,6 +210,14 @@ private:
 
     bool m_disableWatchdogOverflow;
 
+    /* Tick Jitter */
+
+    JitterHistogram m_modemJitter;
+    JitterHistogram m_dmrTx1Jitter;
+    JitterHistogram m_dmrTx2Jitter;
+    JitterHistogram m_p25TxJitter;
+    JitterHistogram m_nxdnTxJitter;
+
     static std::mutex m_clockingMutex;
 
     static uint8_t m_activeTickDelay;
@@ -42,6 +42,7 @@ bool Slot::m_authoritative = true;
 uint32_t Slot::m_colorCode = 0U;
 
 SiteData Slot::m_siteData = SiteData();
+uint32_t Slot::m_siteGeneration = 0U;
 uint32_t Slot::m_channelNo = 0U;
 
 bool Slot::m_embeddedLCOnly = false;
@@ -461,11 +462,10 @@ void Slot::clock()
     m_interval.start();
 
     if (m_network != nullptr) {
-        if (m_network->getStatus() == network::NET_STAT_RUNNING) {
-            m_siteData.setNetActive(true);
-        }
-        else {
-            m_siteData.setNetActive(false);
+        bool netActive = (m_network->getStatus() == network::NET_STAT_RUNNING);
+        if (netActive != m_siteData.netActive()) {
+            m_siteData.setNetActive(netActive);
+            m_siteGeneration++;
         }
 
         lc::CSBK::setSiteData(m_siteData);
@@ -899,6 +899,7 @@ void Slot::init(Control* dmr, bool authoritative, uint32_t colorCode, SiteData s
     m_colorCode = colorCode;
 
     m_siteData = siteData;
+    m_siteGeneration++;
 
     m_embeddedLCOnly = embeddedLCOnly;
     m_dumpTAData = dumpTAData;
@@ -997,6 +998,7 @@ void Slot::setSiteData(::lookups::VoiceChData controlChData, uint32_t netId, uin
     }
 
     m_controlChData = controlChData;
+    m_siteGeneration++;
 
     lc::CSBK::setSiteData(m_siteData);
 }
@@ -1007,6 +1009,7 @@ void Slot::setAlohaConfig(uint8_t nRandWait, uint8_t backOff)
 {
     m_alohaNRandWait = nRandWait;
     m_alohaBackOff = backOff;
+    m_siteGeneration++;
 }
 
 // ---------------------------------------------------------------------------
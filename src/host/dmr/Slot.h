@@ -409,6 +409,7 @@ namespace dmr
         static uint32_t m_colorCode;
 
         static SiteData m_siteData;
+        static uint32_t m_siteGeneration;
         static uint32_t m_channelNo;
 
         static bool m_embeddedLCOnly;
@@ -73,8 +73,7 @@ bool DMRAffiliationLookup::grantChSlot(uint32_t dstId, uint32_t srcId, uint8_t s
     m_uuGrantedTable[dstId] = !grp;
     m_netGrantedTable[dstId] = netGranted;
 
-    m_grantTimers[dstId] = Timer(1000U, grantTimeout);
-    m_grantTimers[dstId].start();
+    m_grantTimers.start(dstId, grantTimeout);
 
     if (m_verbose) {
         LogMessage(LOG_HOST, "%s, granting channel, chNo = %u, slot = %u, dstId = %u, group = %u",
@@ -143,7 +142,7 @@ bool DMRAffiliationLookup::releaseGrant(uint32_t dstId, bool releaseAll, bool no
             m_rfGrantChCnt = 0U;
         }
 
-        m_grantTimers[dstId].stop();
+        m_grantTimers.stop(dstId);
 
         if (!noLock)
             m_mutex.unlock();
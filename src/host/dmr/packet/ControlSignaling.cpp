@@ -688,7 +688,8 @@ ControlSignaling::ControlSignaling(Slot * slot, network::BaseNetwork * network,
     m_slot(slot),
     m_dumpCSBKData(dumpCSBKData),
     m_verbose(verbose),
-    m_debug(debug)
+    m_debug(debug),
+    m_bcastBursts()
 {
     /* stub */
 }
@@ -713,6 +714,18 @@ void ControlSignaling::writeRF_CSBK(lc::CSBK* csbk, bool imm)
     }
 
     uint8_t data[DMR_FRAME_LENGTH_BYTES + 2U];
+    encodeRF_CSBK(csbk, data);
+
+    m_slot->m_rfSeqNo = 0U;
+
+    if (m_slot->m_duplex)
+        m_slot->addFrame(data, false, imm);
+}
+
+/* Helper to encode a CSBK packet into a modem frame. */
+
+void ControlSignaling::encodeRF_CSBK(lc::CSBK* csbk, uint8_t* data)
+{
     ::memset(data + 2U, 0x00U, DMR_FRAME_LENGTH_BYTES);
 
     SlotType slotType;
@@ -728,13 +741,47 @@ void ControlSignaling::writeRF_CSBK(lc::CSBK* csbk, bool imm)
     // Convert the Data Sync to be from the BS or MS as needed
     Sync::addDMRDataSync(data + 2U, m_slot->m_duplex);
 
-    m_slot->m_rfSeqNo = 0U;
-
     data[0U] = modem::TAG_DATA;
     data[1U] = 0x00U;
+}
+
+/* Helper to write a cached pre-encoded TSCC broadcast burst. */
+
+bool ControlSignaling::writeRF_TSCC_Cached(uint64_t key)
+{
+    auto it = m_bcastBursts.find(key);
+    if (it == m_bcastBursts.end())
+        return false;
+
+    const BcastBurst& burst = it->second;
+    if (burst.generation != m_slot->m_siteGeneration || burst.colorCode != m_slot->m_colorCode ||
+        burst.duplex != m_slot->m_duplex)
+        return false;
+
+    // don't add any frames if the queue is full
+    uint32_t space = m_slot->m_txQueue.freeSpace();
+    if (space < (DMR_FRAME_LENGTH_BYTES + 2U + 1U)) {
+        return true;
+    }
+
+    m_slot->m_rfSeqNo = 0U;
 
     if (m_slot->m_duplex)
-        m_slot->addFrame(data, false, imm);
+        m_slot->addFrame(burst.data, false, false);
+    return true;
+}
+
+/* Helper to encode, cache and write a TSCC broadcast CSBK packet. */
+
+void ControlSignaling::writeRF_TSCC_Bcast(uint64_t key, lc::CSBK* csbk)
+{
+    BcastBurst& burst = m_bcastBursts[key];
+    burst.generation = m_slot->m_siteGeneration;
+    burst.colorCode = m_slot->m_colorCode;
+    burst.duplex = m_slot->m_duplex;
+    encodeRF_CSBK(csbk, burst.data);
+
+    writeRF_TSCC_Cached(key);
 }
 
 /* Helper to write a network CSBK. */
@@ -1475,12 +1522,16 @@ void ControlSignaling::writeRF_CSBK_Payload_Clear(uint32_t dstId, uint32_t srcId
 
 void ControlSignaling::writeRF_TSCC_Aloha()
 {
+    uint64_t key = ((uint64_t)CSBKO::ALOHA << 56) + (m_slot->m_alohaNRandWait << 8) + m_slot->m_alohaBackOff;
+    if (writeRF_TSCC_Cached(key))
+        return;
+
     std::unique_ptr<CSBK_ALOHA> csbk = std::make_unique<CSBK_ALOHA>();
     DEBUG_LOG_CSBK(csbk->toString());
     csbk->setNRandWait(m_slot->m_alohaNRandWait);
     csbk->setBackoffNo(m_slot->m_alohaBackOff);
 
-    writeRF_CSBK(csbk.get());
+    writeRF_TSCC_Bcast(key, csbk.get());
 }
 
 /* Helper to write a TSCC Ann-Wd broadcast packet on the RF interface. */
@@ -1489,6 +1540,11 @@ void ControlSignaling::writeRF_TSCC_Bcast_Ann_Wd(uint32_t channelNo, bool annWd,
 {
     m_slot->m_rfSeqNo = 0U;
 
+    uint64_t key = ((uint64_t)CSBKO::BROADCAST << 56) + ((uint64_t)BroadcastAnncType::ANN_WD_TSCC << 48) +
+        ((uint64_t)(channelNo & 0xFFFU) << 20) + ((systemIdentity & 0xFFFFU) << 2) + ((annWd) ? 2U : 0U) + ((requireReg) ? 1U : 0U);
+    if (!m_debug && writeRF_TSCC_Cached(key))
+        return;
+
     std::unique_ptr<CSBK_BROADCAST> csbk = std::make_unique<CSBK_BROADCAST>();
     csbk->siteIdenEntry(m_slot->m_idenEntry);
     csbk->setCdef(false);
@@ -1503,26 +1559,34 @@ void ControlSignaling::writeRF_TSCC_Bcast_Ann_Wd(uint32_t channelNo, bool annWd,
             m_slot->m_slotNo, csbk->toString().c_str(), channelNo, annWd);
     }
 
-    writeRF_CSBK(csbk.get());
+    writeRF_TSCC_Bcast(key, csbk.get());
 }
 
 /* Helper to write a TSCC Sys_Parm broadcast packet on the RF interface. */
 
 void ControlSignaling::writeRF_TSCC_Bcast_Sys_Parm()
 {
+    uint64_t key = ((uint64_t)CSBKO::BROADCAST << 56) + ((uint64_t)BroadcastAnncType::SITE_PARMS << 48);
+    if (writeRF_TSCC_Cached(key))
+        return;
+
     std::unique_ptr<CSBK_BROADCAST> csbk = std::make_unique<CSBK_BROADCAST>();
     DEBUG_LOG_CSBK(csbk->toString());
     csbk->setAnncType(BroadcastAnncType::SITE_PARMS);
 
-    writeRF_CSBK(csbk.get());
+    writeRF_TSCC_Bcast(key, csbk.get());
 }
 
 /* Helper to write a TSCC Git Hash broadcast packet on the RF interface. */
 
 void ControlSignaling::writeRF_TSCC_Git_Hash()
 {
+    uint64_t key = ((uint64_t)CSBKO::DVM_GIT_HASH << 56);
+    if (writeRF_TSCC_Cached(key))
+        return;
+
     std::unique_ptr<CSBK_DVM_GIT_HASH> csbk = std::make_unique<CSBK_DVM_GIT_HASH>();
     DEBUG_LOG_CSBK(csbk->toString());
 
-    writeRF_CSBK(csbk.get());
+    writeRF_TSCC_Bcast(key, csbk.get());
 }
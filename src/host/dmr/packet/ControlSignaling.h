@@ -28,6 +28,7 @@
 #include "common/Timer.h"
 #include "modem/Modem.h"
 
+#include <unordered_map>
 #include <vector>
 
 namespace dmr
@@ -93,6 +94,17 @@ namespace dmr
             bool m_verbose;
             bool m_debug;
 
+            /**
+             * @brief Represents a pre-encoded TSCC broadcast burst.
+             */
+            struct BcastBurst {
+                uint32_t generation;    //! Site generation the burst was encoded for
+                uint32_t colorCode;     //! Color code the burst was encoded for
+                bool duplex;            //! Flag indicating the burst data sync was encoded for duplex
+                uint8_t data[defines::DMR_FRAME_LENGTH_BYTES + 2U];
+            };
+            std::unordered_map<uint64_t, BcastBurst> m_bcastBursts;
+
             /**
              * @brief Initializes a new instance of the ControlSignaling class.
              * @param slot DMR slot.
@@ -122,6 +134,24 @@ namespace dmr
              * @param imm Flag indicating the TSBK should be written to the immediate queue.
              */
             void writeRF_CSBK(lc::CSBK* csbk, bool imm = false);
+            /**
+             * @brief Helper to encode a CSBK packet into a modem frame.
+             * @param csbk CSBK to encode.
+             * @param[out] data Buffer to encode the modem frame into (DMR_FRAME_LENGTH_BYTES + 2).
+             */
+            void encodeRF_CSBK(lc::CSBK* csbk, uint8_t* data);
+            /**
+             * @brief Helper to write a cached pre-encoded TSCC broadcast burst.
+             * @param key Broadcast cache key.
+             * @returns bool True, if a valid cached burst exists for the current site generation, otherwise false.
+             */
+            bool writeRF_TSCC_Cached(uint64_t key);
+            /**
+             * @brief Helper to encode, cache and write a TSCC broadcast CSBK packet.
+             * @param key Broadcast cache key.
+             * @param csbk CSBK to write to the modem.
+             */
+            void writeRF_TSCC_Bcast(uint64_t key, lc::CSBK* csbk);
             /**
              * @brief Helper to write a network CSBK packet.
              * @param csbk CSBK to write to the network.
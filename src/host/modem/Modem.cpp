@@ -1697,6 +1697,7 @@ bool Modem::setDMRIgnoreCACH_AT(uint8_t slotNo)
 
 int Modem::write(const uint8_t* data, uint32_t length)
 {
+    std::lock_guard<std::mutex> lock(m_portWriteLock);
     return m_port->write(data, length);
 }
 
@@ -2089,7 +2090,11 @@ bool Modem::writeRFParams()
 
     buffer[1U] = lengthToWrite;
 
-    int ret = m_port->write(buffer, lengthToWrite);
+    int ret = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_portWriteLock);
+        ret = m_port->write(buffer, lengthToWrite);
+    }
     if (ret <= 0)
         return false;
 
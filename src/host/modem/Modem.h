@@ -707,6 +707,7 @@ namespace modem
 #endif // defined(ENABLE_SETUP_TUI)
 
         port::IModemPort* m_port;
+        std::mutex m_portWriteLock;     // serializes writes to the port (the V.24 modem writes from its Tx scheduler)
 
         uint8_t m_protoVer;
 
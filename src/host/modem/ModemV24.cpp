@@ -20,10 +20,12 @@
 #include "common/p25/NID.h"
 #include "common/p25/P25Utils.h"
 #include "common/p25/Sync.h"
+#include "common/Clock.h"
 #include "common/Log.h"
 #include "common/Utils.h"
 #include "modem/ModemV24.h"
 
+using namespace system_clock;
 using namespace modem;
 using namespace p25;
 using namespace p25::defines;
@@ -32,6 +34,13 @@ using namespace p25::dfsi::frames;
 
 #include <cassert>
 
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define IMBE_FRAME_SPACING_US 20000U
+#define NON_IMBE_FRAME_SPACING_US 5000U
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -46,7 +55,15 @@ ModemV24::ModemV24(port::IModemPort* port, bool duplex, uint32_t p25QueueSize, u
     m_diu(diu),
     m_audio(),
     m_nid(nullptr),
-    m_txP25Queue(p25TxQueueSize, "TX P25 Queue"),
+    m_txP25Queue(),
+    m_txP25QueueSize(p25TxQueueSize),
+    m_txP25QueueBytes(0U),
+    m_txQueueLock(),
+    m_txQueueSignal(),
+    m_txThread(nullptr),
+    m_txThreadRunning(false),
+    m_txJitter(),
+    m_lastIMBETx(0U),
     m_txCall(),
     m_rxCall(),
     m_txCallInProgress(false),
@@ -113,6 +130,18 @@ bool ModemV24::open()
     m_rspOffset = 0U;
     m_rspState = RESP_START;
 
+    // start the P25 Tx scheduler
+    if (!m_txThreadRunning) {
+        m_txThreadRunning = true;
+        m_txThread = new thread_t();
+        if (!Thread::runAsThread(this, threadTxScheduler, m_txThread)) {
+            m_txThread = nullptr;
+            m_txThreadRunning = false;
+            m_port->close();
+            return false;
+        }
+    }
+
     // do we have an open port handler?
     if (m_openPortHandler) {
         ret = m_openPortHandler(this);
@@ -148,7 +177,7 @@ void ModemV24::clock(uint32_t ms)
         reset();
     }
 
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t now = mono::nowUS() / 1000U;
     bool forceModemReset = false;
     RESP_TYPE_DVM type = getResponse();
 
@@ -371,16 +400,8 @@ void ModemV24::clock(uint32_t ms)
         reset();
     }
 
-    // write anything waiting to the serial port
-    int len = writeSerial();
-    if (m_debug && len > 0) {
-        LogDebug(LOG_MODEM, "Wrote %u-byte message to the serial V24 device", len);
-    } else if (len < 0) {
-        LogError(LOG_MODEM, "Failed to write to serial port!");
-    }
-
     // clear an RX call in progress flag if we're longer than our timeout value
-    now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    now = mono::nowUS() / 1000U;
     if (m_rxCallInProgress && (now - m_rxLastFrameTime > m_callTimeout)) {
         m_rxCallInProgress = false;
         m_rxCall->resetCallData();
@@ -393,6 +414,29 @@ void ModemV24::clock(uint32_t ms)
 void ModemV24::close()
 {
     LogDebug(LOG_MODEM, "Closing the modem");
+
+    // stop the P25 Tx scheduler
+    if (m_txThreadRunning) {
+        {
+            std::lock_guard<std::mutex> lock(m_txQueueLock);
+            m_txThreadRunning = false;
+        }
+        m_txQueueSignal.notify_all();
+
+#if defined(_WIN32)
+        ::WaitForSingleObject(m_txThread->thread, INFINITE);
+        ::CloseHandle(m_txThread->thread);
+#else
+        ::pthread_join(m_txThread->thread, NULL);
+#endif // defined(_WIN32)
+
+        delete m_txThread;
+        m_txThread = nullptr;
+    }
+
+    clearTxQueue();
+    LogInfoEx(LOG_MODEM, "V.24 IMBE Tx jitter, %s", m_txJitter.toString().c_str());
+
     m_port->close();
 
     m_gotModemStatus = false;
@@ -440,79 +484,93 @@ int ModemV24::write(const uint8_t* data, uint32_t length)
 //  Private Class Members
 // ---------------------------------------------------------------------------
 
-/* Helper to write data from the P25 Tx queue to the serial interface. */
+/* Entry point to the P25 Tx scheduler thread. */
 
-int ModemV24::writeSerial()
+void* ModemV24::threadTxScheduler(void* arg)
 {
-    /*
-     *  Serial TX ringbuffer format:
-     * 
-     *  | 0x01 | 0x02 | 0x03 | 0x04 | 0x05 | 0x06 | 0x07 | 0x08 | 0x09 | 0x0A | 0x0B | 0x0C | ... |
-     *  |   Length    | Tag  |               int64_t timestamp in ms                 |   data     |
-     */
-
-    // check empty
-    if (m_txP25Queue.isEmpty())
-        return 0U;
-
-    // get length
-    uint8_t length[2U];
-    ::memset(length, 0x00U, 2U);
-    m_txP25Queue.peek(length, 2U);
-
-    // convert length byets to int
-    uint16_t len = 0U;
-    len = (length[0U] << 8) + length[1U];
-
-    // this ensures we never get in a situation where we have length & type bytes stuck in the queue by themselves
-    if (m_txP25Queue.dataSize() == 2U && len > m_txP25Queue.dataSize()) {
-        m_txP25Queue.get(length, 2U); // ensure we pop bytes off
-        return 0U;
-    }
+    thread_t* th = (thread_t*)arg;
+    if (th != nullptr) {
+        std::string threadName("v24d:tx-sched");
+        ModemV24* modem = static_cast<ModemV24*>(th->obj);
+        if (modem == nullptr) {
+            LogDebug(LOG_MODEM, "[FAIL] %s", threadName.c_str());
+            return nullptr;
+        }
+
+        LogDebug(LOG_MODEM, "[ OK ] %s", threadName.c_str());
+#ifdef _GNU_SOURCE
+        ::pthread_setname_np(th->thread, threadName.c_str());
+#endif // _GNU_SOURCE
+
+        while (true) {
+            DFSITxFrame frame;
 
-    // get current timestamp
-    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            // scope is intentional
+            {
+                std::unique_lock<std::mutex> lock(modem->m_txQueueLock);
+                if (!modem->m_txThreadRunning)
+                    break;
+
+                // wait for a frame to be queued
+                if (modem->m_txP25Queue.empty()) {
+                    modem->m_txQueueSignal.wait(lock);
+                    continue;
+                }
 
-    // peek the timestamp to see if we should wait
-    if (m_txP25Queue.dataSize() >= 11U) {
-        uint8_t lengthTagTs[11U];
-        ::memset(lengthTagTs, 0x00U, 11U);
-        m_txP25Queue.peek(lengthTagTs, 11U);
+                // frames are always queued in due order, so only the head of the queue needs to be checked
+                uint64_t now = mono::nowUS();
+                uint64_t due = modem->m_txP25Queue.front().timestamp;
+                if (due > now) {
+                    modem->m_txQueueSignal.wait_for(lock, std::chrono::microseconds(due - now));
+                    continue;
+                }
 
-        // get the timestamp
-        int64_t ts;
-        assert(sizeof ts == 8);
-        ::memcpy(&ts, lengthTagTs + 3U, 8U);
+                frame = std::move(modem->m_txP25Queue.front());
+                modem->m_txP25Queue.pop_front();
+                modem->m_txP25QueueBytes -= frame.length;
+            }
 
-        // if it's not time to send, return
-        if (ts > now) {
-            return 0U;
+            int len = modem->writeSerial(frame);
+            if (modem->m_debug && len > 0) {
+                LogDebug(LOG_MODEM, "Wrote %u-byte message to the serial V24 device", len);
+            } else if (len < 0) {
+                LogError(LOG_MODEM, "Failed to write to serial port!");
+            }
         }
+
+        LogDebug(LOG_MODEM, "[STOP] %s", threadName.c_str());
     }
 
-    // check if we have enough data to get everything - len + 2U (length bytes) + 1U (tag) + 8U (timestamp)
-    if (m_txP25Queue.dataSize() >= len + 11U) {
-        // Get the length, tag and timestamp
-        uint8_t lengthTagTs[11U];
-        m_txP25Queue.get(lengthTagTs, 11U);
-        
-        // Get the actual data
-        UInt8Array __buffer = std::make_unique<uint8_t[]>(len);
-        uint8_t* buffer = __buffer.get();
-        m_txP25Queue.get(buffer, len);
-        
-        // Sanity check on data tag
-        uint8_t tag = lengthTagTs[2U];
-        if (tag != TAG_DATA) {
-            LogError(LOG_MODEM, "Got unexpected data tag from TX P25 ringbuffer! %02X", tag);
-            return 0U;
+    return nullptr;
+}
+
+/* Helper to write a scheduled frame to the serial interface. */
+
+int ModemV24::writeSerial(const DFSITxFrame& frame)
+{
+    uint64_t now = mono::nowUS();
+
+    // measure the spacing error between consecutive IMBE frames
+    if (frame.msgType == STT_IMBE) {
+        if (m_lastIMBETx != 0U && (now - m_lastIMBETx) < (IMBE_FRAME_SPACING_US * 2U)) {
+            uint64_t spacing = now - m_lastIMBETx;
+            m_txJitter.record((spacing > IMBE_FRAME_SPACING_US) ? spacing - IMBE_FRAME_SPACING_US : IMBE_FRAME_SPACING_US - spacing);
         }
 
-        // we already checked the timestamp above, so we just get the data and write it
-        return m_port->write(buffer, len);
+        m_lastIMBETx = now;
     }
 
-    return 0U;
+    std::lock_guard<std::mutex> lock(m_portWriteLock);
+    return m_port->write(frame.data.get(), frame.length);
+}
+
+/* Helper to clear the P25 Tx queue. */
+
+void ModemV24::clearTxQueue()
+{
+    std::lock_guard<std::mutex> lock(m_txQueueLock);
+    m_txP25Queue.clear();
+    m_txP25QueueBytes = 0U;
 }
 
 /* Helper to store converted Rx frames. */
@@ -567,22 +625,20 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
     ::memset(buffer, 0x00U, P25_PDU_FRAME_LENGTH_BYTES + 2U);
 
     // get the DFSI data (skip the 0x00 padded byte at the start)
-    UInt8Array __dfsiData = std::make_unique<uint8_t[]>(length - 1U);
-    uint8_t* dfsiData = __dfsiData.get();
-    ::memset(dfsiData, 0x00U, length - 1U);
-    ::memcpy(dfsiData, data + 1U, length - 1U);
+    const uint8_t* dfsiData = data + 1U;
 
     if (m_debug)
         Utils::dump("V24 RX data from board", dfsiData, length - 1U);
 
     DFSIFrameType::E frameType = (DFSIFrameType::E)dfsiData[0U];
-    m_rxLastFrameTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    m_rxLastFrameTime = mono::nowUS() / 1000U;
 
     // Switch based on DFSI frame type
     switch (frameType) {
         case DFSIFrameType::MOT_START_STOP:
         {
-            MotStartOfStream start = MotStartOfStream(dfsiData);
+            MotStartOfStream start = MotStartOfStream();
+            start.decode(dfsiData);
             if (start.getStartStop() == StartStopFlag::START) {
                 m_rxCall->resetCallData();
                 m_rxCallInProgress = true;
@@ -606,7 +662,8 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
 
         case DFSIFrameType::MOT_VHDR_1:
         {
-            MotVoiceHeader1 vhdr1 = MotVoiceHeader1(dfsiData);
+            MotVoiceHeader1 vhdr1 = MotVoiceHeader1();
+            vhdr1.decode(dfsiData);
 
             // copy to call data VHDR1
             ::memset(m_rxCall->VHDR1, 0x00U, MotVoiceHeader1::HCW_LENGTH);
@@ -615,7 +672,8 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
         break;
         case DFSIFrameType::MOT_VHDR_2:
         {
-            MotVoiceHeader2 vhdr2 = MotVoiceHeader2(dfsiData);
+            MotVoiceHeader2 vhdr2 = MotVoiceHeader2();
+            vhdr2.decode(dfsiData);
 
             // copy to call data VHDR2
             ::memset(m_rxCall->VHDR2, 0x00U, MotVoiceHeader2::HCW_LENGTH);
@@ -698,15 +756,15 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
         // VOICE1/10 create a start voice frame
         case DFSIFrameType::LDU1_VOICE1:
         {
-            MotStartVoiceFrame svf = MotStartVoiceFrame(dfsiData);
-            ::memcpy(m_rxCall->netLDU1 + 10U, svf.fullRateVoice->imbeData, RAW_IMBE_LENGTH_BYTES);
+            MotVoiceFrameView voice = MotVoiceFrameView(dfsiData);
+            ::memcpy(m_rxCall->netLDU1 + 10U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
             m_rxCall->n++;
         }
         break;
         case DFSIFrameType::LDU2_VOICE10:
         {
-            MotStartVoiceFrame svf = MotStartVoiceFrame(dfsiData);
-            ::memcpy(m_rxCall->netLDU2 + 10U, svf.fullRateVoice->imbeData, RAW_IMBE_LENGTH_BYTES);
+            MotVoiceFrameView voice = MotVoiceFrameView(dfsiData);
+            ::memcpy(m_rxCall->netLDU2 + 10U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
             m_rxCall->n++;
         }
         break;
@@ -714,7 +772,8 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
         case DFSIFrameType::PDU:
         {
             // bryanb: this is gonna be a complete clusterfuck...
-            MotPDUFrame pf = MotPDUFrame(dfsiData);
+            MotPDUFrame pf = MotPDUFrame();
+            pf.decode(dfsiData);
             data::DataHeader dataHeader = data::DataHeader();
             if (!dataHeader.decode(pf.pduHeaderData, true)) {
                 LogError(LOG_MODEM, "V.24/DFSI traffic failed to decode PDU FEC");
@@ -779,7 +838,8 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
 
         case DFSIFrameType::TSBK:
         {
-            MotTSBKFrame tf = MotTSBKFrame(dfsiData);
+            MotTSBKFrame tf = MotTSBKFrame();
+            tf.decode(dfsiData);
             lc::tsbk::OSP_TSBK_RAW tsbk = lc::tsbk::OSP_TSBK_RAW();
             if (!tsbk.decode(tf.tsbkData, true)) {
                 LogError(LOG_MODEM, "V.24/DFSI traffic failed to decode TSBK FEC");
@@ -815,20 +875,21 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
         // The remaining LDUs all create full rate voice frames so we do that here
         default:
         {
-            MotFullRateVoice voice = MotFullRateVoice(dfsiData);
+            MotVoiceFrameView voice = MotVoiceFrameView(dfsiData);
+            const uint8_t* additionalData = voice.getAdditionalData();
             switch (frameType) {
                 case DFSIFrameType::LDU1_VOICE2:
                 {
-                    ::memcpy(m_rxCall->netLDU1 + 26U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
+                    ::memcpy(m_rxCall->netLDU1 + 26U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
                 }
                 break;
                 case DFSIFrameType::LDU1_VOICE3:
                 {
-                    ::memcpy(m_rxCall->netLDU1 + 55U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
-                    if (voice.additionalData != nullptr) {
-                        m_rxCall->lco = voice.additionalData[0U];
-                        m_rxCall->mfId = voice.additionalData[1U];
-                        m_rxCall->serviceOptions = voice.additionalData[2U];
+                    ::memcpy(m_rxCall->netLDU1 + 55U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+                    if (additionalData != nullptr) {
+                        m_rxCall->lco = additionalData[0U];
+                        m_rxCall->mfId = additionalData[1U];
+                        m_rxCall->serviceOptions = additionalData[2U];
                     } else {
                         LogWarning(LOG_MODEM, "V.24/DFSI VC3 traffic missing metadata");
                     }
@@ -836,9 +897,9 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
                 break;
                 case DFSIFrameType::LDU1_VOICE4:
                 {
-                    ::memcpy(m_rxCall->netLDU1 + 80U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
-                    if (voice.additionalData != nullptr) {
-                        m_rxCall->dstId = __GET_UINT16(voice.additionalData, 0U);
+                    ::memcpy(m_rxCall->netLDU1 + 80U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+                    if (additionalData != nullptr) {
+                        m_rxCall->dstId = __GET_UINT16(additionalData, 0U);
                     } else {
                         LogWarning(LOG_MODEM, "V.24/DFSI VC4 traffic missing metadata");
                     }
@@ -846,9 +907,9 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
                 break;
                 case DFSIFrameType::LDU1_VOICE5:
                 {
-                    ::memcpy(m_rxCall->netLDU1 + 105U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
-                    if (voice.additionalData != nullptr) {
-                        m_rxCall->srcId = __GET_UINT16(voice.additionalData, 0U);
+                    ::memcpy(m_rxCall->netLDU1 + 105U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+                    if (additionalData != nullptr) {
+                        m_rxCall->srcId = __GET_UINT16(additionalData, 0U);
                     } else {
                         LogWarning(LOG_MODEM, "V.24/DFSI VC5 traffic missing metadata");
                     }
@@ -856,25 +917,25 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
                 break;
                 case DFSIFrameType::LDU1_VOICE6:
                 {
-                    ::memcpy(m_rxCall->netLDU1 + 130U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
+                    ::memcpy(m_rxCall->netLDU1 + 130U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
                 }
                 break;
                 case DFSIFrameType::LDU1_VOICE7:
                 {
-                    ::memcpy(m_rxCall->netLDU1 + 155U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
+                    ::memcpy(m_rxCall->netLDU1 + 155U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
                 }
                 break;
                 case DFSIFrameType::LDU1_VOICE8:
                 {
-                    ::memcpy(m_rxCall->netLDU1 + 180U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
+                    ::memcpy(m_rxCall->netLDU1 + 180U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
                 }
                 break;
                 case DFSIFrameType::LDU1_VOICE9:
                 {
-                    ::memcpy(m_rxCall->netLDU1 + 204U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
-                    if (voice.additionalData != nullptr) {
-                        m_rxCall->lsd1 = voice.additionalData[0U];
-                        m_rxCall->lsd2 = voice.additionalData[1U];
+                    ::memcpy(m_rxCall->netLDU1 + 204U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+                    if (additionalData != nullptr) {
+                        m_rxCall->lsd1 = additionalData[0U];
+                        m_rxCall->lsd2 = additionalData[1U];
                     } else {
                         LogWarning(LOG_MODEM, "V.24/DFSI VC9 traffic missing metadata");
                     }
@@ -882,14 +943,14 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
                 break;
                 case DFSIFrameType::LDU2_VOICE11:
                 {
-                    ::memcpy(m_rxCall->netLDU2 + 26U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
+                    ::memcpy(m_rxCall->netLDU2 + 26U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
                 }
                 break;
                 case DFSIFrameType::LDU2_VOICE12:
                 {
-                    ::memcpy(m_rxCall->netLDU2 + 55U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
-                    if (voice.additionalData != nullptr) {
-                        ::memcpy(m_rxCall->MI, voice.additionalData, 3U);
+                    ::memcpy(m_rxCall->netLDU2 + 55U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+                    if (additionalData != nullptr) {
+                        ::memcpy(m_rxCall->MI, additionalData, 3U);
                     } else {
                         LogWarning(LOG_MODEM, "V.24/DFSI VC12 traffic missing metadata");
                     }
@@ -897,9 +958,9 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
                 break;
                 case DFSIFrameType::LDU2_VOICE13:
                 {
-                    ::memcpy(m_rxCall->netLDU2 + 80U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
-                    if (voice.additionalData != nullptr) {
-                        ::memcpy(m_rxCall->MI + 3U, voice.additionalData, 3U);
+                    ::memcpy(m_rxCall->netLDU2 + 80U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+                    if (additionalData != nullptr) {
+                        ::memcpy(m_rxCall->MI + 3U, additionalData, 3U);
                     } else {
                         LogWarning(LOG_MODEM, "V.24/DFSI VC13 traffic missing metadata");
                     }
@@ -907,9 +968,9 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
                 break;
                 case DFSIFrameType::LDU2_VOICE14:
                 {
-                    ::memcpy(m_rxCall->netLDU2 + 105U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
-                    if (voice.additionalData != nullptr) {
-                        ::memcpy(m_rxCall->MI + 6U, voice.additionalData, 3U);
+                    ::memcpy(m_rxCall->netLDU2 + 105U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+                    if (additionalData != nullptr) {
+                        ::memcpy(m_rxCall->MI + 6U, additionalData, 3U);
                     } else {
                         LogWarning(LOG_MODEM, "V.24/DFSI VC14 traffic missing metadata");
                     }
@@ -917,10 +978,10 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
                 break;
                 case DFSIFrameType::LDU2_VOICE15:
                 {
-                    ::memcpy(m_rxCall->netLDU2 + 130U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
-                    if (voice.additionalData != nullptr) {
-                        m_rxCall->algoId = voice.additionalData[0U];
-                        m_rxCall->kId = __GET_UINT16B(voice.additionalData, 1U);
+                    ::memcpy(m_rxCall->netLDU2 + 130U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+                    if (additionalData != nullptr) {
+                        m_rxCall->algoId = additionalData[0U];
+                        m_rxCall->kId = __GET_UINT16B(additionalData, 1U);
                     } else {
                         LogWarning(LOG_MODEM, "V.24/DFSI VC15 traffic missing metadata");
                     }
@@ -928,20 +989,20 @@ void ModemV24::convertToAir(const uint8_t *data, uint32_t length)
                 break;
                 case DFSIFrameType::LDU2_VOICE16:
                 {
-                    ::memcpy(m_rxCall->netLDU2 + 155U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
+                    ::memcpy(m_rxCall->netLDU2 + 155U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
                 }
                 break;
                 case DFSIFrameType::LDU2_VOICE17:
                 {
-                    ::memcpy(m_rxCall->netLDU2 + 180U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
+                    ::memcpy(m_rxCall->netLDU2 + 180U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
                 }
                 break;
                 case DFSIFrameType::LDU2_VOICE18:
                 {
-                    ::memcpy(m_rxCall->netLDU2 + 204U, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
-                    if (voice.additionalData != nullptr) {
-                        m_rxCall->lsd1 = voice.additionalData[0U];
-                        m_rxCall->lsd2 = voice.additionalData[1U];
+                    ::memcpy(m_rxCall->netLDU2 + 204U, voice.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+                    if (additionalData != nullptr) {
+                        m_rxCall->lsd1 = additionalData[0U];
+                        m_rxCall->lsd2 = additionalData[1U];
                     } else {
                         LogWarning(LOG_MODEM, "V.24/DFSI VC18 traffic missing metadata");
                     }
@@ -1093,15 +1154,16 @@ void ModemV24::queueP25Frame(uint8_t* data, uint16_t len, SERIAL_TX_TYPE msgType
     if (m_trace)
         Utils::dump(1U, "ModemV24::queueP25Frame() data", data, len);
 
-    // get current time in ms
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    // get current monotonic time in us
+    uint64_t now = mono::nowUS();
+    uint64_t jitter = m_jitter * 1000ULL;
 
-    // timestamp for this message (in ms)
+    // timestamp for this message (in us)
     uint64_t msgTime = 0U;
 
-    // if this is our first message, timestamp is just now + the jitter buffer offset in ms
+    // if this is our first message, timestamp is just now + the jitter buffer offset
     if (m_lastP25Tx == 0U) {
-        msgTime = now + m_jitter;
+        msgTime = now + jitter;
 
         // if the message type requests no jitter delay -- just set the message time to now
         if (msgType == STT_NON_IMBE_NO_JITTER)
@@ -1110,53 +1172,54 @@ void ModemV24::queueP25Frame(uint8_t* data, uint16_t len, SERIAL_TX_TYPE msgType
     // if we had a message before this, calculate the new timestamp dynamically
     else {
         // if the last message occurred longer than our jitter buffer delay, we restart the sequence and calculate the same as above
-        if ((int64_t)(now - m_lastP25Tx) > m_jitter) {
-            msgTime = now + m_jitter;
+        if (now > m_lastP25Tx && (now - m_lastP25Tx) > jitter) {
+            msgTime = now + jitter;
         }
         // otherwise, we time out messages as required by the message type
         else {
             if (msgType == STT_IMBE) {
                 // IMBEs must go out at 20ms intervals
-                msgTime = m_lastP25Tx + 20U;
+                msgTime = m_lastP25Tx + IMBE_FRAME_SPACING_US;
             } else {
                 // Otherwise we don't care, we use 5ms since that's the theoretical minimum time a 9600 baud message can take
-                msgTime = m_lastP25Tx + 5U;
+                msgTime = m_lastP25Tx + NON_IMBE_FRAME_SPACING_US;
             }
         }
     }
 
     len += 4U;
 
-    // convert 16-bit length to 2 bytes
-    uint8_t length[2U];
-    if (len > 255U)
-        length[0U] = (len >> 8U) & 0xFFU;
-    else
-        length[0U] = 0x00U;
-    length[1U] = len & 0xFFU;
-
-    m_txP25Queue.addData(length, 2U);
-
-    // add the data tag
-    uint8_t tag = TAG_DATA;
-    m_txP25Queue.addData(&tag, 1U);
-
-    // convert 64-bit timestamp to 8 bytes and add
-    uint8_t tsBytes[8U];
-    assert(sizeof msgTime == 8U);
-    ::memcpy(tsBytes, &msgTime, 8U);
-    m_txP25Queue.addData(tsBytes, 8U);
+    DFSITxFrame frame;
+    frame.timestamp = msgTime;
+    frame.msgType = msgType;
+    frame.length = len;
+    frame.data = std::make_unique<uint8_t[]>(len);
 
     // add the DVM start byte, length byte, CMD byte, and padding 0
-    uint8_t header[4U];
-    header[0U] = DVM_SHORT_FRAME_START;
-    header[1U] = len & 0xFFU;
-    header[2U] = CMD_P25_DATA;
-    header[3U] = 0x00U;
-    m_txP25Queue.addData(header, 4U);
+    uint8_t* buffer = frame.data.get();
+    buffer[0U] = DVM_SHORT_FRAME_START;
+    buffer[1U] = len & 0xFFU;
+    buffer[2U] = CMD_P25_DATA;
+    buffer[3U] = 0x00U;
 
     // add the data
-    m_txP25Queue.addData(data, len - 4U);
+    ::memcpy(buffer + 4U, data, len - 4U);
+
+    // scope is intentional
+    {
+        std::lock_guard<std::mutex> lock(m_txQueueLock);
+        if (m_txP25QueueBytes + len > m_txP25QueueSize) {
+            LogError(LOG_MODEM, "**** Overflow in TX P25 queue, %u > %u, clearing the queue", len, m_txP25QueueSize - m_txP25QueueBytes);
+            m_txP25Queue.clear();
+            m_txP25QueueBytes = 0U;
+            return;
+        }
+
+        m_txP25Queue.push_back(std::move(frame));
+        m_txP25QueueBytes += len;
+    }
+
+    m_txQueueSignal.notify_one();
 
     // update the last message time
     m_lastP25Tx = msgTime;
@@ -1453,148 +1516,27 @@ void ModemV24::convertFromAir(uint8_t* data, uint32_t length)
             m_rs.encode24169(rs);
         }
 
-        for (int n = 0; n < 9; n++) {
-            uint8_t* buffer = nullptr;
-            uint16_t bufferSize = 0;
-            MotFullRateVoice voice = MotFullRateVoice();
-
-            switch (n) {
-                case 0: // VOICE1/10
-                {
-                    voice.setFrameType((duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE1 : DFSIFrameType::LDU2_VOICE10);
-
-                    MotStartVoiceFrame svf = MotStartVoiceFrame();
-                    svf.startOfStream->setStartStop(StartStopFlag::START);
-                    svf.startOfStream->setRT(m_rtrt ? RTFlag::ENABLED : RTFlag::DISABLED);
-                    svf.fullRateVoice->setFrameType(voice.getFrameType());
-                    svf.fullRateVoice->setSource(m_diu ? SourceFlag::DIU : SourceFlag::QUANTAR);
-                    svf.setICW(m_diu ? ICWFlag::DIU : ICWFlag::QUANTAR);
-
-                    ::memcpy(svf.fullRateVoice->imbeData, ldu + 10U, RAW_IMBE_LENGTH_BYTES);
-
-                    buffer = new uint8_t[MotStartVoiceFrame::LENGTH];
-                    ::memset(buffer, 0x00U, MotStartVoiceFrame::LENGTH);
-                    svf.encode(buffer);
-                    bufferSize = MotStartVoiceFrame::LENGTH;
-                }
-                break;
-                case 1: // VOICE2/11
-                {
-                    voice.setFrameType((duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE2 : DFSIFrameType::LDU2_VOICE11);
-                    voice.setSource(m_diu ? SourceFlag::DIU : SourceFlag::QUANTAR);
-                    ::memcpy(voice.imbeData, ldu + 26U, RAW_IMBE_LENGTH_BYTES);
-                }
-                break;
-                case 2: // VOICE3/12
-                {
-                    voice.setFrameType((duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE3 : DFSIFrameType::LDU2_VOICE12);
-                    ::memcpy(voice.imbeData, ldu + 55U, RAW_IMBE_LENGTH_BYTES);
-
-                    voice.additionalData = new uint8_t[voice.ADDITIONAL_LENGTH];
-                    ::memset(voice.additionalData, 0x00U, voice.ADDITIONAL_LENGTH);
-
-                    // copy additional data
-                    voice.additionalData[0U] = rs[0U];
-                    voice.additionalData[1U] = rs[1U];
-                    voice.additionalData[2U] = rs[2U];
-                }
-                break;
-                case 3: // VOICE4/13
-                {
-                    voice.setFrameType((duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE4 : DFSIFrameType::LDU2_VOICE13);
-                    ::memcpy(voice.imbeData, ldu + 80U, RAW_IMBE_LENGTH_BYTES);
-
-                    voice.additionalData = new uint8_t[voice.ADDITIONAL_LENGTH];
-                    ::memset(voice.additionalData, 0x00U, voice.ADDITIONAL_LENGTH);
-
-                    // copy additional data
-                    voice.additionalData[0U] = rs[3U];
-                    voice.additionalData[1U] = rs[4U];
-                    voice.additionalData[2U] = rs[5U];
-                }
-                break;
-                case 4: // VOICE5/14
-                {
-                    voice.setFrameType((duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE5 : DFSIFrameType::LDU2_VOICE14);
-                    ::memcpy(voice.imbeData, ldu + 105U, RAW_IMBE_LENGTH_BYTES);
-
-                    voice.additionalData = new uint8_t[voice.ADDITIONAL_LENGTH];
-                    ::memset(voice.additionalData, 0x00U, voice.ADDITIONAL_LENGTH);
-
-                    voice.additionalData[0U] = rs[6U];
-                    voice.additionalData[1U] = rs[7U];
-                    voice.additionalData[2U] = rs[8U];
-                }
-                break;
-                case 5: // VOICE6/15
-                {
-                    voice.setFrameType((duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE6 : DFSIFrameType::LDU2_VOICE15);
-                    ::memcpy(voice.imbeData, ldu + 130U, RAW_IMBE_LENGTH_BYTES);
-
-                    voice.additionalData = new uint8_t[voice.ADDITIONAL_LENGTH];
-                    ::memset(voice.additionalData, 0x00U, voice.ADDITIONAL_LENGTH);
-
-                    voice.additionalData[0U] = rs[9U];
-                    voice.additionalData[1U] = rs[10U];
-                    voice.additionalData[2U] = rs[11U];
-                }
-                break;
-                case 6: // VOICE7/16
-                {
-                    voice.setFrameType((duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE7 : DFSIFrameType::LDU2_VOICE16);
-                    ::memcpy(voice.imbeData, ldu + 155U, RAW_IMBE_LENGTH_BYTES);
-
-                    voice.additionalData = new uint8_t[voice.ADDITIONAL_LENGTH];
-                    ::memset(voice.additionalData, 0x00U, voice.ADDITIONAL_LENGTH);
-
-                    voice.additionalData[0U] = rs[12U];
-                    voice.additionalData[1U] = rs[13U];
-                    voice.additionalData[2U] = rs[14U];
-                }
-                break;
-                case 7: // VOICE8/17
-                {
-                    voice.setFrameType((duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE8 : DFSIFrameType::LDU2_VOICE17);
-                    ::memcpy(voice.imbeData, ldu + 180U, RAW_IMBE_LENGTH_BYTES);
-
-                    voice.additionalData = new uint8_t[voice.ADDITIONAL_LENGTH];
-                    ::memset(voice.additionalData, 0x00U, voice.ADDITIONAL_LENGTH);
-
-                    voice.additionalData[0U] = rs[15U];
-                    voice.additionalData[1U] = rs[16U];
-                    voice.additionalData[2U] = rs[17U];
-                }
-                break;
-                case 8: // VOICE9/18
-                {
-                    voice.setFrameType((duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE9 : DFSIFrameType::LDU2_VOICE18);
-                    ::memcpy(voice.imbeData, ldu + 204U, RAW_IMBE_LENGTH_BYTES);
-
-                    voice.additionalData = new uint8_t[voice.ADDITIONAL_LENGTH];
-                    ::memset(voice.additionalData, 0x00U, voice.ADDITIONAL_LENGTH);
-
-                    voice.additionalData[0U] = lsd.getLSD1();
-                    voice.additionalData[1U] = lsd.getLSD2();
-                }
-                break;
-            }
-
-            // For n=0 (VHDR1/10) case we create the buffer in the switch, for all other frame types we do that here
-            if (n != 0) {
-                buffer = new uint8_t[voice.size()];
-                ::memset(buffer, 0x00U, voice.size());
-                voice.encode(buffer);
-                bufferSize = voice.size();
+        // encode all 9 voice frames of the superframe in one pass
+        MotLDUSuperframe superframe = MotLDUSuperframe();
+        superframe.setDUID(duid);
+        superframe.setRT(m_rtrt ? RTFlag::ENABLED : RTFlag::DISABLED);
+        superframe.setICW(m_diu ? ICWFlag::DIU : ICWFlag::QUANTAR);
+        superframe.setSource(m_diu ? SourceFlag::DIU : SourceFlag::QUANTAR);
+        superframe.setRS(rs);
+        superframe.setLSD1(lsd.getLSD1());
+        superframe.setLSD2(lsd.getLSD2());
+
+        uint8_t buffer[MotLDUSuperframe::LENGTH];
+        superframe.encode(buffer, ldu);
+
+        for (uint8_t n = 0U; n < MotLDUSuperframe::FRAME_COUNT; n++) {
+            uint8_t* frame = buffer + MotLDUSuperframe::frameOffset(n);
+            uint32_t frameLength = MotLDUSuperframe::frameLength(n);
+            if (m_trace) {
+                Utils::dump("ModemV24::convertFromAir() Encoded V.24 Voice Frame Data", frame, frameLength);
             }
 
-            if (buffer != nullptr) {
-                if (m_trace) {
-                    Utils::dump("ModemV24::convertFromAir() Encoded V.24 Voice Frame Data", buffer, bufferSize);
-                }
-
-                queueP25Frame(buffer, bufferSize, STT_IMBE);
-                delete[] buffer;
-            }
+            queueP25Frame(frame, frameLength, STT_IMBE);
         }
     }
 }
@@ -18,6 +18,8 @@
 
 #include "Defines.h"
 #include "common/edac/RS634717.h"
+#include "common/JitterHistogram.h"
+#include "common/Thread.h"
 #include "common/p25/dfsi/frames/MotVoiceHeader1.h"
 #include "common/p25/dfsi/frames/MotVoiceHeader2.h"
 #include "common/p25/lc/LC.h"
@@ -25,6 +27,11 @@
 #include "common/p25/NID.h"
 #include "modem/Modem.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
 namespace modem
 {
     // ---------------------------------------------------------------------------
@@ -49,6 +56,21 @@ namespace modem
 
     /** @} */
 
+    // ---------------------------------------------------------------------------
+    //  Structure Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Represents a V.24 frame waiting in the Tx scheduler.
+     * @ingroup modem
+     */
+    struct DFSITxFrame {
+        uint64_t timestamp;                 //! Monotonic time (in microseconds) the frame is due to be sent.
+        SERIAL_TX_TYPE msgType;             //! Type of message.
+        uint16_t length;                    //! Length of frame data.
+        UInt8Array data;                    //! Frame data.
+    };
+
     // ---------------------------------------------------------------------------
     //  Class Declaration
     // ---------------------------------------------------------------------------
@@ -292,6 +314,12 @@ namespace modem
          */
         int write(const uint8_t* data, uint32_t length) override;
 
+        /**
+         * @brief Gets the inter-frame spacing error statistics for transmitted IMBE voice frames.
+         * @returns JitterHistogram& Inter-frame spacing error statistics (in microseconds).
+         */
+        const JitterHistogram& getTxJitter() const { return m_txJitter; }
+
     private:
         bool m_rtrt;
         bool m_diu;
@@ -300,7 +328,17 @@ namespace modem
 
         p25::NID* m_nid;
 
-        RingBuffer<uint8_t> m_txP25Queue;
+        std::deque<DFSITxFrame> m_txP25Queue;
+        uint32_t m_txP25QueueSize;
+        uint32_t m_txP25QueueBytes;
+        std::mutex m_txQueueLock;
+        std::condition_variable m_txQueueSignal;
+
+        thread_t* m_txThread;
+        std::atomic<bool> m_txThreadRunning;
+
+        JitterHistogram m_txJitter;
+        uint64_t m_lastIMBETx;
 
         DFSICallData* m_txCall;
         DFSICallData* m_rxCall;
@@ -317,10 +355,21 @@ namespace modem
         edac::RS634717 m_rs;
 
         /**
-         * @brief Helper to write data from the P25 Tx queue to the serial interface.
+         * @brief Entry point to the P25 Tx scheduler thread.
+         * @param arg Instance of the thread_t structure.
+         * @returns void* (Ignore)
+         */
+        static void* threadTxScheduler(void* arg);
+        /**
+         * @brief Helper to write a scheduled frame to the serial interface.
+         * @param frame Frame to write.
          * @return int Actual number of bytes written to the serial interface.
          */
-        int writeSerial();
+        int writeSerial(const DFSITxFrame& frame);
+        /**
+         * @brief Helper to clear the P25 Tx queue.
+         */
+        void clearTxQueue();
 
         /**
          * @brief Helper to store converted Rx frames.
@@ -71,6 +71,7 @@ Network::Network(const std::string& address, uint16_t port, uint16_t localPort,
     m_restApiPort(0),
     m_conventional(false),
     m_remotePeerId(0U),
+    m_masterFlags(0U),
     m_promiscuousPeer(false)
 {
     assert(!address.empty());
@@ -577,7 +578,9 @@ void Network::clock(uint32_t ms)
                         m_timeoutTimer.start();
                         m_retryTimer.start();
 
+                        m_masterFlags = 0x00U;
                         if (length > 6) {
+                            m_masterFlags = buffer[6U];
                             m_useAlternatePortForDiagnostics = (buffer[6U] & 0x80U) == 0x80U;
                             if (m_useAlternatePortForDiagnostics) {
                                 LogMessage(LOG_NET, "PEER %u RPTC ACK, master commanded alternate port for diagnostics and activity logging, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
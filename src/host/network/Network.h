@@ -210,6 +210,7 @@ namespace network
         bool m_conventional;
 
         uint32_t m_remotePeerId;
+        uint8_t m_masterFlags;
 
         bool m_promiscuousPeer;
 
@@ -107,6 +107,7 @@ Control::Control(bool authoritative, uint32_t ran, uint32_t callHang, uint32_t q
     m_ccFrameCnt(0U),
     m_ccSeq(0U),
     m_siteData(),
+    m_siteGeneration(0U),
     m_rssiMapper(rssiMapper),
     m_rssi(0U),
     m_maxRSSI(0U),
@@ -287,6 +288,7 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, const std::string cw
 
     lc::RCCH::setSiteData(m_siteData);
     lc::RCCH::setCallsign(cwCallsign);
+    m_siteGeneration++;
 
     std::vector<lookups::IdenTable> entries = m_idenTable->list();
     for (auto entry : entries) {
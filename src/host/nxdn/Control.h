@@ -329,6 +329,7 @@ namespace nxdn
         uint8_t m_ccSeq;
 
         SiteData m_siteData;
+        uint32_t m_siteGeneration;
 
         lookups::RSSIInterpolator* m_rssiMapper;
         uint8_t m_rssi;
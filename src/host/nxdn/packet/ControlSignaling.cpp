@@ -296,9 +296,12 @@ ControlSignaling::ControlSignaling(Control* nxdn, bool debug, bool verbose) :
     m_disableGrantSrcIdCheck(false),
     m_lastRejectId(0U),
     m_verbose(verbose),
-    m_debug(debug)
+    m_debug(debug),
+    m_siteInfoBurst(),
+    m_srvInfoBurst()
 {
-    /* stub */
+    m_siteInfoBurst.valid = false;
+    m_srvInfoBurst.valid = false;
 }
 
 /* Finalizes a instance of the ControlSignaling class. */
@@ -733,7 +736,22 @@ void ControlSignaling::writeRF_Message_U_Reg_Rsp(uint32_t srcId, uint32_t locId)
 
 void ControlSignaling::writeRF_CC_Message_Site_Info()
 {
-    uint8_t data[NXDN_FRAME_LENGTH_BYTES + 2U];
+    // the broadcast only changes when the site data does; reuse the pre-encoded burst if possible
+    if (!m_siteInfoBurst.valid || m_siteInfoBurst.generation != m_nxdn->m_siteGeneration) {
+        encodeRF_CC_Message_Site_Info(m_siteInfoBurst.data);
+        m_siteInfoBurst.generation = m_nxdn->m_siteGeneration;
+        m_siteInfoBurst.valid = true;
+    }
+
+    if (m_nxdn->m_duplex) {
+        m_nxdn->addFrame(m_siteInfoBurst.data);
+    }
+}
+
+/* Helper to encode a CC SITE_INFO broadcast packet. */
+
+void ControlSignaling::encodeRF_CC_Message_Site_Info(uint8_t* data)
+{
     ::memset(data + 2U, 0x00U, NXDN_FRAME_LENGTH_BYTES);
 
     Sync::addNXDNSync(data + 2U);
@@ -771,17 +789,28 @@ void ControlSignaling::writeRF_CC_Message_Site_Info()
 
     NXDNUtils::scrambler(data + 2U);
     NXDNUtils::addPostBits(data + 2U);
+}
+
+/* Helper to write a CC SRV_INFO broadcast packet on the RF interface. */
+
+void ControlSignaling::writeRF_CC_Message_Service_Info()
+{
+    // the broadcast only changes when the site data does; reuse the pre-encoded burst if possible
+    if (!m_srvInfoBurst.valid || m_srvInfoBurst.generation != m_nxdn->m_siteGeneration) {
+        encodeRF_CC_Message_Service_Info(m_srvInfoBurst.data);
+        m_srvInfoBurst.generation = m_nxdn->m_siteGeneration;
+        m_srvInfoBurst.valid = true;
+    }
 
     if (m_nxdn->m_duplex) {
-        m_nxdn->addFrame(data);
+        m_nxdn->addFrame(m_srvInfoBurst.data);
     }
 }
 
-/* Helper to write a CC SRV_INFO broadcast packet on the RF interface. */
+/* Helper to encode a CC SRV_INFO broadcast packet. */
 
-void ControlSignaling::writeRF_CC_Message_Service_Info()
+void ControlSignaling::encodeRF_CC_Message_Service_Info(uint8_t* data)
 {
-    uint8_t data[NXDN_FRAME_LENGTH_BYTES + 2U];
     ::memset(data + 2U, 0x00U, NXDN_FRAME_LENGTH_BYTES);
 
     Sync::addNXDNSync(data + 2U);
@@ -814,8 +843,4 @@ void ControlSignaling::writeRF_CC_Message_Service_Info()
 
     NXDNUtils::scrambler(data + 2U);
     NXDNUtils::addPostBits(data + 2U);
-
-    if (m_nxdn->m_duplex) {
-        m_nxdn->addFrame(data);
-    }
 }
@@ -89,6 +89,17 @@ namespace nxdn
             bool m_verbose;
             bool m_debug;
 
+            /**
+             * @brief Represents a pre-encoded CC broadcast burst.
+             */
+            struct BcastBurst {
+                bool valid;             //! Flag indicating the burst has been encoded
+                uint32_t generation;    //! Site generation the burst was encoded for
+                uint8_t data[defines::NXDN_FRAME_LENGTH_BYTES + 2U];
+            };
+            BcastBurst m_siteInfoBurst;
+            BcastBurst m_srvInfoBurst;
+
             /**
              * @brief Initializes a new instance of the ControlSignaling class.
              * @param nxdn Instance of the Control class.
@@ -176,10 +187,20 @@ namespace nxdn
              * @brief Helper to write a CC SITE_INFO broadcast packet on the RF interface.
              */
             void writeRF_CC_Message_Site_Info();
+            /**
+             * @brief Helper to encode a CC SITE_INFO broadcast packet.
+             * @param[out] data Buffer to encode the modem frame into (NXDN_FRAME_LENGTH_BYTES + 2).
+             */
+            void encodeRF_CC_Message_Site_Info(uint8_t* data);
             /**
              * @brief Helper to write a CC SRV_INFO broadcast packet on the RF interface.
              */
             void writeRF_CC_Message_Service_Info();
+            /**
+             * @brief Helper to encode a CC SRV_INFO broadcast packet.
+             * @param[out] data Buffer to encode the modem frame into (NXDN_FRAME_LENGTH_BYTES + 2).
+             */
+            void encodeRF_CC_Message_Service_Info(uint8_t* data);
         };
     } // namespace packet
 } // namespace nxdn
@@ -1254,6 +1254,7 @@ ControlSignaling::ControlSignaling(Control* p25, bool dumpTSBKData, bool debug,
     m_sccbTable(),
     m_sccbUpdateCnt(),
     m_llaDemandTable(),
+    m_ctrlTSBKPool(),
     m_lastMFID(MFG_STANDARD),
     m_noStatusAck(false),
     m_noMessageAck(true),
@@ -1283,6 +1284,7 @@ ControlSignaling::ControlSignaling(Control* p25, bool dumpTSBKData, bool debug,
     m_sccbUpdateCnt.clear();
 
     m_llaDemandTable.clear();
+    m_ctrlTSBKPool.clear();
 
     m_adjSiteUpdateInterval = ADJ_SITE_TIMER_TIMEOUT;
     m_adjSiteUpdateTimer.setTimeout(m_adjSiteUpdateInterval);
@@ -1896,7 +1898,7 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
     if (!m_p25->m_enableControl)
         return;
 
-    std::unique_ptr<lc::TSBK> tsbk;
+    lc::TSBK* tsbk = nullptr;
 
     switch (lco) {
         case TSBKO::OSP_IDEN_UP:
@@ -1918,20 +1920,20 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
 
                         // handle 700/800/900 identities
                         if (entry.baseFrequency() >= 762000000U) {
-                            std::unique_ptr<OSP_IDEN_UP> osp = std::make_unique<OSP_IDEN_UP>();
+                            OSP_IDEN_UP* osp = getCtrlTSBK<OSP_IDEN_UP>(TSBKO::OSP_IDEN_UP, m_mbfIdenCnt);
                             DEBUG_LOG_TSBK(osp->toString());
                             osp->siteIdenEntry(entry);
 
                             // transmit channel ident broadcast
-                            tsbk = std::move(osp);
+                            tsbk = osp;
                         }
                         else {
-                            std::unique_ptr<OSP_IDEN_UP_VU> osp = std::make_unique<OSP_IDEN_UP_VU>();
+                            OSP_IDEN_UP_VU* osp = getCtrlTSBK<OSP_IDEN_UP_VU>(TSBKO::OSP_IDEN_UP_VU, m_mbfIdenCnt);
                             DEBUG_LOG_TSBK(osp->toString());
                             osp->siteIdenEntry(entry);
 
                             // transmit channel ident broadcast
-                            tsbk = std::move(osp);
+                            tsbk = osp;
                         }
 
                         m_mbfIdenCnt++;
@@ -1942,12 +1944,12 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
             break;
         case TSBKO::OSP_NET_STS_BCAST:
             // transmit net status burst
-            tsbk = std::make_unique<OSP_NET_STS_BCAST>();
+            tsbk = getCtrlTSBK<OSP_NET_STS_BCAST>(TSBKO::OSP_NET_STS_BCAST);
             DEBUG_LOG_TSBK(tsbk->toString());
             break;
         case TSBKO::OSP_RFSS_STS_BCAST:
             // transmit rfss status burst
-            tsbk = std::make_unique<OSP_RFSS_STS_BCAST>();
+            tsbk = getCtrlTSBK<OSP_RFSS_STS_BCAST>(TSBKO::OSP_RFSS_STS_BCAST);
             DEBUG_LOG_TSBK(tsbk->toString());
             break;
         case TSBKO::OSP_ADJ_STS_BCAST:
@@ -1956,7 +1958,7 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
                 if (m_mbfAdjSSCnt >= m_adjSiteTable.size())
                     m_mbfAdjSSCnt = 0U;
 
-                std::unique_ptr<OSP_ADJ_STS_BCAST> osp = std::make_unique<OSP_ADJ_STS_BCAST>();
+                OSP_ADJ_STS_BCAST* osp = getCtrlTSBK<OSP_ADJ_STS_BCAST>(TSBKO::OSP_ADJ_STS_BCAST, m_mbfAdjSSCnt);
                 DEBUG_LOG_TSBK(osp->toString());
 
                 uint8_t i = 0U;
@@ -1991,7 +1993,7 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
                         osp->setAdjSiteChnNo(site.channelNo());
                         osp->setAdjSiteSvcClass(site.serviceClass());
 
-                        tsbk = std::move(osp);
+                        tsbk = osp;
                         m_mbfAdjSSCnt++;
                         break;
                     }
@@ -2007,7 +2009,7 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
                 if (m_mbfSCCBCnt >= m_sccbTable.size())
                     m_mbfSCCBCnt = 0U;
 
-                std::unique_ptr<OSP_SCCB_EXP> osp = std::make_unique<OSP_SCCB_EXP>();
+                OSP_SCCB_EXP* osp = getCtrlTSBK<OSP_SCCB_EXP>(TSBKO::OSP_SCCB_EXP, m_mbfSCCBCnt);
                 DEBUG_LOG_TSBK(osp->toString());
 
                 uint8_t i = 0U;
@@ -2025,7 +2027,7 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
                         osp->setSCCBChnId1(site.channelId());
                         osp->setSCCBChnNo(site.channelNo());
 
-                        tsbk = std::move(osp);
+                        tsbk = osp;
                         m_mbfSCCBCnt++;
                         break;
                     }
@@ -2038,29 +2040,27 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
         case TSBKO::OSP_SNDCP_CH_ANN:
         {
             // transmit SNDCP announcement
-            std::unique_ptr<OSP_SNDCP_CH_ANN> osp = std::make_unique<OSP_SNDCP_CH_ANN>();
+            OSP_SNDCP_CH_ANN* osp = getCtrlTSBK<OSP_SNDCP_CH_ANN>(TSBKO::OSP_SNDCP_CH_ANN);
             osp->siteIdenEntry(m_p25->m_idenEntry);
-            if (!m_p25->m_sndcpSupport) {
-                osp->setImplicitChannel(true);
-            }
-            tsbk = std::move(osp);
+            osp->setImplicitChannel(!m_p25->m_sndcpSupport);
+            tsbk = osp;
             DEBUG_LOG_TSBK(tsbk->toString());
         }
         break;
         case TSBKO::OSP_SYNC_BCAST:
         {
             // transmit sync broadcast
-            std::unique_ptr<OSP_SYNC_BCAST> osp = std::make_unique<OSP_SYNC_BCAST>();
+            OSP_SYNC_BCAST* osp = getCtrlTSBK<OSP_SYNC_BCAST>(TSBKO::OSP_SYNC_BCAST);
             DEBUG_LOG_TSBK(osp->toString());
             osp->setMicroslotCount(m_microslotCount);
-            tsbk = std::move(osp);
+            tsbk = osp;
         }
         break;
         case TSBKO::OSP_TIME_DATE_ANN:
         {
             if (m_ctrlTimeDateAnn) {
                 // transmit time/date announcement
-                tsbk = std::make_unique<OSP_TIME_DATE_ANN>();
+                tsbk = getCtrlTSBK<OSP_TIME_DATE_ANN>(TSBKO::OSP_TIME_DATE_ANN);
                 DEBUG_LOG_TSBK(tsbk->toString());
             }
         }
@@ -2069,20 +2069,20 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
         /** Motorola CC data */
         case TSBKO::OSP_MOT_PSH_CCH:
             // transmit motorola PSH CCH burst
-            tsbk = std::make_unique<OSP_MOT_PSH_CCH>();
+            tsbk = getCtrlTSBK<OSP_MOT_PSH_CCH>(TSBKO::OSP_MOT_PSH_CCH);
             DEBUG_LOG_TSBK(tsbk->toString());
             break;
 
         case TSBKO::OSP_MOT_CC_BSI:
             // transmit motorola CC BSI burst
-            tsbk = std::make_unique<OSP_MOT_CC_BSI>();
+            tsbk = getCtrlTSBK<OSP_MOT_CC_BSI>(TSBKO::OSP_MOT_CC_BSI);
             DEBUG_LOG_TSBK(tsbk->toString());
             break;
 
         /** DVM CC data */
         case TSBKO::OSP_DVM_GIT_HASH:
             // transmit git hash burst
-            tsbk = std::make_unique<OSP_DVM_GIT_HASH>();
+            tsbk = getCtrlTSBK<OSP_DVM_GIT_HASH>(TSBKO::OSP_DVM_GIT_HASH);
             DEBUG_LOG_TSBK(tsbk->toString());
             break;
     }
@@ -2092,10 +2092,10 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
 
         // are we transmitting CC as a multi-block?
         if (m_ctrlTSDUMBF) {
-            writeRF_TSDU_MBF(tsbk.get());
+            writeRF_TSDU_MBF(tsbk);
         }
         else {
-            writeRF_TSDU_SBF(tsbk.get(), true);
+            writeRF_TSDU_SBF(tsbk, true);
         }
     }
 }
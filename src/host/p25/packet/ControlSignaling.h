@@ -183,6 +183,8 @@ namespace p25
 
             std::unordered_map<uint32_t, ulong64_t> m_llaDemandTable;
 
+            std::unordered_map<uint32_t, std::unique_ptr<lc::TSBK>> m_ctrlTSBKPool;
+
             uint8_t m_lastMFID;
 
             bool m_noStatusAck;
@@ -312,6 +314,27 @@ namespace p25
              * @param lco TSBK LCO to queue into the frame queue.
              */
             void queueRF_TSBK_Ctrl(uint8_t lco);
+            /**
+             * @brief Helper to get the pooled instance of a control TSBK.
+             *  Control TSBKs are repeatedly broadcast with largely unchanging content; reusing the same instance
+             *  avoids an allocation per broadcast and lets the TSBK reuse its previously encoded block.
+             * @tparam T TSBK type.
+             * @param lco TSBK LCO.
+             * @param index Index of the entry being broadcast (for broadcasts that cycle through a table).
+             * @returns T* Pooled instance of the TSBK.
+             */
+            template <class T>
+            T* getCtrlTSBK(uint8_t lco, uint16_t index = 0U)
+            {
+                uint32_t key = (lco << 16) | index;
+                auto it = m_ctrlTSBKPool.find(key);
+                if (it != m_ctrlTSBKPool.end())
+                    return static_cast<T*>(it->second.get());
+
+                T* tsbk = new T();
+                m_ctrlTSBKPool[key] = std::unique_ptr<lc::TSBK>(tsbk);
+                return tsbk;
+            }
 
             /**
              * @brief Helper to write a grant packet.
@@ -24,8 +24,14 @@ using namespace network::rest::http;
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <iomanip>
+#include <memory>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 // ---------------------------------------------------------------------------
 //  Constants
@@ -40,16 +46,23 @@ using namespace network::rest::http;
 #define ERRNO_NO_ADDRESS 404
 #define ERRNO_NO_PASSWORD 403
 
+#define REST_DEADLINE_INTERVAL 25
+
 // ---------------------------------------------------------------------------
 //  Static Class Members
 // ---------------------------------------------------------------------------
 
-bool RESTClient::m_responseAvailable = false;
-HTTPPayload RESTClient::m_response;
-
 bool RESTClient::m_console = false;
-bool RESTClient::m_enableSSL = false;
-bool RESTClient::m_debug = false;
+
+std::mutex RESTClient::m_sessionLock;
+std::map<std::string, std::shared_ptr<RESTClientSession>> RESTClient::m_sessions;
+
+// ---------------------------------------------------------------------------
+//  Global Variables
+// ---------------------------------------------------------------------------
+
+/** @brief Flag indicating the current thread is a REST client connection thread. */
+static thread_local bool t_connectionThread = false;
 
 // ---------------------------------------------------------------------------
 //  Global Functions
@@ -81,109 +94,312 @@ bool parseResponseBody(const HTTPPayload& response, json::object& obj)
 }
 
 // ---------------------------------------------------------------------------
-//  Public Class Members
+//  Class Declaration
 // ---------------------------------------------------------------------------
 
-/* Initializes a new instance of the RESTClient class. */
+/**
+ * @brief This class implements a persistent, authenticated connection to a REST API.
+ *
+ * Requests are written as soon as the session holds an authentication token and their responses
+ * are matched to them in order. The connection is re-established on demand after it is lost (for
+ * example when the server closes an idle connection); a GET that was written to a connection just
+ * as it was lost, or a request not yet written, is retried once on a new connection, and the session
+ * re-authenticates once when a request is rejected because its token is no longer valid.
+ *
+ * Every request has a deadline; a request not answered by its deadline is failed and the connection
+ * is dropped, as the responses pipelined behind it can no longer be matched.
+ * @ingroup remote_rest
+ */
+class HOST_SW_API RESTClientSession : public std::enable_shared_from_this<RESTClientSession> {
+public:
+    /**
+     * @brief Initializes a new instance of the RESTClientSession class.
+     * @param address Network Hostname/IP address to connect to.
+     * @param port Network port number.
+     * @param enableSSL Flag indicating whether or not HTTPS is enabled.
+     */
+    RESTClientSession(const std::string& address, uint32_t port, bool enableSSL) :
+        m_address(address),
+        m_port(port),
+        m_password(),
+        m_enableSSL(enableSSL),
+        m_debug(false),
+        m_client(nullptr),
+#if defined(ENABLE_TCP_SSL)
+        m_sslClient(nullptr),
+#endif // ENABLE_TCP_SSL
+        m_token(),
+        m_authPending(false),
+        m_generation(0U),
+        m_waiting(),
+        m_inflight(),
+        m_retired(),
+        m_lock(),
+        m_deadlineThread()
+    {
+        /* stub */
+    }
+    /**
+     * @brief Finalizes a instance of the RESTClientSession class.
+     */
+    ~RESTClientSession()
+    {
+        close();
+
+        if (m_deadlineThread.joinable()) {
+            // the deadline thread may itself have released the last reference to the session
+            if (m_deadlineThread.get_id() == std::this_thread::get_id()) {
+                m_deadlineThread.detach();
+            }
+            else {
+                m_deadlineThread.join();
+            }
+        }
+    }
 
-RESTClient::RESTClient(const std::string& address, uint32_t port, const std::string& password, bool enableSSL, bool debug) :
-    m_address(address),
-    m_port(port),
-    m_password(password)
-{
-    assert(!address.empty());
-    assert(port > 0U);
+    /**
+     * @brief Starts the thread enforcing request deadlines. The session must be owned by a shared pointer.
+     */
+    void start()
+    {
+        // the thread only holds the session while checking it, and stops once the session is released
+        std::weak_ptr<RESTClientSession> session = shared_from_this();
+        m_deadlineThread = std::thread([session]() {
+            while (true) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(REST_DEADLINE_INTERVAL));
+
+                std::vector<Completion> completions;
+                {
+                    std::shared_ptr<RESTClientSession> self = session.lock();
+                    if (self == nullptr) {
+                        return;
+                    }
+
+                    self->expire(completions);
+                    self->releaseRetired();
+                }
 
-    m_console = true;
-    m_enableSSL = enableSSL;
-    m_debug = debug;
-}
+                complete(completions);
+            }
+        });
+    }
 
-/* Finalizes a instance of the RESTClient class. */
+    /**
+     * @brief Queues a REST API request.
+     * @param password Authentication password.
+     * @param method REST API method.
+     * @param endpoint REST API endpoint.
+     * @param payload REST API endpoint payload.
+     * @param callback Callback invoked when the request completes.
+     * @param timeout Time (in milliseconds) the request must be answered in.
+     * @param debug Flag indicating whether debug is enabled.
+     */
+    void request(const std::string& password, const std::string& method, const std::string& endpoint, json::object payload,
+        RESTResponseCallback callback, int timeout, bool debug)
+    {
+        std::vector<Completion> completions;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_debug = debug;
+            if (m_password != password) {
+                m_password = password;
+                m_token = "";
+            }
 
-RESTClient::~RESTClient() = default;
+            PendingRequest req;
+            req.method = method;
+            req.endpoint = endpoint;
+            req.payload = payload;
+            req.callback = callback;
+            req.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+            req.auth = false;
+            req.retried = false;
+
+            // the token belongs to this host rather than the connection, and outlives a reconnect
+            if (!m_token.empty()) {
+                transmit(req, completions);
+            }
+            else {
+                m_waiting.push_back(req);
+                if (!m_authPending) {
+                    authenticate(completions);
+                }
+            }
+        }
 
-/* Sends remote control command to the specified modem. */
+        releaseRetired();
+        complete(completions);
+    }
 
-int RESTClient::send(const std::string method, const std::string endpoint, json::object payload)
-{
-    json::object rsp = json::object();
-    return send(method, endpoint, payload, rsp);
-}
+    /**
+     * @brief Closes the connection; outstanding requests are failed.
+     */
+    void close()
+    {
+        std::vector<Completion> completions;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            failAll(ERRNO_API_CALL_TIMEOUT, completions);
+            disconnect();
+        }
 
-/* Sends remote control command to the specified modem. */
+        releaseRetired();
+        complete(completions);
+    }
 
-int RESTClient::send(const std::string method, const std::string endpoint, json::object payload, json::object& response)
-{
-    return send(m_address, m_port, m_password, method, endpoint, payload, response, m_enableSSL, m_debug);
-}
+private:
+    typedef network::rest::BasicRequestDispatcher<HTTPPayload, HTTPPayload> RESTDispatcherType;
+
+    /**
+     * @brief Represents a queued REST API request.
+     */
+    struct PendingRequest {
+        std::string method;
+        std::string endpoint;
+        json::object payload;
+        RESTResponseCallback callback;
+        std::chrono::steady_clock::time_point deadline;
+        bool auth;
+        bool retried;
+    };
+
+    /**
+     * @brief Represents a completed request whose callback is still to be invoked.
+     */
+    struct Completion {
+        RESTResponseCallback callback;
+        int status;
+        json::object response;
+    };
+
+    std::string m_address;
+    uint32_t m_port;
+    std::string m_password;
+    bool m_enableSSL;
+    bool m_debug;
+
+    HTTPClient<RESTDispatcherType>* m_client;
+#if defined(ENABLE_TCP_SSL)
+    SecureHTTPClient<RESTDispatcherType>* m_sslClient;
+#endif // ENABLE_TCP_SSL
 
-/* Sends remote control command to the specified modem. */
+    std::string m_token;
+    bool m_authPending;
+    uint32_t m_generation;
 
-int RESTClient::send(const std::string& address, uint32_t port, const std::string& password, const std::string method,
-    const std::string endpoint, json::object payload, bool enableSSL, int timeout, bool debug)
-{
-    json::object rsp = json::object();
-    return send(address, port, password, method, endpoint, payload, rsp, enableSSL, timeout, debug);
-}
+    std::deque<PendingRequest> m_waiting;
+    std::deque<PendingRequest> m_inflight;
+    std::vector<std::function<void()>> m_retired;
 
-/* Sends remote control command to the specified modem. */
+    std::mutex m_lock;
 
-int RESTClient::send(const std::string& address, uint32_t port, const std::string& password, const std::string method,
-    const std::string endpoint, json::object payload, json::object& response, bool enableSSL, int timeout, bool debug)
-{
-    if (address.empty()) {
-        return ERRNO_NO_ADDRESS;
-    }
-    if (address == "0.0.0.0") {
-        return ERRNO_NO_ADDRESS;
-    }
-    if (port <= 0U) {
-        return ERRNO_NO_ADDRESS;
-    }
-    if (password.empty()) {
-        return ERRNO_NO_PASSWORD;
-    }
-
-    int ret = EXIT_SUCCESS;
-    m_enableSSL = enableSSL;
-    m_debug = debug;
+    std::thread m_deadlineThread;
 
-    typedef network::rest::BasicRequestDispatcher<network::rest::http::HTTPPayload, network::rest::http::HTTPPayload> RESTDispatcherType;
-    RESTDispatcherType m_dispatcher(RESTClient::responseHandler);
-    HTTPClient<RESTDispatcherType>* client = nullptr;
+    /**
+     * @brief Helper to determine if the session is connected (or connecting).
+     * @returns bool True, if the session is connected, otherwise false.
+     */
+    bool isConnected() const
+    {
 #if defined(ENABLE_TCP_SSL)
-    SecureHTTPClient<RESTDispatcherType>* sslClient = nullptr;
+        if (m_enableSSL) {
+            return m_sslClient != nullptr && m_sslClient->isConnected();
+        }
 #endif // ENABLE_TCP_SSL
+        return m_client != nullptr && m_client->isConnected();
+    }
 
-    try {
-        // setup HTTP client for authentication payload
+    /**
+     * @brief Helper to (re)open the connection. The session lock must be held.
+     * @returns bool True, if the connection was opened, otherwise false.
+     */
+    bool connect()
+    {
+        disconnect();
+
+        // a retired connection may still report a response or its loss; these are ignored
+        uint32_t generation = ++m_generation;
+        RESTDispatcherType dispatcher([this, generation](const HTTPPayload& response, HTTPPayload& reply) { responseHandler(generation, response); });
 #if defined(ENABLE_TCP_SSL)
         if (m_enableSSL) {
-            sslClient = new SecureHTTPClient<RESTDispatcherType>(address, port);
-            if (!sslClient->open()) {
-                delete sslClient;
-                return ERRNO_SOCK_OPEN;
+            m_sslClient = new SecureHTTPClient<RESTDispatcherType>(m_address, m_port);
+            m_sslClient->setHandler(dispatcher);
+            m_sslClient->setDisconnectHandler([this, generation]() { disconnected(generation); });
+            if (!m_sslClient->open()) {
+                delete m_sslClient;
+                m_sslClient = nullptr;
+                return false;
             }
-            sslClient->setHandler(m_dispatcher);
-        } else {
+
+            return true;
+        }
 #endif // ENABLE_TCP_SSL
-            client = new HTTPClient<RESTDispatcherType>(address, port);
-            if (!client->open()) {
-                delete client;
-                return ERRNO_SOCK_OPEN;
-            }
-            client->setHandler(m_dispatcher);
+        m_client = new HTTPClient<RESTDispatcherType>(m_address, m_port);
+        m_client->setHandler(dispatcher);
+        m_client->setDisconnectHandler([this, generation]() { disconnected(generation); });
+        if (!m_client->open()) {
+            delete m_client;
+            m_client = nullptr;
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Helper to detach the connection. The session lock must be held; the connection is
+     *  closed by releaseRetired() once the lock is released, as closing it waits for the connection
+     *  thread which may itself be waiting for the session lock.
+     */
+    void disconnect()
+    {
+        if (m_client != nullptr) {
+            HTTPClient<RESTDispatcherType>* client = m_client;
+            m_retired.push_back([client]() { client->close(); delete client; });
+            m_client = nullptr;
+        }
 #if defined(ENABLE_TCP_SSL)
+        if (m_sslClient != nullptr) {
+            SecureHTTPClient<RESTDispatcherType>* client = m_sslClient;
+            m_retired.push_back([client]() { client->close(); delete client; });
+            m_sslClient = nullptr;
         }
 #endif // ENABLE_TCP_SSL
+    }
+
+    /**
+     * @brief Helper to close detached connections. The session lock must not be held.
+     */
+    void releaseRetired()
+    {
+        // a connection thread (e.g. a callback issuing a new request) may be the one being closed,
+        // and leaves the detached connections to the next caller
+        if (t_connectionThread) {
+            return;
+        }
 
+        std::vector<std::function<void()>> retired;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            retired.swap(m_retired);
+        }
+
+        for (auto& release : retired)
+            release();
+    }
+
+    /**
+     * @brief Helper to send the authentication request. The session lock must be held.
+     * @param[out] completions Requests completed by a failure.
+     */
+    void authenticate(std::vector<Completion>& completions)
+    {
         // generate password SHA hash
-        size_t size = password.size();
+        size_t size = m_password.size();
 
         uint8_t* in = new uint8_t[size];
         for (size_t i = 0U; i < size; i++)
-            in[i] = password.at(i);
+            in[i] = m_password.at(i);
 
         uint8_t out[32U];
         ::memset(out, 0x00U, 32U);
@@ -199,205 +415,413 @@ int RESTClient::send(const std::string& address, uint32_t port, const std::strin
         for (uint8_t i = 0; i < 32U; i++)
             ss << std::setw(2) << std::setfill('0') << (int)out[i];
 
-        std::string hash = ss.str();
+        PendingRequest req;
+        req.method = HTTP_PUT;
+        req.endpoint = "/auth";
+        req.payload = json::object();
+        req.payload["auth"].set<std::string>(ss.str());
+        req.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(REST_DEFAULT_WAIT);
+        req.auth = true;
+        req.retried = false;
+
+        m_authPending = true;
+        transmit(req, completions);
+    }
+
+    /**
+     * @brief Helper to write a request to the connection. The session lock must be held.
+     * @param req Request.
+     * @param[out] completions Requests completed by a failure.
+     */
+    void transmit(const PendingRequest& req, std::vector<Completion>& completions)
+    {
+        if (!isConnected() && !connect()) {
+            if (req.auth) {
+                failAll(ERRNO_SOCK_OPEN, completions);
+            }
+            else {
+                completions.push_back(Completion { req.callback, ERRNO_SOCK_OPEN, json::object() });
+            }
+            return;
+        }
+
+        HTTPPayload httpPayload = HTTPPayload::requestPayload(req.method, req.endpoint);
+        if (!req.auth) {
+            httpPayload.headers.add("X-DVM-Auth-Token", m_token);
+        }
+
+        json::object payload = req.payload;
+        httpPayload.payload(payload);
 
-        // send authentication API
-        json::object request = json::object();
-        request["auth"].set<std::string>(hash);
+        // requests are pipelined on a persistent connection, and must be delimited by their length
+        httpPayload.headers.add("Content-Length", std::to_string(httpPayload.content.size()));
+        httpPayload.headers.add("Connection", "keep-alive");
 
-        HTTPPayload httpPayload = HTTPPayload::requestPayload(HTTP_PUT, "/auth");
-        httpPayload.payload(request);
+        m_inflight.push_back(req);
 #if defined(ENABLE_TCP_SSL)
         if (m_enableSSL) {
-            sslClient->request(httpPayload);
-        } else {
-#endif // ENABLE_TCP_SSL
-            client->request(httpPayload);
-#if defined(ENABLE_TCP_SSL)
+            m_sslClient->request(httpPayload);
+            return;
         }
 #endif // ENABLE_TCP_SSL
+        m_client->request(httpPayload);
+    }
 
-        // wait for response and parse
-        if (wait()) {
-#if defined(ENABLE_TCP_SSL)
-            if (m_enableSSL) {
-                sslClient->close();
-                delete sslClient;
-            } else {
-#endif // ENABLE_TCP_SSL
-                client->close();
-                delete client;
-#if defined(ENABLE_TCP_SSL)
+    /**
+     * @brief Helper to fail all outstanding requests. The session lock must be held.
+     * @param status Error code.
+     * @param[out] completions Failed requests.
+     */
+    void failAll(int status, std::vector<Completion>& completions)
+    {
+        for (const PendingRequest& req : m_inflight) {
+            if (!req.auth) {
+                completions.push_back(Completion { req.callback, status, json::object() });
             }
-#endif // ENABLE_TCP_SSL
-            return ERRNO_API_CALL_TIMEOUT;
         }
-
-        json::object rsp = json::object();
-        if (!parseResponseBody(m_response, rsp)) {
-            return ERRNO_BAD_API_RESPONSE;
+        for (const PendingRequest& req : m_waiting) {
+            completions.push_back(Completion { req.callback, status, json::object() });
         }
 
-        std::string token = "";
-        int status = rsp["status"].get<int>();
-        if (status == HTTPPayload::StatusType::OK) {
-            token = rsp["token"].get<std::string>();
-        }
-        else {
-#if defined(ENABLE_TCP_SSL)
-            if (m_enableSSL) {
-                sslClient->close();
-                delete sslClient;
-            } else {
-#endif // ENABLE_TCP_SSL
-                client->close();
-                delete client;
-#if defined(ENABLE_TCP_SSL)
+        m_inflight.clear();
+        m_waiting.clear();
+        m_authPending = false;
+    }
+
+    /**
+     * @brief Helper to invoke the callbacks of completed requests. The session lock must not be held.
+     * @param completions Completed requests.
+     */
+    static void complete(std::vector<Completion>& completions)
+    {
+        for (Completion& c : completions) {
+            if (c.callback) {
+                c.callback(c.status, c.response);
             }
-#endif // ENABLE_TCP_SSL
-            return ERRNO_BAD_AUTH_RESPONSE;
         }
+    }
 
-#if defined(ENABLE_TCP_SSL)
-        if (m_enableSSL) {
-            sslClient->close();
-            delete sslClient;
-        } else {
-#endif // ENABLE_TCP_SSL
-            client->close();
-            delete client;
-#if defined(ENABLE_TCP_SSL)
-        }
-#endif // ENABLE_TCP_SSL
+    /**
+     * @brief Helper to drop the connection, and retry or fail the requests outstanding on it. The session
+     *  lock must be held.
+     * @param now Current time; requests past their deadline are failed.
+     * @param[out] completions Failed requests.
+     */
+    void requeue(std::chrono::steady_clock::time_point now, std::vector<Completion>& completions)
+    {
+        // a request that was written but not answered may have been acted on, and is only retried if
+        // repeating it is harmless (a GET); requests waiting for the token were never written
+        std::deque<PendingRequest> pending;
+        for (const PendingRequest& req : m_inflight) {
+            if (req.auth) {
+                continue;
+            }
 
-        // reset the HTTP client and setup for actual payload request
-#if defined(ENABLE_TCP_SSL)
-        if (m_enableSSL) {
-            sslClient = new SecureHTTPClient<RESTDispatcherType>(address, port);
-            if (!sslClient->open()) {
-                delete sslClient;
-                return ERRNO_SOCK_OPEN;
+            if (req.method == HTTP_GET) {
+                pending.push_back(req);
             }
-            sslClient->setHandler(m_dispatcher);
-        } else {
-#endif // ENABLE_TCP_SSL
-            client = new HTTPClient<RESTDispatcherType>(address, port);
-            if (!client->open()) {
-                delete client;
-                return ERRNO_SOCK_OPEN;
+            else {
+                completions.push_back(Completion { req.callback, ERRNO_API_CALL_TIMEOUT, json::object() });
             }
-            client->setHandler(m_dispatcher);
-#if defined(ENABLE_TCP_SSL)
         }
-#endif // ENABLE_TCP_SSL
-
-        // send actual API request
-        httpPayload = HTTPPayload::requestPayload(method, endpoint);
-        httpPayload.headers.add("X-DVM-Auth-Token", token);
-        httpPayload.payload(payload);
-#if defined(ENABLE_TCP_SSL)
-        if (m_enableSSL) {
-            sslClient->request(httpPayload);
-        } else {
-#endif // ENABLE_TCP_SSL
-            client->request(httpPayload);
-#if defined(ENABLE_TCP_SSL)
+        if (m_authPending) {
+            pending.insert(pending.end(), m_waiting.begin(), m_waiting.end());
         }
-#endif // ENABLE_TCP_SSL
 
-        // wait for response and parse
-        if (wait()) {
-#if defined(ENABLE_TCP_SSL)
-            if (m_enableSSL) {
-                sslClient->close();
-                delete sslClient;
-            } else {
-#endif // ENABLE_TCP_SSL
-                client->close();
-                delete client;
-#if defined(ENABLE_TCP_SSL)
+        m_inflight.clear();
+        m_waiting.clear();
+        m_authPending = false;
+        disconnect();
+
+        for (PendingRequest& req : pending) {
+            if (req.retried || req.deadline <= now) {
+                completions.push_back(Completion { req.callback, ERRNO_API_CALL_TIMEOUT, json::object() });
+            }
+            else {
+                req.retried = true;
+                m_waiting.push_back(req);
             }
-#endif // ENABLE_TCP_SSL
-            return ERRNO_API_CALL_TIMEOUT;
         }
 
-        response = json::object();
-        if (!parseResponseBody(m_response, response)) {
-            return ERRNO_BAD_API_RESPONSE;
+        if (!m_waiting.empty()) {
+            if (!m_token.empty()) {
+                std::deque<PendingRequest> waiting;
+                waiting.swap(m_waiting);
+                for (const PendingRequest& w : waiting) {
+                    transmit(w, completions);
+                }
+            }
+            else {
+                authenticate(completions);
+            }
         }
+    }
 
-        ret = response["status"].get<int>();
-        if (m_console) {
-            fprintf(stdout, "%s\r\n", m_response.content.c_str());
+    /**
+     * @brief Helper to fail the requests outstanding on a connection that did not answer in time.
+     * @param[out] completions Failed requests.
+     */
+    void expire(std::vector<Completion>& completions)
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        bool expired = false;
+        for (const PendingRequest& req : m_inflight) {
+            if (req.deadline <= now) {
+                expired = true;
+            }
         }
-        else {
-            if (m_debug) {
-                if (m_response.content.size() < 4095) {
-                    ::LogDebug(LOG_REST, "REST Response: %s", m_response.content.c_str());
-                }
-                // bryanb: this will cause REST responses >4095 characters to simply not print...
+        for (const PendingRequest& req : m_waiting) {
+            if (req.deadline <= now) {
+                expired = true;
             }
         }
 
-#if defined(ENABLE_TCP_SSL)
-        if (m_enableSSL) {
-            sslClient->close();
-            delete sslClient;
-        } else {
-#endif // ENABLE_TCP_SSL
-            client->close();
-            delete client;
-#if defined(ENABLE_TCP_SSL)
+        if (!expired) {
+            return;
         }
-#endif // ENABLE_TCP_SSL
+
+        if (m_debug) {
+            ::LogDebug(LOG_REST, "REST request to %s:%u timed out, reconnecting", m_address.c_str(), m_port);
+        }
+
+        requeue(now, completions);
     }
-    catch (std::exception&) {
-#if defined(ENABLE_TCP_SSL)
-        if (m_enableSSL) {
-            if (sslClient != nullptr) {
-                delete sslClient;
+
+    /**
+     * @brief HTTP response handler.
+     * @param generation Connection the response was received on.
+     * @param response HTTP response.
+     */
+    void responseHandler(uint32_t generation, const HTTPPayload& response)
+    {
+        t_connectionThread = true;
+
+        std::vector<Completion> completions;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            if (generation != m_generation || m_inflight.empty()) {
+                return;
             }
-        } else {
-#endif // ENABLE_TCP_SSL
-            if (client != nullptr) {
-                delete client;
+
+            PendingRequest req = m_inflight.front();
+            m_inflight.pop_front();
+
+            json::object rsp = json::object();
+            bool parsed = parseResponseBody(response, rsp);
+            if (m_debug && response.content.size() < 4095) {
+                ::LogDebug(LOG_REST, "REST Response: %s", response.content.c_str());
+            }
+
+            if (req.auth) {
+                m_authPending = false;
+                if (parsed && rsp["status"].getDefault<int>(0) == HTTPPayload::StatusType::OK && rsp["token"].is<std::string>()) {
+                    m_token = rsp["token"].get<std::string>();
+
+                    std::deque<PendingRequest> waiting;
+                    waiting.swap(m_waiting);
+                    for (const PendingRequest& w : waiting) {
+                        transmit(w, completions);
+                    }
+                }
+                else {
+                    m_token = "";
+                    for (const PendingRequest& w : m_waiting) {
+                        completions.push_back(Completion { w.callback, (parsed) ? ERRNO_BAD_AUTH_RESPONSE : ERRNO_BAD_API_RESPONSE, json::object() });
+                    }
+                    m_waiting.clear();
+                }
+            }
+            else if (response.status == HTTPPayload::UNAUTHORIZED && !req.retried) {
+                // the token was invalidated (e.g. the server restarted); authenticate again and retry once
+                req.retried = true;
+                m_token = "";
+                m_waiting.push_back(req);
+                if (!m_authPending) {
+                    authenticate(completions);
+                }
+            }
+            else if (parsed) {
+                completions.push_back(Completion { req.callback, rsp["status"].getDefault<int>(response.status), rsp });
+            }
+            else {
+                completions.push_back(Completion { req.callback, ERRNO_BAD_API_RESPONSE, json::object() });
             }
-#if defined(ENABLE_TCP_SSL)
         }
-#endif // ENABLE_TCP_SSL
-        return ERRNO_INTERNAL_ERROR;
+
+        complete(completions);
     }
 
-    return ret;
-}
+    /**
+     * @brief Handler for a lost connection.
+     * @param generation Connection that was lost.
+     */
+    void disconnected(uint32_t generation)
+    {
+        t_connectionThread = true;
+
+        std::vector<Completion> completions;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            if (generation != m_generation) {
+                return;
+            }
+
+            requeue(std::chrono::steady_clock::now(), completions);
+        }
+
+        complete(completions);
+    }
+};
 
 // ---------------------------------------------------------------------------
-//  Private Class Members
+//  Public Class Members
 // ---------------------------------------------------------------------------
 
-/* HTTP response handler. */
+/* Initializes a new instance of the RESTClient class. */
+
+RESTClient::RESTClient(const std::string& address, uint32_t port, const std::string& password, bool enableSSL, bool debug) :
+    m_address(address),
+    m_port(port),
+    m_password(password),
+    m_enableSSL(enableSSL),
+    m_debug(debug)
+{
+    assert(!address.empty());
+    assert(port > 0U);
+
+    m_console = true;
+}
+
+/* Finalizes a instance of the RESTClient class. */
+
+RESTClient::~RESTClient() = default;
 
-void RESTClient::responseHandler(const HTTPPayload& request, HTTPPayload& reply)
+/* Sends remote control command to the specified modem. */
+
+int RESTClient::send(const std::string method, const std::string endpoint, json::object payload)
 {
-    m_responseAvailable = true;
-    m_response = request;
+    json::object rsp = json::object();
+    return send(method, endpoint, payload, rsp);
 }
 
-/* Helper to wait for a HTTP response. */
+/* Sends remote control command to the specified modem. */
 
-bool RESTClient::wait(const int t)
+int RESTClient::send(const std::string method, const std::string endpoint, json::object payload, json::object& response)
 {
-    m_responseAvailable = false;
+    return send(m_address, m_port, m_password, method, endpoint, payload, response, m_enableSSL, REST_DEFAULT_WAIT, m_debug);
+}
 
-    int timeout = t;
-    while (!m_responseAvailable && timeout > 0) {
-        timeout--;
-        Thread::sleep(1);
+/* Sends remote control command to the specified modem. */
+
+int RESTClient::send(const std::string& address, uint32_t port, const std::string& password, const std::string method,
+    const std::string endpoint, json::object payload, bool enableSSL, int timeout, bool debug)
+{
+    json::object rsp = json::object();
+    return send(address, port, password, method, endpoint, payload, rsp, enableSSL, timeout, debug);
+}
+
+
+/* Sends remote control command to the specified modem. */
+
+int RESTClient::send(const std::string& address, uint32_t port, const std::string& password, const std::string method,
+    const std::string endpoint, json::object payload, json::object& response, bool enableSSL, int timeout, bool debug)
+{
+    /**
+     * @brief Represents the result of a synchronous request.
+     */
+    struct SyncResult {
+        std::mutex lock;
+        std::condition_variable cond;
+        bool done = false;
+        int status = EXIT_SUCCESS;
+        json::object response;
+    };
+
+    // the result is shared with the callback, which may still run after the wait below timed out
+    std::shared_ptr<SyncResult> result = std::make_shared<SyncResult>();
+    int ret = sendAsync(address, port, password, method, endpoint, payload, enableSSL, [result](int status, json::object& rsp) {
+        std::lock_guard<std::mutex> lock(result->lock);
+        result->status = status;
+        result->response = rsp;
+        result->done = true;
+        result->cond.notify_all();
+    }, timeout, debug);
+    if (ret != EXIT_SUCCESS) {
+        return ret;
     }
 
-    if (timeout == 0) {
-        return true;
+    // wait for response
+    std::unique_lock<std::mutex> lock(result->lock);
+    if (!result->cond.wait_for(lock, std::chrono::milliseconds(timeout), [&]() { return result->done; })) {
+        return ERRNO_API_CALL_TIMEOUT;
+    }
+
+    response = result->response;
+    if (m_console && !response.empty()) {
+        fprintf(stdout, "%s\r\n", json::value(response).serialize().c_str());
+    }
+
+    return result->status;
+}
+
+/* Sends remote control command to the specified modem, without waiting for the response. */
+
+int RESTClient::sendAsync(const std::string& address, uint32_t port, const std::string& password, const std::string method,
+    const std::string endpoint, json::object payload, bool enableSSL, RESTResponseCallback callback, int timeout, bool debug)
+{
+    if (address.empty()) {
+        return ERRNO_NO_ADDRESS;
+    }
+    if (address == "0.0.0.0") {
+        return ERRNO_NO_ADDRESS;
+    }
+    if (port <= 0U) {
+        return ERRNO_NO_ADDRESS;
+    }
+    if (password.empty()) {
+        return ERRNO_NO_PASSWORD;
     }
 
-    return false;
+    // the session is shared, so it remains valid while this request is queued even if the connections are closed
+    std::shared_ptr<RESTClientSession> session;
+    {
+        std::lock_guard<std::mutex> lock(m_sessionLock);
+        std::string key = address + ":" + std::to_string(port) + (enableSSL ? ":ssl" : "");
+        auto it = m_sessions.find(key);
+        if (it == m_sessions.end()) {
+            session = std::make_shared<RESTClientSession>(address, port, enableSSL);
+            session->start();
+            m_sessions[key] = session;
+        }
+        else {
+            session = it->second;
+        }
+    }
+
+    try {
+        session->request(password, method, endpoint, payload, callback, timeout, debug);
+    }
+    catch (std::exception&) {
+        return ERRNO_INTERNAL_ERROR;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* Closes all persistent REST API connections. */
+
+void RESTClient::closeConnections()
+{
+    std::map<std::string, std::shared_ptr<RESTClientSession>> sessions;
+    {
+        std::lock_guard<std::mutex> lock(m_sessionLock);
+        sessions.swap(m_sessions);
+    }
+
+    // outstanding requests are failed (and their callbacks invoked) without holding the session lock
+    for (auto& entry : sessions) {
+        entry.second->close();
+    }
 }
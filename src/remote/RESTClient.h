@@ -27,17 +27,42 @@
 #include "common/network/json/json.h"
 #include "common/network/rest/http/HTTPPayload.h"
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #define REST_DEFAULT_WAIT 500
 #define REST_QUICK_WAIT 150
 
+// ---------------------------------------------------------------------------
+//  Class Prototypes
+// ---------------------------------------------------------------------------
+
+class HOST_SW_API RESTClientSession;
+
+// ---------------------------------------------------------------------------
+//  Types
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Callback invoked when an asynchronous REST API request completes.
+ * @param status REST API response status, or an error code if the request failed.
+ * @param response REST API endpoint response.
+ */
+typedef std::function<void(int status, json::object& response)> RESTResponseCallback;
+
 // ---------------------------------------------------------------------------
 //  Class Declaration
 // ---------------------------------------------------------------------------
 
 /**
  * @brief This class implements the REST client logic.
+ *
+ * Requests to the same REST API (address, port and SSL mode) share a single persistent
+ * connection and authentication token; requests issued before an earlier response arrived
+ * are pipelined on that connection.
  * @ingroup remote_rest
  */
 class HOST_SW_API RESTClient
@@ -106,32 +131,42 @@ public:
     static int send(const std::string& address, uint32_t port, const std::string& password, const std::string method,
         const std::string endpoint, json::object payload, json::object& response, bool enableSSL, int timeout, bool debug = false);
 
-private:
-    typedef network::rest::http::HTTPPayload HTTPPayload;
     /**
-     * @brief HTTP response handler.
-     * @param request HTTP request.
-     * @param reply HTTP reply.
+     * @brief Sends remote control command to the specified modem, without waiting for the response.
+     * @param address Network Hostname/IP address to connect to.
+     * @param port Network port number.
+     * @param password Authentication password.
+     * @param method REST API method.
+     * @param endpoint REST API endpoint.
+     * @param payload REST API endpoint payload.
+     * @param enableSSL Flag indicating whether or not HTTPS is enabled.
+     * @param callback Callback invoked (from the connection thread) when the request completes.
+     * @param timeout Time (in milliseconds) after which an unanswered request fails.
+     * @param debug Flag indicating whether debug is enabled.
+     * @returns EXIT_SUCCESS, if command was queued, otherwise an error code.
      */
-    static void responseHandler(const HTTPPayload& request, HTTPPayload& reply);
+    static int sendAsync(const std::string& address, uint32_t port, const std::string& password, const std::string method,
+        const std::string endpoint, json::object payload, bool enableSSL, RESTResponseCallback callback, int timeout = REST_DEFAULT_WAIT,
+        bool debug = false);
 
     /**
-     * @brief Helper to wait for a HTTP response.
-     * @returns True, if timed out, otherwise false.
+     * @brief Closes all persistent REST API connections.
      */
-    static bool wait(const int t = REST_DEFAULT_WAIT);
+    static void closeConnections();
 
+private:
+    typedef network::rest::http::HTTPPayload HTTPPayload;
     std::string m_address;
     uint32_t m_port;
     std::string m_password;
 
-    static bool m_console;
+    bool m_enableSSL;
+    bool m_debug;
 
-    static bool m_responseAvailable;
-    static HTTPPayload m_response;
+    static bool m_console;
 
-    static bool m_enableSSL;
-    static bool m_debug;
+    static std::mutex m_sessionLock;
+    static std::map<std::string, std::shared_ptr<RESTClientSession>> m_sessions;
 };
 
 #endif // __REMOTE_COMMAND_H__
@@ -939,6 +939,8 @@ int main(int argc, char** argv)
         }
     }
 
+    RESTClient::closeConnections();
+
     ::LogFinalise();
     return retCode;
 }
@@ -147,6 +147,13 @@ HostWS::HostWS(const std::string& confFile) :
     m_websocketPort(8443U),
     m_wsServer(),
     m_wsConList(),
+    m_restLock(),
+    m_restUpdates(),
+    m_peerListPending(false),
+    m_affListPending(false),
+    m_wsFullSync(false),
+    m_peerStatusVersion(0U),
+    m_peerStatusBatch(false),
     m_debug(false)
 {
     /* stub */
@@ -276,6 +283,27 @@ int HostWS::run()
 
     setNetDataEventCallback([=](json::object obj) { netDataEvent(obj); });
 
+    // FNE queries are sent on a persistent connection and answered asynchronously; a query is
+    // skipped while the previous one of the same kind is still outstanding
+    auto queryFNE = [&](const std::string& endpoint, const std::string& type, std::atomic<bool>& pending) {
+        if (pending.exchange(true)) {
+            return;
+        }
+
+        int ret = RESTClient::sendAsync(fneRESTAddress, fneRESTPort, fnePassword, HTTP_GET, endpoint, json::object(), fneSSL,
+            [this, type, &pending](int status, json::object& rsp) {
+                {
+                    std::lock_guard<std::mutex> lock(m_restLock);
+                    m_restUpdates.push_back(RESTUpdate { type, status, rsp });
+                }
+                pending = false;
+            }, REST_DEFAULT_WAIT, g_debug);
+        if (ret != EXIT_SUCCESS) {
+            pending = false;
+            ::LogError(LOG_HOST, "[AFFVIEW] failed to query %s for %s:%u", type.c_str(), fneRESTAddress.c_str(), fneRESTPort);
+        }
+    };
+
     // main execution loop
     while (!g_killed) {
         uint32_t ms = stopWatch.elapsed();
@@ -301,74 +329,70 @@ int HostWS::run()
             if (peerStatusUpdate.isRunning() && peerStatusUpdate.hasExpired()) {
                 peerStatusUpdate.start();
 
-                getNetwork()->lockPeerStatus();
-                std::map<uint32_t, json::object> peerStatus(getNetwork()->peerStatus.begin(), getNetwork()->peerStatus.end());
-                getNetwork()->unlockPeerStatus();
+                // a newly connected client gets the status of every peer, otherwise only the peers whose
+                // status changed since the last update are sent; clients that do not understand batches
+                // get the status of every peer as individual messages
+                bool full = m_wsFullSync.exchange(false) || !m_peerStatusBatch;
+                uint32_t version = full ? 0U : m_peerStatusVersion;
+                std::vector<std::pair<uint32_t, std::string>> changes = getNetwork()->peerStatusChanges(version);
+                m_peerStatusVersion = version;
+
+                if (!m_peerStatusBatch) {
+                    for (auto& entry : changes) {
+                        send("{\"type\":\"peer_status\",\"peerId\":" + std::to_string(entry.first) + ",\"payload\":" + entry.second + "}");
+                    }
+                }
+                else if (changes.size() > 0U) {
+                    // the peer status is forwarded as received, without parsing or serializing it again
+                    std::string json = "{\"type\":\"peer_status_batch\",\"full\":";
+                    json += full ? "true" : "false";
+                    json += ",\"payload\":[";
+                    for (size_t i = 0U; i < changes.size(); i++) {
+                        if (i > 0U)
+                            json += ",";
+                        json += "{\"peerId\":" + std::to_string(changes[i].first) + ",\"payload\":" + changes[i].second + "}";
+                    }
+                    json += "]}";
+                    send(json);
+                }
+            }
+
+            // forward completed FNE queries
+            std::deque<RESTUpdate> updates;
+            {
+                std::lock_guard<std::mutex> lock(m_restLock);
+                updates.swap(m_restUpdates);
+            }
 
-                for (auto entry : peerStatus) {
+            for (RESTUpdate& update : updates) {
+                if (update.status != network::rest::http::HTTPPayload::StatusType::OK) {
+                    ::LogError(LOG_HOST, "[AFFVIEW] failed to query %s for %s:%u", update.type.c_str(), fneRESTAddress.c_str(), fneRESTPort);
+                    continue;
+                }
+
+                try {
                     json::object wsObj = json::object();
-                    std::string type = "peer_status";
-                    wsObj["type"].set<std::string>(type);
-                    uint32_t peerId = entry.first;
-                    wsObj["peerId"].set<uint32_t>(peerId);
-                    json::object peerStatus = entry.second;
-                    wsObj["payload"].set<json::object>(peerStatus);
+                    wsObj["type"].set<std::string>(update.type);
+                    wsObj["payload"].set<json::object>(update.payload);
                     send(wsObj);
                 }
+                catch (std::exception& e) {
+                    ::LogWarning(LOG_HOST, "[AFFVIEW] %s:%u, failed to properly handle %s request, %s", fneRESTAddress.c_str(), fneRESTPort, update.type.c_str(), e.what());
+                }
             }
 
             // update peer list data
             peerListUpdate.clock(ms);
             if (peerListUpdate.isRunning() && peerListUpdate.hasExpired()) {
                 peerListUpdate.start();
-                // callback REST API to get status of the channel we represent
-                json::object req = json::object();
-                json::object rsp = json::object();
-            
-                int ret = RESTClient::send(fneRESTAddress, fneRESTPort, fnePassword,
-                    HTTP_GET, FNE_GET_PEER_QUERY, req, rsp, fneSSL, g_debug);
-                if (ret != network::rest::http::HTTPPayload::StatusType::OK) {
-                    ::LogError(LOG_HOST, "[AFFVIEW] failed to query peers for %s:%u", fneRESTAddress.c_str(), fneRESTPort);
-                }
-                else {
-                    try {
-                        json::object wsObj = json::object();
-                        std::string type = "peer_list";
-                        wsObj["type"].set<std::string>(type);
-                        wsObj["payload"].set<json::object>(rsp);
-                        send(wsObj);
-                    }
-                    catch (std::exception& e) {
-                        ::LogWarning(LOG_HOST, "[AFFVIEW] %s:%u, failed to properly handle peer query request, %s", fneRESTAddress.c_str(), fneRESTPort, e.what());
-                    }
-                }
+                queryFNE(FNE_GET_PEER_QUERY, "peer_list", m_peerListPending);
             }
 
             // update affiliation list data
             affListUpdate.clock(ms);
             if (affListUpdate.isRunning() && affListUpdate.hasExpired()) {
                 affListUpdate.start();
-                // callback REST API to get status of the channel we represent
-                json::object req = json::object();
-                json::object rsp = json::object();
-            
-                int ret = RESTClient::send(fneRESTAddress, fneRESTPort, fnePassword,
-                    HTTP_GET, FNE_GET_AFF_LIST, req, rsp, fneSSL, g_debug);
-                if (ret != network::rest::http::HTTPPayload::StatusType::OK) {
-                    ::LogError(LOG_HOST, "[AFFVIEW] failed to query peers for %s:%u", fneRESTAddress.c_str(), fneRESTPort);
-                }
-                else {
-                    try {
-                        json::object wsObj = json::object();
-                        std::string type = "aff_list";
-                        wsObj["type"].set<std::string>(type);
-                        wsObj["payload"].set<json::object>(rsp);
-                        send(wsObj);
-                    }
-                    catch (std::exception& e) {
-                        ::LogWarning(LOG_HOST, "[AFFVIEW] %s:%u, failed to properly handle peer query request, %s", fneRESTAddress.c_str(), fneRESTPort, e.what());
-                    }
-                }
+                queryFNE(FNE_GET_AFF_LIST, "aff_list", m_affListPending);
             }
 
             // send full talkgroup list data
@@ -433,6 +457,8 @@ int HostWS::run()
 
     g_logDisplayLevel = 1U;
 
+    RESTClient::closeConnections();
+
     if (g_killed)
         m_wsServer.stop();
 
@@ -443,10 +469,15 @@ int HostWS::run()
 
 void HostWS::send(json::object obj)
 {
-    try {
-        json::value v = json::value(obj);
-        std::string json = std::string(v.serialize());
+    json::value v = json::value(obj);
+    send(std::string(v.serialize()));
+}
+
+/* Helper to send an already serialized JSON message to all WebSocket clients. */
 
+void HostWS::send(const std::string& json)
+{
+    try {
         wsConList::iterator it;
         for (it = m_wsConList.begin(); it != m_wsConList.end(); ++it) {
             m_wsServer.send(*it, json, websocketpp::frame::opcode::text);
@@ -466,9 +497,11 @@ bool HostWS::readParams()
     yaml::Node websocketConf = m_conf["websocket"];
     m_websocketPort = websocketConf["port"].as<uint16_t>(8443U);
     m_debug = websocketConf["debug"].as<bool>(false);
+    m_peerStatusBatch = websocketConf["peerStatusBatch"].as<bool>(false);
 
     LogInfo("General Parameters");
     LogInfo("    Port: %u", m_websocketPort);
+    LogInfo("    Peer Status Batching: %s", m_peerStatusBatch ? "yes" : "no");
 
     if (m_debug) {
         LogInfo("    Debug: yes");
@@ -493,6 +526,9 @@ void HostWS::netDataEvent(json::object obj)
 void HostWS::wsOnConOpen(websocketpp::connection_hdl handle)
 {
     m_wsConList.insert(handle);
+
+    // send the status of every peer to the new client on the next update
+    m_wsFullSync = true;
 }
 
 /* Called when a WebSocket connection is closed. */
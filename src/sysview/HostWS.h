@@ -28,6 +28,9 @@
 #include <websocketpp/config/asio_no_tls.hpp>
 #include <websocketpp/server.hpp>
 
+#include <atomic>
+#include <deque>
+#include <mutex>
 #include <string>
 #include <set>
 #include <unordered_map>
@@ -64,6 +67,11 @@ public:
      * @param obj 
      */
     void send(json::object obj);
+    /**
+     * @brief Helper to send an already serialized JSON message to all WebSocket clients.
+     * @param json Serialized JSON message.
+     */
+    void send(const std::string& json);
 
 private:
     const std::string& m_confFile;
@@ -76,6 +84,23 @@ private:
     typedef std::set<websocketpp::connection_hdl, std::owner_less<websocketpp::connection_hdl>> wsConList;
     wsConList m_wsConList;
 
+    /**
+     * @brief Represents a completed FNE REST API query, to be forwarded to the WebSocket clients.
+     */
+    struct RESTUpdate {
+        std::string type;
+        int status;
+        json::object payload;
+    };
+    std::mutex m_restLock;
+    std::deque<RESTUpdate> m_restUpdates;
+    std::atomic<bool> m_peerListPending;
+    std::atomic<bool> m_affListPending;
+
+    std::atomic<bool> m_wsFullSync;
+    uint32_t m_peerStatusVersion;
+    bool m_peerStatusBatch;
+
     bool m_debug;
 
     /**
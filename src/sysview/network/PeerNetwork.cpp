@@ -38,6 +38,8 @@ PeerNetwork::PeerNetwork(const std::string& address, uint16_t port, uint16_t loc
     bool duplex, bool debug, bool dmr, bool p25, bool nxdn, bool slot1, bool slot2, bool allowActivityTransfer, bool allowDiagnosticTransfer, bool updateLookup, bool saveLookup) :
     Network(address, port, localPort, peerId, password, duplex, debug, dmr, p25, nxdn, slot1, slot2, allowActivityTransfer, allowDiagnosticTransfer, updateLookup, saveLookup),
     peerStatus(),
+    m_peerStatusEntries(),
+    m_peerStatusVersion(0U),
     m_peerLink(false),
     m_tgidCompressedSize(0U),
     m_tgidSize(0U),
@@ -54,6 +56,23 @@ PeerNetwork::PeerNetwork(const std::string& address, uint16_t port, uint16_t loc
     m_promiscuousPeer = true;
 }
 
+/* Helper to get the raw JSON status of the peers whose status changed since the given version. */
+
+std::vector<std::pair<uint32_t, std::string>> PeerNetwork::peerStatusChanges(uint32_t& version)
+{
+    std::vector<std::pair<uint32_t, std::string>> changes;
+
+    std::lock_guard<std::mutex> lock(m_peerStatusMutex);
+    for (auto& entry : m_peerStatusEntries) {
+        if (version == 0U || entry.second.version > version) {
+            changes.push_back(std::make_pair(entry.first, entry.second.raw));
+        }
+    }
+
+    version = m_peerStatusVersion;
+    return changes;
+}
+
 // ---------------------------------------------------------------------------
 //  Protected Class Members
 // ---------------------------------------------------------------------------
@@ -114,6 +133,13 @@ void PeerNetwork::userPacketHandler(uint32_t peerId, FrameQueue::OpcodePair opco
             uint32_t actualPeerId = obj["peerId"].getDefault<uint32_t>(peerId);
             std::lock_guard<std::mutex> lock(m_peerStatusMutex);
             peerStatus[actualPeerId] = obj;
+
+            // only a status that differs from the last one is a change
+            PeerStatusEntry& entry = m_peerStatusEntries[actualPeerId];
+            if (entry.raw != payload) {
+                entry.raw = payload;
+                entry.version = ++m_peerStatusVersion;
+            }
         }
         break;
 
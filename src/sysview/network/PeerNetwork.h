@@ -26,6 +26,9 @@
 #include <string>
 #include <cstdint>
 #include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace network
 {
@@ -76,6 +79,14 @@ namespace network
          */
         std::unordered_map<uint32_t, json::object> peerStatus;
 
+        /**
+         * @brief Helper to get the raw JSON status of the peers whose status changed since the given version.
+         * @param[in,out] version Peer status version last seen by the caller, updated to the current version.
+         *  A version of 0 gets the status of all peers.
+         * @returns std::vector<std::pair<uint32_t, std::string>> List of peer IDs and their raw JSON status.
+         */
+        std::vector<std::pair<uint32_t, std::string>> peerStatusChanges(uint32_t& version);
+
     protected:
         /**
          * @brief User overrideable handler that allows user code to process network packets not handled by this class.
@@ -96,6 +107,15 @@ namespace network
 
     private:
         static std::mutex m_peerStatusMutex;
+        /**
+         * @brief Represents the last received status of a peer.
+         */
+        struct PeerStatusEntry {
+            uint32_t version;
+            std::string raw;
+        };
+        std::unordered_map<uint32_t, PeerStatusEntry> m_peerStatusEntries;
+        uint32_t m_peerStatusVersion;
         bool m_peerLink;
 
         uint32_t m_tgidCompressedSize;
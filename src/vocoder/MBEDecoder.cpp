@@ -8,6 +8,7 @@
  *  Copyright (C) 2021 Bryan Biedenkapp, N2PLL
  *
  */
+#include <cassert>
 #include <iostream>
 #include <string.h>
 #include <math.h>
@@ -314,3 +315,33 @@ int32_t MBEDecoder::decode(uint8_t* codeword, int16_t samples[])
 
     return errs;
 }
+
+/* Decodes the IMBE codewords of a P25 LDU to contiguous PCM samples. */
+
+int32_t MBEDecoder::decodeLDU(const uint8_t* ldu, int16_t samples[])
+{
+    assert(ldu != nullptr);
+    assert(samples != nullptr);
+    assert(m_mbeMode == DECODE_88BIT_IMBE);
+
+    int32_t errs = 0;
+    for (uint32_t n = 0U; n < IMBE_CODEWORDS_PER_LDU; n++)
+        errs += decode(const_cast<uint8_t*>(ldu + IMBE_LDU_OFFSETS[n]), samples + (n * MBE_FRAME_SAMPLES));
+
+    return errs;
+}
+
+/* Decodes the AMBE codewords of a DMR voice burst to contiguous PCM samples. */
+
+int32_t MBEDecoder::decodeBurst(const uint8_t* ambe, int16_t samples[])
+{
+    assert(ambe != nullptr);
+    assert(samples != nullptr);
+    assert(m_mbeMode == DECODE_DMR_AMBE);
+
+    int32_t errs = 0;
+    for (uint32_t n = 0U; n < AMBE_CODEWORDS_PER_BURST; n++)
+        errs += decode(const_cast<uint8_t*>(ambe + (n * RAW_AMBE_CODEWORD_BYTES)), samples + (n * MBE_FRAME_SAMPLES));
+
+    return errs;
+}
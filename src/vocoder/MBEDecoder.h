@@ -22,6 +22,7 @@ extern "C" {
 }
 
 #include "common/Defines.h"
+#include "vocoder/MBEDefines.h"
 
 #include <stdlib.h>
 #include <queue>
@@ -110,6 +111,23 @@ namespace vocoder
          */
         int32_t decode(uint8_t* codeword, int16_t samples[]);
 
+        /**
+         * @brief Decodes the IMBE codewords of a P25 LDU to contiguous PCM samples.
+         *  (The decoder must be in 88-bit IMBE mode.)
+         * @param[in] ldu LDU buffer, holding the IMBE codewords at IMBE_LDU_OFFSETS.
+         * @param[out] samples PCM Samples (in short format), IMBE_CODEWORDS_PER_LDU * MBE_FRAME_SAMPLES long.
+         * @returns int32_t Number of errors corrected across all codewords.
+         */
+        int32_t decodeLDU(const uint8_t* ldu, int16_t samples[]);
+        /**
+         * @brief Decodes the AMBE codewords of a DMR voice burst to contiguous PCM samples.
+         *  (The decoder must be in DMR AMBE mode.)
+         * @param[in] ambe AMBE codewords, AMBE_CODEWORDS_PER_BURST * RAW_AMBE_CODEWORD_BYTES long.
+         * @param[out] samples PCM Samples (in short format), AMBE_CODEWORDS_PER_BURST * MBE_FRAME_SAMPLES long.
+         * @returns int32_t Number of errors corrected across all codewords.
+         */
+        int32_t decodeBurst(const uint8_t* ambe, int16_t samples[]);
+
     private:
         mbelibParms* m_mbelibParms;
 
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - MBE Vocoder
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file MBEDefines.h
+ * @ingroup vocoder
+ */
+#if !defined(__MBE_DEFINES_H__)
+#define __MBE_DEFINES_H__
+
+#include "common/Defines.h"
+
+#include <stdint.h>
+
+namespace vocoder
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    const uint32_t MBE_FRAME_SAMPLES = 160U;        // 20ms of 8kHz PCM per MBE codeword
+
+    const uint32_t RAW_AMBE_CODEWORD_BYTES = 9U;
+    const uint32_t RAW_IMBE_CODEWORD_BYTES = 11U;
+
+    /** @brief Number of AMBE codewords carried by a DMR voice burst. */
+    const uint32_t AMBE_CODEWORDS_PER_BURST = 3U;
+    /** @brief Number of IMBE codewords carried by a P25 LDU. */
+    const uint32_t IMBE_CODEWORDS_PER_LDU = 9U;
+    /** @brief Offsets of the IMBE codewords within a P25 LDU buffer. */
+    const uint32_t IMBE_LDU_OFFSETS[IMBE_CODEWORDS_PER_LDU] = { 10U, 26U, 55U, 80U, 105U, 130U, 155U, 180U, 204U };
+} // namespace vocoder
+
+#endif // __MBE_DEFINES_H__
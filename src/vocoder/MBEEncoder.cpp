@@ -573,6 +573,78 @@ static void encodeDmrAMBE(const uint8_t* in, uint8_t* out)
     }
 }
 
+/**
+ * @brief Helper to pack the IMBE u[] vectors into a 88-bit IMBE codeword.
+ * @param[in] frame_vector IMBE u[] vectors.
+ * @param[out] codeword 88-bit IMBE codeword.
+ */
+static void encode88bitIMBE(const int16_t frame_vector[8], uint8_t* codeword)
+{
+    uint32_t offset = 0U;
+    int16_t mask = 0x0800;
+
+    for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[0U] & mask) != 0);
+
+    mask = 0x0800;
+    for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[1U] & mask) != 0);
+
+    mask = 0x0800;
+    for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[2U] & mask) != 0);
+
+    mask = 0x0800;
+    for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[3U] & mask) != 0);
+
+    mask = 0x0400;
+    for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[4U] & mask) != 0);
+
+    mask = 0x0400;
+    for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[5U] & mask) != 0);
+
+    mask = 0x0400;
+    for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[6U] & mask) != 0);
+
+    mask = 0x0040;
+    for (uint32_t i = 0U; i < 7U; i++, mask >>= 1, offset++)
+        WRITE_BIT(codeword, offset, (frame_vector[7U] & mask) != 0);
+}
+
+/**
+ * @brief Helper to pack the AMBE b[] parameters into a DMR AMBE codeword.
+ * @param[in] b AMBE b[] parameters.
+ * @param[out] codeword DMR AMBE codeword.
+ */
+static void encode49bitDmrAMBE(const int b[9], uint8_t* codeword)
+{
+    uint8_t bits[49U];
+    ::memset(bits, 0x00U, 49U);
+
+    encode49bit(bits, b);
+
+    // build 49-bit AMBE bytes
+    uint8_t rawAmbe[9U];
+    ::memset(rawAmbe, 0x00U, 9U);
+
+    for (int i = 0; i < 9; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            rawAmbe[i] |= (bits[(i * 8) + j] << (7 - j));
+        }
+    }
+
+    // build DMR AMBE bytes
+    uint8_t dmrAMBE[9U];
+    ::memset(dmrAMBE, 0x00U, 9U);
+
+    encodeDmrAMBE(rawAmbe, dmrAMBE);
+    ::memcpy(codeword, dmrAMBE, 9U);
+}
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -653,66 +725,58 @@ void MBEEncoder::encode(int16_t* samples, uint8_t* codeword)
             m_vocoder.set_gain_adjust(m_gainAdjust);
         }
 
-        uint32_t offset = 0U;
-        int16_t mask = 0x0800;
-
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[0U] & mask) != 0);
-
-        mask = 0x0800;
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[1U] & mask) != 0);
-
-        mask = 0x0800;
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[2U] & mask) != 0);
-
-        mask = 0x0800;
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[3U] & mask) != 0);
+        encode88bitIMBE(frame_vector, codeword);
+    }
+    else {
+        int b[9];
 
-        mask = 0x0400;
-        for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[4U] & mask) != 0);
+        // halfrate audio encoding - output rate is 2450 (49 bits)
+        encodeAMBE(m_vocoder.param(), b, &m_curMBEParms, &m_prevMBEParms, m_gainAdjust);
+        encode49bitDmrAMBE(b, codeword);
+    }
+}
 
-        mask = 0x0400;
-        for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[5U] & mask) != 0);
+/* Encodes the given MBE model parameters using the encoder mode to MBE codewords. */
 
-        mask = 0x0400;
-        for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[6U] & mask) != 0);
+void MBEEncoder::encodeParms(const IMBE_PARAM* parms, uint8_t* codeword)
+{
+    assert(parms != nullptr);
+    assert(codeword != nullptr);
 
-        mask = 0x0040;
-        for (uint32_t i = 0U; i < 7U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[7U] & mask) != 0);
+    if (m_mbeMode == ENCODE_88BIT_IMBE) {
+        int16_t frame_vector[8];
+        m_vocoder.imbe_encode_params(frame_vector, parms);
+        encode88bitIMBE(frame_vector, codeword);
     }
     else {
         int b[9];
 
         // halfrate audio encoding - output rate is 2450 (49 bits)
-        encodeAMBE(m_vocoder.param(), b, &m_curMBEParms, &m_prevMBEParms, m_gainAdjust);
+        encodeAMBE(parms, b, &m_curMBEParms, &m_prevMBEParms, m_gainAdjust);
+        encode49bitDmrAMBE(b, codeword);
+    }
+}
 
-        uint8_t bits[49U];
-        ::memset(bits, 0x00U, 49U);
+/* Encodes contiguous PCM samples to the IMBE codewords of a P25 LDU. */
 
-        encode49bit(bits, b);
+void MBEEncoder::encodeLDU(int16_t* samples, uint8_t* ldu)
+{
+    assert(samples != nullptr);
+    assert(ldu != nullptr);
+    assert(m_mbeMode == ENCODE_88BIT_IMBE);
 
-        // build 49-bit AMBE bytes
-        uint8_t rawAmbe[9U];
-        ::memset(rawAmbe, 0x00U, 9U);
+    for (uint32_t n = 0U; n < IMBE_CODEWORDS_PER_LDU; n++)
+        encode(samples + (n * MBE_FRAME_SAMPLES), ldu + IMBE_LDU_OFFSETS[n]);
+}
 
-        for (int i = 0; i < 9; ++i) {
-            for (int j = 0; j < 8; ++j) {
-                rawAmbe[i] |= (bits[(i * 8) + j] << (7 - j));
-            }
-        }
+/* Encodes contiguous PCM samples to the AMBE codewords of a DMR voice burst. */
 
-        // build DMR AMBE bytes
-        uint8_t dmrAMBE[9U];
-        ::memset(dmrAMBE, 0x00U, 9U);
+void MBEEncoder::encodeBurst(int16_t* samples, uint8_t* ambe)
+{
+    assert(samples != nullptr);
+    assert(ambe != nullptr);
+    assert(m_mbeMode == ENCODE_DMR_AMBE);
 
-        encodeDmrAMBE(rawAmbe, dmrAMBE);
-        ::memcpy(codeword, dmrAMBE, 9U);
-    }
+    for (uint32_t n = 0U; n < AMBE_CODEWORDS_PER_BURST; n++)
+        encode(samples + (n * MBE_FRAME_SAMPLES), ambe + (n * RAW_AMBE_CODEWORD_BYTES));
 }
@@ -18,6 +18,7 @@
 #define __MBE_ENCODER_H__
 
 #include "common/Defines.h"
+#include "vocoder/MBEDefines.h"
 #include "mbe.h"
 #include "imbe/imbe_vocoder.h"
 
@@ -65,6 +66,28 @@ namespace vocoder
          * @param[out] codeword MBE codewords.
          */
         void encode(int16_t* samples, uint8_t* codeword);
+        /**
+         * @brief Encodes the given MBE model parameters using the encoder mode to MBE codewords.
+         *  (This skips speech analysis; the parameters are quantized directly.)
+         * @param[in] parms MBE model parameters (ref_pitch, num_harms, num_bands, v_uv_dsn and sa).
+         * @param[out] codeword MBE codewords.
+         */
+        void encodeParms(const IMBE_PARAM* parms, uint8_t* codeword);
+
+        /**
+         * @brief Encodes contiguous PCM samples to the IMBE codewords of a P25 LDU.
+         *  (The encoder must be in 88-bit IMBE mode.)
+         * @param[in] samples PCM samples (in short format), IMBE_CODEWORDS_PER_LDU * MBE_FRAME_SAMPLES long.
+         * @param[out] ldu LDU buffer, the IMBE codewords are written at IMBE_LDU_OFFSETS.
+         */
+        void encodeLDU(int16_t* samples, uint8_t* ldu);
+        /**
+         * @brief Encodes contiguous PCM samples to the AMBE codewords of a DMR voice burst.
+         *  (The encoder must be in DMR AMBE mode.)
+         * @param[in] samples PCM samples (in short format), AMBE_CODEWORDS_PER_BURST * MBE_FRAME_SAMPLES long.
+         * @param[out] ambe AMBE codewords, AMBE_CODEWORDS_PER_BURST * RAW_AMBE_CODEWORD_BYTES long.
+         */
+        void encodeBurst(int16_t* samples, uint8_t* ambe);
 
     private:
         imbe_vocoder m_vocoder;
@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - MBE Vocoder
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include "common/Defines.h"
+#include "vocoder/MBETranscoder.h"
+#include "vocoder/imbe/globals.h"
+
+#include <cassert>
+#include <cstring>
+
+using namespace vocoder;
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const int MIN_REF_PITCH = 0x13E0;               // 19.875 in Q8.8 (IMBE b0 = 0)
+const int MAX_REF_PITCH = 0x7B20;               // 123.125 in Q8.8 (IMBE b0 = 207)
+
+const float IMBE_SA_LOG2_GAIN = 1.84f;          // log2(sa / Ml) of the IMBE quantizer
+
+const int AMBE_MAX_ERRS = 3;                    // errors after which a DMR AMBE frame is repeated
+const int IMBE_MAX_ERRS = 5;                    // errors after which an IMBE frame is repeated
+const int MAX_REPEATS = 3;                      // repeated frames after which the stream is muted
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to map decoded MBE model parameters onto the speech model parameters quantized by
+ *  the encoders.
+ *
+ *  The pitch, number of harmonics and bands are derived as the IMBE speech analysis derives them, the
+ *  source spectral amplitudes are converted to the amplitude domain of the target encoder (and interpolated
+ *  onto the target harmonics), and each band takes the voicing decision carrying the most energy.
+ * @param[in] mp Decoded MBE model parameters.
+ * @param ambe Flag indicating the parameters were decoded from DMR AMBE for IMBE (otherwise the reverse).
+ * @param mute Flag indicating the frame should be silent.
+ * @param[out] imbe_param Speech model parameters.
+ */
+static void mapMBEParms(const mbe_parms* mp, bool ambe, bool mute, IMBE_PARAM* imbe_param)
+{
+    ::memset(imbe_param, 0x00U, sizeof(IMBE_PARAM));
+
+    // the IMBE pitch period is related to the fundamental as w0 = 4pi / (2 * pitch + 0.5)
+    int refPitch = (int)((((2.0f * (float)M_PI) / mp->w0) - 0.25f) * 256.0f + 0.5f);
+    if (refPitch < MIN_REF_PITCH)
+        refPitch = MIN_REF_PITCH;
+    if (refPitch > MAX_REF_PITCH)
+        refPitch = MAX_REF_PITCH;
+
+    // L = fix(0.9254 * fix(pitch / 2 + 0.25))
+    int numHarms = (int)((CNST_0_9254_Q0_16 * (uint32_t)(((refPitch >> 1) + 0x40) >> 8)) >> 16);
+    if (numHarms < NUM_HARMS_MIN)
+        numHarms = NUM_HARMS_MIN;
+    if (numHarms > NUM_HARMS_MAX)
+        numHarms = NUM_HARMS_MAX;
+
+    int numBands = (numHarms <= 36) ? (numHarms + 2) / 3 : NUM_BANDS_MAX;
+
+    imbe_param->ref_pitch = (Word16)refPitch;
+    imbe_param->num_harms = (Word16)numHarms;
+    imbe_param->num_bands = (Word16)numBands;
+
+    int srcL = mp->L;
+    if (srcL < 1)
+        srcL = 1;
+    if (srcL > NUM_HARMS_MAX)
+        srcL = NUM_HARMS_MAX;
+
+    // convert the source log2 spectral amplitudes to the log2 amplitudes quantized by the target encoder, such
+    // that the target decodes to the same (synthesized) spectral amplitudes as the source
+    float lsa[NUM_HARMS_MAX + 1];
+    for (int l = 1; l <= srcL; l++) {
+        if (ambe) {
+            // DMR AMBE unvoiced amplitudes are scaled for noise synthesis, and the IMBE encoder quantizes sa
+            // such that it decodes to Ml = sa / 3.58
+            lsa[l] = mp->log2Ml[l] + IMBE_SA_LOG2_GAIN;
+            if (!mp->Vl[l])
+                lsa[l] += log2f(0.2046f / sqrtf(mp->w0));
+        }
+        else {
+            // the DMR AMBE encoder quantizes sa such that it decodes (including the noise synthesis scaling of
+            // unvoiced amplitudes) to Ml = sa
+            lsa[l] = mp->log2Ml[l];
+        }
+    }
+
+    // interpolate onto the target harmonics
+    float w0 = (2.0f * (float)M_PI) / (((float)refPitch / 256.0f) + 0.25f);
+    float ratio = w0 / mp->w0;
+
+    float energy[NUM_HARMS_MAX];
+    bool voiced[NUM_HARMS_MAX];
+    for (int l = 1; l <= numHarms; l++) {
+        float k = (float)l * ratio;
+        if (k < 1.0f)
+            k = 1.0f;
+        if (k > (float)srcL)
+            k = (float)srcL;
+
+        int k0 = (int)k;
+        int k1 = (k0 < srcL) ? k0 + 1 : k0;
+        float frac = k - (float)k0;
+
+        float sa = 1.0f;
+        if (!mute) {
+            sa = exp2f(((1.0f - frac) * lsa[k0]) + (frac * lsa[k1]));
+            if (sa < 1.0f)
+                sa = 1.0f;
+            if (sa > 32767.0f)
+                sa = 32767.0f;
+        }
+
+        imbe_param->sa[l - 1] = (Word16)sa;
+        energy[l - 1] = sa * sa;
+        voiced[l - 1] = mp->Vl[(int)(k + 0.5f) > srcL ? srcL : (int)(k + 0.5f)] != 0;
+    }
+
+    // voicing decisions are made per band of three harmonics (the last band takes the remainder)
+    int l = 0;
+    for (int band = 0; band < numBands; band++) {
+        int bandLen = (band < numBands - 1) ? 3 : numHarms - l;
+
+        float voicedEnergy = 0.0f, unvoicedEnergy = 0.0f;
+        for (int i = l; i < l + bandLen; i++) {
+            if (voiced[i])
+                voicedEnergy += energy[i];
+            else
+                unvoicedEnergy += energy[i];
+        }
+
+        Word16 v_uv = (!mute && voicedEnergy >= unvoicedEnergy) ? 1 : 0;
+        for (int i = 0; i < bandLen; i++, l++)
+            imbe_param->v_uv_dsn[l] = v_uv;
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the MBETranscoder class. */
+
+MBETranscoder::MBETranscoder(MBE_TRANSCODER_MODE mode) :
+    m_mode(mode),
+    m_decoder(nullptr),
+    m_encoder(nullptr),
+    m_mbelibParms(nullptr)
+{
+    if (m_mode == TRANSCODE_DMR_AMBE_TO_IMBE)
+        m_decoder = new MBEDecoder(DECODE_DMR_AMBE);
+    else
+        m_decoder = new MBEDecoder(DECODE_88BIT_IMBE);
+
+    m_mbelibParms = new mbelibParms();
+    reset();
+}
+
+/* Finalizes a instance of the MBETranscoder class. */
+
+MBETranscoder::~MBETranscoder()
+{
+    delete m_mbelibParms;
+    delete m_encoder;
+    delete m_decoder;
+}
+
+/* Transcodes the given MBE codeword using the transcoder mode. */
+
+int32_t MBETranscoder::transcode(uint8_t* codeword, uint8_t* output)
+{
+    assert(codeword != nullptr);
+    assert(output != nullptr);
+
+    mbe_parms* cur = m_mbelibParms->m_cur_mp;
+    mbe_parms* prev = m_mbelibParms->m_prev_mp;
+
+    // deinterleave and error correct the source codeword
+    char bits[88U];
+    ::memset(bits, 0x00U, 88U);
+    int32_t errs = m_decoder->decodeBits(codeword, bits);
+
+    // decode the MBE model parameters (handling bad frames as the decoder would)
+    bool ambe = (m_mode == TRANSCODE_DMR_AMBE_TO_IMBE);
+    bool mute = false;
+    if (ambe) {
+        int bad = mbe_decodeAmbe2450Parms(bits, cur, prev);
+        if (bad != 0) {
+            // erasure and tone frames have no harmonic model representation
+            mute = true;
+        }
+        else if (errs > AMBE_MAX_ERRS) {
+            mbe_useLastMbeParms(cur, prev);
+            cur->repeat++;
+        }
+        else {
+            cur->repeat = 0;
+        }
+    }
+    else {
+        int bad = mbe_decodeImbe4400Parms(bits, cur, prev);
+        if (bad == 1 || errs > IMBE_MAX_ERRS) {
+            mbe_useLastMbeParms(cur, prev);
+            cur->repeat++;
+        }
+        else {
+            cur->repeat = 0;
+        }
+    }
+
+    if (cur->repeat > MAX_REPEATS)
+        mute = true;
+
+    IMBE_PARAM imbe_param;
+    if (mute) {
+        mbe_initMbeParms(cur, prev, m_mbelibParms->m_prev_mp_enhanced);
+        mapMBEParms(cur, ambe, true, &imbe_param);
+    }
+    else {
+        mbe_moveMbeParms(cur, prev);
+        mapMBEParms(cur, ambe, false, &imbe_param);
+    }
+
+    // quantize the parameters with the target encoder
+    m_encoder->encodeParms(&imbe_param, output);
+    return errs;
+}
+
+/* Resets the transcoder state for a new voice stream. */
+
+void MBETranscoder::reset()
+{
+    mbe_initMbeParms(m_mbelibParms->m_cur_mp, m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced);
+
+    // the encoder quantizer prediction state is reset by starting over with a new encoder
+    if (m_encoder != nullptr)
+        delete m_encoder;
+
+    if (m_mode == TRANSCODE_DMR_AMBE_TO_IMBE)
+        m_encoder = new MBEEncoder(ENCODE_88BIT_IMBE);
+    else
+        m_encoder = new MBEEncoder(ENCODE_DMR_AMBE);
+}
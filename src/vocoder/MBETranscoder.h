@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - MBE Vocoder
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file MBETranscoder.h
+ * @ingroup vocoder
+ * @file MBETranscoder.cpp
+ * @ingroup vocoder
+ */
+#if !defined(__MBE_TRANSCODER_H__)
+#define __MBE_TRANSCODER_H__
+
+#include "common/Defines.h"
+#include "vocoder/MBEDecoder.h"
+#include "vocoder/MBEEncoder.h"
+
+#include <stdint.h>
+
+namespace vocoder
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Vocoder Transcoding Mode
+     */
+    enum MBE_TRANSCODER_MODE {
+        TRANSCODE_DMR_AMBE_TO_IMBE,     //! DMR AMBE to 88-bit IMBE (P25)
+        TRANSCODE_IMBE_TO_DMR_AMBE,     //! 88-bit IMBE (P25) to DMR AMBE
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements MBE transcoding between DMR AMBE and P25 IMBE codewords.
+     *
+     * Transcoding is done in the MBE parameter domain; the source codeword is decoded to MBE
+     * model parameters (fundamental frequency, voicing decisions and spectral amplitudes), which
+     * are mapped onto the harmonics of the target codec and quantized directly by its encoder.
+     * No speech is synthesized or analyzed, so the audio is only quantized once more, rather than
+     * degraded by a second vocoder pass, and it costs a fraction of a PCM round trip.
+     *
+     * Both quantizers are predictive, so an instance holds the state of a single voice stream.
+     */
+    class HOST_SW_API MBETranscoder {
+    public:
+        /**
+         * @brief Initializes a new instance of the MBETranscoder class.
+         * @param mode Transcoder mode.
+         */
+        MBETranscoder(MBE_TRANSCODER_MODE mode);
+        /**
+         * @brief Finalizes a instance of the MBETranscoder class.
+         */
+        ~MBETranscoder();
+
+        /**
+         * @brief Transcodes the given MBE codeword using the transcoder mode.
+         *  (Erasure and tone frames, and frames repeated too many times for errors, are
+         *  transcoded as silence.)
+         * @param[in] codeword Source MBE codeword (9 byte DMR AMBE or 11 byte IMBE).
+         * @param[out] output Target MBE codeword (11 byte IMBE or 9 byte DMR AMBE).
+         * @returns int32_t Number of errors corrected in the source codeword.
+         */
+        int32_t transcode(uint8_t* codeword, uint8_t* output);
+
+        /**
+         * @brief Resets the transcoder state for a new voice stream.
+         */
+        void reset();
+
+    private:
+        MBE_TRANSCODER_MODE m_mode;
+
+        MBEDecoder* m_decoder;
+        MBEEncoder* m_encoder;
+
+        mbelibParms* m_mbelibParms;
+    };
+} // namespace vocoder
+
+#endif // __MBE_TRANSCODER_H__
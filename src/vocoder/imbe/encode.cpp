@@ -89,3 +89,40 @@ void imbe_vocoder::encode(IMBE_PARAM* imbe_param, Word16* frame_vector, Word16*
     sa_encode(imbe_param);
     encode_frame_vector(imbe_param, frame_vector);
 }
+
+void imbe_vocoder::encode_params(IMBE_PARAM* imbe_param, Word16* frame_vector, const IMBE_PARAM* params)
+{
+    Word16 i, j, band_cnt, band_len, num_harms, num_bands, uv_harms_cnt, b1_vec, v_uv;
+
+    num_harms = params->num_harms;
+    num_bands = params->num_bands;
+
+    imbe_param->ref_pitch = params->ref_pitch;
+    imbe_param->num_harms = num_harms;
+    imbe_param->num_bands = num_bands;
+
+    // the voiced/unvoiced decision of each band is taken from its first harmonic
+    b1_vec = 0;
+    uv_harms_cnt = 0;
+    i = 0;
+    for (band_cnt = 0; band_cnt < num_bands; band_cnt++) {
+        band_len = (band_cnt < num_bands - 1) ? 3 : num_harms - i;
+        v_uv = (params->v_uv_dsn[i]) ? 1 : 0;
+
+        b1_vec = (b1_vec << 1) | v_uv;
+        for (j = 0; j < band_len; j++, i++) {
+            imbe_param->v_uv_dsn[i] = v_uv;
+            imbe_param->sa[i] = params->sa[i];
+            if (!v_uv)
+                uv_harms_cnt++;
+        }
+    }
+
+    imbe_param->l_uv = uv_harms_cnt;
+
+    imbe_param->b_vec[1] = b1_vec;                                       // Save encoded voiced/unvoiced decision
+    imbe_param->b_vec[0] = shr(sub(imbe_param->ref_pitch, 0x1380), 7);  // Pitch encode  fix(2*pitch - 39)
+
+    sa_encode(imbe_param);
+    encode_frame_vector(imbe_param, frame_vector);
+}
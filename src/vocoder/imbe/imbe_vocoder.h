@@ -48,6 +48,14 @@ public:
     {
         encode(&my_imbe_param, frame_vector, snd);
     }
+
+    // imbe_encode_params quantizes externally supplied speech model parameters
+    // (ref_pitch, num_harms, num_bands, v_uv_dsn[] and sa[]) without speech analysis,
+    // outputs u[] vectors as frame_vector[]
+    void imbe_encode_params(int16_t *frame_vector, const IMBE_PARAM *params)
+    {
+        encode_params(&my_imbe_param, frame_vector, params);
+    }
     
     // imbe_decode decodes IMBE codewords (frame_vector),
     // outputs the resulting 160 audio samples (snd)
@@ -93,6 +101,7 @@ private:
     void fft_init(void);
     void fft(Word16 *datam1, Word16 nn, Word16 isign);
     void encode(IMBE_PARAM *imbe_param, Word16 *frame_vector, Word16 *snd);
+    void encode_params(IMBE_PARAM *imbe_param, Word16 *frame_vector, const IMBE_PARAM *params);
     void pitch_est_init(void);
     Word32 autocorr(Word16 *sigin, Word16 shift, Word16 scale_shift);
     void e_p(Word16 *sigin, Word16 *res_buf);
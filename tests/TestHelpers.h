@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#if !defined(__TEST_HELPERS_H__)
+#define __TEST_HELPERS_H__
+
+#include "Defines.h"
+#include "common/Log.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to create a uniquely named (empty) temporary file, so parallel or repeated test runs
+ *  do not collide.
+ * @param name Base name of the temporary file.
+ * @returns std::string Path to the temporary file.
+ */
+inline std::string makeTempFile(const char* name)
+{
+    const char* dir = ::getenv("TMPDIR");
+    std::string path = std::string((dir != nullptr && dir[0] != '\0') ? dir : "/tmp") + "/" + name + ".XXXXXX";
+
+    std::vector<char> buffer(path.begin(), path.end());
+    buffer.push_back('\0');
+
+    int fd = ::mkstemp(buffer.data());
+    if (fd >= 0)
+        ::close(fd);
+
+    return std::string(buffer.data());
+}
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Sets the global log display level for the lifetime of the instance, restoring the previous level
+ *  when it leaves scope (including when a failed assertion unwinds the test).
+ */
+class ScopedLogDisplayLevel {
+public:
+    /**
+     * @brief Initializes a new instance of the ScopedLogDisplayLevel class.
+     * @param level Log display level.
+     */
+    explicit ScopedLogDisplayLevel(uint32_t level) :
+        m_previous(g_logDisplayLevel)
+    {
+        g_logDisplayLevel = level;
+    }
+    /**
+     * @brief Finalizes a instance of the ScopedLogDisplayLevel class.
+     */
+    ~ScopedLogDisplayLevel()
+    {
+        g_logDisplayLevel = m_previous;
+    }
+
+private:
+    uint32_t m_previous;
+};
+
+#endif // __TEST_HELPERS_H__
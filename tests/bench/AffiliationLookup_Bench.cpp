@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmarks
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/lookups/AffiliationLookup.h"
+#include "bench/Bench.h"
+#include "TestHelpers.h"
+
+using namespace lookups;
+
+#include <cstdio>
+
+BENCHMARK(AffiliationLookup) {
+    const uint32_t UNITS = 50000U;
+    const uint32_t TALKGROUPS = 500U;
+    const uint32_t LOOKUPS = 1000000U;
+    const uint32_t REG_TIMEOUT_SECS = 43200U;
+
+    // suppress the per-unit registration and affiliation logging
+    ScopedLogDisplayLevel logLevel(5U);
+
+    ChannelLookup chLookup;
+    chLookup.addRFCh(1U, true);
+    chLookup.addRFCh(2U, true);
+
+    AffiliationLookup aff("Bench", &chLookup, false);
+
+    uint32_t deregCount = 0U;
+    aff.setUnitDeregCallback([&](uint32_t srcId, bool automatic) {
+        if (automatic)
+            deregCount++;
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < UNITS; i++) {
+        aff.unitReg(100000U + i);
+        aff.groupAff(100000U + i, 1U + (i % TALKGROUPS));
+    }
+    int64_t elapsed = elapsedUs(start);
+    BENCH_CHECK(aff.unitRegSize() == UNITS);
+    BENCH_CHECK(aff.grpAffCount(1U) == UNITS / TALKGROUPS);
+    ::printf("AffiliationLookup: register and affiliate %u units across %u talkgroups in %lldus\n", UNITS, TALKGROUPS, (long long)elapsed);
+
+    // half of the talkgroups looked up have no affiliations
+    start = std::chrono::steady_clock::now();
+    uint32_t found = 0U;
+    for (uint32_t i = 0U; i < LOOKUPS; i++) {
+        if (aff.hasGroupAff(1U + (i % (TALKGROUPS * 2U))))
+            found++;
+    }
+    elapsed = elapsedUs(start);
+    BENCH_CHECK(found == LOOKUPS / 2U);
+    ::printf("AffiliationLookup: %u per-talkgroup lookups in %lldus\n", LOOKUPS, (long long)elapsed);
+
+    start = std::chrono::steady_clock::now();
+    uint32_t members = 0U;
+    for (uint32_t i = 0U; i < LOOKUPS; i++) {
+        uint32_t srcId = 100000U + (i % UNITS);
+        if (aff.isGroupAff(srcId, 1U + ((srcId - 100000U) % TALKGROUPS)))
+            members++;
+    }
+    elapsed = elapsedUs(start);
+    BENCH_CHECK(members == LOOKUPS);
+    ::printf("AffiliationLookup: %u unit affiliation checks in %lldus\n", LOOKUPS, (long long)elapsed);
+
+    // release half of the talkgroups by unaffiliating their units, and the other half at once
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < UNITS; i++) {
+        uint32_t dstId = 1U + (i % TALKGROUPS);
+        if (dstId % 2U)
+            BENCH_CHECK(aff.groupUnaff(100000U + i));
+    }
+    for (uint32_t i = 0U; i < TALKGROUPS; i++) {
+        if (!((1U + i) % 2U))
+            aff.clearGroupAff(1U + i, false);
+    }
+    elapsed = elapsedUs(start);
+    BENCH_CHECK(aff.grpAffSize() == 0U);
+    ::printf("AffiliationLookup: release %u affiliations in %lldus\n", UNITS, (long long)elapsed);
+
+    // one second clock ticks up to the registration timeout, none of which expire a unit
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < REG_TIMEOUT_SECS - 1U; i++)
+        aff.clock(1000U);
+    elapsed = elapsedUs(start);
+    BENCH_CHECK(deregCount == 0U);
+    ::printf("AffiliationLookup: %u idle clock ticks with %u registered units in %lldus\n", REG_TIMEOUT_SECS - 1U, UNITS,
+        (long long)elapsed);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < 3U; i++)
+        aff.clock(1000U);
+    elapsed = elapsedUs(start);
+    BENCH_CHECK(deregCount == UNITS);
+    BENCH_CHECK(aff.unitRegSize() == 0U);
+    ::printf("AffiliationLookup: expire %u unit registrations in %lldus\n", UNITS, (long long)elapsed);
+}
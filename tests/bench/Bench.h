@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmarks
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#if !defined(__BENCH_H__)
+#define __BENCH_H__
+
+#include "Defines.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Macros
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Declares a benchmark, which is registered with the benchmark runner.
+ * @param name Name of the benchmark.
+ */
+#define BENCHMARK(name)                                                         \
+    static void bench_##name();                                                 \
+    static BenchRegistration bench_##name##_reg(#name, bench_##name);           \
+    static void bench_##name()
+
+/**
+ * @brief Fails the running benchmark if the given condition does not hold.
+ * @param cond Condition.
+ */
+#define BENCH_CHECK(cond)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            ::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            ::exit(EXIT_FAILURE);                                               \
+        }                                                                       \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+//  Structure Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Represents a registered benchmark.
+ */
+struct Benchmark {
+    const char* name;
+    void (*func)();
+};
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Gets the list of registered benchmarks.
+ * @returns std::vector<Benchmark>& List of registered benchmarks.
+ */
+inline std::vector<Benchmark>& benchmarks()
+{
+    static std::vector<Benchmark> list;
+    return list;
+}
+
+/**
+ * @brief Helper to get the microseconds elapsed since the given time.
+ * @param start Start time.
+ * @returns int64_t Elapsed microseconds.
+ */
+inline int64_t elapsedUs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Registers a benchmark with the benchmark runner, at static initialization.
+ */
+class BenchRegistration {
+public:
+    /**
+     * @brief Initializes a new instance of the BenchRegistration class.
+     * @param name Name of the benchmark.
+     * @param func Benchmark entry point.
+     */
+    BenchRegistration(const char* name, void (*func)())
+    {
+        benchmarks().push_back(Benchmark { name, func });
+    }
+};
+
+#endif // __BENCH_H__
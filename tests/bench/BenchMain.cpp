@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmarks
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "bench/Bench.h"
+
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Program Entry Point
+// ---------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && (::strcmp(argv[1], "-h") == 0 || ::strcmp(argv[1], "--help") == 0)) {
+        ::fprintf(stdout, "usage: %s [benchmark name filter...]\n\nbenchmarks:\n", argv[0]);
+        for (const Benchmark& bench : benchmarks())
+            ::fprintf(stdout, "    %s\n", bench.name);
+        return EXIT_SUCCESS;
+    }
+
+    // with no arguments every benchmark is run, otherwise those whose name contains any of the arguments
+    for (const Benchmark& bench : benchmarks()) {
+        bool run = (argc <= 1);
+        for (int i = 1; i < argc; i++) {
+            if (::strstr(bench.name, argv[i]) != nullptr)
+                run = true;
+        }
+
+        if (!run)
+            continue;
+
+        ::fprintf(stdout, "[%s]\n", bench.name);
+        bench.func();
+    }
+
+    return EXIT_SUCCESS;
+}
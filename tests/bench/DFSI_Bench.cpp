@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmarks
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/dfsi/DFSIDefines.h"
+#include "common/p25/dfsi/frames/Frames.h"
+#include "bench/Bench.h"
+#include "p25/DFSITestData.h"
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::dfsi;
+using namespace p25::dfsi::defines;
+using namespace p25::dfsi::frames;
+
+#include <cstring>
+#include <random>
+
+BENCHMARK(DFSI) {
+    const uint32_t STREAM_LDUS = 50000U;
+
+    std::mt19937 rng(0x25DF51U);
+
+    uint8_t ldu[9U * 25U], rs[P25_LDU_LC_FEC_LENGTH_BYTES];
+    uint8_t lsd1, lsd2;
+    generateLDU(rng, ldu, rs, lsd1, lsd2);
+
+    uint8_t buffer[MotLDUSuperframe::LENGTH];
+    uint8_t decodedLDU[9U * 25U], decodedRS[P25_LDU_LC_FEC_LENGTH_BYTES];
+
+    // per-frame encode and decode through the owning frame classes, as ModemV24 did; the legacy encoders
+    // write past the end of some frames, so each frame is encoded into its own scratch buffer
+    uint8_t frame[MotFullRateVoice::LENGTH + MotStartVoiceFrame::LENGTH];
+    ::memset(decodedLDU, 0x00U, sizeof(decodedLDU));
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < STREAM_LDUS; i++) {
+        DUID::E duid = ((i & 1U) == 0U) ? DUID::LDU1 : DUID::LDU2;
+        for (uint8_t n = 0U; n < MotLDUSuperframe::FRAME_COUNT; n++) {
+            legacyEncode(duid, n, ldu, rs, lsd1, lsd2, frame);
+
+            uint8_t* imbe = decodedLDU + MotLDUSuperframe::LDU_IMBE_OFFSETS[n];
+            if (n == 0U) {
+                MotStartVoiceFrame svf = MotStartVoiceFrame(frame);
+                ::memcpy(imbe, svf.fullRateVoice->imbeData, RAW_IMBE_LENGTH_BYTES);
+            } else {
+                MotFullRateVoice voice = MotFullRateVoice(frame);
+                ::memcpy(imbe, voice.imbeData, RAW_IMBE_LENGTH_BYTES);
+            }
+        }
+    }
+    int64_t elapsed = elapsedUs(start);
+    BENCH_CHECK(::memcmp(decodedLDU, ldu, sizeof(decodedLDU)) == 0);
+    ::printf("DFSI: round trip %u LDUs through the per-frame classes in %lldus\n", STREAM_LDUS, (long long)elapsed);
+
+    // whole superframe encode and decode through the batch API
+    ::memset(decodedLDU, 0x00U, sizeof(decodedLDU));
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < STREAM_LDUS; i++) {
+        DUID::E duid = ((i & 1U) == 0U) ? DUID::LDU1 : DUID::LDU2;
+
+        MotLDUSuperframe encoder = MotLDUSuperframe();
+        encoder.setDUID(duid);
+        encoder.setRS(rs);
+        encoder.setLSD1(lsd1);
+        encoder.setLSD2(lsd2);
+        encoder.encode(buffer, ldu);
+
+        MotLDUSuperframe decoder = MotLDUSuperframe();
+        BENCH_CHECK(decoder.decode(buffer, MotLDUSuperframe::LENGTH, decodedLDU));
+        decoder.getRS(decodedRS);
+    }
+    elapsed = elapsedUs(start);
+    BENCH_CHECK(::memcmp(decodedLDU, ldu, sizeof(decodedLDU)) == 0);
+    BENCH_CHECK(::memcmp(decodedRS, rs, P25_LDU_LC_FEC_LENGTH_BYTES) == 0);
+    ::printf("DFSI: round trip %u LDUs through the superframe in %lldus\n", STREAM_LDUS, (long long)elapsed);
+
+    // superframe encode, then in-place reads of the voice frames (the start voice frame has no view)
+    ::memset(decodedLDU, 0x00U, sizeof(decodedLDU));
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < STREAM_LDUS; i++) {
+        DUID::E duid = ((i & 1U) == 0U) ? DUID::LDU1 : DUID::LDU2;
+
+        MotLDUSuperframe encoder = MotLDUSuperframe();
+        encoder.setDUID(duid);
+        encoder.setRS(rs);
+        encoder.setLSD1(lsd1);
+        encoder.setLSD2(lsd2);
+        encoder.encode(buffer, ldu);
+
+        for (uint8_t n = 1U; n < MotLDUSuperframe::FRAME_COUNT; n++) {
+            MotVoiceFrameView view = MotVoiceFrameView((const uint8_t*)(buffer + MotLDUSuperframe::frameOffset(n)));
+            ::memcpy(decodedLDU + MotLDUSuperframe::LDU_IMBE_OFFSETS[n], view.getIMBE(), RAW_IMBE_LENGTH_BYTES);
+        }
+    }
+    elapsed = elapsedUs(start);
+    BENCH_CHECK(::memcmp(decodedLDU + MotLDUSuperframe::LDU_IMBE_OFFSETS[1U], ldu + MotLDUSuperframe::LDU_IMBE_OFFSETS[1U],
+        sizeof(decodedLDU) - MotLDUSuperframe::LDU_IMBE_OFFSETS[1U]) == 0);
+    ::printf("DFSI: round trip %u LDUs through the superframe and in-place frame views in %lldus\n", STREAM_LDUS, (long long)elapsed);
+}
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmarks
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/network/json/json.h"
+#include "bench/Bench.h"
+#include "network/JSONTestData.h"
+
+#include <iterator>
+#include <string>
+
+BENCHMARK(JSONPeerList) {
+    const uint32_t PEERS = 250U;
+    const uint32_t ITERATIONS = 100U;
+
+    json::object response = json::object();
+    int status = 200;
+    response["status"].set<int>(status);
+    json::array peers = buildPeerList(PEERS);
+    response["peers"].set<json::array>(peers);
+    json::value v = json::value(response);
+
+    std::string payload = v.serialize();
+
+    auto start = std::chrono::steady_clock::now();
+    size_t length = 0U;
+    for (uint32_t i = 0U; i < ITERATIONS; i++) {
+        std::string iter;
+        v.serialize(std::back_inserter(iter));
+        length += iter.length();
+    }
+    int64_t elapsed = elapsedUs(start);
+    BENCH_CHECK(length == payload.length() * ITERATIONS);
+    ::printf("JSON: serialize %u peers (%u bytes) with an output iterator %u times in %lldus\n", PEERS, (uint32_t)payload.length(),
+        ITERATIONS, (long long)elapsed);
+
+    start = std::chrono::steady_clock::now();
+    length = 0U;
+    for (uint32_t i = 0U; i < ITERATIONS; i++)
+        length += v.serialize().length();
+    elapsed = elapsedUs(start);
+    BENCH_CHECK(length == payload.length() * ITERATIONS);
+    ::printf("JSON: serialize %u peers (%u bytes) %u times in %lldus\n", PEERS, (uint32_t)payload.length(), ITERATIONS, (long long)elapsed);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < ITERATIONS; i++) {
+        json::value parsed;
+        BENCH_CHECK(json::parse(parsed, payload).empty());
+    }
+    elapsed = elapsedUs(start);
+    ::printf("JSON: parse %u peers (%u bytes) %u times in %lldus\n", PEERS, (uint32_t)payload.length(), ITERATIONS, (long long)elapsed);
+}
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmarks
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "vocoder/MBEDecoder.h"
+#include "vocoder/MBEEncoder.h"
+#include "bench/Bench.h"
+
+using namespace vocoder;
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+const uint32_t LDU_LENGTH = 9U * 25U;
+const uint32_t LDU_SAMPLES = IMBE_CODEWORDS_PER_LDU * MBE_FRAME_SAMPLES;
+
+/**
+ * @brief Helper to generate a voiced test signal.
+ */
+static void generateVoice(int16_t* samples, uint32_t count)
+{
+    double phase = 0.0;
+    for (uint32_t i = 0U; i < count; i++) {
+        double f0 = 120.0 + 30.0 * ::sin(i * 0.0005);
+        phase += 2.0 * M_PI * f0 / 8000.0;
+
+        double sample = 0.0;
+        for (int h = 1; h <= 20; h++)
+            sample += (2000.0 / h) * ::sin(h * phase);
+        samples[i] = (int16_t)sample;
+    }
+}
+
+BENCHMARK(MBEBatch) {
+    const uint32_t LDUS = 200U;
+
+    std::vector<int16_t> pcm(LDU_SAMPLES);
+    generateVoice(pcm.data(), pcm.size());
+
+    uint8_t ldu[LDU_LENGTH];
+    ::memset(ldu, 0x00U, LDU_LENGTH);
+    MBEEncoder encoder(ENCODE_88BIT_IMBE);
+    encoder.encodeLDU(pcm.data(), ldu);
+
+    // codeword at a time, copying each codeword out of the LDU first
+    MBEDecoder decoder(DECODE_88BIT_IMBE);
+    int16_t samples[LDU_SAMPLES];
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < LDUS; i++) {
+        for (uint32_t n = 0U; n < IMBE_CODEWORDS_PER_LDU; n++) {
+            uint8_t imbe[RAW_IMBE_CODEWORD_BYTES];
+            ::memcpy(imbe, ldu + IMBE_LDU_OFFSETS[n], RAW_IMBE_CODEWORD_BYTES);
+            decoder.decode(imbe, samples + (n * MBE_FRAME_SAMPLES));
+        }
+    }
+    int64_t singleElapsed = elapsedUs(start);
+
+    // whole LDU at a time
+    MBEDecoder batchDecoder(DECODE_88BIT_IMBE);
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < LDUS; i++)
+        batchDecoder.decodeLDU(ldu, samples);
+    int64_t batchElapsed = elapsedUs(start);
+
+    ::printf("MBE Batch: decode %u LDUs codeword at a time in %lldus, batched in %lldus\n", LDUS,
+        (long long)singleElapsed, (long long)batchElapsed);
+
+    // encoding a whole LDU at a time
+    MBEEncoder batchEncoder(ENCODE_88BIT_IMBE);
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < LDUS / 10U; i++)
+        batchEncoder.encodeLDU(pcm.data(), ldu);
+    int64_t encodeElapsed = elapsedUs(start);
+
+    ::printf("MBE Batch: encode %u LDUs batched in %lldus\n", LDUS / 10U, (long long)encodeElapsed);
+}
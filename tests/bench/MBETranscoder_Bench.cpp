@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmarks
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "vocoder/MBETranscoder.h"
+#include "bench/Bench.h"
+
+using namespace vocoder;
+
+#include <cmath>
+
+/**
+ * @brief Helper to generate a frame of a voiced test signal, with a slowly sweeping pitch.
+ */
+static void generateVoice(int16_t* samples, uint32_t frame, double& phase)
+{
+    double f0 = 110.0 + 40.0 * ::sin(frame * 0.05);
+    for (uint32_t i = 0U; i < MBE_FRAME_SAMPLES; i++) {
+        phase += 2.0 * M_PI * f0 / 8000.0;
+
+        double sample = 0.0;
+        for (int h = 1; h <= 30 && h * f0 < 3800.0; h++)
+            sample += (2000.0 / h) * ::sin(h * phase);
+        samples[i] = (int16_t)sample;
+    }
+}
+
+BENCHMARK(MBETranscoder) {
+    const uint32_t CODEWORDS = 2000U;
+
+    MBEEncoder encoder(ENCODE_88BIT_IMBE);
+    static uint8_t codewords[CODEWORDS][11U];
+    double phase = 0.0;
+    for (uint32_t i = 0U; i < CODEWORDS; i++) {
+        int16_t samples[MBE_FRAME_SAMPLES];
+        generateVoice(samples, i, phase);
+        encoder.encode(samples, codewords[i]);
+    }
+
+    // transcoding in the parameter domain
+    MBETranscoder transcoder(TRANSCODE_IMBE_TO_DMR_AMBE);
+    uint8_t ambe[9U];
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < CODEWORDS; i++)
+        transcoder.transcode(codewords[i], ambe);
+    int64_t transcodeElapsed = elapsedUs(start);
+
+    // decoding to PCM and encoding again
+    MBEDecoder decoder(DECODE_88BIT_IMBE);
+    MBEEncoder ambeEncoder(ENCODE_DMR_AMBE);
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < CODEWORDS; i++) {
+        int16_t samples[MBE_FRAME_SAMPLES];
+        decoder.decode(codewords[i], samples);
+        ambeEncoder.encode(samples, ambe);
+    }
+    int64_t pcmElapsed = elapsedUs(start);
+
+    ::printf("Transcode: %u codewords in %lldus (%.0f/s), PCM round trip in %lldus (%.0f/s)\n", CODEWORDS,
+        (long long)transcodeElapsed, CODEWORDS * 1000000.0 / (transcodeElapsed + 1),
+        (long long)pcmElapsed, CODEWORDS * 1000000.0 / (pcmElapsed + 1));
+}
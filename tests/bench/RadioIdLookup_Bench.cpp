@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmarks
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/lookups/RadioIdLookup.h"
+#include "bench/Bench.h"
+#include "TestHelpers.h"
+
+using namespace lookups;
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+BENCHMARK(RadioIdLookup) {
+    const uint32_t ENTRIES = 250000U;
+    const uint32_t LOOKUPS = 1000000U;
+    const uint32_t MAX_THREADS = 8U;
+
+    std::string filename = makeTempFile("dvm_rid_lookup_bench");
+    std::string cacheFile = filename + ".cache";
+    {
+        std::ofstream file(filename, std::ofstream::out);
+        for (uint32_t i = 0U; i < ENTRIES; i++) {
+            // only every other radio ID is in the file, so half of the lookups below miss
+            file << (1000000U + (i * 2U)) << "," << (i % 10U != 0U ? 1 : 0) << ",RADIO " << i << "\n";
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    RadioIdLookup lookup(filename, 0U, true);
+    lookup.setBinaryCache(true);
+    BENCH_CHECK(lookup.read());
+    int64_t elapsed = elapsedUs(start);
+    BENCH_CHECK(lookup.table().size() == ENTRIES);
+    ::printf("RadioIdLookup: load %u entries from CSV in %lldus\n", ENTRIES, (long long)elapsed);
+
+    start = std::chrono::steady_clock::now();
+    RadioIdLookup cached(filename, 0U, true);
+    cached.setBinaryCache(true);
+    BENCH_CHECK(cached.read());
+    elapsed = elapsedUs(start);
+    BENCH_CHECK(cached.table().size() == ENTRIES);
+    ::printf("RadioIdLookup: load %u entries from the binary cache in %lldus\n", ENTRIES, (long long)elapsed);
+
+    for (uint32_t threadCount = 1U; threadCount <= MAX_THREADS; threadCount *= 2U) {
+        std::atomic<uint32_t> hits(0U);
+        std::vector<std::thread> threads;
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t t = 0U; t < threadCount; t++) {
+            threads.push_back(std::thread([&lookup, &hits, t]() {
+                uint32_t found = 0U;
+                for (uint32_t i = 0U; i < LOOKUPS; i++) {
+                    uint32_t id = 1000000U + ((i * 7919U + t) % (ENTRIES * 2U));
+                    if (!lookup.find(id).radioDefault())
+                        found++;
+                }
+                hits += found;
+            }));
+        }
+        for (auto& thread : threads)
+            thread.join();
+        elapsed = elapsedUs(start);
+
+        BENCH_CHECK(hits == (threadCount * LOOKUPS) / 2U);
+        double rate = (elapsed > 0) ? ((double)threadCount * LOOKUPS * 1000000.0) / (double)elapsed : 0.0;
+        ::printf("RadioIdLookup: %u lookups on %u reader thread(s) in %lldus (%.0f lookups/s)\n", threadCount * LOOKUPS, threadCount,
+            (long long)elapsed, rate);
+    }
+
+    ::remove(filename.c_str());
+    ::remove(cacheFile.c_str());
+}
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmarks
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/Log.h"
+#include "common/network/rest/RequestDispatcher.h"
+#include "common/network/rest/http/HTTPServer.h"
+#include "bench/Bench.h"
+#include "network/RESTTestEndpoints.h"
+
+using namespace network::rest;
+using namespace network::rest::http;
+
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Helper to calculate a request rate.
+ */
+static double requestRate(uint32_t requests, int64_t elapsedUs)
+{
+    return (elapsedUs > 0) ? ((double)requests * 1000000.0) / (double)elapsedUs : 0.0;
+}
+
+BENCHMARK(RequestDispatcher) {
+    const std::vector<std::string> uris = { "/version", "/status", "/peer/query", "/peer/count", "/tg/query",
+        "/rid/query", "/report-affiliations", "/dmr/debug/1/1" };
+    const uint32_t DISPATCHES = 200000U;
+    const uint32_t CONNECTIONS = 2000U;
+    const uint32_t CLIENTS = 4U;
+    const uint32_t BATCHES = 500U;
+    const uint32_t PIPELINE = 8U;
+
+    DefaultRequestDispatcher dispatcher;
+    registerFNEEndpoints(dispatcher);
+
+    // route table only, without the HTTP transport
+    auto start = std::chrono::steady_clock::now();
+    uint32_t ok = 0U;
+    for (uint32_t i = 0U; i < DISPATCHES; i++) {
+        HTTPPayload request = HTTPPayload::requestPayload(HTTP_GET, uris[i % uris.size()]);
+        HTTPPayload reply;
+        dispatcher.handleRequest(request, reply);
+        if (reply.status == HTTPPayload::OK)
+            ok++;
+    }
+    int64_t elapsed = elapsedUs(start);
+    BENCH_CHECK(ok == DISPATCHES);
+    ::printf("RequestDispatcher: dispatch %u requests in %lldus (%.0f requests/s)\n", DISPATCHES, (long long)elapsed,
+        requestRate(DISPATCHES, elapsed));
+
+    HTTPServer<DefaultRequestDispatcher> server("127.0.0.1", 0U, false, CLIENTS);
+    server.open();
+    server.setHandler(dispatcher);
+    std::thread thread([&]() { server.run(); });
+
+    asio::ip::tcp::endpoint endpoint(asio::ip::address::from_string("127.0.0.1"), server.port());
+
+    // one connection per request
+    {
+        asio::io_context io;
+
+        start = std::chrono::steady_clock::now();
+        ok = 0U;
+        for (uint32_t i = 0U; i < CONNECTIONS; i++) {
+            asio::ip::tcp::socket socket(io);
+            socket.connect(endpoint);
+
+            std::string request = "GET " + uris[i % uris.size()] + " HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n";
+            asio::write(socket, asio::buffer(request));
+
+            std::string response;
+            asio::error_code ec;
+            char buffer[1024];
+            while (!ec) {
+                size_t len = socket.read_some(asio::buffer(buffer), ec);
+                response.append(buffer, len);
+            }
+
+            if (response.find("200 OK") != std::string::npos)
+                ok++;
+        }
+        elapsed = elapsedUs(start);
+        BENCH_CHECK(ok == CONNECTIONS);
+        ::printf("RequestDispatcher: HTTPServer %u requests, one connection each, in %lldus (%.0f requests/s)\n", CONNECTIONS,
+            (long long)elapsed, requestRate(CONNECTIONS, elapsed));
+    }
+
+    // pipelined requests on persistent connections
+    {
+        std::vector<uint32_t> counts(CLIENTS, 0U);
+        std::vector<std::thread> clients;
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t c = 0U; c < CLIENTS; c++) {
+            clients.emplace_back([&, c]() {
+                asio::io_context io;
+                asio::ip::tcp::socket socket(io);
+                socket.connect(endpoint);
+
+                std::string batch;
+                for (uint32_t i = 0U; i < PIPELINE; i++)
+                    batch += "GET " + uris[(c + i) % uris.size()] + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+
+                std::string response;
+                char buffer[4096];
+                for (uint32_t b = 0U; b < BATCHES; b++) {
+                    asio::write(socket, asio::buffer(batch));
+
+                    uint32_t expected = counts[c] + PIPELINE;
+                    asio::error_code ec;
+                    while (!ec && counts[c] < expected) {
+                        size_t len = socket.read_some(asio::buffer(buffer), ec);
+                        response.append(buffer, len);
+
+                        size_t pos;
+                        while ((pos = response.find("200 OK")) != std::string::npos) {
+                            counts[c]++;
+                            response.erase(0U, pos + 6U);
+                        }
+                    }
+                }
+            });
+        }
+
+        for (auto& client : clients)
+            client.join();
+        elapsed = elapsedUs(start);
+
+        const uint32_t REQUESTS = CLIENTS * BATCHES * PIPELINE;
+        uint32_t total = 0U;
+        for (uint32_t count : counts)
+            total += count;
+        BENCH_CHECK(total == REQUESTS);
+        ::printf("RequestDispatcher: HTTPServer %u keep-alive requests on %u connections in %lldus (%.0f requests/s)\n", REQUESTS,
+            CLIENTS, (long long)elapsed, requestRate(REQUESTS, elapsed));
+    }
+
+    server.stop();
+    thread.join();
+}
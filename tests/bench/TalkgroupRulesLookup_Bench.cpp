@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Benchmarks
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/lookups/TalkgroupRulesLookup.h"
+#include "common/yaml/Yaml.h"
+#include "bench/Bench.h"
+#include "lookups/TalkgroupRulesTestData.h"
+#include "TestHelpers.h"
+
+using namespace lookups;
+
+#include <cstdio>
+#include <string>
+#include <sys/resource.h>
+
+/**
+ * @brief Helper to get the peak resident set size of the process, in kilobytes.
+ */
+static long peakRSS()
+{
+    struct rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0L;
+    return usage.ru_maxrss;
+}
+
+BENCHMARK(TalkgroupRulesLookup) {
+    const uint32_t RULES = 20000U;
+
+    // suppress the per-rule informational logging while loading
+    ScopedLogDisplayLevel logLevel(4U);
+
+    std::string filename = makeTempFile("dvm_tg_rules_bench");
+    writeTalkgroupRules(filename, RULES);
+
+    // the peak RSS is a high water mark for the whole process, run this benchmark on its own for a meaningful figure
+    long rss = peakRSS();
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        yaml::Node rules;
+        BENCH_CHECK(yaml::Parse(rules, filename.c_str()));
+        BENCH_CHECK(rules["groupVoice"].size() == RULES);
+    }
+    int64_t elapsed = elapsedUs(start);
+    long parseRSS = peakRSS();
+    ::printf("TalkgroupRulesLookup: parse %u rules as YAML in %lldus (peak RSS %ldKB, +%ldKB)\n", RULES, (long long)elapsed,
+        parseRSS, parseRSS - rss);
+
+    start = std::chrono::steady_clock::now();
+    TalkgroupRulesLookup lookup(filename, 0U, true);
+    BENCH_CHECK(lookup.read());
+    elapsed = elapsedUs(start);
+    BENCH_CHECK(lookup.groupVoice().size() == RULES);
+    BENCH_CHECK(lookup.find(11U).name() == "TG 10");
+    long loadRSS = peakRSS();
+    ::printf("TalkgroupRulesLookup: load %u rules in %lldus (peak RSS %ldKB, +%ldKB)\n", RULES, (long long)elapsed,
+        loadRSS, loadRSS - rss);
+
+    ::remove(filename.c_str());
+}
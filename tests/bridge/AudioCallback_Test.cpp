@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/SPSCRingBuffer.h"
+#include "vocoder/MBEDecoder.h"
+#include "vocoder/MBEEncoder.h"
+#include "bridge/AudioCallback.h"
+
+using namespace vocoder;
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+const uint32_t SAMPLES = 160U;                  // 20ms at 8kHz
+
+TEST_CASE("AudioCallback", "[bridge][audio]") {
+    SECTION("RingBuffer") {
+        SPSCRingBuffer<short> buffer(10U, "Test Buffer");
+        REQUIRE(buffer.length() == 10U);
+        REQUIRE(buffer.freeSpace() == 10U);
+
+        short data[10U];
+        for (uint32_t i = 0U; i < 10U; i++)
+            data[i] = (short)i;
+
+        // fill and drain across the end of the buffer
+        short out[10U];
+        REQUIRE(buffer.addData(data, 7U));
+        REQUIRE(buffer.get(out, 5U));
+        REQUIRE(buffer.addData(data, 6U));
+        REQUIRE(buffer.dataSize() == 8U);
+        REQUIRE(buffer.get(out, 8U));
+        REQUIRE(out[0U] == 5);
+        REQUIRE(out[1U] == 6);
+        REQUIRE(out[2U] == 0);
+        REQUIRE(out[7U] == 5);
+
+        // data that does not fit is dropped and counted
+        REQUIRE(buffer.addData(data, 10U));
+        REQUIRE_FALSE(buffer.addData(data, 1U));
+        REQUIRE(buffer.overruns() == 1U);
+        REQUIRE(buffer.dataSize() == 10U);
+
+        // running dry is counted once, and only after data was being retrieved
+        REQUIRE(buffer.get(out, 10U));
+        REQUIRE_FALSE(buffer.get(out, 1U));
+        REQUIRE_FALSE(buffer.get(out, 1U));
+        REQUIRE(buffer.underruns() == 1U);
+
+        SPSCRingBuffer<short> idle(10U, "Idle Buffer");
+        REQUIRE_FALSE(idle.get(out, 1U));
+        REQUIRE(idle.underruns() == 0U);
+    }
+
+    SECTION("Threaded") {
+        const uint32_t FRAMES = 20000U;
+        SPSCRingBuffer<short> buffer(SAMPLES * 4U, "Test Buffer");
+
+        std::thread producer([&]() {
+            short frame[SAMPLES];
+            for (uint32_t n = 0U; n < FRAMES; n++) {
+                for (uint32_t i = 0U; i < SAMPLES; i++)
+                    frame[i] = (short)((n * SAMPLES) + i);
+                while (buffer.freeSpace() < SAMPLES)
+                    std::this_thread::yield();
+                buffer.addData(frame, SAMPLES);
+            }
+        });
+
+        uint32_t mismatches = 0U;
+        short frame[SAMPLES];
+        for (uint32_t n = 0U; n < FRAMES; n++) {
+            while (buffer.dataSize() < SAMPLES)
+                std::this_thread::yield();
+            buffer.get(frame, SAMPLES);
+            for (uint32_t i = 0U; i < SAMPLES; i++) {
+                if (frame[i] != (short)((n * SAMPLES) + i))
+                    mismatches++;
+            }
+        }
+
+        producer.join();
+        REQUIRE(mismatches == 0U);
+        REQUIRE(buffer.overruns() == 0U);
+        REQUIRE(buffer.underruns() == 0U);
+    }
+
+    SECTION("Callback") {
+        SPSCRingBuffer<short> input(SAMPLES * 4U, "Input Audio Buffer");
+        SPSCRingBuffer<short> output(SAMPLES * 4U, "Output Audio Buffer");
+
+        short captured[SAMPLES], playback[SAMPLES];
+        for (uint32_t i = 0U; i < SAMPLES; i++) {
+            captured[i] = (short)i;
+            playback[i] = (short)(SAMPLES - i);
+        }
+
+        // captured audio is buffered, and buffered audio is played back
+        REQUIRE(output.addData(playback, SAMPLES));
+        short out[SAMPLES];
+        ::memset(out, 0x00U, sizeof(out));
+        audioCallback(input, output, out, captured, SAMPLES);
+        REQUIRE(::memcmp(out, playback, sizeof(out)) == 0);
+        REQUIRE(input.dataSize() == SAMPLES);
+
+        short in[SAMPLES];
+        REQUIRE(input.get(in, SAMPLES));
+        REQUIRE(::memcmp(in, captured, sizeof(in)) == 0);
+
+        // without enough buffered audio the device buffer is left untouched, and the underrun counted
+        ::memset(out, 0x00U, sizeof(out));
+        audioCallback(input, output, out, captured, SAMPLES);
+        REQUIRE(out[0U] == 0);
+        REQUIRE(output.underruns() == 1U);
+    }
+
+    SECTION("RealTime") {
+        const uint32_t RUN_MS = 1000U;
+        const uint32_t PREBUFFER_FRAMES = 4U;
+
+        SPSCRingBuffer<short> input(SAMPLES * 32U, "Input Audio Buffer");
+        SPSCRingBuffer<short> output(SAMPLES * 32U, "Output Audio Buffer");
+
+        // the encoder and network threads contend for this lock as the bridge audio and network threads do;
+        // the callback must never wait on it
+        std::mutex audioMutex;
+        std::atomic<bool> running(true);
+
+        uint8_t codeword[11U];
+        short tone[SAMPLES];
+        for (uint32_t i = 0U; i < SAMPLES; i++)
+            tone[i] = (short)(((i / 20U) % 2U) ? 4000 : -4000);
+        {
+            MBEEncoder encoder(ENCODE_88BIT_IMBE);
+            encoder.encode(tone, codeword);
+        }
+
+        // network thread; decodes received audio into the output buffer at the frame rate
+        MBEDecoder decoder(DECODE_88BIT_IMBE);
+        short frame[SAMPLES];
+        decoder.decode(codeword, frame);
+        for (uint32_t i = 0U; i < PREBUFFER_FRAMES; i++)
+            output.addData(frame, SAMPLES);
+
+        std::thread network([&]() {
+            auto deadline = std::chrono::steady_clock::now();
+            while (running) {
+                deadline += std::chrono::milliseconds(20);
+                std::this_thread::sleep_until(deadline);
+
+                short samples[SAMPLES];
+                std::lock_guard<std::mutex> lock(audioMutex);
+                decoder.decode(codeword, samples);
+                output.addData(samples, SAMPLES);
+            }
+        });
+
+        // encoder thread; buffers captured audio and encodes a whole LDU at a time under the lock
+        std::thread encoderThread([&]() {
+            MBEEncoder encoder(ENCODE_88BIT_IMBE);
+            short samples[SAMPLES * IMBE_CODEWORDS_PER_LDU];
+            uint8_t ldu[9U * 25U];
+            uint32_t n = 0U;
+            while (running) {
+                if (input.dataSize() < SAMPLES) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    continue;
+                }
+
+                input.get(samples + (n * SAMPLES), SAMPLES);
+                if (++n == IMBE_CODEWORDS_PER_LDU) {
+                    std::lock_guard<std::mutex> lock(audioMutex);
+                    encoder.encodeLDU(samples, ldu);
+                    n = 0U;
+                }
+            }
+        });
+
+        // audio device thread; runs the bridge audio callback every period
+        auto deadline = std::chrono::steady_clock::now();
+        for (uint32_t i = 0U; i < RUN_MS / 20U; i++) {
+            deadline += std::chrono::milliseconds(20);
+            std::this_thread::sleep_until(deadline);
+
+            short out[SAMPLES];
+            audioCallback(input, output, out, tone, SAMPLES);
+        }
+
+        running = false;
+        network.join();
+        encoderThread.join();
+
+        REQUIRE(input.overruns() == 0U);
+        REQUIRE(output.overruns() == 0U);
+        REQUIRE(output.underruns() == 0U);
+    }
+}
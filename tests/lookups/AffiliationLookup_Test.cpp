@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/Log.h"
+#include "common/lookups/AffiliationLookup.h"
+
+using namespace lookups;
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("AffiliationLookup", "[lookups][affiliation]") {
+    ChannelLookup chLookup;
+    chLookup.addRFCh(1U, true);
+    chLookup.addRFCh(2U, true);
+
+    SECTION("GroupAffiliationIndex") {
+        AffiliationLookup aff("Test", &chLookup, false);
+
+        aff.groupAff(1001U, 1U);
+        aff.groupAff(1002U, 1U);
+        aff.groupAff(1003U, 2U);
+        REQUIRE(aff.hasGroupAff(1U));
+        REQUIRE(aff.grpAffCount(1U) == 2U);
+        REQUIRE(aff.grpAffCount(2U) == 1U);
+
+        // re-affiliating moves the source ID to the new talkgroup
+        aff.groupAff(1002U, 2U);
+        REQUIRE(aff.grpAffCount(1U) == 1U);
+        REQUIRE(aff.grpAffCount(2U) == 2U);
+        REQUIRE(aff.isGroupAff(1002U, 2U));
+        REQUIRE_FALSE(aff.isGroupAff(1002U, 1U));
+
+        REQUIRE(aff.groupUnaff(1001U));
+        REQUIRE_FALSE(aff.hasGroupAff(1U));
+        REQUIRE_FALSE(aff.groupUnaff(1001U));
+
+        std::vector<uint32_t> released = aff.clearGroupAff(2U, false);
+        REQUIRE(released.size() == 2U);
+        REQUIRE_FALSE(aff.hasGroupAff(2U));
+        REQUIRE(aff.grpAffSize() == 0U);
+    }
+
+    SECTION("GroupAffiliationCallback") {
+        AffiliationLookup aff("Test", &chLookup, false);
+
+        std::vector<std::pair<uint32_t, bool>> changes;
+        aff.setGroupAffCallback([&](uint32_t dstId, bool affiliated) {
+            changes.push_back(std::make_pair(dstId, affiliated));
+        });
+
+        // only the first affiliation and the last unaffiliation of a talkgroup are reported
+        aff.groupAff(1001U, 1U);
+        aff.groupAff(1002U, 1U);
+        REQUIRE(changes.size() == 1U);
+        REQUIRE(changes[0U] == std::make_pair(1U, true));
+
+        aff.groupAff(1001U, 2U);
+        REQUIRE(changes.size() == 2U);
+        REQUIRE(changes[1U] == std::make_pair(2U, true));
+
+        aff.groupUnaff(1002U);
+        REQUIRE(changes.size() == 3U);
+        REQUIRE(changes[2U] == std::make_pair(1U, false));
+
+        aff.clearGroupAff(0U, true);
+        REQUIRE(changes.size() == 4U);
+        REQUIRE(changes[3U] == std::make_pair(2U, false));
+    }
+
+    SECTION("UnitRegistrationTimeout") {
+        AffiliationLookup aff("Test", &chLookup, false);
+
+        uint32_t deregCount = 0U;
+        aff.setUnitDeregCallback([&](uint32_t srcId, bool automatic) {
+            if (automatic)
+                deregCount++;
+        });
+
+        aff.unitReg(1001U);
+        aff.unitReg(1002U);
+        aff.groupAff(1001U, 1U);
+        REQUIRE(aff.unitRegSize() == 2U);
+        REQUIRE(aff.unitRegTimeout(1001U) == 43200U);
+
+        // advance 6 hours, then keep the second unit alive
+        for (uint32_t i = 0U; i < 6U * 3600U; i++)
+            aff.clock(1000U);
+        REQUIRE(aff.unitRegTimer(1001U) == 6U * 3600U);
+        aff.touchUnitReg(1002U);
+        REQUIRE(aff.unitRegTimer(1002U) == 0U);
+
+        // advance past the registration timeout of the first unit
+        for (uint32_t i = 0U; i < 6U * 3600U + 2U; i++)
+            aff.clock(1000U);
+        REQUIRE_FALSE(aff.isUnitReg(1001U));
+        REQUIRE_FALSE(aff.hasGroupAff(1U));
+        REQUIRE(aff.isUnitReg(1002U));
+        REQUIRE(deregCount == 1U);
+    }
+
+    SECTION("GrantTimeout") {
+        AffiliationLookup aff("Test", &chLookup, false);
+
+        uint32_t releasedDstId = 0U;
+        aff.setReleaseGrantCallback([&](uint32_t chNo, uint32_t dstId, uint8_t slot) {
+            releasedDstId = dstId;
+        });
+
+        REQUIRE(aff.grantCh(1U, 1001U, 5U, true, false));
+        REQUIRE(aff.isGranted(1U));
+
+        for (uint32_t i = 0U; i < 400U; i++)
+            aff.clock(10U);
+        aff.touchGrant(1U);
+        for (uint32_t i = 0U; i < 400U; i++)
+            aff.clock(10U);
+        REQUIRE(aff.isGranted(1U));
+
+        for (uint32_t i = 0U; i < 120U; i++)
+            aff.clock(10U);
+        REQUIRE_FALSE(aff.isGranted(1U));
+        REQUIRE(releasedDstId == 1U);
+    }
+
+    SECTION("ManyUnits") {
+        const uint32_t UNITS = 5000U;
+        const uint32_t TALKGROUPS = 50U;
+
+        // suppress the affiliation release warnings
+        uint32_t logDisplayLevel = g_logDisplayLevel;
+        g_logDisplayLevel = 5U;
+
+        AffiliationLookup aff("Test", &chLookup, false);
+
+        for (uint32_t i = 0U; i < UNITS; i++) {
+            aff.unitReg(100000U + i);
+            aff.groupAff(100000U + i, 1U + (i % TALKGROUPS));
+        }
+        REQUIRE(aff.unitRegSize() == UNITS);
+        REQUIRE(aff.grpAffCount(1U) == UNITS / TALKGROUPS);
+
+        uint32_t found = 0U;
+        for (uint32_t i = 0U; i < UNITS; i++) {
+            if (aff.hasGroupAff(1U + (i % (TALKGROUPS * 2U))))
+                found++;
+        }
+        REQUIRE(found == UNITS / 2U);
+
+        // ten seconds of 10ms clock ticks
+        for (uint32_t i = 0U; i < 1000U; i++)
+            aff.clock(10U);
+        REQUIRE(aff.unitRegSize() == UNITS);
+
+        for (uint32_t i = 0U; i < TALKGROUPS; i++)
+            aff.clearGroupAff(1U + i, false);
+        REQUIRE(aff.grpAffSize() == 0U);
+
+        for (uint32_t i = 0U; i < UNITS; i++)
+            aff.unitDereg(100000U + i);
+        REQUIRE(aff.unitRegSize() == 0U);
+
+        g_logDisplayLevel = logDisplayLevel;
+    }
+}
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "TestHelpers.h"
+#include "common/lookups/FlatIdMap.h"
+#include "common/lookups/PackedTable.h"
+#include "common/lookups/RadioIdLookup.h"
+
+using namespace lookups;
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+TEST_CASE("RadioIdLookup", "[lookups][rid]") {
+    SECTION("FlatIdMapMatchesUnorderedMap") {
+        std::mt19937 rng(0x1D1DU);
+        std::uniform_int_distribution<uint32_t> ids(1U, 4096U);
+        std::uniform_int_distribution<uint32_t> ops(0U, 2U);
+
+        FlatIdMap<uint32_t> map;
+        std::unordered_map<uint32_t, uint32_t> reference;
+        for (uint32_t i = 0U; i < 200000U; i++) {
+            uint32_t id = ids(rng);
+            switch (ops(rng)) {
+            case 0U:
+                map[id] = i;
+                reference[id] = i;
+                break;
+            case 1U:
+                REQUIRE(map.erase(id) == reference.erase(id));
+                break;
+            default:
+            {
+                const uint32_t* value = map.get(id);
+                auto it = reference.find(id);
+                REQUIRE((value != nullptr) == (it != reference.end()));
+                if (value != nullptr)
+                    REQUIRE(*value == it->second);
+            }
+            break;
+            }
+        }
+
+        REQUIRE(map.size() == reference.size());
+        for (auto entry : map) {
+            REQUIRE(reference.at(entry.first) == entry.second);
+        }
+    }
+
+    SECTION("LoadAndConcurrentFind") {
+        const uint32_t ENTRIES = 250000U;
+        const uint32_t THREADS = 4U;
+        const uint32_t LOOKUPS = 100000U;
+
+        std::string filename = makeTempFile("dvm_rid_lookup_test");
+        {
+            std::ofstream file(filename, std::ofstream::out);
+            for (uint32_t i = 0U; i < ENTRIES; i++) {
+                // only every other radio ID is in the file, so half of the lookups below miss
+                file << (1000000U + (i * 2U)) << "," << (i % 10U != 0U ? 1 : 0) << ",RADIO " << i << "\n";
+            }
+        }
+
+        RadioIdLookup lookup(filename, 0U, true);
+        REQUIRE(lookup.read());
+
+        REQUIRE(lookup.table().size() == ENTRIES);
+        REQUIRE(lookup.find(1000000U).radioEnabled() == false);
+        REQUIRE(lookup.find(1000002U).radioEnabled() == true);
+        REQUIRE(lookup.find(1000002U).radioAlias() == "RADIO 1");
+        REQUIRE(lookup.find(1000001U).radioDefault() == true);
+        REQUIRE(lookup.hasEntry(1000002U));
+        REQUIRE_FALSE(lookup.hasEntry(1000003U));
+
+        std::atomic<uint32_t> hits(0U);
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0U; t < THREADS; t++) {
+            threads.push_back(std::thread([&lookup, &hits, t]() {
+                uint32_t found = 0U;
+                for (uint32_t i = 0U; i < LOOKUPS; i++) {
+                    uint32_t id = 1000000U + ((i * 7919U + t) % (ENTRIES * 2U));
+                    if (!lookup.find(id).radioDefault())
+                        found++;
+                }
+                hits += found;
+            }));
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(hits == (THREADS * LOOKUPS) / 2U);
+
+        lookup.eraseEntry(1000002U);
+        REQUIRE(lookup.find(1000002U).radioDefault() == true);
+        REQUIRE(lookup.table().size() == ENTRIES - 1U);
+
+        ::remove(filename.c_str());
+    }
+
+    SECTION("BinaryCacheRoundTrip") {
+        std::string filename = makeTempFile("dvm_rid_cache_test");
+        std::string cacheFile = filename + ".cache";
+        ::remove(cacheFile.c_str());
+        {
+            std::ofstream file(filename, std::ofstream::out | std::ofstream::binary);
+            file << "# comment line\r\n";
+            file << "1234,1,ALIAS ONE,10.0.0.1\r\n";
+            file << "\r\n";
+            file << "5678,0,,\n";
+            file << "9999,1\n";
+            file << "1234,0,ALIAS TWO";
+        }
+
+        RadioIdLookup lookup(filename, 0U, true);
+        lookup.setBinaryCache(true);
+        REQUIRE(lookup.read());
+        REQUIRE(lookup.table().size() == 3U);
+        REQUIRE(lookup.find(1234U).radioEnabled() == false);
+        REQUIRE(lookup.find(1234U).radioAlias() == "ALIAS TWO");
+        REQUIRE(lookup.find(5678U).radioAlias() == "");
+        REQUIRE(lookup.find(9999U).radioEnabled() == true);
+
+        std::ifstream cache(cacheFile, std::ifstream::in);
+        REQUIRE(cache.good());
+        cache.close();
+
+        // a second instance loads the unchanged lookup file from the cache
+        RadioIdLookup cached(filename, 0U, true);
+        cached.setBinaryCache(true);
+        REQUIRE(cached.read());
+        REQUIRE(cached.table().size() == 3U);
+        for (auto entry : lookup.table()) {
+            RadioId other = cached.find(entry.first);
+            REQUIRE(other.radioDefault() == false);
+            REQUIRE(other.radioEnabled() == entry.second.radioEnabled());
+            REQUIRE(other.radioAlias() == entry.second.radioAlias());
+            REQUIRE(other.radioIPAddress() == entry.second.radioIPAddress());
+        }
+
+        // a cache whose entry count exceeds its length is ignored, and the lookup file is parsed instead
+        std::vector<char> contents;
+        {
+            std::ifstream in(cacheFile, std::ifstream::in | std::ifstream::binary);
+            contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        REQUIRE(contents.size() > PACKED_TABLE_MAGIC_LEN + 20U);
+        contents.resize(PACKED_TABLE_MAGIC_LEN + 16U);
+        contents.insert(contents.end(), { '\xFF', '\xFF', '\xFF', '\xFF' });
+        {
+            std::ofstream out(cacheFile, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+            out.write(contents.data(), contents.size());
+        }
+
+        RadioIdLookup corrupt(filename, 0U, true);
+        corrupt.setBinaryCache(true);
+        REQUIRE(corrupt.read());
+        REQUIRE(corrupt.table().size() == 3U);
+        REQUIRE(corrupt.find(1234U).radioAlias() == "ALIAS TWO");
+
+        ::remove(cacheFile.c_str());
+        ::remove(filename.c_str());
+    }
+
+    SECTION("SerializeRoundTrip") {
+        RadioIdLookup lookup("", 0U, true);
+        REQUIRE(lookup.deserialize((const uint8_t*)"100,1,ALPHA\n200,0\n300,1,GAMMA,10.0.0.3\n", 39U));
+        REQUIRE(lookup.table().size() == 3U);
+
+        std::vector<uint8_t> data;
+        lookup.serialize(data);
+
+        RadioIdLookup other("", 0U, true);
+        REQUIRE(other.deserialize(data.data(), data.size()));
+        REQUIRE(other.table().size() == 3U);
+        REQUIRE(other.find(100U).radioAlias() == "ALPHA");
+        REQUIRE(other.find(200U).radioEnabled() == false);
+        REQUIRE(other.find(300U).radioIPAddress() == "10.0.0.3");
+
+        // a truncated table is rejected and leaves the existing table in place
+        REQUIRE_FALSE(other.deserialize(data.data(), data.size() - 1U));
+        REQUIRE(other.table().size() == 3U);
+
+        // an entry count the table cannot hold is rejected before anything is allocated for it
+        std::vector<uint8_t> oversized(data.begin(), data.begin() + PACKED_TABLE_MAGIC_LEN);
+        oversized.insert(oversized.end(), { 0xFFU, 0xFFU, 0xFFU, 0xFFU });
+        REQUIRE_FALSE(other.deserialize(oversized.data(), oversized.size()));
+        REQUIRE(other.table().size() == 3U);
+
+        oversized.insert(oversized.end(), data.begin() + PACKED_TABLE_MAGIC_LEN + 4U, data.end());
+        REQUIRE_FALSE(other.deserialize(oversized.data(), oversized.size()));
+        REQUIRE(other.table().size() == 3U);
+
+        // a table truncated within its first entry is rejected
+        REQUIRE_FALSE(other.deserialize(data.data(), PACKED_TABLE_MAGIC_LEN + 4U + 2U));
+        REQUIRE(other.table().size() == 3U);
+
+        // an empty table is still serialized, and clears the receiving table
+        RadioIdLookup empty("", 0U, true);
+        empty.serialize(data);
+        REQUIRE(data.size() == PACKED_TABLE_MAGIC_LEN + 4U);
+        REQUIRE(other.deserialize(data.data(), data.size()));
+        REQUIRE(other.table().size() == 0U);
+    }
+}
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "TestHelpers.h"
+#include "common/Log.h"
+#include "common/lookups/TalkgroupRulesLookup.h"
+#include "common/yaml/Yaml.h"
+#include "lookups/TalkgroupRulesTestData.h"
+
+using namespace lookups;
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <string>
+
+TEST_CASE("TalkgroupRulesLookup", "[lookups][tgid]") {
+    SECTION("ParseLargeRulesFile") {
+        const uint32_t RULES = 2000U;
+
+        // suppress the per-rule informational logging while loading
+        ScopedLogDisplayLevel logLevel(4U);
+
+        std::string filename = makeTempFile("dvm_tg_rules_test");
+        writeTalkgroupRules(filename, RULES);
+
+        yaml::Node rules;
+        REQUIRE(yaml::Parse(rules, filename.c_str()));
+        REQUIRE(rules["groupVoice"].size() == RULES);
+        REQUIRE(rules["groupVoice"][5]["name"].as<std::string>() == "TG 5");
+        REQUIRE(rules["groupVoice"][5]["config"]["exclusion"][1].as<uint32_t>() == 5678U);
+
+        TalkgroupRulesLookup lookup(filename, 0U, true);
+        REQUIRE(lookup.read());
+
+        REQUIRE(lookup.groupVoice().size() == RULES);
+        TalkgroupRuleGroupVoice tg = lookup.find(11U);
+        REQUIRE(tg.name() == "TG 10");
+        REQUIRE_FALSE(tg.config().active());
+        REQUIRE(tg.config().exclusion().size() == 2U);
+        REQUIRE(tg.config().rewrite()[0U].tgId() == 50010U);
+
+        // reloading the unchanged rules file does not re-parse it
+        uint32_t version = lookup.version();
+        REQUIRE(lookup.reload());
+        REQUIRE(lookup.version() == version);
+
+        // reloading after the rules are changed in memory restores the rules from the file
+        lookup.eraseEntry(11U, 1U);
+        REQUIRE(lookup.find(11U).isInvalid());
+        REQUIRE(lookup.reload());
+        REQUIRE(lookup.find(11U).name() == "TG 10");
+
+        ::remove(filename.c_str());
+    }
+}
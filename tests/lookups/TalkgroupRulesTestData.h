@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#if !defined(__TALKGROUP_RULES_TEST_DATA_H__)
+#define __TALKGROUP_RULES_TEST_DATA_H__
+
+#include "Defines.h"
+
+#include <fstream>
+#include <string>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to write a talkgroup rules file with the given number of group voice rules; rule i is
+ *  named "TG i", has talkgroup ID i + 1 and every tenth rule is inactive.
+ */
+inline void writeTalkgroupRules(const std::string& filename, uint32_t count)
+{
+    std::ofstream file(filename, std::ofstream::out);
+    file << "groupVoice:\n";
+    for (uint32_t i = 0U; i < count; i++) {
+        file << "    # Talkgroup " << i << "\n";
+        file << "  - name: \"TG " << i << "\"\n";
+        file << "    alias: Tactical\n";
+        file << "    config:\n";
+        file << "      active: " << ((i % 10U != 0U) ? "true" : "false") << "\n";
+        file << "      affiliated: false\n";
+        file << "      inclusion: []\n";
+        file << "      exclusion:\n";
+        file << "        - 1234\n";
+        file << "        - 5678\n";
+        file << "      rewrite:\n";
+        file << "        - peerid: 9000\n";
+        file << "          tgid: " << (50000U + i) << "\n";
+        file << "          slot: 1\n";
+        file << "      always: []\n";
+        file << "      preferred: []\n";
+        file << "    source:\n";
+        file << "      tgid: " << (i + 1U) << "\n";
+        file << "      slot: 1\n\n";
+    }
+}
+
+#endif // __TALKGROUP_RULES_TEST_DATA_H__
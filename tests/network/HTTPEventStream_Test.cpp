@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/Log.h"
+#include "common/network/json/json.h"
+#include "common/network/rest/RequestDispatcher.h"
+#include "common/network/rest/http/HTTPEventStream.h"
+#include "common/network/rest/http/HTTPServer.h"
+
+using namespace network::rest;
+using namespace network::rest::http;
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <asio.hpp>
+
+/**
+ * @brief Helper to read from the socket until the given delimiter.
+ */
+static std::string readUntil(asio::ip::tcp::socket& socket, asio::streambuf& buffer, const std::string& delim)
+{
+    asio::error_code ec;
+    size_t len = asio::read_until(socket, buffer, delim, ec);
+    if (ec) {
+        return "";
+    }
+
+    std::string ret(asio::buffers_begin(buffer.data()), asio::buffers_begin(buffer.data()) + len);
+    buffer.consume(len);
+    return ret;
+}
+
+TEST_CASE("HTTPEventStream", "[network][rest]") {
+    SECTION("Format") {
+        REQUIRE(HTTPEventStream::format("test", "{}") == "event: test\ndata: {}\n\n");
+        REQUIRE(HTTPEventStream::format("test", "a\nb") == "event: test\ndata: a\ndata: b\n\n");
+    }
+
+    SECTION("Overflow") {
+        // suppress the dropped subscriber warning
+        uint32_t logDisplayLevel = g_logDisplayLevel;
+        g_logDisplayLevel = 6U;
+
+        HTTPEventPublisher publisher(4U);
+        REQUIRE_FALSE(publisher.hasSubscribers());
+
+        std::shared_ptr<HTTPEventStream> stream = publisher.subscribe();
+        REQUIRE(publisher.subscribers() == 1U);
+
+        // a subscriber that never takes its events is dropped once its queue is full
+        json::object data = json::object();
+        for (uint32_t i = 0U; i < 4U; i++)
+            publisher.publish("test", data);
+        REQUIRE(publisher.subscribers() == 1U);
+
+        publisher.publish("test", data);
+        REQUIRE(publisher.subscribers() == 0U);
+        REQUIRE(stream->isOverflowed());
+
+        std::string events;
+        REQUIRE_FALSE(stream->take(events));
+        REQUIRE(events.empty());
+
+        g_logDisplayLevel = logDisplayLevel;
+    }
+
+    SECTION("Subscribe") {
+        HTTPEventPublisher publisher;
+        DefaultRequestDispatcher dispatcher;
+        dispatcher.match("/events").get([&](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+            reply.eventStream(publisher.subscribe());
+        });
+
+        // bind an ephemeral port, so concurrent test runs do not collide
+        HTTPServer<DefaultRequestDispatcher> server("127.0.0.1", 0U, false, 2U);
+        server.open();
+        const uint16_t PORT = server.port();
+        server.setHandler(dispatcher);
+        std::thread thread([&]() { server.run(); });
+
+        asio::io_context io;
+        asio::ip::tcp::socket socket(io);
+        asio::error_code ec;
+        socket.connect(asio::ip::tcp::endpoint(asio::ip::make_address("127.0.0.1"), PORT), ec);
+        REQUIRE_FALSE(ec);
+
+        std::string request = "GET /events HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n";
+        asio::write(socket, asio::buffer(request), ec);
+        REQUIRE_FALSE(ec);
+
+        asio::streambuf buffer;
+        std::string headers = readUntil(socket, buffer, "\r\n\r\n");
+        REQUIRE(headers.find("200 OK") != std::string::npos);
+        REQUIRE(headers.find("Content-Type: text/event-stream") != std::string::npos);
+        REQUIRE(headers.find("Content-Length") == std::string::npos);
+        REQUIRE(publisher.subscribers() == 1U);
+
+        // events are pushed in the order they were published
+        for (uint32_t i = 0U; i < 3U; i++) {
+            json::object data = json::object();
+            data["seq"].set<uint32_t>(i);
+            publisher.publish("test", data);
+        }
+
+        for (uint32_t i = 0U; i < 3U; i++) {
+            std::string event = readUntil(socket, buffer, "\n\n");
+            REQUIRE(event == "event: test\ndata: {\"seq\":" + std::to_string(i) + "}\n\n");
+        }
+
+        // the subscriber is dropped once the client goes away
+        socket.close();
+        for (uint32_t i = 0U; i < 1000U && publisher.hasSubscribers(); i++) {
+            json::object data = json::object();
+            publisher.publish("test", data);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE_FALSE(publisher.hasSubscribers());
+
+        server.stop();
+        thread.join();
+    }
+}
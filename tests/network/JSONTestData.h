@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#if !defined(__JSON_TEST_DATA_H__)
+#define __JSON_TEST_DATA_H__
+
+#include "Defines.h"
+#include "common/network/json/json.h"
+
+#include <string>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to build a peer list, as reported by the FNE peer query.
+ */
+inline json::array buildPeerList(uint32_t count)
+{
+    json::array peers = json::array();
+    for (uint32_t i = 0U; i < count; i++) {
+        json::object peerObj = json::object();
+        uint32_t peerId = 9000000U + i;
+        peerObj["peerId"].set<uint32_t>(peerId);
+        std::string address = "10.0.0." + std::to_string(i % 250U);
+        peerObj["address"].set<std::string>(address);
+        uint16_t port = 62031U;
+        peerObj["port"].set<uint16_t>(port);
+        bool connected = true;
+        peerObj["connected"].set<bool>(connected);
+        uint32_t connectionState = 4U;
+        peerObj["connectionState"].set<uint32_t>(connectionState);
+        uint32_t pingsReceived = 1000U + i;
+        peerObj["pingsReceived"].set<uint32_t>(pingsReceived);
+        uint64_t lastPing = 1718000000U + i;
+        peerObj["lastPing"].set<uint64_t>(lastPing);
+        uint32_t ccPeerId = 0U;
+        peerObj["controlChannel"].set<uint32_t>(ccPeerId);
+
+        json::object config = json::object();
+        std::string identity = "SITE " + std::to_string(i) + " \"REPEATER\"";
+        config["identity"].set<std::string>(identity);
+        uint32_t rxFrequency = 449000000U + i * 12500U;
+        config["rxFrequency"].set<uint32_t>(rxFrequency);
+        uint32_t txFrequency = 444000000U + i * 12500U;
+        config["txFrequency"].set<uint32_t>(txFrequency);
+
+        json::object sysInfo = json::object();
+        float latitude = 41.5f;
+        sysInfo["latitude"].set<float>(latitude);
+        float longitude = -71.25f;
+        sysInfo["longitude"].set<float>(longitude);
+        int height = 30;
+        sysInfo["height"].set<int>(height);
+        std::string location = "Anytown/Site";
+        sysInfo["location"].set<std::string>(location);
+        config["info"].set<json::object>(sysInfo);
+
+        json::object channel = json::object();
+        uint32_t txPower = 50U;
+        channel["txPower"].set<uint32_t>(txPower);
+        float txOffsetMhz = 5.0f;
+        channel["txOffsetMhz"].set<float>(txOffsetMhz);
+        float chBandwidthKhz = 12.5f;
+        channel["chBandwidthKhz"].set<float>(chBandwidthKhz);
+        uint8_t channelId = 1U;
+        channel["channelId"].set<uint8_t>(channelId);
+        uint32_t channelNo = 1U + i;
+        channel["channelNo"].set<uint32_t>(channelNo);
+        config["channel"].set<json::object>(channel);
+
+        bool conventionalPeer = false;
+        config["conventionalPeer"].set<bool>(conventionalPeer);
+        std::string software = "DVM_R04A00";
+        config["software"].set<std::string>(software);
+        peerObj["config"].set<json::object>(config);
+
+        json::array voiceChannels = json::array();
+        voiceChannels.push_back(json::value((double)(peerId + 1U)));
+        voiceChannels.push_back(json::value((double)(peerId + 2U)));
+        peerObj["voiceChannels"].set<json::array>(voiceChannels);
+
+        peers.push_back(json::value(peerObj));
+    }
+
+    return peers;
+}
+
+#endif // __JSON_TEST_DATA_H__
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/network/json/json.h"
+#include "network/JSONTestData.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <string>
+
+TEST_CASE("JSON", "[network][json]") {
+    SECTION("Serialize") {
+        json::object obj = json::object();
+        std::string str = "a \"quoted\"\\path/\n\t\x01";
+        obj["str"].set<std::string>(str);
+        int neg = -42;
+        obj["int"].set<int>(neg);
+        uint64_t big = 1718000000123ULL;
+        obj["u64"].set<uint64_t>(big);
+        uint8_t small = 255U;
+        obj["u8"].set<uint8_t>(small);
+        obj["num"] = json::value(12.5);
+        obj["whole"] = json::value(-3.0);
+        obj["null"] = json::value();
+        obj["arr"] = json::value(json::array { json::value(true), json::value(false) });
+
+        json::value v = json::value(obj);
+        std::string expected = "{\"arr\":[true,false],\"int\":-42,\"null\":null,\"num\":12.5,\"str\":\"a \\\"quoted\\\"\\\\path\\/\\n\\t\\u0001\","
+            "\"u64\":1718000000123,\"u8\":255,\"whole\":-3}";
+        REQUIRE(v.serialize() == expected);
+
+        // the string writer and the output iterator writer produce identical output
+        for (bool prettify : { false, true }) {
+            std::string iter;
+            v.serialize(std::back_inserter(iter), prettify);
+            REQUIRE(v.serialize(prettify) == iter);
+        }
+    }
+
+    SECTION("Parse") {
+        json::value v;
+        std::string err = json::parse(v, "{\"b\":[1,-2,3.5,1e3,12345678901234567],\"a\":\"x\\u00e9\",\"c\":-0}");
+        REQUIRE(err.empty());
+        REQUIRE(v.is<json::object>());
+
+        json::object obj = v.get<json::object>();
+        json::array arr = obj["b"].get<json::array>();
+        REQUIRE(arr.size() == 5U);
+        REQUIRE(arr[0U].get<double>() == 1.0);
+        REQUIRE(arr[1U].get<double>() == -2.0);
+        REQUIRE(arr[2U].get<double>() == 3.5);
+        REQUIRE(arr[3U].get<double>() == 1000.0);
+        REQUIRE(arr[4U].get<double>() == 12345678901234567.0);
+        REQUIRE(obj["a"].get<std::string>() == "x\xc3\xa9");
+        REQUIRE(obj["c"].serialize() == "-0");
+
+        // duplicate keys keep the last value
+        err = json::parse(v, "{\"b\":1,\"a\":2,\"b\":3}");
+        REQUIRE(err.empty());
+        REQUIRE(v.get<json::object>().size() == 2U);
+        REQUIRE(v.get("b").get<double>() == 3.0);
+    }
+
+    SECTION("PeerList") {
+        json::object response = json::object();
+        int status = 200;
+        response["status"].set<int>(status);
+        json::array peers = buildPeerList(250U);
+        response["peers"].set<json::array>(peers);
+        json::value v = json::value(response);
+
+        // both writers produce identical output
+        std::string payload = v.serialize();
+        std::string out;
+        v.serialize(std::back_inserter(out));
+        REQUIRE(out == payload);
+
+        // parsed values serialize identically with either writer, and parse back to the same values
+        json::value parsed;
+        REQUIRE(json::parse(parsed, payload).empty());
+        std::string normalized = parsed.serialize();
+        std::string iter;
+        parsed.serialize(std::back_inserter(iter));
+        REQUIRE(normalized == iter);
+
+        json::value reparsed;
+        REQUIRE(json::parse(reparsed, normalized).empty());
+        REQUIRE(reparsed.serialize() == normalized);
+    }
+}
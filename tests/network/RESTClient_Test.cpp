@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/Log.h"
+#include "common/network/json/json.h"
+#include "common/network/rest/RequestDispatcher.h"
+#include "common/network/rest/http/HTTPServer.h"
+#include "remote/RESTClient.h"
+
+using namespace network::rest;
+using namespace network::rest::http;
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+TEST_CASE("RESTClient", "[network][rest]") {
+    const std::string PASSWORD = "PASSWORD";
+
+    // suppress the REST API errors
+    uint32_t logDisplayLevel = g_logDisplayLevel;
+    g_logDisplayLevel = 6U;
+
+    std::atomic<uint32_t> authCount(0U);
+    std::atomic<uint64_t> token(0U);
+
+    // minimal REST API; any password is accepted and every authentication issues a new token
+    DefaultRequestDispatcher dispatcher;
+    dispatcher.match("/auth").put([&](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+        uint64_t salt = 1000U + (++authCount);
+        token = salt;
+
+        int status = HTTPPayload::OK;
+        json::object response = json::object();
+        response["status"].set<int>(status);
+        response["token"].set<std::string>(std::to_string(salt));
+        reply.payload(response);
+    });
+    dispatcher.match("/version").get([&](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+        json::object response = json::object();
+        if (request.headers.find("X-DVM-Auth-Token") != std::to_string(token)) {
+            int status = HTTPPayload::UNAUTHORIZED;
+            std::string message = "invalid authentication token";
+            response["status"].set<int>(status);
+            response["message"].set<std::string>(message);
+            reply.payload(response, HTTPPayload::UNAUTHORIZED);
+            return;
+        }
+
+        int status = HTTPPayload::OK;
+        std::string version = "test";
+        response["status"].set<int>(status);
+        response["version"].set<std::string>(version);
+        reply.payload(response);
+    });
+    dispatcher.match("/slow").get([&](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+        int status = HTTPPayload::OK;
+        json::object response = json::object();
+        response["status"].set<int>(status);
+        reply.payload(response);
+    });
+
+    // bind an ephemeral port, so concurrent test runs do not collide
+    HTTPServer<DefaultRequestDispatcher> server("127.0.0.1", 0U, false, 2U);
+    server.open();
+    const uint16_t PORT = server.port();
+    server.setHandler(dispatcher);
+    std::thread thread([&]() { server.run(); });
+
+    SECTION("PersistentSession") {
+        // requests share one authenticated connection
+        json::object req = json::object();
+        json::object rsp = json::object();
+        REQUIRE(RESTClient::send("127.0.0.1", PORT, PASSWORD, HTTP_GET, "/version", req, rsp, false, REST_DEFAULT_WAIT) == HTTPPayload::OK);
+        REQUIRE(rsp["version"].get<std::string>() == "test");
+
+        const uint32_t REQUESTS = 1000U;
+        uint32_t ok = 0U;
+        for (uint32_t i = 0U; i < REQUESTS; i++) {
+            json::object rsp = json::object();
+            if (RESTClient::send("127.0.0.1", PORT, PASSWORD, HTTP_GET, "/version", req, rsp, false, REST_DEFAULT_WAIT) == HTTPPayload::OK)
+                ok++;
+        }
+        REQUIRE(ok == REQUESTS);
+        REQUIRE(authCount == 1U);
+
+        // a rejected token is renewed and the request retried
+        token = 0U;
+        REQUIRE(RESTClient::send("127.0.0.1", PORT, PASSWORD, HTTP_GET, "/version", req, rsp, false, REST_DEFAULT_WAIT) == HTTPPayload::OK);
+        REQUIRE(authCount == 2U);
+    }
+
+    SECTION("PipelinedRequests") {
+        const uint32_t REQUESTS = 1000U;
+
+        std::atomic<uint32_t> completed(0U);
+        std::atomic<uint32_t> ok(0U);
+        for (uint32_t i = 0U; i < REQUESTS; i++) {
+            RESTClient::sendAsync("127.0.0.1", PORT, PASSWORD, HTTP_GET, "/version", json::object(), false, [&](int status, json::object& rsp) {
+                if (status == HTTPPayload::OK)
+                    ok++;
+                completed++;
+            }, 5000);
+        }
+
+        for (uint32_t i = 0U; i < 5000U && completed < REQUESTS; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        REQUIRE(completed == REQUESTS);
+        REQUIRE(ok == REQUESTS);
+        REQUIRE(authCount == 1U);
+    }
+
+    SECTION("Deadline") {
+        json::object req = json::object();
+        json::object rsp = json::object();
+        REQUIRE(RESTClient::send("127.0.0.1", PORT, PASSWORD, HTTP_GET, "/version", req, rsp, false, REST_DEFAULT_WAIT) == HTTPPayload::OK);
+
+        // a request not answered in time fails through its callback, without another request being made
+        std::atomic<bool> completed(false);
+        std::atomic<int> result(0);
+        RESTClient::sendAsync("127.0.0.1", PORT, PASSWORD, HTTP_GET, "/slow", json::object(), false, [&](int status, json::object& rsp) {
+            result = status;
+            completed = true;
+        }, 100);
+
+        for (uint32_t i = 0U; i < 1000U && !completed; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        REQUIRE(completed);
+        REQUIRE(result != HTTPPayload::OK);
+
+        // the stalled connection was dropped; the next request is answered on a new one
+        REQUIRE(RESTClient::send("127.0.0.1", PORT, PASSWORD, HTTP_GET, "/version", req, rsp, false, REST_DEFAULT_WAIT) == HTTPPayload::OK);
+        REQUIRE(authCount == 1U);
+    }
+
+    SECTION("Reconnect") {
+        json::object req = json::object();
+        json::object rsp = json::object();
+        REQUIRE(RESTClient::send("127.0.0.1", PORT, PASSWORD, HTTP_GET, "/version", req, rsp, false, REST_DEFAULT_WAIT) == HTTPPayload::OK);
+
+        // the server drops all connections; the next request reconnects without authenticating again
+        server.stop();
+        thread.join();
+
+        HTTPServer<DefaultRequestDispatcher> restarted("127.0.0.1", PORT, false);
+        restarted.open();
+        restarted.setHandler(dispatcher);
+        std::thread restartedThread([&]() { restarted.run(); });
+
+        REQUIRE(RESTClient::send("127.0.0.1", PORT, PASSWORD, HTTP_GET, "/version", req, rsp, false, REST_DEFAULT_WAIT) == HTTPPayload::OK);
+        REQUIRE(authCount == 1U);
+
+        RESTClient::closeConnections();
+        restarted.stop();
+        restartedThread.join();
+    }
+
+    RESTClient::closeConnections();
+
+    server.stop();
+    if (thread.joinable())
+        thread.join();
+
+    g_logDisplayLevel = logDisplayLevel;
+}
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#if !defined(__REST_TEST_ENDPOINTS_H__)
+#define __REST_TEST_ENDPOINTS_H__
+
+#include "Defines.h"
+#include "common/network/rest/RequestDispatcher.h"
+#include "fne/network/RESTDefines.h"
+
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to register the FNE REST API endpoint set; each handler replies with its expression.
+ */
+inline void registerFNEEndpoints(network::rest::DefaultRequestDispatcher& dispatcher)
+{
+    using namespace network::rest;
+    using namespace network::rest::http;
+
+    const std::vector<std::string> endpoints = {
+        PUT_AUTHENTICATE, GET_VERSION, GET_STATUS,
+        FNE_GET_PEER_QUERY, FNE_GET_PEER_COUNT, FNE_PUT_PEER_RESET,
+        FNE_GET_RID_QUERY, FNE_PUT_RID_ADD, FNE_PUT_RID_DELETE, FNE_GET_RID_COMMIT,
+        FNE_GET_TGID_QUERY, FNE_PUT_TGID_ADD, FNE_PUT_TGID_DELETE, FNE_GET_TGID_COMMIT,
+        FNE_GET_PEER_LIST, FNE_PUT_PEER_ADD, FNE_PUT_PEER_DELETE, FNE_GET_PEER_COMMIT, FNE_GET_PEER_MODE,
+        FNE_GET_FORCE_UPDATE, FNE_GET_RELOAD_TGS, FNE_GET_RELOAD_RIDS, FNE_GET_AFF_LIST,
+        PUT_DMR_RID, PUT_P25_RID,
+        GET_P25_CC, GET_P25_CC_DEDICATED, GET_P25_CC_BCAST
+    };
+
+    for (const std::string& endpoint : endpoints) {
+        auto handler = [endpoint](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+            std::string content = endpoint;
+            reply.payload(content, HTTPPayload::OK, "text/plain");
+        };
+
+        dispatcher.match(endpoint).get(handler).put(handler);
+    }
+
+    dispatcher.match(GET_DMR_DEBUG, true).get([](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+        std::string content = match.str(1) + ":" + match.str(2);
+        reply.payload(content, HTTPPayload::OK, "text/plain");
+    });
+    dispatcher.match("/tg/([a-z]+)-info", true).get([](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+        std::string content = "info " + match.str(1);
+        reply.payload(content, HTTPPayload::OK, "text/plain");
+    });
+}
+
+#endif // __REST_TEST_ENDPOINTS_H__
@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/network/RTPAudioCodec.h"
+#include "common/network/RTPJitterBuffer.h"
+
+using namespace network;
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * @brief Helper to fill a frame with a recognizable pattern.
+ */
+static void fillFrame(short* samples, uint32_t count, uint32_t frameNo)
+{
+    for (uint32_t i = 0U; i < count; i++)
+        samples[i] = (short)((frameNo * 100U) + 1U);
+}
+
+TEST_CASE("RTPAudio", "[network][rtp]") {
+    SECTION("G711") {
+        // every code word survives a decode/encode round trip
+        for (uint32_t i = 0U; i < 256U; i++) {
+            uint8_t ulaw = (uint8_t)i;
+            if (ulaw != 0x7FU)  // u-law negative zero encodes as positive zero
+                REQUIRE(RTPAudioCodec::linearToULaw(RTPAudioCodec::ulawToLinear(ulaw)) == ulaw);
+
+            uint8_t alaw = (uint8_t)i;
+            REQUIRE(RTPAudioCodec::linearToALaw(RTPAudioCodec::alawToLinear(alaw)) == alaw);
+        }
+
+        // reference values
+        REQUIRE(RTPAudioCodec::linearToULaw(0) == 0xFFU);
+        REQUIRE(RTPAudioCodec::linearToULaw(32767) == 0x80U);
+        REQUIRE(RTPAudioCodec::linearToULaw(-32768) == 0x00U);
+        REQUIRE(RTPAudioCodec::linearToALaw(0) == 0xD5U);
+        REQUIRE(RTPAudioCodec::linearToALaw(32767) == 0xAAU);
+        REQUIRE(RTPAudioCodec::linearToALaw(-32768) == 0x2AU);
+
+        // quantization error stays within the segment step size
+        for (int sample = -32768; sample < 32768; sample += 7) {
+            int ulawError = std::abs(RTPAudioCodec::ulawToLinear(RTPAudioCodec::linearToULaw((short)sample)) - sample);
+            int alawError = std::abs(RTPAudioCodec::alawToLinear(RTPAudioCodec::linearToALaw((short)sample)) - sample);
+            int step = std::abs(sample) / 16 + 16;
+            REQUIRE(ulawError <= step);
+            REQUIRE(alawError <= step);
+        }
+    }
+
+    SECTION("Payload") {
+        short samples[4U] = { 0, 1, -2, 0x1234 };
+        uint8_t payload[8U];
+        REQUIRE(RTPAudioCodec::encode(RTPAudioCodecType::PCM16, samples, 4U, payload) == 8U);
+        REQUIRE(payload[6U] == 0x12U);
+        REQUIRE(payload[7U] == 0x34U);
+
+        short decoded[4U];
+        REQUIRE(RTPAudioCodec::decode(RTPAudioCodecType::PCM16, payload, 8U, decoded) == 4U);
+        for (uint32_t i = 0U; i < 4U; i++)
+            REQUIRE(decoded[i] == samples[i]);
+
+        RTPAudioCodecType::E codec;
+        REQUIRE(RTPAudioCodec::fromPayloadType(RTP_PCMA_PAYLOAD_TYPE, codec));
+        REQUIRE(codec == RTPAudioCodecType::ALAW);
+        REQUIRE_FALSE(RTPAudioCodec::fromPayloadType(0x56U, codec));
+        REQUIRE(RTPAudioCodec::fromName("ulaw", codec));
+        REQUIRE(codec == RTPAudioCodecType::ULAW);
+    }
+
+    SECTION("JitterBuffer") {
+        const uint32_t SAMPLES = 160U;
+        const uint32_t SSRC = 0x1234U;
+
+        RTPJitterBuffer buffer(SAMPLES, 2U, 10U, 3U);
+        short frame[SAMPLES];
+        short out[SAMPLES];
+
+        // packets carrying two frames each, arriving every 40ms with the first two swapped
+        std::vector<short> packet(SAMPLES * 2U);
+        auto writePacket = [&](uint32_t n) {
+            fillFrame(packet.data(), SAMPLES, n * 2U);
+            fillFrame(packet.data() + SAMPLES, SAMPLES, (n * 2U) + 1U);
+            return buffer.write(SSRC, 1000U + (n * 2U * SAMPLES), packet.data(), SAMPLES * 2U);
+        };
+
+        REQUIRE(writePacket(1U));
+        REQUIRE(writePacket(0U));
+
+        // a duplicate and a partial frame are ignored
+        fillFrame(frame, SAMPLES, 2U);
+        REQUIRE_FALSE(buffer.write(SSRC, 1000U + (2U * SAMPLES), frame, SAMPLES));
+        REQUIRE(buffer.duplicates() == 1U);
+        REQUIRE_FALSE(buffer.write(SSRC, 1000U + (8U * SAMPLES), frame, SAMPLES - 1U));
+
+        // frames play out in timestamp order, one per 20ms
+        for (uint32_t i = 0U; i < 8U; i++) {
+            if (i == 2U)
+                REQUIRE(writePacket(2U));
+            if (i == 4U)
+                REQUIRE(writePacket(3U));
+
+            REQUIRE(buffer.read(out));
+            REQUIRE(out[0U] == (short)((i * 100U) + 1U));
+            REQUIRE_FALSE(buffer.read(out));
+            buffer.clock(20U);
+        }
+        REQUIRE(buffer.dropped() == 0U);
+
+        // a frame that arrives after it was due is discarded
+        fillFrame(frame, SAMPLES, 0U);
+        REQUIRE_FALSE(buffer.write(SSRC, 1000U, frame, SAMPLES));
+        REQUIRE(buffer.late() == 1U);
+
+        // a lost frame is concealed by repeating the last frame with decaying gain
+        fillFrame(frame, SAMPLES, 9U);
+        REQUIRE(buffer.write(SSRC, 1000U + (9U * SAMPLES), frame, SAMPLES));
+        REQUIRE(buffer.read(out));
+        REQUIRE(out[0U] > 0);
+        REQUIRE(out[0U] < 701);
+        REQUIRE(buffer.concealed() == 1U);
+        buffer.clock(20U);
+        REQUIRE(buffer.read(out));
+        REQUIRE(out[0U] == 901);
+        buffer.clock(20U);
+
+        // the stream ends once nothing more arrives during the concealment period
+        for (uint32_t i = 0U; i < 3U; i++) {
+            REQUIRE(buffer.read(out));
+            buffer.clock(20U);
+        }
+        REQUIRE_FALSE(buffer.read(out));
+        REQUIRE_FALSE(buffer.isPlaying());
+        REQUIRE(buffer.received() == 9U);
+    }
+
+    SECTION("JitterBufferAdaptive") {
+        const uint32_t SAMPLES = 160U;
+        RTPJitterBuffer buffer(SAMPLES, 2U, 10U, 3U);
+        REQUIRE(buffer.targetDelay() == 2U);
+
+        // packets arrive in bursts of five every 100ms
+        short frame[SAMPLES];
+        short out[SAMPLES];
+        uint32_t played = 0U;
+        for (uint32_t burst = 0U; burst < 20U; burst++) {
+            for (uint32_t i = 0U; i < 5U; i++) {
+                uint32_t n = (burst * 5U) + i;
+                fillFrame(frame, SAMPLES, n);
+                buffer.write(0x1U, n * SAMPLES, frame, SAMPLES);
+            }
+
+            for (uint32_t ms = 0U; ms < 100U; ms += 20U) {
+                while (buffer.read(out))
+                    played++;
+                buffer.clock(20U);
+            }
+        }
+
+        // the target delay grows to cover the burst interval
+        REQUIRE(buffer.jitter() >= 20U);
+        REQUIRE(buffer.targetDelay() > 2U);
+        REQUIRE(buffer.targetDelay() <= 10U);
+        REQUIRE(played >= 90U);
+    }
+}
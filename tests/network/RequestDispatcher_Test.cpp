@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/Log.h"
+#include "common/network/rest/RequestDispatcher.h"
+#include "common/network/rest/http/HTTPServer.h"
+#include "fne/network/RESTDefines.h"
+#include "network/RESTTestEndpoints.h"
+
+using namespace network::rest;
+using namespace network::rest::http;
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Helper to dispatch a GET request.
+ */
+static HTTPPayload dispatchGet(DefaultRequestDispatcher& dispatcher, const std::string& uri)
+{
+    HTTPPayload request = HTTPPayload::requestPayload(HTTP_GET, uri);
+    HTTPPayload reply;
+    dispatcher.handleRequest(request, reply);
+    return reply;
+}
+
+TEST_CASE("RequestDispatcher", "[network][rest]") {
+    // suppress the unknown endpoint errors
+    uint32_t logDisplayLevel = g_logDisplayLevel;
+    g_logDisplayLevel = 6U;
+
+    DefaultRequestDispatcher dispatcher;
+    registerFNEEndpoints(dispatcher);
+
+    SECTION("StaticRoutes") {
+        REQUIRE(dispatchGet(dispatcher, "/version").content == GET_VERSION);
+        REQUIRE(dispatchGet(dispatcher, "/peer/query").content == FNE_GET_PEER_QUERY);
+        REQUIRE(dispatchGet(dispatcher, "/peer/query/").content == FNE_GET_PEER_QUERY);
+        REQUIRE(dispatchGet(dispatcher, "/peer/query?full=1").content == FNE_GET_PEER_QUERY);
+
+        // a shorter endpoint no longer shadows a longer endpoint it is a prefix of
+        REQUIRE(dispatchGet(dispatcher, "/p25/cc").content == GET_P25_CC);
+        REQUIRE(dispatchGet(dispatcher, "/p25/cc-enable").content == GET_P25_CC_DEDICATED);
+        REQUIRE(dispatchGet(dispatcher, "/p25/cc-broadcast").content == GET_P25_CC_BCAST);
+    }
+
+    SECTION("PathParameters") {
+        HTTPPayload reply = dispatchGet(dispatcher, "/dmr/debug/1/0");
+        REQUIRE(reply.content == "1:0");
+        REQUIRE(dispatchGet(dispatcher, "/dmr/debug/1/x").status == HTTPPayload::BAD_REQUEST);
+        REQUIRE(dispatchGet(dispatcher, "/tg/full-info").content == "info full");
+    }
+
+    SECTION("PartialRoutes") {
+        // plain expressions still match when embedded within a longer URI
+        REQUIRE(dispatchGet(dispatcher, "/api/version").content == GET_VERSION);
+        REQUIRE(dispatchGet(dispatcher, "/unknown").status == HTTPPayload::BAD_REQUEST);
+    }
+
+    SECTION("RepeatedDispatch") {
+        const std::vector<std::string> uris = { "/version", "/status", "/peer/query", "/peer/count", "/tg/query",
+            "/rid/query", "/report-affiliations", "/dmr/debug/1/1" };
+        const uint32_t REQUESTS = 1000U;
+
+        uint32_t ok = 0U;
+        for (uint32_t i = 0U; i < REQUESTS; i++) {
+            HTTPPayload reply = dispatchGet(dispatcher, uris[i % uris.size()]);
+            if (reply.status == HTTPPayload::OK)
+                ok++;
+        }
+        REQUIRE(ok == REQUESTS);
+    }
+
+    SECTION("HTTPServer") {
+        const uint32_t REQUESTS = 200U;
+
+        // bind an ephemeral port, so parallel test runs do not collide
+        HTTPServer<DefaultRequestDispatcher> server("127.0.0.1", 0U, false);
+        server.open();
+        server.setHandler(dispatcher);
+        std::thread thread([&]() { server.run(); });
+
+        asio::io_context io;
+        asio::ip::tcp::endpoint endpoint(asio::ip::address::from_string("127.0.0.1"), server.port());
+
+        uint32_t ok = 0U;
+        for (uint32_t i = 0U; i < REQUESTS; i++) {
+            asio::ip::tcp::socket socket(io);
+            socket.connect(endpoint);
+
+            std::string request = (i % 2U) ? "GET /peer/query HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n" :
+                "GET /dmr/debug/1/1 HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n";
+            asio::write(socket, asio::buffer(request));
+
+            std::string response;
+            asio::error_code ec;
+            char buffer[1024];
+            while (!ec) {
+                size_t len = socket.read_some(asio::buffer(buffer), ec);
+                response.append(buffer, len);
+            }
+
+            if (response.find("200 OK") != std::string::npos)
+                ok++;
+        }
+
+        server.stop();
+        thread.join();
+
+        REQUIRE(ok == REQUESTS);
+    }
+
+    SECTION("HTTPServerKeepAlive") {
+        const uint32_t CLIENTS = 4U;
+        const uint32_t BATCHES = 25U;
+        const uint32_t PIPELINE = 8U;
+
+        dispatcher.match("/echo").put([](const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match) {
+            std::string content = request.content;
+            reply.payload(content, HTTPPayload::OK, "text/plain");
+        });
+
+        HTTPServer<DefaultRequestDispatcher> server("127.0.0.1", 0U, false, CLIENTS);
+        server.open();
+        server.setHandler(dispatcher);
+        std::thread thread([&]() { server.run(); });
+
+        asio::ip::tcp::endpoint endpoint(asio::ip::address::from_string("127.0.0.1"), server.port());
+
+        // a request body split across writes is reassembled before the request is dispatched
+        {
+            asio::io_context io;
+            asio::ip::tcp::socket socket(io);
+            socket.connect(endpoint);
+
+            asio::write(socket, asio::buffer(std::string("PUT /echo HTTP/1.1\r\nContent-Length: 10\r\n\r\n01234")));
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            asio::write(socket, asio::buffer(std::string("56789GET /version HTTP/1.1\r\nConnection: close\r\n\r\n")));
+
+            std::string response;
+            asio::error_code ec;
+            char buffer[1024];
+            while (!ec) {
+                size_t len = socket.read_some(asio::buffer(buffer), ec);
+                response.append(buffer, len);
+            }
+
+            size_t first = response.find("0123456789");
+            REQUIRE(first != std::string::npos);
+            REQUIRE(response.find("Connection: keep-alive") < first);
+            REQUIRE(response.find(GET_VERSION, first) != std::string::npos);
+            REQUIRE(response.find("Connection: close", first) != std::string::npos);
+        }
+
+        // pipelined requests on persistent connections, serviced by several IO threads
+        std::vector<uint32_t> ok(CLIENTS, 0U);
+        std::vector<std::thread> clients;
+        for (uint32_t c = 0U; c < CLIENTS; c++) {
+            clients.emplace_back([&, c]() {
+                asio::io_context io;
+                asio::ip::tcp::socket socket(io);
+                socket.connect(endpoint);
+
+                std::string batch;
+                for (uint32_t i = 0U; i < PIPELINE; i++) {
+                    batch += (i % 2U) ? "GET /peer/query HTTP/1.1\r\nHost: localhost\r\n\r\n" :
+                        "GET /dmr/debug/1/1 HTTP/1.1\r\nHost: localhost\r\n\r\n";
+                }
+
+                std::string response;
+                char buffer[4096];
+                for (uint32_t b = 0U; b < BATCHES; b++) {
+                    asio::write(socket, asio::buffer(batch));
+
+                    uint32_t expected = ok[c] + PIPELINE;
+                    asio::error_code ec;
+                    while (!ec && ok[c] < expected) {
+                        size_t len = socket.read_some(asio::buffer(buffer), ec);
+                        response.append(buffer, len);
+
+                        size_t pos;
+                        while ((pos = response.find("200 OK")) != std::string::npos) {
+                            ok[c]++;
+                            response.erase(0U, pos + 6U);
+                        }
+                    }
+                }
+            });
+        }
+
+        for (auto& client : clients)
+            client.join();
+
+        server.stop();
+        thread.join();
+
+        const uint32_t REQUESTS = CLIENTS * BATCHES * PIPELINE;
+        uint32_t total = 0U;
+        for (uint32_t count : ok)
+            total += count;
+        REQUIRE(total == REQUESTS);
+    }
+
+    g_logDisplayLevel = logDisplayLevel;
+}
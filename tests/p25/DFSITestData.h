@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#if !defined(__DFSI_TEST_DATA_H__)
+#define __DFSI_TEST_DATA_H__
+
+#include "Defines.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/dfsi/DFSIDefines.h"
+#include "common/p25/dfsi/frames/Frames.h"
+
+#include <cstring>
+#include <random>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Helper to synthesize a LDU, RS and LSD set for a voice stream.
+ */
+inline void generateLDU(std::mt19937& rng, uint8_t* ldu, uint8_t* rs, uint8_t& lsd1, uint8_t& lsd2)
+{
+    using namespace p25::defines;
+    using namespace p25::dfsi::defines;
+    using namespace p25::dfsi::frames;
+
+    std::uniform_int_distribution<uint32_t> dist(0x00U, 0xFFU);
+
+    ::memset(ldu, 0x00U, 9U * 25U);
+    for (uint8_t n = 0U; n < MotLDUSuperframe::FRAME_COUNT; n++) {
+        for (uint32_t i = 0U; i < RAW_IMBE_LENGTH_BYTES; i++)
+            ldu[MotLDUSuperframe::LDU_IMBE_OFFSETS[n] + i] = (uint8_t)dist(rng);
+    }
+
+    for (uint32_t i = 0U; i < P25_LDU_LC_FEC_LENGTH_BYTES; i++)
+        rs[i] = (uint8_t)dist(rng);
+
+    lsd1 = (uint8_t)dist(rng);
+    lsd2 = (uint8_t)dist(rng);
+}
+
+/**
+ * @brief Helper to encode a voice frame the way ModemV24 did using the owning frame classes.
+ */
+inline uint32_t legacyEncode(p25::defines::DUID::E duid, uint8_t n, const uint8_t* ldu, const uint8_t* rs, uint8_t lsd1, uint8_t lsd2, uint8_t* buffer)
+{
+    using namespace p25::defines;
+    using namespace p25::dfsi::defines;
+    using namespace p25::dfsi::frames;
+
+    DFSIFrameType::E first = (duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE1 : DFSIFrameType::LDU2_VOICE10;
+    if (n == 0U) {
+        MotStartVoiceFrame svf = MotStartVoiceFrame();
+        svf.startOfStream->setStartStop(StartStopFlag::START);
+        svf.startOfStream->setRT(RTFlag::ENABLED);
+        svf.fullRateVoice->setFrameType(first);
+        svf.fullRateVoice->setSource(SourceFlag::QUANTAR);
+        svf.setICW(ICWFlag::QUANTAR);
+        ::memcpy(svf.fullRateVoice->imbeData, ldu + MotLDUSuperframe::LDU_IMBE_OFFSETS[0U], RAW_IMBE_LENGTH_BYTES);
+        svf.encode(buffer);
+        return MotStartVoiceFrame::LENGTH;
+    }
+
+    MotFullRateVoice voice = MotFullRateVoice();
+    voice.setFrameType((DFSIFrameType::E)(first + n));
+    ::memcpy(voice.imbeData, ldu + MotLDUSuperframe::LDU_IMBE_OFFSETS[n], RAW_IMBE_LENGTH_BYTES);
+    if (n >= 2U) {
+        voice.additionalData = new uint8_t[MotFullRateVoice::ADDITIONAL_LENGTH];
+        ::memset(voice.additionalData, 0x00U, MotFullRateVoice::ADDITIONAL_LENGTH);
+        if (n == 8U) {
+            voice.additionalData[0U] = lsd1;
+            voice.additionalData[1U] = lsd2;
+        } else {
+            ::memcpy(voice.additionalData, rs + ((n - 2U) * 3U), 3U);
+        }
+    }
+
+    voice.encode(buffer);
+    return voice.size();
+}
+
+#endif // __DFSI_TEST_DATA_H__
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/dfsi/DFSIDefines.h"
+#include "common/p25/dfsi/frames/Frames.h"
+#include "p25/DFSITestData.h"
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::dfsi;
+using namespace p25::dfsi::defines;
+using namespace p25::dfsi::frames;
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <random>
+
+TEST_CASE("DFSI", "[p25][dfsi]") {
+    std::mt19937 rng(0x25DF51U);
+
+    SECTION("SuperframeMatchesLegacyEncode") {
+        for (DUID::E duid : { DUID::LDU1, DUID::LDU2 }) {
+            uint8_t ldu[9U * 25U], rs[P25_LDU_LC_FEC_LENGTH_BYTES];
+            uint8_t lsd1, lsd2;
+            generateLDU(rng, ldu, rs, lsd1, lsd2);
+
+            MotLDUSuperframe superframe = MotLDUSuperframe();
+            superframe.setDUID(duid);
+            superframe.setRT(RTFlag::ENABLED);
+            superframe.setICW(ICWFlag::QUANTAR);
+            superframe.setSource(SourceFlag::QUANTAR);
+            superframe.setRS(rs);
+            superframe.setLSD1(lsd1);
+            superframe.setLSD2(lsd2);
+
+            uint8_t buffer[MotLDUSuperframe::LENGTH];
+            REQUIRE(superframe.encode(buffer, ldu) == MotLDUSuperframe::LENGTH);
+
+            for (uint8_t n = 0U; n < MotLDUSuperframe::FRAME_COUNT; n++) {
+                // the legacy start voice frame encoder writes 1 byte past the end of the frame
+                uint8_t legacy[MotFullRateVoice::LENGTH + MotStartVoiceFrame::LENGTH];
+                ::memset(legacy, 0x00U, sizeof(legacy));
+
+                uint32_t length = legacyEncode(duid, n, ldu, rs, lsd1, lsd2, legacy);
+                REQUIRE(length == MotLDUSuperframe::frameLength(n));
+                REQUIRE(::memcmp(buffer + MotLDUSuperframe::frameOffset(n), legacy, length) == 0);
+            }
+        }
+    }
+
+    SECTION("ViewMatchesLegacyDecode") {
+        uint8_t ldu[9U * 25U], rs[P25_LDU_LC_FEC_LENGTH_BYTES];
+        uint8_t lsd1, lsd2;
+        generateLDU(rng, ldu, rs, lsd1, lsd2);
+
+        MotLDUSuperframe superframe = MotLDUSuperframe();
+        superframe.setDUID(DUID::LDU2);
+        superframe.setRS(rs);
+        superframe.setLSD1(lsd1);
+        superframe.setLSD2(lsd2);
+
+        uint8_t buffer[MotLDUSuperframe::LENGTH];
+        superframe.encode(buffer, ldu);
+
+        for (uint8_t n = 1U; n < MotLDUSuperframe::FRAME_COUNT; n++) {
+            uint8_t* frame = buffer + MotLDUSuperframe::frameOffset(n);
+            MotFullRateVoice legacy = MotFullRateVoice(frame);
+            MotVoiceFrameView view = MotVoiceFrameView((const uint8_t*)frame);
+
+            REQUIRE(view.getFrameType() == legacy.getFrameType());
+            REQUIRE(view.getSource() == legacy.getSource());
+            REQUIRE(view.size() == legacy.size());
+            REQUIRE(::memcmp(view.getIMBE(), legacy.imbeData, RAW_IMBE_LENGTH_BYTES) == 0);
+            if (n >= 2U) {
+                REQUIRE(view.getAdditionalData() != nullptr);
+                REQUIRE(::memcmp(view.getAdditionalData(), legacy.additionalData, 3U) == 0);
+            }
+        }
+    }
+
+    SECTION("SuperframeRoundTrip") {
+        const uint32_t STREAM_LDUS = 500U;
+
+        uint8_t ldu[9U * 25U], rs[P25_LDU_LC_FEC_LENGTH_BYTES];
+        uint8_t lsd1, lsd2;
+        generateLDU(rng, ldu, rs, lsd1, lsd2);
+
+        uint8_t buffer[MotLDUSuperframe::LENGTH];
+        uint8_t decodedLDU[9U * 25U], decodedRS[P25_LDU_LC_FEC_LENGTH_BYTES];
+
+        for (uint32_t i = 0U; i < STREAM_LDUS; i++) {
+            DUID::E duid = ((i & 1U) == 0U) ? DUID::LDU1 : DUID::LDU2;
+
+            MotLDUSuperframe encoder = MotLDUSuperframe();
+            encoder.setDUID(duid);
+            encoder.setRS(rs);
+            encoder.setLSD1(lsd1);
+            encoder.setLSD2(lsd2);
+            encoder.encode(buffer, ldu);
+
+            ::memset(decodedLDU, 0x00U, sizeof(decodedLDU));
+            MotLDUSuperframe decoder = MotLDUSuperframe();
+            REQUIRE(decoder.decode(buffer, MotLDUSuperframe::LENGTH, decodedLDU));
+            REQUIRE(decoder.getDUID() == duid);
+            REQUIRE(decoder.getLSD1() == lsd1);
+            REQUIRE(decoder.getLSD2() == lsd2);
+
+            decoder.getRS(decodedRS);
+            REQUIRE(::memcmp(decodedRS, rs, P25_LDU_LC_FEC_LENGTH_BYTES) == 0);
+            REQUIRE(::memcmp(decodedLDU, ldu, sizeof(decodedLDU)) == 0);
+        }
+    }
+
+    SECTION("RejectsTruncatedSuperframe") {
+        uint8_t ldu[9U * 25U], rs[P25_LDU_LC_FEC_LENGTH_BYTES];
+        uint8_t lsd1, lsd2;
+        generateLDU(rng, ldu, rs, lsd1, lsd2);
+
+        MotLDUSuperframe superframe = MotLDUSuperframe();
+        uint8_t buffer[MotLDUSuperframe::LENGTH];
+        superframe.encode(buffer, ldu);
+
+        REQUIRE_FALSE(superframe.decode(buffer, MotLDUSuperframe::LENGTH - 1U, ldu));
+
+        buffer[MotLDUSuperframe::frameOffset(4U)] = DFSIFrameType::TSBK;
+        REQUIRE_FALSE(superframe.decode(buffer, MotLDUSuperframe::LENGTH, ldu));
+    }
+}
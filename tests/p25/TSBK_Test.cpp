@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/lc/tsbk/TSBKFactory.h"
+#include "common/p25/lc/tdulc/TDULCFactory.h"
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::lc;
+using namespace p25::lc::tsbk;
+using namespace p25::lc::tdulc;
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+
+TEST_CASE("TSBK", "[p25][tsbk]") {
+    SECTION("FactoryDecodesEncodedTSBK") {
+        IOSP_GRP_VCH osp = IOSP_GRP_VCH();
+        osp.setSrcId(1234567U);
+        osp.setDstId(9876U);
+        osp.setGrpVchNo(0x123U);
+        osp.setLastBlock(true);
+
+        uint8_t data[P25_TSDU_FRAME_LENGTH_BYTES];
+        ::memset(data, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+        osp.encode(data);
+
+        std::unique_ptr<TSBK> tsbk = TSBKFactory::createTSBK(data);
+        REQUIRE(tsbk != nullptr);
+        REQUIRE(tsbk->getLCO() == TSBKO::IOSP_GRP_VCH);
+        REQUIRE(tsbk->getSrcId() == 1234567U);
+        REQUIRE(tsbk->getDstId() == 9876U);
+        REQUIRE(tsbk->getGrpVchNo() == 0x123U);
+        REQUIRE(tsbk->getDecodedRaw() != nullptr);
+    }
+
+    SECTION("ReusedInstanceReencodesOnChange") {
+        IOSP_GRP_VCH osp = IOSP_GRP_VCH();
+        osp.setSrcId(1U);
+        osp.setDstId(2U);
+
+        uint8_t first[P25_TSDU_FRAME_LENGTH_BYTES], second[P25_TSDU_FRAME_LENGTH_BYTES];
+        ::memset(first, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+        ::memset(second, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+        osp.encode(first);
+        osp.encode(second);
+        REQUIRE(::memcmp(first, second, P25_TSDU_FRAME_LENGTH_BYTES) == 0);
+
+        // a freshly created instance must produce the same block as the reused one
+        IOSP_GRP_VCH fresh = IOSP_GRP_VCH();
+        fresh.setSrcId(1U);
+        fresh.setDstId(3U);
+        osp.setDstId(3U);
+
+        ::memset(first, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+        ::memset(second, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+        fresh.encode(first);
+        osp.encode(second);
+        REQUIRE(::memcmp(first, second, P25_TSDU_FRAME_LENGTH_BYTES) == 0);
+
+        std::unique_ptr<TSBK> tsbk = TSBKFactory::createTSBK(second);
+        REQUIRE(tsbk != nullptr);
+        REQUIRE(tsbk->getDstId() == 3U);
+    }
+
+    SECTION("FactoryDecodesEncodedTDULC") {
+        LC_GROUP lc = LC_GROUP();
+        lc.setSrcId(1234567U);
+        lc.setDstId(9876U);
+
+        uint8_t data[P25_TDULC_FRAME_LENGTH_BYTES];
+        ::memset(data, 0x00U, P25_TDULC_FRAME_LENGTH_BYTES);
+        lc.encode(data);
+
+        std::unique_ptr<TDULC> tdulc = TDULCFactory::createTDULC(data);
+        REQUIRE(tdulc != nullptr);
+        REQUIRE(tdulc->getLCO() == LCO::GROUP);
+        REQUIRE(tdulc->getSrcId() == 1234567U);
+        REQUIRE(tdulc->getDstId() == 9876U);
+    }
+}
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/Log.h"
+#include "vocoder/MBETranscoder.h"
+
+using namespace vocoder;
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstring>
+
+const uint32_t FRAMES = 200U;
+const uint32_t SAMPLES = 160U;                  // 20ms at 8kHz
+
+/**
+ * @brief Helper to generate a frame of a voiced test signal, with a slowly sweeping pitch.
+ */
+static void generateVoice(int16_t* samples, uint32_t frame, double& phase)
+{
+    double f0 = 110.0 + 40.0 * ::sin(frame * 0.05);
+    for (uint32_t i = 0U; i < SAMPLES; i++) {
+        phase += 2.0 * M_PI * f0 / 8000.0;
+
+        double sample = 0.0;
+        for (int h = 1; h <= 30 && h * f0 < 3800.0; h++)
+            sample += (2000.0 / h) * ::sin(h * phase);
+        samples[i] = (int16_t)sample;
+    }
+}
+
+/**
+ * @brief Helper to calculate the RMS level of a frame.
+ */
+static double rms(const int16_t* samples)
+{
+    double sum = 0.0;
+    for (uint32_t i = 0U; i < SAMPLES; i++)
+        sum += (double)samples[i] * samples[i];
+    return ::sqrt(sum / SAMPLES);
+}
+
+/**
+ * @brief Helper to decode the fundamental frequency of a MBE codeword.
+ */
+static float decodeW0(MBEDecoder& decoder, bool ambe, uint8_t* codeword, mbe_parms* cur, mbe_parms* prev)
+{
+    char bits[88U];
+    ::memset(bits, 0x00U, 88U);
+    decoder.decodeBits(codeword, bits);
+
+    if (ambe)
+        mbe_decodeAmbe2450Parms(bits, cur, prev);
+    else
+        mbe_decodeImbe4400Parms(bits, cur, prev);
+
+    float w0 = cur->w0;
+    mbe_moveMbeParms(cur, prev);
+    return w0;
+}
+
+/**
+ * @brief Helper to check the transcoded audio keeps the pitch and level of the source audio.
+ */
+static void checkFidelity(MBE_TRANSCODER_MODE mode)
+{
+    bool fromAMBE = (mode == TRANSCODE_DMR_AMBE_TO_IMBE);
+
+    MBEEncoder encoder(fromAMBE ? ENCODE_DMR_AMBE : ENCODE_88BIT_IMBE);
+    MBEDecoder srcDecoder(fromAMBE ? DECODE_DMR_AMBE : DECODE_88BIT_IMBE);
+    MBEDecoder srcParmsDecoder(fromAMBE ? DECODE_DMR_AMBE : DECODE_88BIT_IMBE);
+    MBEDecoder dstDecoder(fromAMBE ? DECODE_88BIT_IMBE : DECODE_DMR_AMBE);
+    MBEDecoder dstParmsDecoder(fromAMBE ? DECODE_88BIT_IMBE : DECODE_DMR_AMBE);
+    MBETranscoder transcoder(mode);
+
+    mbe_parms srcCur, srcPrev, dstCur, dstPrev, enhanced;
+    mbe_initMbeParms(&srcCur, &srcPrev, &enhanced);
+    mbe_initMbeParms(&dstCur, &dstPrev, &enhanced);
+
+    double phase = 0.0;
+    double srcLevel = 0.0, dstLevel = 0.0;
+    uint32_t pitchMatches = 0U;
+    for (uint32_t i = 0U; i < FRAMES; i++) {
+        int16_t samples[SAMPLES];
+        generateVoice(samples, i, phase);
+
+        uint8_t codeword[11U], transcoded[11U];
+        ::memset(codeword, 0x00U, 11U);
+        ::memset(transcoded, 0x00U, 11U);
+        encoder.encode(samples, codeword);
+        REQUIRE(transcoder.transcode(codeword, transcoded) == 0);
+
+        int16_t srcSamples[SAMPLES], dstSamples[SAMPLES];
+        srcDecoder.decode(codeword, srcSamples);
+        dstDecoder.decode(transcoded, dstSamples);
+        srcLevel += rms(srcSamples);
+        dstLevel += rms(dstSamples);
+
+        float srcW0 = decodeW0(srcParmsDecoder, fromAMBE, codeword, &srcCur, &srcPrev);
+        float dstW0 = decodeW0(dstParmsDecoder, !fromAMBE, transcoded, &dstCur, &dstPrev);
+        if (::fabs(dstW0 - srcW0) <= srcW0 * 0.03f)
+            pitchMatches++;
+    }
+
+    double levelDiff = 20.0 * ::log10(dstLevel / srcLevel);
+    ::LogDebug("T", "Transcode %s: level difference %.1fdB, pitch matched %u/%u frames",
+        fromAMBE ? "AMBE -> IMBE" : "IMBE -> AMBE", levelDiff, pitchMatches, FRAMES);
+
+    REQUIRE(::fabs(levelDiff) < 4.0);
+    REQUIRE(pitchMatches >= (FRAMES * 9U) / 10U);
+}
+
+TEST_CASE("MBETranscoder", "[vocoder][transcoder]") {
+    SECTION("AMBEToIMBE") {
+        checkFidelity(TRANSCODE_DMR_AMBE_TO_IMBE);
+    }
+
+    SECTION("IMBEToAMBE") {
+        checkFidelity(TRANSCODE_IMBE_TO_DMR_AMBE);
+    }
+
+    SECTION("Silence") {
+        MBETranscoder transcoder(TRANSCODE_DMR_AMBE_TO_IMBE);
+        MBEDecoder decoder(DECODE_88BIT_IMBE);
+
+        // an erasure frame (all bits set fails the golay checks) transcodes to silence
+        uint8_t codeword[9U], transcoded[11U];
+        ::memset(codeword, 0xFFU, 9U);
+        for (uint32_t i = 0U; i < 10U; i++) {
+            transcoder.transcode(codeword, transcoded);
+
+            int16_t samples[SAMPLES];
+            decoder.decode(transcoded, samples);
+            if (i > 4U)
+                REQUIRE(rms(samples) < 100.0);
+        }
+    }
+}